@@ -9,5 +9,12 @@
 #include "xio2d_cairo_sdl2_surfaces_impl.h"
 #include "xio2d_cairo_sdl2_output_surfaces.h"
 #include "xio2d_cairo_sdl2_unmanaged_output_surfaces.h"
+#include "xcairo_extern_templates.h"
+
+namespace std::experimental::io2d {
+	inline namespace v1 {
+		_IO2D_Cairo_default_templates(extern template)
+	}
+}
 
 #endif // _XIO2D_CAIRO_SDL2_MAIN_H_
@@ -57,7 +57,7 @@ namespace std::experimental::io2d {
 			};
 
 			template<class GraphicsMath>
-			inline typename _Cairo_graphics_surfaces<GraphicsMath>::surfaces::output_surface_data_type _Cairo_graphics_surfaces<GraphicsMath>::surfaces::create_output_surface(int preferredWidth, int preferredHeight, io2d::format preferredFormat, io2d::scaling scl, io2d::refresh_style rr, float fps) {
+			typename _Cairo_graphics_surfaces<GraphicsMath>::surfaces::output_surface_data_type _Cairo_graphics_surfaces<GraphicsMath>::surfaces::create_output_surface(int preferredWidth, int preferredHeight, io2d::format preferredFormat, io2d::scaling scl, io2d::refresh_style rr, float fps) {
 				auto result = make_unique<_Output_surface_data>();
 				_Display_surface_data_type& data = result->data;
 				data.display_dimensions.x(preferredWidth);
@@ -71,13 +71,13 @@ namespace std::experimental::io2d {
 				return result.release();
 			}
 			template<class GraphicsMath>
-			inline typename _Cairo_graphics_surfaces<GraphicsMath>::surfaces::output_surface_data_type _Cairo_graphics_surfaces<GraphicsMath>::surfaces::create_output_surface(int preferredWidth, int preferredHeight, io2d::format preferredFormat, error_code& ec, io2d::scaling scl, io2d::refresh_style rr, float fps) noexcept {
+			typename _Cairo_graphics_surfaces<GraphicsMath>::surfaces::output_surface_data_type _Cairo_graphics_surfaces<GraphicsMath>::surfaces::create_output_surface(int preferredWidth, int preferredHeight, io2d::format preferredFormat, error_code& ec, io2d::scaling scl, io2d::refresh_style rr, float fps) noexcept {
 				auto result = make_unique<_Output_surface_data>();
 				_Display_surface_data_type& data = result->data;
 				data.display_dimensions.x(preferredWidth);
 				data.display_dimensions.y(preferredHeight);
 				data.rr = rr;
-				data.refresh_style = fps;
+				data.refresh_fps = fps;
 				data.scl = scl;
 				data.back_buffer.format = preferredFormat;
 				data.back_buffer.dimensions.x(preferredWidth);
@@ -86,13 +86,13 @@ namespace std::experimental::io2d {
 				return result.release();
 			}
 			template<class GraphicsMath>
-			inline typename _Cairo_graphics_surfaces<GraphicsMath>::surfaces::output_surface_data_type _Cairo_graphics_surfaces<GraphicsMath>::surfaces::create_output_surface(int preferredWidth, int preferredHeight, io2d::format preferredFormat, int preferredDisplayWidth, int preferredDisplayHeight, io2d::scaling scl, io2d::refresh_style rr, float fps) {
+			typename _Cairo_graphics_surfaces<GraphicsMath>::surfaces::output_surface_data_type _Cairo_graphics_surfaces<GraphicsMath>::surfaces::create_output_surface(int preferredWidth, int preferredHeight, io2d::format preferredFormat, int preferredDisplayWidth, int preferredDisplayHeight, io2d::scaling scl, io2d::refresh_style rr, float fps) {
 				auto result = make_unique<_Output_surface_data>();
 				_Display_surface_data_type& data = result->data;
 				data.display_dimensions.x(preferredDisplayWidth);
 				data.display_dimensions.y(preferredDisplayHeight);
 				data.rr = rr;
-				data.refresh_style = fps;
+				data.refresh_fps = fps;
 				data.scl = scl;
 				data.back_buffer.format = preferredFormat;
 				data.back_buffer.dimensions.x(preferredWidth);
@@ -100,13 +100,13 @@ namespace std::experimental::io2d {
 				return result.release();
 			}
 			template <class GraphicsMath>
-			inline typename _Cairo_graphics_surfaces<GraphicsMath>::surfaces::output_surface_data_type _Cairo_graphics_surfaces<GraphicsMath>::surfaces::create_output_surface(int preferredWidth, int preferredHeight, io2d::format preferredFormat, int preferredDisplayWidth, int preferredDisplayHeight, error_code& ec, io2d::scaling scl, io2d::refresh_style rr, float fps) noexcept {
+			typename _Cairo_graphics_surfaces<GraphicsMath>::surfaces::output_surface_data_type _Cairo_graphics_surfaces<GraphicsMath>::surfaces::create_output_surface(int preferredWidth, int preferredHeight, io2d::format preferredFormat, int preferredDisplayWidth, int preferredDisplayHeight, error_code& ec, io2d::scaling scl, io2d::refresh_style rr, float fps) noexcept {
 				auto result = make_unique<_Output_surface_data>();
 				_Display_surface_data_type& data = result->data;
 				data.display_dimensions.x(preferredDisplayWidth);
 				data.display_dimensions.y(preferredDisplayHeight);
 				data.rr = rr;
-				data.refresh_style = fps;
+				data.refresh_fps = fps;
 				data.scl = scl;
 				data.back_buffer.format = preferredFormat;
 				data.back_buffer.dimensions.x(preferredWidth);
@@ -115,22 +115,131 @@ namespace std::experimental::io2d {
 				return result.release();
 			}
 			template <class GraphicsMath>
-			inline typename _Cairo_graphics_surfaces<GraphicsMath>::surfaces::output_surface_data_type _Cairo_graphics_surfaces<GraphicsMath>::surfaces::move_output_surface(output_surface_data_type&& data) noexcept {
+			typename _Cairo_graphics_surfaces<GraphicsMath>::surfaces::output_surface_data_type _Cairo_graphics_surfaces<GraphicsMath>::surfaces::move_output_surface(output_surface_data_type&& data) noexcept {
 				auto result = data;
 				data = nullptr;
 				return result;
 			}
 			template <class GraphicsMath>
-			inline void _Cairo_graphics_surfaces<GraphicsMath>::surfaces::destroy(output_surface_data_type& data) noexcept {
+			void _Cairo_graphics_surfaces<GraphicsMath>::surfaces::destroy(output_surface_data_type& data) noexcept {
 				destroy(data->data.back_buffer);
 				delete data;
 			}
 
 			template <class GraphicsMath>
-			bool _Is_active(typename _Cairo_graphics_surfaces<GraphicsMath>::surfaces::_Display_surface_data_type& data) noexcept;
+			bool _Is_active(typename _Cairo_graphics_surfaces<GraphicsMath>::surfaces::_Display_surface_data_type& data) noexcept
+			{
+				if (SDL_QuitRequested()) {
+					return false;
+				}
+				if (data.window == nullptr || data.renderer == nullptr) {
+					return false;
+				}
+				return true;
+			}
+
+			template <class GraphicsMath>
+			int _Cairo_graphics_surfaces<GraphicsMath>::surfaces::begin_show(output_surface_data_type& osd, basic_output_surface<_Cairo_graphics_surfaces<GraphicsMath>>* instance, basic_output_surface<_Cairo_graphics_surfaces<GraphicsMath>>& sfc)
+			{
+				_Display_surface_data_type &data = osd->data;
+
+				//
+				// Let SDL create:
+				//  1. a window
+				//  2. an SDL renderer, which will be used to help draw Cairo-rendered content to the desired display(s)
+				//
+
+#if 0 //__LINUX__
+				// HACK: work around a bug in SDL2 + OpenGL + Vagrant + Ubuntu 18.04 + X11 via macOS'/X11,
+				// whereby apps will crash/terminate upon trying to initialize SDL.  This crash occurs
+				// when trying to detect OpenGL-related resources.
+				SDL_SetHint(SDL_HINT_FRAMEBUFFER_ACCELERATION, "0");
+				const Uint32 renderer_flags = SDL_RENDERER_SOFTWARE;
+#else
+				const Uint32 renderer_flags = 0;
+#endif
+
+				if (SDL_Init(SDL_INIT_VIDEO) != 0) {
+					throw ::std::system_error(::std::make_error_code(::std::errc::io_error), SDL_GetError());
+				}
+
+				data.window = SDL_CreateWindow(
+					"",
+					SDL_WINDOWPOS_CENTERED,
+					SDL_WINDOWPOS_CENTERED,
+					data.display_dimensions.x(),
+					data.display_dimensions.y(),
+					SDL_WINDOW_SHOWN
+				);
+				if (!data.window) {
+					throw ::std::system_error(::std::make_error_code(::std::errc::io_error), SDL_GetError());
+				}
+
+				// TODO(dludwig@pobox.com): Fix errors logged by Emscripten in SDL_CreateRenderer (regarding sigaction + emscripten_set_main_loop_timing)
+				data.renderer = SDL_CreateRenderer(
+					data.window,
+					-1,
+					renderer_flags
+				);
+				if (!data.renderer) {
+					throw ::std::system_error(::std::make_error_code(::std::errc::io_error), SDL_GetError());
+				}
+
+				_Create_display_surface_and_context<GraphicsMath>(data);
+
+				data._Default_letterbox_brush = basic_brush<_Cairo_graphics_surfaces>(rgba_color::black);
+				data._Letterbox_brush = data._Default_letterbox_brush;
+
+				data.back_buffer = ::std::move(create_image_surface(data.back_buffer.format, data.back_buffer.dimensions.x(), data.back_buffer.dimensions.y()));
+
+				data.elapsed_draw_time = 0.0f;
+				data.previous_time = decltype(data.previous_time)();	// reset to epoch
+
+				data.redraw_required = true;
+
+				while (_Is_active<GraphicsMath>(data)) {
+					auto currentTime = ::std::chrono::steady_clock::now();
+					auto elapsedTimeIncrement = static_cast<float>(::std::chrono::duration_cast<::std::chrono::nanoseconds>(currentTime - data.previous_time).count());
+					data.elapsed_draw_time += elapsedTimeIncrement;
+					data.previous_time = currentTime;
+
+					SDL_Event ev;
+					while (SDL_PollEvent(&ev)) {}
+
+					bool redraw = true;
+					if (data.rr == io2d::refresh_style::as_needed) {
+						redraw = data.redraw_required;
+						data.redraw_required = false;
+					}
+
+					const auto desiredElapsed = 1'000'000'000.0F / data.refresh_fps;
+					if (data.rr == io2d::refresh_style::fixed) {
+						redraw = data.elapsed_draw_time >= desiredElapsed;
+					}
+					if (redraw) {
+						if (osd->draw_callback) {
+							osd->draw_callback(sfc);
+						}
+						_Render_to_native_surface(osd, sfc);
+						if (data.rr == experimental::io2d::refresh_style::fixed) {
+							while (data.elapsed_draw_time >= desiredElapsed) {
+								data.elapsed_draw_time -= desiredElapsed;
+							}
+						}
+						else {
+							data.elapsed_draw_time = 0.0F;
+						}
+					}
+
+					// Try to delay by a negligible amount of time.  On some platforms, this can help with responsiveness.
+					SDL_Delay(0);
+				}
+				data.elapsed_draw_time = 0.0F;
+				return 0;
+			}
 
 			template<class GraphicsMath>
-			inline void _Cairo_graphics_surfaces<GraphicsMath>::surfaces::end_show(output_surface_data_type& data) {
+			void _Cairo_graphics_surfaces<GraphicsMath>::surfaces::end_show(output_surface_data_type& data) {
 				printf("IMPLEMENT ME: %s\n", __PRETTY_FUNCTION__);
 				// if (data.renderer) {
 				// 	SDL_DestroyRenderer(data.renderer);
@@ -143,7 +252,7 @@ namespace std::experimental::io2d {
 			}
 
 			template<class GraphicsMath>
-			inline void _Cairo_graphics_surfaces<GraphicsMath>::surfaces::display_dimensions(output_surface_data_type& datap, const basic_display_point<GraphicsMath>& val) {
+			void _Cairo_graphics_surfaces<GraphicsMath>::surfaces::display_dimensions(output_surface_data_type& datap, const basic_display_point<GraphicsMath>& val) {
 				auto &data = *datap;
 				data.data.display_dimensions = val;
 				printf("IMPLEMENT ME: %s\n", __PRETTY_FUNCTION__);
@@ -179,138 +288,170 @@ namespace std::experimental::io2d {
 			}
 
 			template<class GraphicsMath>
-			inline void _Cairo_graphics_surfaces<GraphicsMath>::surfaces::refresh_style(output_surface_data_type& data, io2d::refresh_style val) {
+			void _Cairo_graphics_surfaces<GraphicsMath>::surfaces::refresh_style(output_surface_data_type& data, io2d::refresh_style val) {
 				data->data.rr = val;
 			}
 			template<class GraphicsMath>
-			inline void _Cairo_graphics_surfaces<GraphicsMath>::surfaces::desired_frame_rate(output_surface_data_type& data, float val) {
+			void _Cairo_graphics_surfaces<GraphicsMath>::surfaces::desired_frame_rate(output_surface_data_type& data, float val) {
 				const float oneFramePerHour = 1.0f / (60.0f * 60.0f); // If you need a lower framerate than this, use as_needed and control the refresh by writing a timer that will trigger a refresh at your desired interval.
 				const float maxFPS = 120.0f; // It's unlikely to find a display output that operates higher than this.
 				data->data.refresh_fps = ::std::min(::std::max(val, oneFramePerHour), maxFPS);
 			}
 			template<class GraphicsMath>
-			inline io2d::refresh_style _Cairo_graphics_surfaces<GraphicsMath>::surfaces::refresh_style(const output_surface_data_type& data) noexcept {
+			io2d::refresh_style _Cairo_graphics_surfaces<GraphicsMath>::surfaces::refresh_style(const output_surface_data_type& data) noexcept {
 				return data->data.rr;
 			}
 			template<class GraphicsMath>
-			inline float _Cairo_graphics_surfaces<GraphicsMath>::surfaces::desired_frame_rate(const output_surface_data_type& data) noexcept {
+			float _Cairo_graphics_surfaces<GraphicsMath>::surfaces::desired_frame_rate(const output_surface_data_type& data) noexcept {
 				return data->data.refresh_fps;
 			}
 
 			template<class GraphicsMath>
-			inline void _Cairo_graphics_surfaces<GraphicsMath>::surfaces::flush(output_surface_data_type& data) {
+			void _Cairo_graphics_surfaces<GraphicsMath>::surfaces::flush(output_surface_data_type& data) {
 				cairo_surface_flush(data->data.back_buffer.surface.get());
 			}
 			template<class GraphicsMath>
-			inline void _Cairo_graphics_surfaces<GraphicsMath>::surfaces::flush(output_surface_data_type& data, error_code& ec) noexcept {
+			void _Cairo_graphics_surfaces<GraphicsMath>::surfaces::flush(output_surface_data_type& data, error_code& ec) noexcept {
 				cairo_surface_flush(data->data.back_buffer.surface.get());
 				ec.clear();
 			}
 			template<class GraphicsMath>
-			inline void _Cairo_graphics_surfaces<GraphicsMath>::surfaces::mark_dirty(output_surface_data_type& data) {
+			void _Cairo_graphics_surfaces<GraphicsMath>::surfaces::mark_dirty(output_surface_data_type& data) {
 				cairo_surface_mark_dirty(data->data.back_buffer.surface.get());
 			}
 			template<class GraphicsMath>
-			inline void _Cairo_graphics_surfaces<GraphicsMath>::surfaces::mark_dirty(output_surface_data_type& data, error_code& ec) noexcept {
+			void _Cairo_graphics_surfaces<GraphicsMath>::surfaces::mark_dirty(output_surface_data_type& data, error_code& ec) noexcept {
 				cairo_surface_mark_dirty(data->data.back_buffer.surface.get());
 				ec.clear();
 			}
 			template<class GraphicsMath>
-			inline void _Cairo_graphics_surfaces<GraphicsMath>::surfaces::mark_dirty(output_surface_data_type& data, const basic_bounding_box<GraphicsMath>& extents) {
+			void _Cairo_graphics_surfaces<GraphicsMath>::surfaces::mark_dirty(output_surface_data_type& data, const basic_bounding_box<GraphicsMath>& extents) {
 				cairo_surface_mark_dirty_rectangle(data->data.back_buffer.surface.get(), _Float_to_int(extents.x()), _Float_to_int(extents.y()), _Float_to_int(extents.width()), _Float_to_int(extents.height()));
 			}
 			template<class GraphicsMath>
-			inline void _Cairo_graphics_surfaces<GraphicsMath>::surfaces::mark_dirty(output_surface_data_type& data, const basic_bounding_box<GraphicsMath>& extents, error_code& ec) noexcept {
+			void _Cairo_graphics_surfaces<GraphicsMath>::surfaces::mark_dirty(output_surface_data_type& data, const basic_bounding_box<GraphicsMath>& extents, error_code& ec) noexcept {
 				cairo_surface_mark_dirty_rectangle(data->data.back_buffer.surface.get(), _Float_to_int(extents.x()), _Float_to_int(extents.y()), _Float_to_int(extents.width()), _Float_to_int(extents.height()));
 				ec.clear();
 			}
 
 			template<class GraphicsMath>
-			inline void _Cairo_graphics_surfaces<GraphicsMath>::surfaces::clear(output_surface_data_type& data) {
+			void _Cairo_graphics_surfaces<GraphicsMath>::surfaces::clear(output_surface_data_type& data) {
 				_Ds_clear<_Cairo_graphics_surfaces<GraphicsMath>>(data->data);
 			}
 			template <class GraphicsMath>
-			inline void _Cairo_graphics_surfaces<GraphicsMath>::surfaces::paint(output_surface_data_type& data, const basic_brush<_Graphics_surfaces_type>& b, const basic_brush_props<_Graphics_surfaces_type>& bp, const basic_render_props<_Graphics_surfaces_type>& rp, const basic_clip_props<_Graphics_surfaces_type>& cl) {
+			void _Cairo_graphics_surfaces<GraphicsMath>::surfaces::paint(output_surface_data_type& data, const basic_brush<_Graphics_surfaces_type>& b, const basic_brush_props<_Graphics_surfaces_type>& bp, const basic_render_props<_Graphics_surfaces_type>& rp, const basic_clip_props<_Graphics_surfaces_type>& cl) {
 				_Ds_paint<_Cairo_graphics_surfaces<GraphicsMath>>(data->data, b, bp, rp, cl);
 			}
 			template<class GraphicsMath>
-			inline void _Cairo_graphics_surfaces<GraphicsMath>::surfaces::stroke(output_surface_data_type& data, const basic_brush<_Graphics_surfaces_type>& b, const basic_interpreted_path<_Graphics_surfaces_type>& ip, const basic_brush_props<_Graphics_surfaces_type>& bp, const basic_stroke_props<_Graphics_surfaces_type>& sp, const basic_dashes<_Graphics_surfaces_type>& d, const basic_render_props<_Graphics_surfaces_type>& rp, const basic_clip_props<_Graphics_surfaces_type>& cl) {
+			void _Cairo_graphics_surfaces<GraphicsMath>::surfaces::stroke(output_surface_data_type& data, const basic_brush<_Graphics_surfaces_type>& b, const basic_interpreted_path<_Graphics_surfaces_type>& ip, const basic_brush_props<_Graphics_surfaces_type>& bp, const basic_stroke_props<_Graphics_surfaces_type>& sp, const basic_dashes<_Graphics_surfaces_type>& d, const basic_render_props<_Graphics_surfaces_type>& rp, const basic_clip_props<_Graphics_surfaces_type>& cl) {
 				_Ds_stroke<_Cairo_graphics_surfaces<GraphicsMath>>(data->data, b, ip, bp, sp, d, rp, cl);
 			}
 			template<class GraphicsMath>
-			inline void _Cairo_graphics_surfaces<GraphicsMath>::surfaces::fill(output_surface_data_type& data, const basic_brush<_Graphics_surfaces_type>& b, const basic_interpreted_path<_Graphics_surfaces_type>& ip, const basic_brush_props<_Graphics_surfaces_type>& bp, const basic_render_props<_Graphics_surfaces_type>& rp, const basic_clip_props<_Graphics_surfaces_type>& cl) {
+			void _Cairo_graphics_surfaces<GraphicsMath>::surfaces::fill(output_surface_data_type& data, const basic_brush<_Graphics_surfaces_type>& b, const basic_interpreted_path<_Graphics_surfaces_type>& ip, const basic_brush_props<_Graphics_surfaces_type>& bp, const basic_render_props<_Graphics_surfaces_type>& rp, const basic_clip_props<_Graphics_surfaces_type>& cl) {
 				_Ds_fill<_Cairo_graphics_surfaces<GraphicsMath>>(data->data, b, ip, bp, rp, cl);
 			}
 			template<class GraphicsMath>
-			inline void _Cairo_graphics_surfaces<GraphicsMath>::surfaces::mask(output_surface_data_type& data, const basic_brush<_Graphics_surfaces_type>& b, const basic_brush<_Graphics_surfaces_type>& mb, const basic_brush_props<_Graphics_surfaces_type>& bp, const basic_mask_props<_Graphics_surfaces_type>& mp, const basic_render_props<_Graphics_surfaces_type>& rp, const basic_clip_props<_Graphics_surfaces_type>& cl) {
+			void _Cairo_graphics_surfaces<GraphicsMath>::surfaces::fill_stroke(output_surface_data_type& data, const basic_brush<_Graphics_surfaces_type>& fb, const basic_brush<_Graphics_surfaces_type>& sb, const basic_interpreted_path<_Graphics_surfaces_type>& ip, const basic_brush_props<_Graphics_surfaces_type>& bp, const basic_stroke_props<_Graphics_surfaces_type>& sp, const basic_dashes<_Graphics_surfaces_type>& d, const basic_render_props<_Graphics_surfaces_type>& rp, const basic_clip_props<_Graphics_surfaces_type>& cl) {
+				_Ds_fill_stroke<_Cairo_graphics_surfaces<GraphicsMath>>(data->data, fb, sb, ip, bp, sp, d, rp, cl);
+			}
+			template<class GraphicsMath>
+			void _Cairo_graphics_surfaces<GraphicsMath>::surfaces::fill_instances(output_surface_data_type& data, const basic_brush<_Graphics_surfaces_type>& b, const basic_interpreted_path<_Graphics_surfaces_type>& ip, const _Fill_instance_range<GraphicsMath>& instances, const basic_brush_props<_Graphics_surfaces_type>& bp, const basic_render_props<_Graphics_surfaces_type>& rp, const basic_clip_props<_Graphics_surfaces_type>& cl) {
+				_Ds_fill_instances<_Cairo_graphics_surfaces<GraphicsMath>>(data->data, b, ip, instances, bp, rp, cl);
+			}
+			template<class GraphicsMath>
+			void _Cairo_graphics_surfaces<GraphicsMath>::surfaces::fill_rect(output_surface_data_type& data, const basic_brush<_Graphics_surfaces_type>& b, const basic_bounding_box<GraphicsMath>& bb, const basic_brush_props<_Graphics_surfaces_type>& bp, const basic_render_props<_Graphics_surfaces_type>& rp, const basic_clip_props<_Graphics_surfaces_type>& cl) {
+				_Ds_fill_rect<_Cairo_graphics_surfaces<GraphicsMath>>(data->data, b, bb, bp, rp, cl);
+			}
+			template<class GraphicsMath>
+			void _Cairo_graphics_surfaces<GraphicsMath>::surfaces::stroke_rect(output_surface_data_type& data, const basic_brush<_Graphics_surfaces_type>& b, const basic_bounding_box<GraphicsMath>& bb, const basic_brush_props<_Graphics_surfaces_type>& bp, const basic_stroke_props<_Graphics_surfaces_type>& sp, const basic_dashes<_Graphics_surfaces_type>& d, const basic_render_props<_Graphics_surfaces_type>& rp, const basic_clip_props<_Graphics_surfaces_type>& cl) {
+				_Ds_stroke_rect<_Cairo_graphics_surfaces<GraphicsMath>>(data->data, b, bb, bp, sp, d, rp, cl);
+			}
+			template<class GraphicsMath>
+			void _Cairo_graphics_surfaces<GraphicsMath>::surfaces::fill_circle(output_surface_data_type& data, const basic_brush<_Graphics_surfaces_type>& b, const basic_circle<GraphicsMath>& c, const basic_brush_props<_Graphics_surfaces_type>& bp, const basic_render_props<_Graphics_surfaces_type>& rp, const basic_clip_props<_Graphics_surfaces_type>& cl) {
+				_Ds_fill_circle<_Cairo_graphics_surfaces<GraphicsMath>>(data->data, b, c, bp, rp, cl);
+			}
+			template<class GraphicsMath>
+			void _Cairo_graphics_surfaces<GraphicsMath>::surfaces::mask(output_surface_data_type& data, const basic_brush<_Graphics_surfaces_type>& b, const basic_brush<_Graphics_surfaces_type>& mb, const basic_brush_props<_Graphics_surfaces_type>& bp, const basic_mask_props<_Graphics_surfaces_type>& mp, const basic_render_props<_Graphics_surfaces_type>& rp, const basic_clip_props<_Graphics_surfaces_type>& cl) {
 				_Ds_mask<_Cairo_graphics_surfaces<GraphicsMath>>(data->data, b, mb, bp, mp, rp, cl);
 			}
 			template<class GraphicsMath>
-			inline void _Cairo_graphics_surfaces<GraphicsMath>::surfaces::draw_callback(output_surface_data_type& data, function<void(basic_output_surface<_Graphics_surfaces_type>&)> fn) {
+			void _Cairo_graphics_surfaces<GraphicsMath>::surfaces::coverage_cache_limit(output_surface_data_type& data, size_t bytes) {
+				_Ds_coverage_cache_limit<_Cairo_graphics_surfaces<GraphicsMath>>(data->data, bytes);
+			}
+			template<class GraphicsMath>
+			size_t _Cairo_graphics_surfaces<GraphicsMath>::surfaces::coverage_cache_limit(const output_surface_data_type& data) noexcept {
+				return _Ds_coverage_cache_limit<_Cairo_graphics_surfaces<GraphicsMath>>(data->data);
+			}
+			template<class GraphicsMath>
+			coverage_cache_stats _Cairo_graphics_surfaces<GraphicsMath>::surfaces::coverage_cache_statistics(const output_surface_data_type& data) noexcept {
+				return _Ds_coverage_cache_statistics<_Cairo_graphics_surfaces<GraphicsMath>>(data->data);
+			}
+			template<class GraphicsMath>
+			void _Cairo_graphics_surfaces<GraphicsMath>::surfaces::draw_callback(output_surface_data_type& data, function<void(basic_output_surface<_Graphics_surfaces_type>&)> fn) {
 				data->draw_callback = fn;
 			}
 			template<class GraphicsMath>
-			inline void _Cairo_graphics_surfaces<GraphicsMath>::surfaces::size_change_callback(output_surface_data_type& data, function<void(basic_output_surface<_Graphics_surfaces_type>&)> fn) {
+			void _Cairo_graphics_surfaces<GraphicsMath>::surfaces::size_change_callback(output_surface_data_type& data, function<void(basic_output_surface<_Graphics_surfaces_type>&)> fn) {
 				data->size_change_callback = fn;
 			}
 			template<class GraphicsMath>
-			inline void _Cairo_graphics_surfaces<GraphicsMath>::surfaces::user_scaling_callback(output_surface_data_type& data, function<basic_bounding_box<GraphicsMath>(const basic_output_surface<_Graphics_surfaces_type>&, bool&)> fn) {
+			void _Cairo_graphics_surfaces<GraphicsMath>::surfaces::user_scaling_callback(output_surface_data_type& data, function<basic_bounding_box<GraphicsMath>(const basic_output_surface<_Graphics_surfaces_type>&, bool&)> fn) {
 				data->user_scaling_callback = fn;
 			}
 			template<class GraphicsMath>
-			inline void _Cairo_graphics_surfaces<GraphicsMath>::surfaces::dimensions(output_surface_data_type& data, const basic_display_point<GraphicsMath>& val) {
+			void _Cairo_graphics_surfaces<GraphicsMath>::surfaces::dimensions(output_surface_data_type& data, const basic_display_point<GraphicsMath>& val) {
 				_Ds_dimensions<_Cairo_graphics_surfaces<GraphicsMath>>(data->data, val);
 			}
 			template<class GraphicsMath>
-			inline void _Cairo_graphics_surfaces<GraphicsMath>::surfaces::scaling(output_surface_data_type& data, io2d::scaling val) {
+			void _Cairo_graphics_surfaces<GraphicsMath>::surfaces::scaling(output_surface_data_type& data, io2d::scaling val) {
 				_Ds_scaling<_Cairo_graphics_surfaces<GraphicsMath>>(data->data, val);
 			}
 			template<class GraphicsMath>
-			inline void _Cairo_graphics_surfaces<GraphicsMath>::surfaces::letterbox_brush(output_surface_data_type& data, const optional<basic_brush<_Graphics_surfaces_type>>& val, const optional<basic_brush_props<_Graphics_surfaces_type>>& bp) noexcept {
+			void _Cairo_graphics_surfaces<GraphicsMath>::surfaces::letterbox_brush(output_surface_data_type& data, const optional<basic_brush<_Graphics_surfaces_type>>& val, const optional<basic_brush_props<_Graphics_surfaces_type>>& bp) noexcept {
 				_Ds_letterbox_brush<_Cairo_graphics_surfaces<GraphicsMath>>(data->data, val, bp);
 			}
 			template<class GraphicsMath>
-			inline void _Cairo_graphics_surfaces<GraphicsMath>::surfaces::letterbox_brush_props(output_surface_data_type& data, const basic_brush_props<_Graphics_surfaces_type>& val) {
+			void _Cairo_graphics_surfaces<GraphicsMath>::surfaces::letterbox_brush_props(output_surface_data_type& data, const basic_brush_props<_Graphics_surfaces_type>& val) {
 				_Ds_letterbox_brush_props<_Cairo_graphics_surfaces<GraphicsMath>>(data->data, val);
 			}
 			template<class GraphicsMath>
-			inline void _Cairo_graphics_surfaces<GraphicsMath>::surfaces::auto_clear(output_surface_data_type& data, bool val) {
+			void _Cairo_graphics_surfaces<GraphicsMath>::surfaces::auto_clear(output_surface_data_type& data, bool val) {
 				_Ds_auto_clear<_Cairo_graphics_surfaces<GraphicsMath>>(data->data, val);
 			}
 			template<class GraphicsMath>
-			inline void _Cairo_graphics_surfaces<GraphicsMath>::surfaces::redraw_required(output_surface_data_type& data, bool val) {
+			void _Cairo_graphics_surfaces<GraphicsMath>::surfaces::redraw_required(output_surface_data_type& data, bool val) {
 				_Ds_redraw_required<_Cairo_graphics_surfaces<GraphicsMath>>(data->data, val);
 			}
 			template<class GraphicsMath>
-			inline io2d::format _Cairo_graphics_surfaces<GraphicsMath>::surfaces::format(const output_surface_data_type& data) noexcept {
+			io2d::format _Cairo_graphics_surfaces<GraphicsMath>::surfaces::format(const output_surface_data_type& data) noexcept {
 				return _Ds_format<_Cairo_graphics_surfaces<GraphicsMath>>(data->data);
 			}
 			template<class GraphicsMath>
-			inline basic_display_point<GraphicsMath> _Cairo_graphics_surfaces<GraphicsMath>::surfaces::dimensions(const output_surface_data_type& data) noexcept {
+			basic_display_point<GraphicsMath> _Cairo_graphics_surfaces<GraphicsMath>::surfaces::dimensions(const output_surface_data_type& data) noexcept {
 				return _Ds_dimensions<_Cairo_graphics_surfaces<GraphicsMath>>(data->data);
 			}
 			template<class GraphicsMath>
-			inline basic_display_point<GraphicsMath> _Cairo_graphics_surfaces<GraphicsMath>::surfaces::display_dimensions(const output_surface_data_type& data) noexcept {
+			basic_display_point<GraphicsMath> _Cairo_graphics_surfaces<GraphicsMath>::surfaces::display_dimensions(const output_surface_data_type& data) noexcept {
 				return _Ds_display_dimensions<_Cairo_graphics_surfaces<GraphicsMath>>(data->data);
 			}
 			template<class GraphicsMath>
-			inline io2d::scaling _Cairo_graphics_surfaces<GraphicsMath>::surfaces::scaling(output_surface_data_type& data) noexcept {
+			io2d::scaling _Cairo_graphics_surfaces<GraphicsMath>::surfaces::scaling(const output_surface_data_type& data) noexcept {
 				return _Ds_scaling<_Cairo_graphics_surfaces<GraphicsMath>>(data->data);
 			}
 			template<class GraphicsMath>
-			inline optional<basic_brush<_Cairo_graphics_surfaces<GraphicsMath>>> _Cairo_graphics_surfaces<GraphicsMath>::surfaces::letterbox_brush(const output_surface_data_type& data) noexcept {
+			optional<basic_brush<_Cairo_graphics_surfaces<GraphicsMath>>> _Cairo_graphics_surfaces<GraphicsMath>::surfaces::letterbox_brush(const output_surface_data_type& data) noexcept {
 				return _Ds_letterbox_brush<_Cairo_graphics_surfaces<GraphicsMath>>(data->data);
 			}
 			template<class GraphicsMath>
-			inline basic_brush_props<_Cairo_graphics_surfaces<GraphicsMath>> _Cairo_graphics_surfaces<GraphicsMath>::surfaces::letterbox_brush_props(const output_surface_data_type& data) noexcept {
+			basic_brush_props<_Cairo_graphics_surfaces<GraphicsMath>> _Cairo_graphics_surfaces<GraphicsMath>::surfaces::letterbox_brush_props(const output_surface_data_type& data) noexcept {
 				return _Ds_letterbox_brush_props<_Cairo_graphics_surfaces<GraphicsMath>>(data->data);
 			}
 			template<class GraphicsMath>
-			inline bool _Cairo_graphics_surfaces<GraphicsMath>::surfaces::auto_clear(const output_surface_data_type& data) noexcept {
+			bool _Cairo_graphics_surfaces<GraphicsMath>::surfaces::auto_clear(const output_surface_data_type& data) noexcept {
 				return _Ds_auto_clear<_Cairo_graphics_surfaces<GraphicsMath>>(data->data);
 			}
 			template<class GraphicsMath>
-			inline bool _Cairo_graphics_surfaces<GraphicsMath>::surfaces::redraw_required(const output_surface_data_type& data) noexcept {
+			bool _Cairo_graphics_surfaces<GraphicsMath>::surfaces::redraw_required(const output_surface_data_type& data) noexcept {
 				return _Ds_redraw_required<_Cairo_graphics_surfaces<GraphicsMath>>(data->data);
 			}
 		}
@@ -34,6 +34,103 @@ namespace std::experimental::io2d {
 			};
 
 			void _RegisterWindowClass();
+
+			// The window class's procedure calls the function stored after the output surface pointer in the window's extra bytes, which begin_show
+			// sets to _Output_surface_window_proc for the surface's GraphicsMath.
+			using _Output_surface_window_proc_type = LRESULT(*)(HWND hwnd, UINT msg, WPARAM wParam, LPARAM lParam, LONG_PTR objPtr);
+
+			template <class GraphicsMath>
+			LRESULT _Output_surface_window_proc(HWND hwnd, UINT msg, WPARAM wParam, LPARAM lParam, LONG_PTR objPtr) {
+				auto outputSfc = reinterpret_cast<basic_output_surface<_Cairo_graphics_surfaces<GraphicsMath>>*>(objPtr);
+
+				const static auto lrZero = static_cast<LRESULT>(0);
+				switch (msg) {
+#ifdef __clang__
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunreachable-code-break"
+#endif
+				case WM_CREATE:
+				{
+					outputSfc->display_dimensions(outputSfc->data()->data.display_dimensions);
+					// Return 0 to allow the window to proceed in the creation process.
+					return lrZero;
+				} break;
+#ifdef __clang__
+#pragma clang diagnostic pop
+#endif
+#ifdef __clang__
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunreachable-code-break"
+#endif
+				case WM_CLOSE:
+				{
+					// This message is sent when a window or an application should
+					// terminate.
+					if (!DestroyWindow(hwnd)) {
+						_Throw_system_error_for_GetLastError(GetLastError(), "Failed call to DestroyWindow when processing WM_CLOSE.");
+					}
+					outputSfc->data()->data.hwnd = nullptr;
+					return lrZero;
+				} break;
+
+#ifdef __clang__
+#pragma clang diagnostic pop
+#endif
+
+#ifdef __clang__
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunreachable-code-break"
+#endif
+				case WM_DESTROY:
+				{
+					// This message is sent when a window has been destroyed.
+					PostQuitMessage(0);
+					return lrZero;
+				} break;
+#ifdef __clang__
+#pragma clang diagnostic pop
+#endif
+
+				case WM_SIZE:
+				{
+					auto dimensions = basic_display_point<GraphicsMath>(LOWORD(lParam), HIWORD(lParam));
+					auto& data = *outputSfc->data();
+					if (data.data.display_dimensions != dimensions) {
+						data.data.display_dimensions = dimensions;
+
+						// Call user size change function.
+
+						if (data.size_change_callback != nullptr) {
+							data.size_change_callback(*outputSfc);
+						}
+						//_Display_surface.invoke_size_change_callback();
+					}
+				} break;
+
+				case WM_PAINT:
+				{
+					auto& data = *outputSfc->data();
+					auto& displayDimensions = data.data.display_dimensions;
+					PAINTSTRUCT ps;
+					HDC hdc;
+					hdc = BeginPaint(hwnd, &ps);
+					RECT clientRect;
+					GetClientRect(hwnd, &clientRect);
+					if (clientRect.right - clientRect.left != displayDimensions.x() || clientRect.bottom - clientRect.top != displayDimensions.y()) {
+						// If there is a size mismatch we skip painting and resize the window instead.
+						EndPaint(hwnd, &ps);
+						outputSfc->display_dimensions(displayDimensions);
+						break;
+					}
+
+					data.draw_callback(*outputSfc);
+					_Cairo_graphics_surfaces<GraphicsMath>::surfaces::_Render_to_native_surface(outputSfc->data(), *outputSfc);
+
+					EndPaint(hwnd, &ps);
+				} break;
+				}
+				return DefWindowProc(hwnd, msg, wParam, lParam);
+			}
 			
 			template<class GraphicsMath>
 			struct _Cairo_graphics_surfaces<GraphicsMath>::surfaces::_Output_surface_data {
@@ -166,6 +263,13 @@ namespace std::experimental::io2d {
 					_Throw_system_error_for_GetLastError(GetLastError(), "Failed call to CreateWindowEx.");
 				}
 
+				SetLastError(ERROR_SUCCESS);
+				if (SetWindowLongPtrW(data.hwnd, sizeof(LONG_PTR), reinterpret_cast<LONG_PTR>(&_Output_surface_window_proc<GraphicsMath>)) == 0) {
+					DWORD lastError = GetLastError();
+					if (lastError != ERROR_SUCCESS) {
+						_Throw_system_error_for_GetLastError(lastError, "Failed call to SetWindowLongPtrW(HWND, int, LONG_PTR)");
+					}
+				}
 				SetLastError(ERROR_SUCCESS);
 				if (SetWindowLongPtrW(data.hwnd, 0, reinterpret_cast<LONG_PTR>(instance)) == 0) {
 					// SetWindowLongPtr is weird in terms of how it fails. See its documentation. Hence this weird check.
@@ -433,10 +537,42 @@ namespace std::experimental::io2d {
 				_Ds_fill<_Cairo_graphics_surfaces<GraphicsMath>>(data->data, b, ip, bp, rp, cl);
 			}
 			template<class GraphicsMath>
+			inline void _Cairo_graphics_surfaces<GraphicsMath>::surfaces::fill_stroke(output_surface_data_type& data, const basic_brush<_Graphics_surfaces_type>& fb, const basic_brush<_Graphics_surfaces_type>& sb, const basic_interpreted_path<_Graphics_surfaces_type>& ip, const basic_brush_props<_Graphics_surfaces_type>& bp, const basic_stroke_props<_Graphics_surfaces_type>& sp, const basic_dashes<_Graphics_surfaces_type>& d, const basic_render_props<_Graphics_surfaces_type>& rp, const basic_clip_props<_Graphics_surfaces_type>& cl) {
+				_Ds_fill_stroke<_Cairo_graphics_surfaces<GraphicsMath>>(data->data, fb, sb, ip, bp, sp, d, rp, cl);
+			}
+			template<class GraphicsMath>
+			inline void _Cairo_graphics_surfaces<GraphicsMath>::surfaces::fill_instances(output_surface_data_type& data, const basic_brush<_Graphics_surfaces_type>& b, const basic_interpreted_path<_Graphics_surfaces_type>& ip, const _Fill_instance_range<GraphicsMath>& instances, const basic_brush_props<_Graphics_surfaces_type>& bp, const basic_render_props<_Graphics_surfaces_type>& rp, const basic_clip_props<_Graphics_surfaces_type>& cl) {
+				_Ds_fill_instances<_Cairo_graphics_surfaces<GraphicsMath>>(data->data, b, ip, instances, bp, rp, cl);
+			}
+			template<class GraphicsMath>
+			inline void _Cairo_graphics_surfaces<GraphicsMath>::surfaces::fill_rect(output_surface_data_type& data, const basic_brush<_Graphics_surfaces_type>& b, const basic_bounding_box<GraphicsMath>& bb, const basic_brush_props<_Graphics_surfaces_type>& bp, const basic_render_props<_Graphics_surfaces_type>& rp, const basic_clip_props<_Graphics_surfaces_type>& cl) {
+				_Ds_fill_rect<_Cairo_graphics_surfaces<GraphicsMath>>(data->data, b, bb, bp, rp, cl);
+			}
+			template<class GraphicsMath>
+			inline void _Cairo_graphics_surfaces<GraphicsMath>::surfaces::stroke_rect(output_surface_data_type& data, const basic_brush<_Graphics_surfaces_type>& b, const basic_bounding_box<GraphicsMath>& bb, const basic_brush_props<_Graphics_surfaces_type>& bp, const basic_stroke_props<_Graphics_surfaces_type>& sp, const basic_dashes<_Graphics_surfaces_type>& d, const basic_render_props<_Graphics_surfaces_type>& rp, const basic_clip_props<_Graphics_surfaces_type>& cl) {
+				_Ds_stroke_rect<_Cairo_graphics_surfaces<GraphicsMath>>(data->data, b, bb, bp, sp, d, rp, cl);
+			}
+			template<class GraphicsMath>
+			inline void _Cairo_graphics_surfaces<GraphicsMath>::surfaces::fill_circle(output_surface_data_type& data, const basic_brush<_Graphics_surfaces_type>& b, const basic_circle<GraphicsMath>& c, const basic_brush_props<_Graphics_surfaces_type>& bp, const basic_render_props<_Graphics_surfaces_type>& rp, const basic_clip_props<_Graphics_surfaces_type>& cl) {
+				_Ds_fill_circle<_Cairo_graphics_surfaces<GraphicsMath>>(data->data, b, c, bp, rp, cl);
+			}
+			template<class GraphicsMath>
 			inline void _Cairo_graphics_surfaces<GraphicsMath>::surfaces::mask(output_surface_data_type& data, const basic_brush<_Graphics_surfaces_type>& b, const basic_brush<_Graphics_surfaces_type>& mb, const basic_brush_props<_Graphics_surfaces_type>& bp, const basic_mask_props<_Graphics_surfaces_type>& mp, const basic_render_props<_Graphics_surfaces_type>& rp, const basic_clip_props<_Graphics_surfaces_type>& cl) {
 				_Ds_mask<_Cairo_graphics_surfaces<GraphicsMath>>(data->data, b, mb, bp, mp, rp, cl);
 			}
 			template<class GraphicsMath>
+			inline void _Cairo_graphics_surfaces<GraphicsMath>::surfaces::coverage_cache_limit(output_surface_data_type& data, size_t bytes) {
+				_Ds_coverage_cache_limit<_Cairo_graphics_surfaces<GraphicsMath>>(data->data, bytes);
+			}
+			template<class GraphicsMath>
+			inline size_t _Cairo_graphics_surfaces<GraphicsMath>::surfaces::coverage_cache_limit(const output_surface_data_type& data) noexcept {
+				return _Ds_coverage_cache_limit<_Cairo_graphics_surfaces<GraphicsMath>>(data->data);
+			}
+			template<class GraphicsMath>
+			inline coverage_cache_stats _Cairo_graphics_surfaces<GraphicsMath>::surfaces::coverage_cache_statistics(const output_surface_data_type& data) noexcept {
+				return _Ds_coverage_cache_statistics<_Cairo_graphics_surfaces<GraphicsMath>>(data->data);
+			}
+			template<class GraphicsMath>
 			inline void _Cairo_graphics_surfaces<GraphicsMath>::surfaces::draw_callback(output_surface_data_type& data, function<void(basic_output_surface<_Graphics_surfaces_type>&)> fn) {
 				data->draw_callback = fn;
 			}
@@ -485,7 +621,7 @@ namespace std::experimental::io2d {
 				return _Ds_display_dimensions<_Cairo_graphics_surfaces<GraphicsMath>>(data->data);
 			}
 			template<class GraphicsMath>
-			inline io2d::scaling _Cairo_graphics_surfaces<GraphicsMath>::surfaces::scaling(output_surface_data_type& data) noexcept {
+			inline io2d::scaling _Cairo_graphics_surfaces<GraphicsMath>::surfaces::scaling(const output_surface_data_type& data) noexcept {
 				return _Ds_scaling<_Cairo_graphics_surfaces<GraphicsMath>>(data->data);
 			}
 			template<class GraphicsMath>
@@ -19,9 +19,31 @@ namespace std::experimental::io2d {
             template <class GraphicsSurfaces>
             void _Ds_fill(typename GraphicsSurfaces::surfaces::_Display_surface_data_type& data, const basic_brush<GraphicsSurfaces>& b, const basic_interpreted_path<GraphicsSurfaces>& ip, const basic_brush_props<GraphicsSurfaces>& bp, const basic_render_props<GraphicsSurfaces>& rp, const basic_clip_props<GraphicsSurfaces>& cl);
 
+            template <class GraphicsSurfaces>
+            void _Ds_fill_stroke(typename GraphicsSurfaces::surfaces::_Display_surface_data_type& data, const basic_brush<GraphicsSurfaces>& fb, const basic_brush<GraphicsSurfaces>& sb, const basic_interpreted_path<GraphicsSurfaces>& ip, const basic_brush_props<GraphicsSurfaces>& bp, const basic_stroke_props<GraphicsSurfaces>& sp, const basic_dashes<GraphicsSurfaces>& d, const basic_render_props<GraphicsSurfaces>& rp, const basic_clip_props<GraphicsSurfaces>& cl);
+
+            template <class GraphicsSurfaces>
+            void _Ds_fill_instances(typename GraphicsSurfaces::surfaces::_Display_surface_data_type& data, const basic_brush<GraphicsSurfaces>& b, const basic_interpreted_path<GraphicsSurfaces>& ip, const _Fill_instance_range<typename GraphicsSurfaces::graphics_math_type>& instances, const basic_brush_props<GraphicsSurfaces>& bp, const basic_render_props<GraphicsSurfaces>& rp, const basic_clip_props<GraphicsSurfaces>& cl);
+
+            template <class GraphicsSurfaces>
+            void _Ds_fill_rect(typename GraphicsSurfaces::surfaces::_Display_surface_data_type& data, const basic_brush<GraphicsSurfaces>& b, const basic_bounding_box<typename GraphicsSurfaces::graphics_math_type>& bb, const basic_brush_props<GraphicsSurfaces>& bp, const basic_render_props<GraphicsSurfaces>& rp, const basic_clip_props<GraphicsSurfaces>& cl);
+
+            template <class GraphicsSurfaces>
+            void _Ds_stroke_rect(typename GraphicsSurfaces::surfaces::_Display_surface_data_type& data, const basic_brush<GraphicsSurfaces>& b, const basic_bounding_box<typename GraphicsSurfaces::graphics_math_type>& bb, const basic_brush_props<GraphicsSurfaces>& bp, const basic_stroke_props<GraphicsSurfaces>& sp, const basic_dashes<GraphicsSurfaces>& d, const basic_render_props<GraphicsSurfaces>& rp, const basic_clip_props<GraphicsSurfaces>& cl);
+
+            template <class GraphicsSurfaces>
+            void _Ds_fill_circle(typename GraphicsSurfaces::surfaces::_Display_surface_data_type& data, const basic_brush<GraphicsSurfaces>& b, const basic_circle<typename GraphicsSurfaces::graphics_math_type>& c, const basic_brush_props<GraphicsSurfaces>& bp, const basic_render_props<GraphicsSurfaces>& rp, const basic_clip_props<GraphicsSurfaces>& cl);
+
             template <class GraphicsSurfaces>
             void _Ds_mask(typename GraphicsSurfaces::surfaces::_Display_surface_data_type& data, const basic_brush<GraphicsSurfaces>& b, const basic_brush<GraphicsSurfaces>& mb, const basic_brush_props<GraphicsSurfaces>& bp, const basic_mask_props<GraphicsSurfaces>& mp, const basic_render_props<GraphicsSurfaces>& rp, const basic_clip_props<GraphicsSurfaces>& cl);
 
+            template <class GraphicsSurfaces>
+            void _Ds_coverage_cache_limit(typename GraphicsSurfaces::surfaces::_Display_surface_data_type& data, size_t bytes);
+            template <class GraphicsSurfaces>
+            size_t _Ds_coverage_cache_limit(const typename GraphicsSurfaces::surfaces::_Display_surface_data_type& data) noexcept;
+            template <class GraphicsSurfaces>
+            coverage_cache_stats _Ds_coverage_cache_statistics(const typename GraphicsSurfaces::surfaces::_Display_surface_data_type& data) noexcept;
+
             template <class GraphicsSurfaces>
             void _Ds_dimensions(typename GraphicsSurfaces::surfaces::_Display_surface_data_type& data, const basic_display_point<typename GraphicsSurfaces::graphics_math_type>& val);
 
@@ -59,7 +81,7 @@ namespace std::experimental::io2d {
             basic_display_point<typename GraphicsSurfaces::graphics_math_type> _Ds_max_display_dimensions() noexcept;
 
             template <class GraphicsSurfaces>
-            io2d::scaling _Ds_scaling(typename GraphicsSurfaces::surfaces::_Display_surface_data_type& data) noexcept;
+            io2d::scaling _Ds_scaling(const typename GraphicsSurfaces::surfaces::_Display_surface_data_type& data) noexcept;
 
             template <class GraphicsSurfaces>
             optional<basic_brush<GraphicsSurfaces>> _Ds_letterbox_brush(const typename GraphicsSurfaces::surfaces::_Display_surface_data_type& data) noexcept;
@@ -32,10 +32,42 @@ namespace std::experimental::io2d {
                 GraphicsSurfaces::surfaces::fill(data.back_buffer, b, ip, bp, rp, cl);
             }
             template <class GraphicsSurfaces>
+            inline void _Ds_fill_stroke(typename GraphicsSurfaces::surfaces::_Display_surface_data_type& data, const basic_brush<GraphicsSurfaces>& fb, const basic_brush<GraphicsSurfaces>& sb, const basic_interpreted_path<GraphicsSurfaces>& ip, const basic_brush_props<GraphicsSurfaces>& bp, const basic_stroke_props<GraphicsSurfaces>& sp, const basic_dashes<GraphicsSurfaces>& d, const basic_render_props<GraphicsSurfaces>& rp, const basic_clip_props<GraphicsSurfaces>& cl) {
+                GraphicsSurfaces::surfaces::fill_stroke(data.back_buffer, fb, sb, ip, bp, sp, d, rp, cl);
+            }
+            template <class GraphicsSurfaces>
+            inline void _Ds_fill_instances(typename GraphicsSurfaces::surfaces::_Display_surface_data_type& data, const basic_brush<GraphicsSurfaces>& b, const basic_interpreted_path<GraphicsSurfaces>& ip, const _Fill_instance_range<typename GraphicsSurfaces::graphics_math_type>& instances, const basic_brush_props<GraphicsSurfaces>& bp, const basic_render_props<GraphicsSurfaces>& rp, const basic_clip_props<GraphicsSurfaces>& cl) {
+                GraphicsSurfaces::surfaces::fill_instances(data.back_buffer, b, ip, instances, bp, rp, cl);
+            }
+            template <class GraphicsSurfaces>
+            inline void _Ds_fill_rect(typename GraphicsSurfaces::surfaces::_Display_surface_data_type& data, const basic_brush<GraphicsSurfaces>& b, const basic_bounding_box<typename GraphicsSurfaces::graphics_math_type>& bb, const basic_brush_props<GraphicsSurfaces>& bp, const basic_render_props<GraphicsSurfaces>& rp, const basic_clip_props<GraphicsSurfaces>& cl) {
+                GraphicsSurfaces::surfaces::fill_rect(data.back_buffer, b, bb, bp, rp, cl);
+            }
+            template <class GraphicsSurfaces>
+            inline void _Ds_stroke_rect(typename GraphicsSurfaces::surfaces::_Display_surface_data_type& data, const basic_brush<GraphicsSurfaces>& b, const basic_bounding_box<typename GraphicsSurfaces::graphics_math_type>& bb, const basic_brush_props<GraphicsSurfaces>& bp, const basic_stroke_props<GraphicsSurfaces>& sp, const basic_dashes<GraphicsSurfaces>& d, const basic_render_props<GraphicsSurfaces>& rp, const basic_clip_props<GraphicsSurfaces>& cl) {
+                GraphicsSurfaces::surfaces::stroke_rect(data.back_buffer, b, bb, bp, sp, d, rp, cl);
+            }
+            template <class GraphicsSurfaces>
+            inline void _Ds_fill_circle(typename GraphicsSurfaces::surfaces::_Display_surface_data_type& data, const basic_brush<GraphicsSurfaces>& b, const basic_circle<typename GraphicsSurfaces::graphics_math_type>& c, const basic_brush_props<GraphicsSurfaces>& bp, const basic_render_props<GraphicsSurfaces>& rp, const basic_clip_props<GraphicsSurfaces>& cl) {
+                GraphicsSurfaces::surfaces::fill_circle(data.back_buffer, b, c, bp, rp, cl);
+            }
+            template <class GraphicsSurfaces>
             inline void _Ds_mask(typename GraphicsSurfaces::surfaces::_Display_surface_data_type& data, const basic_brush<GraphicsSurfaces>& b, const basic_brush<GraphicsSurfaces>& mb, const basic_brush_props<GraphicsSurfaces>& bp, const basic_mask_props<GraphicsSurfaces>& mp, const basic_render_props<GraphicsSurfaces>& rp, const basic_clip_props<GraphicsSurfaces>& cl) {
                 GraphicsSurfaces::surfaces::mask(data.back_buffer, b, mb, bp, mp, rp, cl);
             }
             template <class GraphicsSurfaces>
+            inline void _Ds_coverage_cache_limit(typename GraphicsSurfaces::surfaces::_Display_surface_data_type& data, size_t bytes) {
+                GraphicsSurfaces::surfaces::coverage_cache_limit(data.back_buffer, bytes);
+            }
+            template <class GraphicsSurfaces>
+            inline size_t _Ds_coverage_cache_limit(const typename GraphicsSurfaces::surfaces::_Display_surface_data_type& data) noexcept {
+                return GraphicsSurfaces::surfaces::coverage_cache_limit(data.back_buffer);
+            }
+            template <class GraphicsSurfaces>
+            inline coverage_cache_stats _Ds_coverage_cache_statistics(const typename GraphicsSurfaces::surfaces::_Display_surface_data_type& data) noexcept {
+                return GraphicsSurfaces::surfaces::coverage_cache_statistics(data.back_buffer);
+            }
+            template <class GraphicsSurfaces>
             inline void _Ds_dimensions(typename GraphicsSurfaces::surfaces::_Display_surface_data_type& data, const basic_display_point<typename GraphicsSurfaces::graphics_math_type>& val) {
                 if (val != data.back_buffer.dimensions) {
                     // Recreate the render target that is drawn to the displayed surface
@@ -90,7 +122,7 @@ namespace std::experimental::io2d {
                 return GraphicsSurfaces::max_display_dimensions();
             }
             template <class GraphicsSurfaces>
-            inline io2d::scaling _Ds_scaling(typename GraphicsSurfaces::surfaces::_Display_surface_data_type& data) noexcept {
+            inline io2d::scaling _Ds_scaling(const typename GraphicsSurfaces::surfaces::_Display_surface_data_type& data) noexcept {
                 return data.scl;
             }
             template <class GraphicsSurfaces>
@@ -99,7 +131,7 @@ namespace std::experimental::io2d {
             }
             template <class GraphicsSurfaces>
             inline basic_brush_props<GraphicsSurfaces> _Ds_letterbox_brush_props(const typename GraphicsSurfaces::surfaces::_Display_surface_data_type& data) noexcept {
-                return data._Letterbox_brush_props;
+                return data._Letterbox_brush_props.value_or(basic_brush_props<GraphicsSurfaces>());
             }
             template <class GraphicsSurfaces>
             inline bool _Ds_auto_clear(const typename GraphicsSurfaces::surfaces::_Display_surface_data_type& data) noexcept {
@@ -164,25 +196,8 @@ namespace std::experimental::io2d {
                                 cairo_set_source_rgb(displayContext, 0.0, 0.0, 0.0);
                             }
                             else {
-                                auto pttn = data._Letterbox_brush.value().data().brush.get();
-                                if (data._Letterbox_brush_props == nullopt) {
-                                    cairo_pattern_set_extend(pttn, CAIRO_EXTEND_NONE);
-                                    cairo_pattern_set_filter(pttn, CAIRO_FILTER_GOOD);
-                                    cairo_matrix_t cPttnMatrix;
-                                    cairo_matrix_init_identity(&cPttnMatrix);
-                                    cairo_pattern_set_matrix(pttn, &cPttnMatrix);
-                                    cairo_set_source(displayContext, pttn);
-                                }
-                                else {
-                                    const auto& props = data._Letterbox_brush_props.value();
-                                    cairo_pattern_set_extend(pttn, _Extend_to_cairo_extend_t(props.wrap_mode()));
-                                    cairo_pattern_set_filter(pttn, _Filter_to_cairo_filter_t(props.filter()));
-                                    cairo_matrix_t cPttnMatrix;
-                                    const auto& m = props.brush_matrix();
-                                    cairo_matrix_init(&cPttnMatrix, m.m00(), m.m01(), m.m10(), m.m11(), m.m20(), m.m21());
-                                    cairo_pattern_set_matrix(pttn, &cPttnMatrix);
-                                    cairo_set_source(displayContext, pttn);
-                                }
+                                const auto pttn = _Create_brush_pattern(data._Letterbox_brush.value(), data._Letterbox_brush_props);
+                                cairo_set_source(displayContext, pttn.get());
                             }
                             cairo_fill(displayContext);
                         }
@@ -214,26 +229,8 @@ namespace std::experimental::io2d {
                                 //cairo_paint(_Native_context.get());
                             }
                             else {
-                                auto pttn = data._Letterbox_brush.value().data().brush.get();
-                                if (data._Letterbox_brush_props == nullopt) {
-                                    cairo_pattern_set_extend(pttn, CAIRO_EXTEND_NONE);
-                                    cairo_pattern_set_filter(pttn, CAIRO_FILTER_GOOD);
-                                    cairo_matrix_t cPttnMatrix;
-                                    cairo_matrix_init_identity(&cPttnMatrix);
-                                    cairo_pattern_set_matrix(pttn, &cPttnMatrix);
-                                    cairo_set_source(displayContext, pttn);
-                                    //cairo_paint(_Native_context.get());
-                                }
-                                else {
-                                    const auto& props = data._Letterbox_brush_props.value();
-                                    cairo_pattern_set_extend(pttn, _Extend_to_cairo_extend_t(props.wrap_mode()));
-                                    cairo_pattern_set_filter(pttn, _Filter_to_cairo_filter_t(props.filter()));
-                                    cairo_matrix_t cPttnMatrix;
-                                    const auto& m = props.brush_matrix();
-                                    cairo_matrix_init(&cPttnMatrix, m.m00(), m.m01(), m.m10(), m.m11(), m.m20(), m.m21());
-                                    cairo_pattern_set_matrix(pttn, &cPttnMatrix);
-                                    cairo_set_source(displayContext, pttn);
-                                }
+                                const auto pttn = _Create_brush_pattern(data._Letterbox_brush.value(), data._Letterbox_brush_props);
+                                cairo_set_source(displayContext, pttn.get());
                             }
                             cairo_fill(displayContext); // Draws the letterbox brush into the appropriate triangles using the appropriate brush_props, etc., settings.
                         }
@@ -264,27 +261,9 @@ namespace std::experimental::io2d {
                             cairo_paint(displayContext);
                         }
                         else {
-                            auto pttn = data._Letterbox_brush.value().data().brush.get();
-                            if (data._Letterbox_brush_props == nullopt) {
-                                cairo_pattern_set_extend(pttn, CAIRO_EXTEND_NONE);
-                                cairo_pattern_set_filter(pttn, CAIRO_FILTER_GOOD);
-                                cairo_matrix_t cPttnMatrix;
-                                cairo_matrix_init_identity(&cPttnMatrix);
-                                cairo_pattern_set_matrix(pttn, &cPttnMatrix);
-                                cairo_set_source(displayContext, pttn);
-                                cairo_paint(displayContext);
-                            }
-                            else {
-                                const basic_brush_props<_Cairo_graphics_surfaces<GraphicsMath>>& props = data._Letterbox_brush_props.value();
-                                cairo_pattern_set_extend(pttn, _Extend_to_cairo_extend_t(props.wrap_mode()));
-                                cairo_pattern_set_filter(pttn, _Filter_to_cairo_filter_t(props.filter()));
-                                cairo_matrix_t cPttnMatrix;
-                                const auto& m = props.brush_matrix();
-                                cairo_matrix_init(&cPttnMatrix, m.m00(), m.m01(), m.m10(), m.m11(), m.m20(), m.m21());
-                                cairo_pattern_set_matrix(pttn, &cPttnMatrix);
-                                cairo_set_source(displayContext, pttn);
-                                cairo_paint(displayContext);
-                            }
+                            const auto pttn = _Create_brush_pattern(data._Letterbox_brush.value(), data._Letterbox_brush_props);
+                            cairo_set_source(displayContext, pttn.get());
+                            cairo_paint(displayContext);
                         }
                     }
                     cairo_matrix_t ctm;
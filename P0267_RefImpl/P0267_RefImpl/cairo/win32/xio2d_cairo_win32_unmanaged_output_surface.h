@@ -149,10 +149,42 @@ namespace std::experimental::io2d {
 				_Ds_fill<_Cairo_graphics_surfaces<GraphicsMath>>(data->data, b, ip, bp, rp, cl);
 			}
 			template<class GraphicsMath>
+			inline void _Cairo_graphics_surfaces<GraphicsMath>::surfaces::fill_stroke(unmanaged_output_surface_data_type& data, const basic_brush<_Graphics_surfaces_type>& fb, const basic_brush<_Graphics_surfaces_type>& sb, const basic_interpreted_path<_Graphics_surfaces_type>& ip, const basic_brush_props<_Graphics_surfaces_type>& bp, const basic_stroke_props<_Graphics_surfaces_type>& sp, const basic_dashes<_Graphics_surfaces_type>& d, const basic_render_props<_Graphics_surfaces_type>& rp, const basic_clip_props<_Graphics_surfaces_type>& cl) {
+				_Ds_fill_stroke<_Cairo_graphics_surfaces<GraphicsMath>>(data->data, fb, sb, ip, bp, sp, d, rp, cl);
+			}
+			template<class GraphicsMath>
+			inline void _Cairo_graphics_surfaces<GraphicsMath>::surfaces::fill_instances(unmanaged_output_surface_data_type& data, const basic_brush<_Graphics_surfaces_type>& b, const basic_interpreted_path<_Graphics_surfaces_type>& ip, const _Fill_instance_range<GraphicsMath>& instances, const basic_brush_props<_Graphics_surfaces_type>& bp, const basic_render_props<_Graphics_surfaces_type>& rp, const basic_clip_props<_Graphics_surfaces_type>& cl) {
+				_Ds_fill_instances<_Cairo_graphics_surfaces<GraphicsMath>>(data->data, b, ip, instances, bp, rp, cl);
+			}
+			template<class GraphicsMath>
+			inline void _Cairo_graphics_surfaces<GraphicsMath>::surfaces::fill_rect(unmanaged_output_surface_data_type& data, const basic_brush<_Graphics_surfaces_type>& b, const basic_bounding_box<GraphicsMath>& bb, const basic_brush_props<_Graphics_surfaces_type>& bp, const basic_render_props<_Graphics_surfaces_type>& rp, const basic_clip_props<_Graphics_surfaces_type>& cl) {
+				_Ds_fill_rect<_Cairo_graphics_surfaces<GraphicsMath>>(data->data, b, bb, bp, rp, cl);
+			}
+			template<class GraphicsMath>
+			inline void _Cairo_graphics_surfaces<GraphicsMath>::surfaces::stroke_rect(unmanaged_output_surface_data_type& data, const basic_brush<_Graphics_surfaces_type>& b, const basic_bounding_box<GraphicsMath>& bb, const basic_brush_props<_Graphics_surfaces_type>& bp, const basic_stroke_props<_Graphics_surfaces_type>& sp, const basic_dashes<_Graphics_surfaces_type>& d, const basic_render_props<_Graphics_surfaces_type>& rp, const basic_clip_props<_Graphics_surfaces_type>& cl) {
+				_Ds_stroke_rect<_Cairo_graphics_surfaces<GraphicsMath>>(data->data, b, bb, bp, sp, d, rp, cl);
+			}
+			template<class GraphicsMath>
+			inline void _Cairo_graphics_surfaces<GraphicsMath>::surfaces::fill_circle(unmanaged_output_surface_data_type& data, const basic_brush<_Graphics_surfaces_type>& b, const basic_circle<GraphicsMath>& c, const basic_brush_props<_Graphics_surfaces_type>& bp, const basic_render_props<_Graphics_surfaces_type>& rp, const basic_clip_props<_Graphics_surfaces_type>& cl) {
+				_Ds_fill_circle<_Cairo_graphics_surfaces<GraphicsMath>>(data->data, b, c, bp, rp, cl);
+			}
+			template<class GraphicsMath>
 			inline void _Cairo_graphics_surfaces<GraphicsMath>::surfaces::mask(unmanaged_output_surface_data_type& data, const basic_brush<_Graphics_surfaces_type>& b, const basic_brush<_Graphics_surfaces_type>& mb, const basic_brush_props<_Graphics_surfaces_type>& bp, const basic_mask_props<_Graphics_surfaces_type>& mp, const basic_render_props<_Graphics_surfaces_type>& rp, const basic_clip_props<_Graphics_surfaces_type>& cl) {
 				_Ds_mask<_Cairo_graphics_surfaces<GraphicsMath>>(data->data, b, mb, bp, mp, rp, cl);
 			}
 			template<class GraphicsMath>
+			inline void _Cairo_graphics_surfaces<GraphicsMath>::surfaces::coverage_cache_limit(unmanaged_output_surface_data_type& data, size_t bytes) {
+				_Ds_coverage_cache_limit<_Cairo_graphics_surfaces<GraphicsMath>>(data->data, bytes);
+			}
+			template<class GraphicsMath>
+			inline size_t _Cairo_graphics_surfaces<GraphicsMath>::surfaces::coverage_cache_limit(const unmanaged_output_surface_data_type& data) noexcept {
+				return _Ds_coverage_cache_limit<_Cairo_graphics_surfaces<GraphicsMath>>(data->data);
+			}
+			template<class GraphicsMath>
+			inline coverage_cache_stats _Cairo_graphics_surfaces<GraphicsMath>::surfaces::coverage_cache_statistics(const unmanaged_output_surface_data_type& data) noexcept {
+				return _Ds_coverage_cache_statistics<_Cairo_graphics_surfaces<GraphicsMath>>(data->data);
+			}
+			template<class GraphicsMath>
 			inline void _Cairo_graphics_surfaces<GraphicsMath>::surfaces::draw_callback(unmanaged_output_surface_data_type& data, function<void(basic_unmanaged_output_surface<_Graphics_surfaces_type>&)> fn) {
 				data->draw_callback = fn;
 			}
@@ -201,7 +233,7 @@ namespace std::experimental::io2d {
 				return _Ds_display_dimensions<_Cairo_graphics_surfaces<GraphicsMath>>(data->data);
 			}
 			template<class GraphicsMath>
-			inline io2d::scaling _Cairo_graphics_surfaces<GraphicsMath>::surfaces::scaling(unmanaged_output_surface_data_type& data) noexcept {
+			inline io2d::scaling _Cairo_graphics_surfaces<GraphicsMath>::surfaces::scaling(const unmanaged_output_surface_data_type& data) noexcept {
 				return _Ds_scaling<_Cairo_graphics_surfaces<GraphicsMath>>(data->data);
 			}
 			template<class GraphicsMath>
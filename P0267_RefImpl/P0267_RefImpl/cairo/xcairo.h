@@ -4,6 +4,8 @@
 #define _XCAIRO_
 
 #include <cairo.h>
+#include <list>
+#include <unordered_map>
 #include "xio2d.h"
 
 namespace std {
@@ -15,6 +17,85 @@ namespace std {
                     
 					constexpr const wchar_t* _Refimpl_window_class_name = L"_P0267RefImplCairoRenderer_FF2B4C8D-0AB8-4343-AA02-6D0857E9FA21";
 
+					// The A8 coverage masks of filled paths, keyed by everything that decides their pixels except a whole pixel translation, so a path drawn again
+					// at another position can be composited from its mask instead of being rasterized. Translations are snapped to 1/_Subpixel_steps of a pixel.
+					// The masks take at most limit() bytes; the least recently used are evicted to stay within it.
+					class _Coverage_mask_cache {
+					public:
+						static constexpr int _Subpixel_steps = 4;
+						struct _Key {
+							const cairo_path_t* path;
+							float m00;
+							float m01;
+							float m10;
+							float m11;
+							int subpixelX;
+							int subpixelY;
+							cairo_antialias_t antialias;
+							cairo_fill_rule_t fillRule;
+
+							bool operator==(const _Key& other) const noexcept;
+						};
+					private:
+						struct _Key_hash {
+							size_t operator()(const _Key& key) const noexcept;
+						};
+						struct _Entry {
+							_Key key;
+							// Tells a path from a later one allocated at the same address.
+							::std::weak_ptr<cairo_path_t> path;
+							::std::unique_ptr<cairo_surface_t, decltype(&cairo_surface_destroy)> mask;
+							int x;
+							int y;
+							size_t bytes;
+						};
+						// Most recently used first.
+						::std::list<_Entry> _Entries;
+						::std::unordered_map<_Key, ::std::list<_Entry>::iterator, _Key_hash> _Index;
+						size_t _Limit;
+						size_t _Bytes = 0;
+						size_t _Hits = 0;
+						size_t _Misses = 0;
+						size_t _Evictions = 0;
+
+						void _Erase(::std::list<_Entry>::iterator it) noexcept;
+					public:
+						explicit _Coverage_mask_cache(size_t limit) noexcept;
+
+						// Returns the mask cached for key and path, with the device space offset of its top left corner from the translation it was made for in x
+						// and y, or nullptr if there is none.
+						cairo_surface_t* find(const _Key& key, const ::std::shared_ptr<cairo_path_t>& path, int& x, int& y) noexcept;
+						cairo_surface_t* insert(const _Key& key, const ::std::shared_ptr<cairo_path_t>& path, ::std::unique_ptr<cairo_surface_t, decltype(&cairo_surface_destroy)>&& mask, int x, int y, size_t bytes);
+						void limit(size_t bytes) noexcept;
+						size_t limit() const noexcept;
+						coverage_cache_stats stats() const noexcept;
+					};
+
+					// A clip rasterized into an A8 coverage mask of the part of a surface it covers, with the clip path, fill rule, matrix and antialias mode it
+					// was rasterized for. x and y are the device space position of the mask's top left corner.
+					struct _Clip_mask {
+						const cairo_path_t* path;
+						// Tells a path from a later one allocated at the same address.
+						::std::weak_ptr<cairo_path_t> pathOwner;
+						cairo_fill_rule_t fillRule;
+						cairo_matrix_t matrix;
+						cairo_antialias_t antialias;
+						int x;
+						int y;
+						::std::unique_ptr<cairo_surface_t, decltype(&cairo_surface_destroy)> surface{ nullptr, &cairo_surface_destroy };
+					};
+
+					// The clip masks most recently drawn through on one surface, most recently used first. Several are kept so that a clip drawn under a few
+					// matrices, such as the tiles of a tiled surface or frames of an animation, or a few clips used in turn, do not replace each other's masks.
+					class _Clip_mask_cache {
+						static constexpr size_t _Max_masks = 4;
+						::std::list<_Clip_mask> _Masks;
+					public:
+						// Returns the mask made for path, fr, m and aa, or nullptr if there is none.
+						const _Clip_mask* find(const ::std::shared_ptr<cairo_path_t>& path, cairo_fill_rule_t fr, const cairo_matrix_t& m, cairo_antialias_t aa) noexcept;
+						const _Clip_mask* insert(_Clip_mask&& mask);
+					};
+
 					template <class GraphicsMath>
 					struct _Cairo_graphics_surfaces {
 						using graphics_math_type = GraphicsMath;
@@ -227,6 +308,10 @@ namespace std {
 
 							struct _Interpreted_path_data {
 								::std::shared_ptr<cairo_path_t> path;
+								// The tight bounds of path in user space, computed when the path is interpreted.
+								basic_bounding_box<GraphicsMath> bounds;
+								// Created by the first call to flatten and shared by every copy of this data made afterwards.
+								_Flattened_path_cache_ptr<::std::shared_ptr<cairo_path_t>> flattened;
 							};
 							using interpreted_path_data_type = _Interpreted_path_data;
 
@@ -235,9 +320,14 @@ namespace std {
 							static interpreted_path_data_type create_interpreted_path(initializer_list<typename basic_figure_items<graphics_surfaces_type>::figure_item> il);
 							template <class ForwardIterator>
 							static interpreted_path_data_type create_interpreted_path(ForwardIterator first, ForwardIterator last);
+							template <size_t Capacity>
+							static interpreted_path_data_type create_interpreted_path(const basic_static_path<graphics_math_type, Capacity>& sp);
 							static interpreted_path_data_type copy_interpreted_path(const interpreted_path_data_type&);
 							static interpreted_path_data_type move_interpreted_path(interpreted_path_data_type&&) noexcept;
 							static void destroy(interpreted_path_data_type&) noexcept;
+							static interpreted_path_data_type flatten(const interpreted_path_data_type& data, float tolerance, float scale);
+							static basic_bounding_box<GraphicsMath> bounds(const interpreted_path_data_type& data) noexcept;
+							static interpreted_path_data_type stroke_outline(const interpreted_path_data_type& data, const basic_stroke_props<_Graphics_surfaces_type>& sp, const basic_dashes<_Graphics_surfaces_type>& d, float tolerance, float scale);
 						};
 
 
@@ -248,6 +338,8 @@ namespace std {
 								::std::shared_ptr<cairo_surface_t> imageSurface;
 								::std::shared_ptr<cairo_pattern_t> brush;
 								brush_type brushType;
+								// Solid color brushes keep only their color and have no pattern; it is set with cairo_set_source_rgba when drawing.
+								rgba_color color;
 							};
 							using brush_data_type = _Brush_data;
 
@@ -259,6 +351,8 @@ namespace std {
 							static brush_data_type create_brush(const basic_circle<GraphicsMath>& start, const basic_circle<GraphicsMath>& end, InputIterator first, InputIterator last);
 							static brush_data_type create_brush(const basic_circle<GraphicsMath>& start, const basic_circle<GraphicsMath>& end, ::std::initializer_list<gradient_stop> il);
 							static brush_data_type create_brush(basic_image_surface<_Graphics_surfaces_type>&& img);
+							static brush_data_type create_brush(const basic_image_surface<_Graphics_surfaces_type>& img);
+							static brush_data_type create_brush(const brush_data_type& surfaceBrush, const basic_bounding_box<GraphicsMath>& bb);
 							static brush_data_type copy_brush(const brush_data_type& data);
 							static brush_data_type move_brush(brush_data_type&& data) noexcept;
 							static void destroy(brush_data_type& data) noexcept;
@@ -314,6 +408,8 @@ namespace std {
 							struct _Clip_props_data {
 								optional<basic_interpreted_path<_Graphics_surfaces_type>> clip;
 								io2d::fill_rule fr;
+								// Set when the clip was made from a bounding box, so that it can be applied without its path.
+								optional<basic_bounding_box<GraphicsMath>> rect;
 							};
 
 							using clip_props_data_type = _Clip_props_data;
@@ -401,17 +497,25 @@ namespace std {
 							// image_surface
 
 							static basic_display_point<GraphicsMath> max_dimensions() noexcept;
+							static int stride_for_width(io2d::format fmt, int width) noexcept;
 
 							struct _Image_surface_data {
 								::std::unique_ptr<cairo_surface_t, decltype(&cairo_surface_destroy)> surface{ nullptr, &cairo_surface_destroy };
 								::std::unique_ptr<cairo_t, decltype(&cairo_destroy)> context{ nullptr, &cairo_destroy };
 								basic_display_point<GraphicsMath> dimensions;
 								io2d::format format;
+								// Only created while the surface's coverage_cache_limit is not 0.
+								::std::unique_ptr<_Coverage_mask_cache> coverage_cache;
+								// Created by the first draw through a clip mask.
+								::std::unique_ptr<_Clip_mask_cache> clip_masks;
+								// Set when the pixels live in memory the caller or a mapped file provides.
+								bool external_memory = false;
 							};
 
 							using image_surface_data_type = _Image_surface_data;
 
 							static image_surface_data_type create_image_surface(io2d::format fmt, int width, int height);
+							static image_surface_data_type create_image_surface(io2d::format fmt, int width, int height, ::std::byte* data, int stride, ::std::shared_ptr<void> owner);
 #if defined(_Filesystem_support_test)
 							static image_surface_data_type create_image_surface(filesystem::path p, image_file_format iff, io2d::format fmt);
 							static image_surface_data_type create_image_surface(filesystem::path p, image_file_format iff, io2d::format fmt, ::std::error_code& ec) noexcept;
@@ -419,8 +523,14 @@ namespace std {
 							static image_surface_data_type create_image_surface(::std::string p, image_file_format iff, io2d::format fmt);
 							static image_surface_data_type create_image_surface(::std::string p, image_file_format iff, io2d::format fmt, ::std::error_code& ec) noexcept;
 #endif
+							static image_surface_data_type create_image_surface(const ::std::byte* bytes, size_t size, image_file_format iff, io2d::format fmt);
+							static image_surface_data_type create_image_surface(const ::std::byte* bytes, size_t size, image_file_format iff, io2d::format fmt, ::std::error_code& ec) noexcept;
 							static image_surface_data_type move_image_surface(image_surface_data_type&& data) noexcept;
+							// Returns data that draws to the same pixels as data, for copy_surface to share until one of the surfaces is written.
+							static image_surface_data_type share_image_surface(const image_surface_data_type& data);
+							static bool uses_external_memory(const image_surface_data_type& data) noexcept;
 							static void destroy(image_surface_data_type& data) noexcept;
+							static bool is_recyclable(const image_surface_data_type& data) noexcept;
 #if defined(_Filesystem_support_test)
 							static void save(image_surface_data_type& data, filesystem::path p, image_file_format iff);
 							static void save(image_surface_data_type& data, filesystem::path p, image_file_format iff, error_code& ec) noexcept;
@@ -440,7 +550,21 @@ namespace std {
 							static void paint(image_surface_data_type& data, const basic_brush<_Graphics_surfaces_type>& b, const basic_brush_props<_Graphics_surfaces_type>& bp, const basic_render_props<_Graphics_surfaces_type>& rp, const basic_clip_props<_Graphics_surfaces_type>& cl);
 							static void stroke(image_surface_data_type& data, const basic_brush<_Graphics_surfaces_type>& b, const basic_interpreted_path<_Graphics_surfaces_type>& ip, const basic_brush_props<_Graphics_surfaces_type>& bp, const basic_stroke_props<_Graphics_surfaces_type>& sp, const basic_dashes<_Graphics_surfaces_type>& d, const basic_render_props<_Graphics_surfaces_type>& rp, const basic_clip_props<_Graphics_surfaces_type>& cl);
 							static void fill(image_surface_data_type& data, const basic_brush<_Graphics_surfaces_type>& b, const basic_interpreted_path<_Graphics_surfaces_type>& ip, const basic_brush_props<_Graphics_surfaces_type>& bp, const basic_render_props<_Graphics_surfaces_type>& rp, const basic_clip_props<_Graphics_surfaces_type>& cl);
+							static void fill_stroke(image_surface_data_type& data, const basic_brush<_Graphics_surfaces_type>& fb, const basic_brush<_Graphics_surfaces_type>& sb, const basic_interpreted_path<_Graphics_surfaces_type>& ip, const basic_brush_props<_Graphics_surfaces_type>& bp, const basic_stroke_props<_Graphics_surfaces_type>& sp, const basic_dashes<_Graphics_surfaces_type>& d, const basic_render_props<_Graphics_surfaces_type>& rp, const basic_clip_props<_Graphics_surfaces_type>& cl);
+							static void fill_instances(image_surface_data_type& data, const basic_brush<_Graphics_surfaces_type>& b, const basic_interpreted_path<_Graphics_surfaces_type>& ip, const _Fill_instance_range<GraphicsMath>& instances, const basic_brush_props<_Graphics_surfaces_type>& bp, const basic_render_props<_Graphics_surfaces_type>& rp, const basic_clip_props<_Graphics_surfaces_type>& cl);
+							static void fill_rect(image_surface_data_type& data, const basic_brush<_Graphics_surfaces_type>& b, const basic_bounding_box<GraphicsMath>& bb, const basic_brush_props<_Graphics_surfaces_type>& bp, const basic_render_props<_Graphics_surfaces_type>& rp, const basic_clip_props<_Graphics_surfaces_type>& cl);
+							static void stroke_rect(image_surface_data_type& data, const basic_brush<_Graphics_surfaces_type>& b, const basic_bounding_box<GraphicsMath>& bb, const basic_brush_props<_Graphics_surfaces_type>& bp, const basic_stroke_props<_Graphics_surfaces_type>& sp, const basic_dashes<_Graphics_surfaces_type>& d, const basic_render_props<_Graphics_surfaces_type>& rp, const basic_clip_props<_Graphics_surfaces_type>& cl);
+							static void fill_circle(image_surface_data_type& data, const basic_brush<_Graphics_surfaces_type>& b, const basic_circle<GraphicsMath>& c, const basic_brush_props<_Graphics_surfaces_type>& bp, const basic_render_props<_Graphics_surfaces_type>& rp, const basic_clip_props<_Graphics_surfaces_type>& cl);
 							static void mask(image_surface_data_type& data, const basic_brush<_Graphics_surfaces_type>& b, const basic_brush<_Graphics_surfaces_type>& mb, const basic_brush_props<_Graphics_surfaces_type>& bp, const basic_mask_props<_Graphics_surfaces_type>& mp, const basic_render_props<_Graphics_surfaces_type>& rp, const basic_clip_props<_Graphics_surfaces_type>& cl);
+							// Copies a width by height block of pixels from src to dst, which may be the same surface. The caller has checked that both surfaces
+							// have the same format and that both blocks lie inside them.
+							static void copy_region(const image_surface_data_type& src, int x, int y, int width, int height, image_surface_data_type& dst, int dstX, int dstY);
+							// The surface's own pixel memory and the distance in bytes between its rows, for basic_mapped_pixels.
+							static ::std::byte* pixels(image_surface_data_type& data) noexcept;
+							static int stride(const image_surface_data_type& data) noexcept;
+							static void coverage_cache_limit(image_surface_data_type& data, size_t bytes);
+							static size_t coverage_cache_limit(const image_surface_data_type& data) noexcept;
+							static coverage_cache_stats coverage_cache_statistics(const image_surface_data_type& data) noexcept;
 							static _Interchange_buffer _Copy_to_interchange_buffer(image_surface_data_type& data, _Interchange_buffer::pixel_layout layout, _Interchange_buffer::alpha_mode alpha);
 
 							// display surfaces
@@ -484,7 +608,15 @@ namespace std {
 							static void paint(unmanaged_output_surface_data_type& data, const basic_brush<_Graphics_surfaces_type>& b, const basic_brush_props<_Graphics_surfaces_type>& bp, const basic_render_props<_Graphics_surfaces_type>& rp, const basic_clip_props<_Graphics_surfaces_type>& cl);
 							static void stroke(unmanaged_output_surface_data_type& data, const basic_brush<_Graphics_surfaces_type>& b, const basic_interpreted_path<_Graphics_surfaces_type>& ip, const basic_brush_props<_Graphics_surfaces_type>& bp, const basic_stroke_props<_Graphics_surfaces_type>& sp, const basic_dashes<_Graphics_surfaces_type>& d, const basic_render_props<_Graphics_surfaces_type>& rp, const basic_clip_props<_Graphics_surfaces_type>& cl);
 							static void fill(unmanaged_output_surface_data_type& data, const basic_brush<_Graphics_surfaces_type>& b, const basic_interpreted_path<_Graphics_surfaces_type>& pg, const basic_brush_props<_Graphics_surfaces_type>& bp, const basic_render_props<_Graphics_surfaces_type>& rp, const basic_clip_props<_Graphics_surfaces_type>& cl);
+							static void fill_stroke(unmanaged_output_surface_data_type& data, const basic_brush<_Graphics_surfaces_type>& fb, const basic_brush<_Graphics_surfaces_type>& sb, const basic_interpreted_path<_Graphics_surfaces_type>& ip, const basic_brush_props<_Graphics_surfaces_type>& bp, const basic_stroke_props<_Graphics_surfaces_type>& sp, const basic_dashes<_Graphics_surfaces_type>& d, const basic_render_props<_Graphics_surfaces_type>& rp, const basic_clip_props<_Graphics_surfaces_type>& cl);
+							static void fill_instances(unmanaged_output_surface_data_type& data, const basic_brush<_Graphics_surfaces_type>& b, const basic_interpreted_path<_Graphics_surfaces_type>& ip, const _Fill_instance_range<GraphicsMath>& instances, const basic_brush_props<_Graphics_surfaces_type>& bp, const basic_render_props<_Graphics_surfaces_type>& rp, const basic_clip_props<_Graphics_surfaces_type>& cl);
+							static void fill_rect(unmanaged_output_surface_data_type& data, const basic_brush<_Graphics_surfaces_type>& b, const basic_bounding_box<GraphicsMath>& bb, const basic_brush_props<_Graphics_surfaces_type>& bp, const basic_render_props<_Graphics_surfaces_type>& rp, const basic_clip_props<_Graphics_surfaces_type>& cl);
+							static void stroke_rect(unmanaged_output_surface_data_type& data, const basic_brush<_Graphics_surfaces_type>& b, const basic_bounding_box<GraphicsMath>& bb, const basic_brush_props<_Graphics_surfaces_type>& bp, const basic_stroke_props<_Graphics_surfaces_type>& sp, const basic_dashes<_Graphics_surfaces_type>& d, const basic_render_props<_Graphics_surfaces_type>& rp, const basic_clip_props<_Graphics_surfaces_type>& cl);
+							static void fill_circle(unmanaged_output_surface_data_type& data, const basic_brush<_Graphics_surfaces_type>& b, const basic_circle<GraphicsMath>& c, const basic_brush_props<_Graphics_surfaces_type>& bp, const basic_render_props<_Graphics_surfaces_type>& rp, const basic_clip_props<_Graphics_surfaces_type>& cl);
 							static void mask(unmanaged_output_surface_data_type& data, const basic_brush<_Graphics_surfaces_type>& b, const basic_brush<_Graphics_surfaces_type>& mb, const basic_brush_props<_Graphics_surfaces_type>& bp, const basic_mask_props<_Graphics_surfaces_type>& mp, const basic_render_props<_Graphics_surfaces_type>& rp, const basic_clip_props<_Graphics_surfaces_type>& cl);
+							static void coverage_cache_limit(unmanaged_output_surface_data_type& data, size_t bytes);
+							static size_t coverage_cache_limit(const unmanaged_output_surface_data_type& data) noexcept;
+							static coverage_cache_stats coverage_cache_statistics(const unmanaged_output_surface_data_type& data) noexcept;
 							static void draw_callback(unmanaged_output_surface_data_type& data, function<void(basic_unmanaged_output_surface<_Graphics_surfaces_type>&)>);
 							static void size_change_callback(unmanaged_output_surface_data_type& data, function<void(basic_unmanaged_output_surface<_Graphics_surfaces_type>&)>);
 							static void user_scaling_callback(unmanaged_output_surface_data_type& data, function<basic_bounding_box<GraphicsMath>(const basic_unmanaged_output_surface<_Graphics_surfaces_type>&, bool&)>);
@@ -498,7 +630,7 @@ namespace std {
 							static io2d::format format(const unmanaged_output_surface_data_type& data) noexcept;
 							static basic_display_point<GraphicsMath> dimensions(const unmanaged_output_surface_data_type& data) noexcept;
 							static basic_display_point<GraphicsMath> display_dimensions(const unmanaged_output_surface_data_type& data) noexcept;
-							static io2d::scaling scaling(unmanaged_output_surface_data_type& data) noexcept;
+							static io2d::scaling scaling(const unmanaged_output_surface_data_type& data) noexcept;
 							static optional<basic_brush<_Graphics_surfaces_type>> letterbox_brush(const unmanaged_output_surface_data_type& data) noexcept;
 							static basic_brush_props<_Graphics_surfaces_type> letterbox_brush_props(const unmanaged_output_surface_data_type& data) noexcept;
 							static bool auto_clear(const unmanaged_output_surface_data_type& data) noexcept;
@@ -533,7 +665,15 @@ namespace std {
 							static void paint(output_surface_data_type& data, const basic_brush<_Graphics_surfaces_type>& b, const basic_brush_props<_Graphics_surfaces_type>& bp, const basic_render_props<_Graphics_surfaces_type>& rp, const basic_clip_props<_Graphics_surfaces_type>& cl);
 							static void stroke(output_surface_data_type& data, const basic_brush<_Graphics_surfaces_type>& b, const basic_interpreted_path<_Graphics_surfaces_type>& ip, const basic_brush_props<_Graphics_surfaces_type>& bp, const basic_stroke_props<_Graphics_surfaces_type>& sp, const basic_dashes<_Graphics_surfaces_type>& d, const basic_render_props<_Graphics_surfaces_type>& rp, const basic_clip_props<_Graphics_surfaces_type>& cl);
 							static void fill(output_surface_data_type& data, const basic_brush<_Graphics_surfaces_type>& b, const basic_interpreted_path<_Graphics_surfaces_type>& pg, const basic_brush_props<_Graphics_surfaces_type>& bp, const basic_render_props<_Graphics_surfaces_type>& rp, const basic_clip_props<_Graphics_surfaces_type>& cl);
+							static void fill_stroke(output_surface_data_type& data, const basic_brush<_Graphics_surfaces_type>& fb, const basic_brush<_Graphics_surfaces_type>& sb, const basic_interpreted_path<_Graphics_surfaces_type>& ip, const basic_brush_props<_Graphics_surfaces_type>& bp, const basic_stroke_props<_Graphics_surfaces_type>& sp, const basic_dashes<_Graphics_surfaces_type>& d, const basic_render_props<_Graphics_surfaces_type>& rp, const basic_clip_props<_Graphics_surfaces_type>& cl);
+							static void fill_instances(output_surface_data_type& data, const basic_brush<_Graphics_surfaces_type>& b, const basic_interpreted_path<_Graphics_surfaces_type>& ip, const _Fill_instance_range<GraphicsMath>& instances, const basic_brush_props<_Graphics_surfaces_type>& bp, const basic_render_props<_Graphics_surfaces_type>& rp, const basic_clip_props<_Graphics_surfaces_type>& cl);
+							static void fill_rect(output_surface_data_type& data, const basic_brush<_Graphics_surfaces_type>& b, const basic_bounding_box<GraphicsMath>& bb, const basic_brush_props<_Graphics_surfaces_type>& bp, const basic_render_props<_Graphics_surfaces_type>& rp, const basic_clip_props<_Graphics_surfaces_type>& cl);
+							static void stroke_rect(output_surface_data_type& data, const basic_brush<_Graphics_surfaces_type>& b, const basic_bounding_box<GraphicsMath>& bb, const basic_brush_props<_Graphics_surfaces_type>& bp, const basic_stroke_props<_Graphics_surfaces_type>& sp, const basic_dashes<_Graphics_surfaces_type>& d, const basic_render_props<_Graphics_surfaces_type>& rp, const basic_clip_props<_Graphics_surfaces_type>& cl);
+							static void fill_circle(output_surface_data_type& data, const basic_brush<_Graphics_surfaces_type>& b, const basic_circle<GraphicsMath>& c, const basic_brush_props<_Graphics_surfaces_type>& bp, const basic_render_props<_Graphics_surfaces_type>& rp, const basic_clip_props<_Graphics_surfaces_type>& cl);
 							static void mask(output_surface_data_type& data, const basic_brush<_Graphics_surfaces_type>& b, const basic_brush<_Graphics_surfaces_type>& mb, const basic_brush_props<_Graphics_surfaces_type>& bp, const basic_mask_props<_Graphics_surfaces_type>& mp, const basic_render_props<_Graphics_surfaces_type>& rp, const basic_clip_props<_Graphics_surfaces_type>& cl);
+							static void coverage_cache_limit(output_surface_data_type& data, size_t bytes);
+							static size_t coverage_cache_limit(const output_surface_data_type& data) noexcept;
+							static coverage_cache_stats coverage_cache_statistics(const output_surface_data_type& data) noexcept;
 
 							// display_surface common functions
 							static void draw_callback(output_surface_data_type& data, function<void(basic_output_surface<_Graphics_surfaces_type>&)>);
@@ -549,13 +689,12 @@ namespace std {
 							static io2d::format format(const output_surface_data_type& data) noexcept;
 							static basic_display_point<GraphicsMath> dimensions(const output_surface_data_type& data) noexcept;
 							static basic_display_point<GraphicsMath> display_dimensions(const output_surface_data_type& data) noexcept;
-							static io2d::scaling scaling(output_surface_data_type& data) noexcept;
+							static io2d::scaling scaling(const output_surface_data_type& data) noexcept;
 							static optional<basic_brush<_Graphics_surfaces_type>> letterbox_brush(const output_surface_data_type& data) noexcept;
 							static basic_brush_props<_Graphics_surfaces_type> letterbox_brush_props(const output_surface_data_type& data) noexcept;
 							static bool auto_clear(const output_surface_data_type& data) noexcept;
 							static bool redraw_required(const output_surface_data_type& data) noexcept;
 							
-							static basic_image_surface<_Graphics_surfaces_type> copy_surface(basic_image_surface<_Graphics_surfaces_type>& sfc) noexcept;
 							static basic_image_surface<_Graphics_surfaces_type> copy_surface(basic_output_surface<_Graphics_surfaces_type>& sfc) noexcept;
 							// Note: basic_unmanaged_output_surface intentionally not provided. 
 						};
@@ -23,16 +23,17 @@ namespace std::experimental::io2d {
 	inline namespace v1 {
 		namespace _Cairo {
 			template<class GraphicsMath>
-			inline typename _Cairo_graphics_surfaces<GraphicsMath>::brushes::brush_data_type _Cairo_graphics_surfaces<GraphicsMath>::brushes::create_brush(const rgba_color& c) {
+			typename _Cairo_graphics_surfaces<GraphicsMath>::brushes::brush_data_type _Cairo_graphics_surfaces<GraphicsMath>::brushes::create_brush(const rgba_color& c) {
 				brush_data_type data;
 				data.imageSurface = nullptr;
 				data.brushType = brush_type::solid_color;
-				data.brush = shared_ptr<cairo_pattern_t>(cairo_pattern_create_rgba(c.r(), c.g(), c.b(), c.a()), &cairo_pattern_destroy);
+				data.brush = nullptr;
+				data.color = c;
 				return data;
 			}
 			template<class GraphicsMath>
 			template<class InputIterator>
-			inline typename _Cairo_graphics_surfaces<GraphicsMath>::brushes::brush_data_type _Cairo_graphics_surfaces<GraphicsMath>::brushes::create_brush(const basic_point_2d<GraphicsMath>& begin, const basic_point_2d<GraphicsMath>& end, InputIterator first, InputIterator last) {
+			typename _Cairo_graphics_surfaces<GraphicsMath>::brushes::brush_data_type _Cairo_graphics_surfaces<GraphicsMath>::brushes::create_brush(const basic_point_2d<GraphicsMath>& begin, const basic_point_2d<GraphicsMath>& end, InputIterator first, InputIterator last) {
 				brush_data_type data;
 				data.brushType = brush_type::linear;
 				data.imageSurface = nullptr;
@@ -47,12 +48,12 @@ namespace std::experimental::io2d {
 				return data;
 			}
 			template<class GraphicsMath>
-			inline typename _Cairo_graphics_surfaces<GraphicsMath>::brushes::brush_data_type _Cairo_graphics_surfaces<GraphicsMath>::brushes::create_brush(const basic_point_2d<GraphicsMath>& b, const basic_point_2d<GraphicsMath>& e, ::std::initializer_list<gradient_stop> il) {
+			typename _Cairo_graphics_surfaces<GraphicsMath>::brushes::brush_data_type _Cairo_graphics_surfaces<GraphicsMath>::brushes::create_brush(const basic_point_2d<GraphicsMath>& b, const basic_point_2d<GraphicsMath>& e, ::std::initializer_list<gradient_stop> il) {
 				return create_brush(b, e, ::std::begin(il), ::std::end(il));
 			}
 			template<class GraphicsMath>
 			template<class InputIterator>
-			inline typename _Cairo_graphics_surfaces<GraphicsMath>::brushes::brush_data_type _Cairo_graphics_surfaces<GraphicsMath>::brushes::create_brush(const basic_circle<GraphicsMath>& start, const basic_circle<GraphicsMath>& end, InputIterator first, InputIterator last) {
+			typename _Cairo_graphics_surfaces<GraphicsMath>::brushes::brush_data_type _Cairo_graphics_surfaces<GraphicsMath>::brushes::create_brush(const basic_circle<GraphicsMath>& start, const basic_circle<GraphicsMath>& end, InputIterator first, InputIterator last) {
 				brush_data_type data;
 				data.imageSurface = nullptr;
 				data.brushType = brush_type::radial;
@@ -66,11 +67,11 @@ namespace std::experimental::io2d {
 				return data;
 			}
 			template<class GraphicsMath>
-			inline typename _Cairo_graphics_surfaces<GraphicsMath>::brushes::brush_data_type _Cairo_graphics_surfaces<GraphicsMath>::brushes::create_brush(const basic_circle<GraphicsMath>& s, const basic_circle<GraphicsMath>& e, ::std::initializer_list<gradient_stop> il) {
+			typename _Cairo_graphics_surfaces<GraphicsMath>::brushes::brush_data_type _Cairo_graphics_surfaces<GraphicsMath>::brushes::create_brush(const basic_circle<GraphicsMath>& s, const basic_circle<GraphicsMath>& e, ::std::initializer_list<gradient_stop> il) {
 				return create_brush(s, e, ::std::begin(il), ::std::end(il));
 			}
 			template<class GraphicsMath>
-			inline typename _Cairo_graphics_surfaces<GraphicsMath>::brushes::brush_data_type _Cairo_graphics_surfaces<GraphicsMath>::brushes::create_brush(basic_image_surface<_Graphics_surfaces_type>&& img) {
+			typename _Cairo_graphics_surfaces<GraphicsMath>::brushes::brush_data_type _Cairo_graphics_surfaces<GraphicsMath>::brushes::create_brush(basic_image_surface<_Graphics_surfaces_type>&& img) {
 				using img_sfc_data_type = typename _Cairo_graphics_surfaces<GraphicsMath>::surfaces::image_surface_data_type;
 				brush_data_type data;
 				// The surface is dying and I want to steal some of its data, ergo const_cast.
@@ -80,22 +81,48 @@ namespace std::experimental::io2d {
 				data.brushType = brush_type::surface;
 				return data;
 			}
+			// cairo surfaces are reference counted, so the brush takes its own reference and the image keeps its surface. Later drawing to the image shows
+			// through the brush.
 			template<class GraphicsMath>
-			inline typename _Cairo_graphics_surfaces<GraphicsMath>::brushes::brush_data_type _Cairo_graphics_surfaces<GraphicsMath>::brushes::copy_brush(const brush_data_type& data) {
+			typename _Cairo_graphics_surfaces<GraphicsMath>::brushes::brush_data_type _Cairo_graphics_surfaces<GraphicsMath>::brushes::create_brush(const basic_image_surface<_Graphics_surfaces_type>& img) {
+				brush_data_type data;
+				data.imageSurface = shared_ptr<cairo_surface_t>(cairo_surface_reference(img.data().surface.get()), &cairo_surface_destroy);
+				data.brush = shared_ptr<cairo_pattern_t>(cairo_pattern_create_for_surface(data.imageSurface.get()), &cairo_pattern_destroy);
+				_Throw_if_failed_cairo_status_t(cairo_pattern_status(data.brush.get()));
+				data.brushType = brush_type::surface;
+				return data;
+			}
+			// A cairo subsurface keeps a reference to its parent and samples as if it were a separate surface, so extend and filter modes behave at its edges
+			// exactly as they would for an image of that size.
+			template<class GraphicsMath>
+			typename _Cairo_graphics_surfaces<GraphicsMath>::brushes::brush_data_type _Cairo_graphics_surfaces<GraphicsMath>::brushes::create_brush(const brush_data_type& surfaceBrush, const basic_bounding_box<GraphicsMath>& bb) {
+				if (surfaceBrush.brushType != brush_type::surface) {
+					throw ::std::system_error(::std::make_error_code(::std::errc::invalid_argument));
+				}
+				brush_data_type data;
+				data.imageSurface = shared_ptr<cairo_surface_t>(cairo_surface_create_for_rectangle(surfaceBrush.imageSurface.get(), bb.x(), bb.y(), bb.width(), bb.height()), &cairo_surface_destroy);
+				_Throw_if_failed_cairo_status_t(cairo_surface_status(data.imageSurface.get()));
+				data.brush = shared_ptr<cairo_pattern_t>(cairo_pattern_create_for_surface(data.imageSurface.get()), &cairo_pattern_destroy);
+				_Throw_if_failed_cairo_status_t(cairo_pattern_status(data.brush.get()));
+				data.brushType = brush_type::surface;
+				return data;
+			}
+			template<class GraphicsMath>
+			typename _Cairo_graphics_surfaces<GraphicsMath>::brushes::brush_data_type _Cairo_graphics_surfaces<GraphicsMath>::brushes::copy_brush(const brush_data_type& data) {
 				return data;
 			}
 			template<class GraphicsMath>
-			inline typename _Cairo_graphics_surfaces<GraphicsMath>::brushes::brush_data_type _Cairo_graphics_surfaces<GraphicsMath>::brushes::move_brush(brush_data_type&& data) noexcept {
+			typename _Cairo_graphics_surfaces<GraphicsMath>::brushes::brush_data_type _Cairo_graphics_surfaces<GraphicsMath>::brushes::move_brush(brush_data_type&& data) noexcept {
 				return data;
 			}
 
 			template<class GraphicsMath>
-			inline void _Cairo_graphics_surfaces<GraphicsMath>::brushes::destroy(brush_data_type& /*data*/) noexcept {
+			void _Cairo_graphics_surfaces<GraphicsMath>::brushes::destroy(brush_data_type& /*data*/) noexcept {
 				// Do nothing; it destroys itself via the shared_ptr's.
 			}
 
 			template<class GraphicsMath>
-			inline brush_type _Cairo_graphics_surfaces<GraphicsMath>::brushes::get_brush_type(const brush_data_type& data) noexcept {
+			brush_type _Cairo_graphics_surfaces<GraphicsMath>::brushes::get_brush_type(const brush_data_type& data) noexcept {
 				return data.brushType;
 			}
 		}
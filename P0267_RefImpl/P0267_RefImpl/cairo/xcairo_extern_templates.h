@@ -0,0 +1,39 @@
+#pragma once
+
+#ifndef _XCAIRO_EXTERN_TEMPLATES_
+#define _XCAIRO_EXTERN_TEMPLATES_
+
+#include "xcairo.h"
+
+// The default cairo graphics surfaces type, and every front end class template that uses it, is explicitly instantiated once in the cairo backend library
+// (io2d_cairo_xlib, io2d_cairo_sdl2) rather than in every translation unit that includes io2d.h. Each backend's main header expands this list with 'extern template'
+// after all of its definitions (and any explicit specializations) have been declared, and its .cpp file expands it with 'template' to provide the definitions.
+// Members of the listed classes are defined without 'inline' in the *_impl.h headers, since an explicit instantiation declaration does not stop
+// inline functions from being instantiated in every translation unit that uses them. The graphics math classes (including basic_fill_instance) are
+// not listed; they are small and almost entirely constexpr, so they are instantiated where they are used regardless.
+#define _IO2D_Cairo_default_templates(_Explicit) \
+	_Explicit struct _Cairo::_Cairo_graphics_surfaces<_Graphics_math_float_impl>; \
+	_Explicit struct basic_figure_items<_Cairo::_Cairo_graphics_surfaces<_Graphics_math_float_impl>>; \
+	_Explicit class basic_path_builder<_Cairo::_Cairo_graphics_surfaces<_Graphics_math_float_impl>>; \
+	_Explicit class basic_interpreted_path<_Cairo::_Cairo_graphics_surfaces<_Graphics_math_float_impl>>; \
+	_Explicit class basic_brush<_Cairo::_Cairo_graphics_surfaces<_Graphics_math_float_impl>>; \
+	_Explicit class basic_render_props<_Cairo::_Cairo_graphics_surfaces<_Graphics_math_float_impl>>; \
+	_Explicit class basic_brush_props<_Cairo::_Cairo_graphics_surfaces<_Graphics_math_float_impl>>; \
+	_Explicit class basic_clip_props<_Cairo::_Cairo_graphics_surfaces<_Graphics_math_float_impl>>; \
+	_Explicit class basic_stroke_props<_Cairo::_Cairo_graphics_surfaces<_Graphics_math_float_impl>>; \
+	_Explicit class basic_mask_props<_Cairo::_Cairo_graphics_surfaces<_Graphics_math_float_impl>>; \
+	_Explicit class basic_dashes<_Cairo::_Cairo_graphics_surfaces<_Graphics_math_float_impl>>; \
+	_Explicit class basic_image_surface<_Cairo::_Cairo_graphics_surfaces<_Graphics_math_float_impl>>; \
+	_Explicit class basic_output_surface<_Cairo::_Cairo_graphics_surfaces<_Graphics_math_float_impl>>; \
+	_Explicit class basic_unmanaged_output_surface<_Cairo::_Cairo_graphics_surfaces<_Graphics_math_float_impl>>; \
+	_Explicit class basic_atlas_sprite<_Cairo::_Cairo_graphics_surfaces<_Graphics_math_float_impl>>; \
+	_Explicit class basic_image_atlas<_Cairo::_Cairo_graphics_surfaces<_Graphics_math_float_impl>>; \
+	_Explicit class basic_atlas_builder<_Cairo::_Cairo_graphics_surfaces<_Graphics_math_float_impl>>; \
+	_Explicit class basic_image_surface_pool<_Cairo::_Cairo_graphics_surfaces<_Graphics_math_float_impl>>; \
+	_Explicit class basic_image_surface_pool_scope<_Cairo::_Cairo_graphics_surfaces<_Graphics_math_float_impl>>; \
+	_Explicit class basic_tiled_image_surface<_Cairo::_Cairo_graphics_surfaces<_Graphics_math_float_impl>>; \
+	_Explicit class basic_banded_renderer<_Cairo::_Cairo_graphics_surfaces<_Graphics_math_float_impl>>; \
+	_Explicit class basic_image_loader<_Cairo::_Cairo_graphics_surfaces<_Graphics_math_float_impl>>; \
+	_Explicit class basic_mapped_pixels<_Cairo::_Cairo_graphics_surfaces<_Graphics_math_float_impl>>;
+
+#endif
@@ -241,6 +241,9 @@ namespace std::experimental::io2d {
 				}
 			}
 
+			// Identifies the user data holding whatever keeps the pixels of a surface made over external memory alive.
+			inline cairo_user_data_key_t _Surface_owner_key;
+
 			inline cairo_format_t _Format_to_cairo_format_t(::std::experimental::io2d::format f) {
 				switch (f) {
 				case ::std::experimental::io2d::format::invalid:
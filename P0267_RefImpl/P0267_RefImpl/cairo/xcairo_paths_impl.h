@@ -58,7 +58,11 @@ namespace std::experimental::io2d {
                 
                 template <class GraphicsMath, class T, ::std::enable_if_t<::std::is_same_v<T, typename basic_figure_items<GraphicsSurfaces>::abs_new_figure>, _Path_data_abs_new_figure> = _Path_data_abs_new_figure_val>
                 static void _Interpret(const T& item, ::std::vector<typename basic_figure_items<GraphicsSurfaces>::figure_item>& v, basic_matrix_2d<GraphicsMath>& m, basic_point_2d<GraphicsMath>& currentPoint, basic_point_2d<GraphicsMath>& closePoint, stack<basic_matrix_2d<GraphicsMath>>&) noexcept {
-                    const auto pt = item.at() * m;
+                    _Move_to(item.at() * m, v, currentPoint, closePoint);
+                }
+                // Emits a new figure at pt, which has already been transformed.
+                template <class GraphicsMath>
+                static void _Move_to(const basic_point_2d<GraphicsMath>& pt, ::std::vector<typename basic_figure_items<GraphicsSurfaces>::figure_item>& v, basic_point_2d<GraphicsMath>& currentPoint, basic_point_2d<GraphicsMath>& closePoint) noexcept {
                     v.emplace_back(::std::in_place_type<typename basic_figure_items<GraphicsSurfaces>::abs_new_figure>, pt);
                     currentPoint = pt;
                     closePoint = pt;
@@ -109,9 +113,11 @@ namespace std::experimental::io2d {
                 }
                 template <class GraphicsMath, class T, ::std::enable_if_t<::std::is_same_v<T, typename basic_figure_items<GraphicsSurfaces>::abs_cubic_curve>, _Path_data_abs_cubic_curve> = _Path_data_abs_cubic_curve_val>
                 static void _Interpret(const T& item, ::std::vector<typename basic_figure_items<GraphicsSurfaces>::figure_item>& v, basic_matrix_2d<GraphicsMath>& m, basic_point_2d<GraphicsMath>& currentPoint, basic_point_2d<GraphicsMath>&, stack<basic_matrix_2d<GraphicsMath>>&) noexcept {
-                    const auto pt1 = item.control_pt1() * m;
-                    const auto pt2 = item.control_pt2() * m;
-                    const auto pt3 = item.end_pt() * m;
+                    basic_point_2d<GraphicsMath> pts[3] = { item.control_pt1(), item.control_pt2(), item.end_pt() };
+                    m.transform_pts(pts, pts + 3, pts);
+                    const auto& pt1 = pts[0];
+                    const auto& pt2 = pts[1];
+                    const auto& pt3 = pts[2];
                     if (currentPoint == pt1&& pt1 == pt2&& pt2 == pt3) {
                         return; // degenerate path segment
                     }
@@ -120,8 +126,12 @@ namespace std::experimental::io2d {
                     currentPoint = pt3;
                 }
                 template <class GraphicsMath, class T, ::std::enable_if_t<::std::is_same_v<T, typename basic_figure_items<GraphicsSurfaces>::abs_line>, _Path_data_abs_line> = _Path_data_abs_line_val>
-                static void _Interpret(const T& item, ::std::vector<typename basic_figure_items<GraphicsSurfaces>::figure_item>& v, basic_matrix_2d<GraphicsMath>& m, basic_point_2d<GraphicsMath>& currentPoint, basic_point_2d<GraphicsMath>&, stack<basic_matrix_2d<GraphicsMath>>&) noexcept {
-                    const auto pt = item.to() * m;
+                static void _Interpret(const T& item, ::std::vector<typename basic_figure_items<GraphicsSurfaces>::figure_item>& v, basic_matrix_2d<GraphicsMath>& m, basic_point_2d<GraphicsMath>& currentPoint, basic_point_2d<GraphicsMath>& closePoint, stack<basic_matrix_2d<GraphicsMath>>&) noexcept {
+                    _Line_to(item.to() * m, v, currentPoint, closePoint);
+                }
+                // Emits a line to pt, which has already been transformed, unless it is degenerate.
+                template <class GraphicsMath>
+                static void _Line_to(const basic_point_2d<GraphicsMath>& pt, ::std::vector<typename basic_figure_items<GraphicsSurfaces>::figure_item>& v, basic_point_2d<GraphicsMath>& currentPoint, basic_point_2d<GraphicsMath>&) noexcept {
                     if (currentPoint == pt) {
                         return; // degenerate path segment
                     }
@@ -131,8 +141,10 @@ namespace std::experimental::io2d {
                 template <class GraphicsMath, class T, ::std::enable_if_t<::std::is_same_v<T, typename basic_figure_items<GraphicsSurfaces>::abs_quadratic_curve>, _Path_data_abs_quadratic_curve> = _Path_data_abs_quadratic_curve_val>
                 static void _Interpret(const T& item, ::std::vector<typename basic_figure_items<GraphicsSurfaces>::figure_item>& v, basic_matrix_2d<GraphicsMath>& m, basic_point_2d<GraphicsMath>& currentPoint, basic_point_2d<GraphicsMath>&, stack<basic_matrix_2d<GraphicsMath>>&) noexcept {
                     // Turn it into a cubic curve since cairo doesn't have quadratic curves.
-                    const auto controlPt = item.control_pt() * m;
-                    const auto endPt = item.end_pt() * m;
+                    basic_point_2d<GraphicsMath> pts[2] = { item.control_pt(), item.end_pt() };
+                    m.transform_pts(pts, pts + 2, pts);
+                    const auto& controlPt = pts[0];
+                    const auto& endPt = pts[1];
                     if (currentPoint == controlPt&& controlPt == endPt) {
                         return; // degenerate path segment
                     }
@@ -231,24 +243,18 @@ namespace std::experimental::io2d {
                     auto adjustVal = calcAdjustedCurrPt - currentPoint;
                     basic_point_2d<GraphicsMath> tempCurrPt;
                     for (; bezCount > 0; bezCount--) {
-                        const auto rapt0 = m.transform_pt(rotCntrCwFn(pt0, currTheta));
-                        const auto rapt1 = m.transform_pt(rotCntrCwFn(pt1, currTheta));
-                        const auto rapt2 = m.transform_pt(rotCntrCwFn(pt2, currTheta));
-                        const auto rapt3 = m.transform_pt(rotCntrCwFn(pt3, currTheta));
-                        auto cpt0 = ctr + rapt0;
-                        auto cpt1 = ctr + rapt1;
-                        auto cpt2 = ctr + rapt2;
-                        auto cpt3 = ctr + rapt3;
-                        cpt0 = origM.transform_pt(cpt0);
-                        cpt1 = origM.transform_pt(cpt1);
-                        cpt2 = origM.transform_pt(cpt2);
-                        cpt3 = origM.transform_pt(cpt3);
-                        cpt0 -= adjustVal;
-                        cpt1 -= adjustVal;
-                        cpt2 -= adjustVal;
-                        cpt3 -= adjustVal;
-                        currentPoint = cpt3;
-                        v.emplace_back(::std::in_place_type<typename basic_figure_items<GraphicsSurfaces>::abs_cubic_curve>, cpt1, cpt2, cpt3);
+                        // The start point of each segment is the end point of the previous one so only the control points and end point are needed.
+                        basic_point_2d<GraphicsMath> cpts[3] = { rotCntrCwFn(pt1, currTheta), rotCntrCwFn(pt2, currTheta), rotCntrCwFn(pt3, currTheta) };
+                        m.transform_pts(cpts, cpts + 3, cpts);
+                        for (auto& cpt : cpts) {
+                            cpt = ctr + cpt;
+                        }
+                        origM.transform_pts(cpts, cpts + 3, cpts);
+                        for (auto& cpt : cpts) {
+                            cpt -= adjustVal;
+                        }
+                        currentPoint = cpts[2];
+                        v.emplace_back(::std::in_place_type<typename basic_figure_items<GraphicsSurfaces>::abs_cubic_curve>, cpts[0], cpts[1], cpts[2]);
                         currTheta -= theta;
                     }
                     m = origM;
@@ -258,9 +264,11 @@ namespace std::experimental::io2d {
                 static void _Interpret(const T& item, ::std::vector<typename basic_figure_items<GraphicsSurfaces>::figure_item>& v, basic_matrix_2d<GraphicsMath>& m, basic_point_2d<GraphicsMath>& currentPoint, basic_point_2d<GraphicsMath>&, stack<basic_matrix_2d<GraphicsMath>>&) noexcept {
                     auto amtx = m;
                     amtx.m20(0.0F); amtx.m21(0.0F); // obliterate translation since this is relative.
-                    const auto pt1 = item.control_pt1() * amtx;
-                    const auto pt2 = item.control_pt2() * amtx;
-                    const auto pt3 = item.end_pt()* amtx;
+                    basic_point_2d<GraphicsMath> pts[3] = { item.control_pt1(), item.control_pt2(), item.end_pt() };
+                    amtx.transform_pts(pts, pts + 3, pts);
+                    const auto& pt1 = pts[0];
+                    const auto& pt2 = pts[1];
+                    const auto& pt3 = pts[2];
                     if (currentPoint == pt1 && pt1 == pt2 && pt2 == pt3) {
                         return; // degenerate path segment
                     }
@@ -284,8 +292,10 @@ namespace std::experimental::io2d {
                 static void _Interpret(const T& item, ::std::vector<typename basic_figure_items<GraphicsSurfaces>::figure_item>& v, basic_matrix_2d<GraphicsMath>& m, basic_point_2d<GraphicsMath>& currentPoint, basic_point_2d<GraphicsMath>&, stack<basic_matrix_2d<GraphicsMath>>&) noexcept {
                     auto amtx = m;
                     amtx.m20(0.0F); amtx.m21(0.0F); // obliterate translation since this is relative.
-                    const auto controlPt = currentPoint + item.control_pt() * amtx;
-                    const auto endPt = currentPoint + item.control_pt() * amtx + item.end_pt() * amtx;
+                    basic_point_2d<GraphicsMath> pts[2] = { item.control_pt(), item.end_pt() };
+                    amtx.transform_pts(pts, pts + 2, pts);
+                    const auto controlPt = currentPoint + pts[0];
+                    const auto endPt = currentPoint + pts[0] + pts[1];
                     const auto beginPt = currentPoint;
                     if (currentPoint == controlPt&& controlPt == endPt) {
                         return; // degenerate path segment
@@ -298,27 +308,60 @@ namespace std::experimental::io2d {
             };
             
             template <class GraphicsSurfaces, class ForwardIterator>
-            inline ::std::vector<typename basic_figure_items<GraphicsSurfaces>::figure_item> _Interpret_path_items(ForwardIterator first, ForwardIterator last);
+            ::std::vector<typename basic_figure_items<GraphicsSurfaces>::figure_item> _Interpret_path_items(ForwardIterator first, ForwardIterator last);
             
             template <class GraphicsSurfaces, class Allocator>
-            inline ::std::vector<typename basic_figure_items<GraphicsSurfaces>::figure_item> _Interpret_path_items(const basic_path_builder<GraphicsSurfaces, Allocator>& pf) {
+            ::std::vector<typename basic_figure_items<GraphicsSurfaces>::figure_item> _Interpret_path_items(const basic_path_builder<GraphicsSurfaces, Allocator>& pf) {
                 return _Interpret_path_items<GraphicsSurfaces>(begin(pf), end(pf));
             }
             
             template <class GraphicsSurfaces, class ForwardIterator>
-            inline ::std::vector<typename basic_figure_items<GraphicsSurfaces>::figure_item> _Interpret_path_items(ForwardIterator first, ForwardIterator last) {
+            ::std::vector<typename basic_figure_items<GraphicsSurfaces>::figure_item> _Interpret_path_items(ForwardIterator first, ForwardIterator last) {
                 using graphics_math_type = typename GraphicsSurfaces::graphics_math_type;
                 basic_matrix_2d<graphics_math_type> m;
                 basic_point_2d<graphics_math_type> currentPoint; // Tracks the untransformed current point.
                 basic_point_2d<graphics_math_type> closePoint;   // Tracks the transformed close point.
                 ::std::stack<basic_matrix_2d<graphics_math_type>> matrices;
                 ::std::vector<typename basic_figure_items<GraphicsSurfaces>::figure_item> v;
+                using abs_new_figure = typename basic_figure_items<GraphicsSurfaces>::abs_new_figure;
+                using abs_line = typename basic_figure_items<GraphicsSurfaces>::abs_line;
+                const basic_matrix_2d<graphics_math_type> identity;
+                ::std::vector<basic_point_2d<graphics_math_type>> run;
                 
-                for (auto val = first; val != last; val++) {
+                for (auto val = first; val != last;) {
+                    // A run of abs_new_figure and abs_line items is transformed with one transform_pts call, or not at all under the identity matrix.
+                    if (holds_alternative<abs_new_figure>(*val) || holds_alternative<abs_line>(*val)) {
+                        run.clear();
+                        auto runEnd = val;
+                        for (; runEnd != last; ++runEnd) {
+                            if (const auto nf = get_if<abs_new_figure>(&*runEnd)) {
+                                run.push_back(nf->at());
+                            }
+                            else if (const auto ln = get_if<abs_line>(&*runEnd)) {
+                                run.push_back(ln->to());
+                            }
+                            else {
+                                break;
+                            }
+                        }
+                        if (m != identity) {
+                            m.transform_pts(run.data(), run.data() + run.size(), run.data());
+                        }
+                        for (size_t i = 0; val != runEnd; ++val, ++i) {
+                            if (holds_alternative<abs_new_figure>(*val)) {
+                                _Path_item_interpret_visitor<GraphicsSurfaces, abs_new_figure>::_Move_to(run[i], v, currentPoint, closePoint);
+                            }
+                            else {
+                                _Path_item_interpret_visitor<GraphicsSurfaces, abs_line>::_Line_to(run[i], v, currentPoint, closePoint);
+                            }
+                        }
+                        continue;
+                    }
                     ::std::visit([&m, &currentPoint, &closePoint, &matrices, &v](auto&& item) {
                         using T = ::std::remove_cv_t<::std::remove_reference_t<decltype(item)>>;
                         _Path_item_interpret_visitor<GraphicsSurfaces, T>::template _Interpret<typename GraphicsSurfaces::graphics_math_type, T>(item, v, m, currentPoint, closePoint, matrices);
                     }, *val);
+                    ++val;
                 }
                 return v;
             }
@@ -419,26 +462,112 @@ namespace std::experimental::io2d {
 				}
 			};
 
+			// Returns the tight bounding box of a cairo path. Curves contribute their end points and the points where they reach an extreme in x or y,
+			// not their control points.
+			template <class GraphicsMath>
+			basic_bounding_box<GraphicsMath> _Cairo_path_bounds(const cairo_path_t* path) noexcept {
+				if (path == nullptr || path->num_data == 0) {
+					return basic_bounding_box<GraphicsMath>{};
+				}
+				double minX = numeric_limits<double>::infinity();
+				double minY = numeric_limits<double>::infinity();
+				double maxX = -numeric_limits<double>::infinity();
+				double maxY = -numeric_limits<double>::infinity();
+				auto addPoint = [&](double x, double y) noexcept {
+					minX = ::std::min(minX, x);
+					minY = ::std::min(minY, y);
+					maxX = ::std::max(maxX, x);
+					maxY = ::std::max(maxY, y);
+				};
+				// Finds the parameters in (0, 1) where one coordinate of a cubic curve has a zero derivative.
+				auto cubicExtrema = [](double p0, double p1, double p2, double p3, double(&t)[2]) noexcept -> int {
+					const double a = -p0 + 3.0 * p1 - 3.0 * p2 + p3;
+					const double b = 2.0 * (p0 - 2.0 * p1 + p2);
+					const double c = p1 - p0;
+					double roots[2];
+					int rootCount = 0;
+					if (abs(a) < 1e-12) {
+						if (abs(b) > 1e-12) {
+							roots[rootCount++] = -c / b;
+						}
+					}
+					else {
+						const double disc = b * b - 4.0 * a * c;
+						if (disc >= 0.0) {
+							const double sqrtDisc = sqrt(disc);
+							roots[rootCount++] = (-b + sqrtDisc) / (2.0 * a);
+							roots[rootCount++] = (-b - sqrtDisc) / (2.0 * a);
+						}
+					}
+					int count = 0;
+					for (int i = 0; i < rootCount; ++i) {
+						if (roots[i] > 0.0 && roots[i] < 1.0) {
+							t[count++] = roots[i];
+						}
+					}
+					return count;
+				};
+				double currX = 0.0;
+				double currY = 0.0;
+				for (int i = 0; i < path->num_data; i += path->data[i].header.length) {
+					const auto* item = &path->data[i];
+					switch (item->header.type) {
+					case CAIRO_PATH_MOVE_TO:
+					case CAIRO_PATH_LINE_TO:
+						currX = item[1].point.x;
+						currY = item[1].point.y;
+						addPoint(currX, currY);
+						break;
+					case CAIRO_PATH_CURVE_TO:
+					{
+						const double xs[4] = { currX, item[1].point.x, item[2].point.x, item[3].point.x };
+						const double ys[4] = { currY, item[1].point.y, item[2].point.y, item[3].point.y };
+						auto addCurvePoint = [&](double t) noexcept {
+							const double mt = 1.0 - t;
+							const double a = mt * mt * mt, b = 3.0 * mt * mt * t, c = 3.0 * mt * t * t, d = t * t * t;
+							addPoint(a * xs[0] + b * xs[1] + c * xs[2] + d * xs[3], a * ys[0] + b * ys[1] + c * ys[2] + d * ys[3]);
+						};
+						double t[2];
+						for (int n = cubicExtrema(xs[0], xs[1], xs[2], xs[3], t), j = 0; j < n; ++j) {
+							addCurvePoint(t[j]);
+						}
+						for (int n = cubicExtrema(ys[0], ys[1], ys[2], ys[3], t), j = 0; j < n; ++j) {
+							addCurvePoint(t[j]);
+						}
+						currX = xs[3];
+						currY = ys[3];
+						addPoint(currX, currY);
+					} break;
+					case CAIRO_PATH_CLOSE_PATH:
+						break;
+					}
+				}
+				if (minX > maxX) {
+					return basic_bounding_box<GraphicsMath>{};
+				}
+				return basic_bounding_box<GraphicsMath>(static_cast<float>(minX), static_cast<float>(minY), static_cast<float>(maxX - minX), static_cast<float>(maxY - minY));
+			}
+
 			template<class GraphicsMath>
-			inline typename _Cairo_graphics_surfaces<GraphicsMath>::paths::interpreted_path_data_type _Cairo_graphics_surfaces<GraphicsMath>::paths::create_interpreted_path() noexcept {
+			typename _Cairo_graphics_surfaces<GraphicsMath>::paths::interpreted_path_data_type _Cairo_graphics_surfaces<GraphicsMath>::paths::create_interpreted_path() noexcept {
 				interpreted_path_data_type result;
 				result.path = nullptr;
 				return result;
 			}
 			template <class GraphicsMath>
-			inline typename _Cairo_graphics_surfaces<GraphicsMath>::paths::interpreted_path_data_type _Cairo_graphics_surfaces<GraphicsMath>::paths::create_interpreted_path(const basic_bounding_box<GraphicsMath>& bb) {
+			typename _Cairo_graphics_surfaces<GraphicsMath>::paths::interpreted_path_data_type _Cairo_graphics_surfaces<GraphicsMath>::paths::create_interpreted_path(const basic_bounding_box<GraphicsMath>& bb) {
 				using figureItem = typename basic_figure_items<graphics_surfaces_type>::figure_item;
 				//auto bbPath =
 				return create_interpreted_path({ figureItem(in_place_type<typename basic_figure_items<graphics_surfaces_type>::abs_new_figure>, bb.top_left()), figureItem(in_place_type<typename basic_figure_items<graphics_surfaces_type>::rel_line>, basic_point_2d<GraphicsMath>(bb.width(), 0.0f)), figureItem(in_place_type<typename basic_figure_items<graphics_surfaces_type>::rel_line>, basic_point_2d<GraphicsMath>(0.0f, bb.height())), figureItem(in_place_type<typename basic_figure_items<graphics_surfaces_type>::rel_line>, basic_point_2d<GraphicsMath>(-bb.width(), 0.0f)), figureItem(in_place_type<typename basic_figure_items<graphics_surfaces_type>::close_figure>) });
 				//return create_interpreted_path(begin(bbPath), end(bbPath));
 			}
 			template <class GraphicsMath>
-			inline typename _Cairo_graphics_surfaces<GraphicsMath>::paths::interpreted_path_data_type _Cairo_graphics_surfaces<GraphicsMath>::paths::create_interpreted_path(initializer_list<typename basic_figure_items<graphics_surfaces_type>::figure_item> il) {
+			typename _Cairo_graphics_surfaces<GraphicsMath>::paths::interpreted_path_data_type _Cairo_graphics_surfaces<GraphicsMath>::paths::create_interpreted_path(initializer_list<typename basic_figure_items<graphics_surfaces_type>::figure_item> il) {
 				return create_interpreted_path(begin(il), end(il));
 			}
 			template<class GraphicsMath>
 			template<class ForwardIterator>
-			inline typename _Cairo_graphics_surfaces<GraphicsMath>::paths::interpreted_path_data_type _Cairo_graphics_surfaces<GraphicsMath>::paths::create_interpreted_path(ForwardIterator first, ForwardIterator last) {
+			typename _Cairo_graphics_surfaces<GraphicsMath>::paths::interpreted_path_data_type _Cairo_graphics_surfaces<GraphicsMath>::paths::create_interpreted_path(ForwardIterator first, ForwardIterator last) {
 				interpreted_path_data_type result;
 				auto cairoPathT = new cairo_path_t;
 				if (cairoPathT == nullptr) {
@@ -475,217 +604,425 @@ namespace std::experimental::io2d {
 					result.path->data[currItemIndex] = vec[currItemIndex];
 				}
 				result.path->status = CAIRO_STATUS_SUCCESS;
+				result.bounds = _Cairo_path_bounds<GraphicsMath>(result.path.get());
 				return result;
 			}
+			// The segments of a basic_static_path have already been resolved so they are copied directly into the cairo_path_t, producing the same data as interpreting the equivalent figure items would.
 			template<class GraphicsMath>
-			inline typename _Cairo_graphics_surfaces<GraphicsMath>::paths::interpreted_path_data_type _Cairo_graphics_surfaces<GraphicsMath>::paths::copy_interpreted_path(const interpreted_path_data_type& data) {
+			template<size_t Capacity>
+			inline typename _Cairo_graphics_surfaces<GraphicsMath>::paths::interpreted_path_data_type _Cairo_graphics_surfaces<GraphicsMath>::paths::create_interpreted_path(const basic_static_path<graphics_math_type, Capacity>& sp) {
+				using segment_type = typename basic_static_path<graphics_math_type, Capacity>::segment_type;
+				interpreted_path_data_type result;
+				auto cairoPathT = new cairo_path_t;
+				if (cairoPathT == nullptr) {
+					throw bad_alloc();
+				}
+				result.path = shared_ptr<cairo_path_t>(cairoPathT, [](cairo_path_t* path) {
+					if (path != nullptr) {
+						if (path->data != nullptr) {
+							delete[] path->data;
+							path->data = nullptr;
+							path->status = CAIRO_STATUS_NULL_POINTER;
+						}
+						delete path;
+						path = nullptr;
+					}
+				});
+
+				auto last = sp.end();
+				while (last != sp.begin() && (last - 1)->type == segment_type::new_figure) {
+					--last; // remove trailing new_figures
+				}
+				int numData = 0;
+				for (auto seg = sp.begin(); seg != last; ++seg) {
+					switch (seg->type) {
+					case segment_type::new_figure:
+					case segment_type::line:
+						numData += 2;
+						break;
+					case segment_type::cubic_curve:
+						numData += 4;
+						break;
+					case segment_type::close_figure:
+						numData += 3;
+						break;
+					}
+				}
+				result.path->num_data = numData;
+				result.path->data = new cairo_path_data_t[static_cast<size_t>(numData)];
+				auto data = result.path->data;
+				auto addHeader = [&data](cairo_path_data_type_t type, int length) {
+					*data = {};
+					data->header.type = type;
+					data->header.length = length;
+					++data;
+				};
+				auto addPoint = [&data](const basic_point_2d<GraphicsMath>& pt) {
+					*data = {};
+					data->point = { pt.x(), pt.y() };
+					++data;
+				};
+				basic_point_2d<GraphicsMath> lastMoveToPoint;
+				for (auto seg = sp.begin(); seg != last; ++seg) {
+					switch (seg->type) {
+					case segment_type::new_figure:
+						addHeader(CAIRO_PATH_MOVE_TO, 2);
+						addPoint(seg->pts[0]);
+						lastMoveToPoint = seg->pts[0];
+						break;
+					case segment_type::line:
+						addHeader(CAIRO_PATH_LINE_TO, 2);
+						addPoint(seg->pts[0]);
+						break;
+					case segment_type::cubic_curve:
+						addHeader(CAIRO_PATH_CURVE_TO, 4);
+						addPoint(seg->pts[0]);
+						addPoint(seg->pts[1]);
+						addPoint(seg->pts[2]);
+						break;
+					case segment_type::close_figure:
+						addHeader(CAIRO_PATH_CLOSE_PATH, 1);
+						addHeader(CAIRO_PATH_MOVE_TO, 2);
+						addPoint(lastMoveToPoint);
+						break;
+					}
+				}
+				result.path->status = CAIRO_STATUS_SUCCESS;
+				result.bounds = _Cairo_path_bounds<GraphicsMath>(result.path.get());
+				return result;
+			}
+			template<class GraphicsMath>
+			typename _Cairo_graphics_surfaces<GraphicsMath>::paths::interpreted_path_data_type _Cairo_graphics_surfaces<GraphicsMath>::paths::copy_interpreted_path(const interpreted_path_data_type& data) {
 				return data;
 			}
 			template<class GraphicsMath>
-			inline typename _Cairo_graphics_surfaces<GraphicsMath>::paths::interpreted_path_data_type _Cairo_graphics_surfaces<GraphicsMath>::paths::move_interpreted_path(interpreted_path_data_type&& data) noexcept {
+			typename _Cairo_graphics_surfaces<GraphicsMath>::paths::interpreted_path_data_type _Cairo_graphics_surfaces<GraphicsMath>::paths::move_interpreted_path(interpreted_path_data_type&& data) noexcept {
 				return data;
 			}
 
 			template<class GraphicsMath>
-			inline void _Cairo_graphics_surfaces<GraphicsMath>::paths::destroy(interpreted_path_data_type& /*data*/) noexcept {
+			void _Cairo_graphics_surfaces<GraphicsMath>::paths::destroy(interpreted_path_data_type& /*data*/) noexcept {
 				// Do nothing, the shared_ptr deletes for us.
 			}
+			// cairo flattens curves adaptively to the tolerance of a context, measured in device units, so the path is appended to a scratch context scaled by scale
+			// and read back with cairo_copy_path_flat, which returns the line segments in user space.
+			template<class GraphicsMath>
+			typename _Cairo_graphics_surfaces<GraphicsMath>::paths::interpreted_path_data_type _Cairo_graphics_surfaces<GraphicsMath>::paths::flatten(const interpreted_path_data_type& data, float tolerance, float scale) {
+				if (data.path == nullptr || data.path->num_data == 0) {
+					return data;
+				}
+				auto cache = data.flattened.get();
+				interpreted_path_data_type result;
+				// The vertices of the flattened path lie on the original curves, so its bounds are within those of the original.
+				result.bounds = data.bounds;
+				result.path = cache->get(tolerance, scale, [&data, tolerance, scale]() {
+					unique_ptr<cairo_surface_t, decltype(&cairo_surface_destroy)> sfc(cairo_image_surface_create(CAIRO_FORMAT_A8, 1, 1), &cairo_surface_destroy);
+					unique_ptr<cairo_t, decltype(&cairo_destroy)> ctx(cairo_create(sfc.get()), &cairo_destroy);
+					_Throw_if_failed_cairo_status_t(cairo_status(ctx.get()));
+					if (scale > 0.0F) {
+						cairo_scale(ctx.get(), scale, scale);
+					}
+					cairo_set_tolerance(ctx.get(), tolerance);
+					cairo_append_path(ctx.get(), data.path.get());
+					auto flatPath = shared_ptr<cairo_path_t>(cairo_copy_path_flat(ctx.get()), &cairo_path_destroy);
+					_Throw_if_failed_cairo_status_t(flatPath->status);
+					return flatPath;
+				});
+				return result;
+			}
+			template<class GraphicsMath>
+			basic_bounding_box<GraphicsMath> _Cairo_graphics_surfaces<GraphicsMath>::paths::bounds(const interpreted_path_data_type& data) noexcept {
+				return data.bounds;
+			}
+			// The path is flattened for the target scale (reusing the flatten cache) and the resulting figures are outlined by _Stroke_outliner in user space, where
+			// the pen is round, so the outline is transformed along with the path exactly as cairo's stroker would transform the pen.
+			template<class GraphicsMath>
+			typename _Cairo_graphics_surfaces<GraphicsMath>::paths::interpreted_path_data_type _Cairo_graphics_surfaces<GraphicsMath>::paths::stroke_outline(const interpreted_path_data_type& data, const basic_stroke_props<_Graphics_surfaces_type>& sp, const basic_dashes<_Graphics_surfaces_type>& d, float tolerance, float scale) {
+				if (data.path == nullptr || data.path->num_data == 0) {
+					return create_interpreted_path();
+				}
+				const auto flat = flatten(data, tolerance, scale);
+				_Stroke_outliner<GraphicsMath> outliner(sp.line_width(), sp.line_cap(), sp.line_join(), ::std::min(sp.miter_limit(), sp.max_miter_limit()), (scale > 0.0F) ? tolerance / scale : tolerance);
+				const auto& pattern = d.data().pattern;
+				const float offset = d.data().offset;
+				_Stroke_polyline<GraphicsMath> pl;
+				auto addFigure = [&outliner, &pl, &pattern, offset]() {
+					// A figure that is only a new_figure draws nothing; one that is closed or has a segment, even one of zero length, is stroked.
+					if (pl.pts.size() > 1 || pl.closed) {
+						outliner.add(pl, pattern, offset);
+					}
+					pl.pts.clear();
+					pl.closed = false;
+				};
+				const cairo_path_t* path = flat.path.get();
+				for (int i = 0; i < path->num_data; i += path->data[i].header.length) {
+					const auto& pathData = path->data[i];
+					switch (pathData.header.type) {
+					case CAIRO_PATH_MOVE_TO:
+					{
+						addFigure();
+						pl.pts.emplace_back(static_cast<float>(path->data[i + 1].point.x), static_cast<float>(path->data[i + 1].point.y));
+					} break;
+					case CAIRO_PATH_LINE_TO:
+					{
+						pl.pts.emplace_back(static_cast<float>(path->data[i + 1].point.x), static_cast<float>(path->data[i + 1].point.y));
+					} break;
+					case CAIRO_PATH_CLOSE_PATH:
+					{
+						pl.closed = true;
+						addFigure();
+					} break;
+					default:
+					{
+						assert("Unexpected cairo_path_data_type_t in a flattened path." && false);
+					} break;
+					}
+				}
+				addFigure();
+
+				interpreted_path_data_type result;
+				auto cairoPathT = new cairo_path_t;
+				if (cairoPathT == nullptr) {
+					throw bad_alloc();
+				}
+				result.path = shared_ptr<cairo_path_t>(cairoPathT, [](cairo_path_t* path) {
+					if (path != nullptr) {
+						if (path->data != nullptr) {
+							delete[] path->data;
+							path->data = nullptr;
+							path->status = CAIRO_STATUS_NULL_POINTER;
+						}
+						delete path;
+						path = nullptr;
+					}
+				});
+				::std::vector<cairo_path_data_t> vec;
+				auto addHeader = [&vec](cairo_path_data_type_t type, int length) {
+					cairo_path_data_t pd;
+					pd.header.type = type;
+					pd.header.length = length;
+					vec.push_back(pd);
+				};
+				auto addPoint = [&vec](const basic_point_2d<GraphicsMath>& pt) {
+					cairo_path_data_t pd;
+					pd.point.x = pt.x();
+					pd.point.y = pt.y();
+					vec.push_back(pd);
+				};
+				for (const auto& poly : outliner.polygons()) {
+					addHeader(CAIRO_PATH_MOVE_TO, 2);
+					addPoint(poly.front());
+					for (size_t i = 1; i < poly.size(); ++i) {
+						addHeader(CAIRO_PATH_LINE_TO, 2);
+						addPoint(poly[i]);
+					}
+					addHeader(CAIRO_PATH_CLOSE_PATH, 1);
+					addHeader(CAIRO_PATH_MOVE_TO, 2);
+					addPoint(poly.front());
+				}
+				result.path->num_data = static_cast<int>(vec.size());
+				result.path->data = new cairo_path_data_t[vec.size()];
+				::std::copy(vec.begin(), vec.end(), result.path->data);
+				result.path->status = CAIRO_STATUS_SUCCESS;
+				result.bounds = _Cairo_path_bounds<GraphicsMath>(result.path.get());
+				return result;
+			}
 
 			template<class GraphicsMath>
-			inline typename _Cairo_graphics_surfaces<GraphicsMath>::paths::abs_new_figure_data_type _Cairo_graphics_surfaces<GraphicsMath>::paths::create_abs_new_figure() {
+			typename _Cairo_graphics_surfaces<GraphicsMath>::paths::abs_new_figure_data_type _Cairo_graphics_surfaces<GraphicsMath>::paths::create_abs_new_figure() {
 				return abs_new_figure_data_type();
 			}
 
 			template<class GraphicsMath>
-			inline typename _Cairo_graphics_surfaces<GraphicsMath>::paths::abs_new_figure_data_type _Cairo_graphics_surfaces<GraphicsMath>::paths::create_abs_new_figure(const basic_point_2d<GraphicsMath>& pt) {
+			typename _Cairo_graphics_surfaces<GraphicsMath>::paths::abs_new_figure_data_type _Cairo_graphics_surfaces<GraphicsMath>::paths::create_abs_new_figure(const basic_point_2d<GraphicsMath>& pt) {
 				abs_new_figure_data_type result;
 				result.pt = pt;
 				return result;
 			}
 
 			template<class GraphicsMath>
-			inline typename _Cairo_graphics_surfaces<GraphicsMath>::paths::abs_new_figure_data_type _Cairo_graphics_surfaces<GraphicsMath>::paths::copy_abs_new_figure(const abs_new_figure_data_type& data) {
+			typename _Cairo_graphics_surfaces<GraphicsMath>::paths::abs_new_figure_data_type _Cairo_graphics_surfaces<GraphicsMath>::paths::copy_abs_new_figure(const abs_new_figure_data_type& data) {
 				return data;
 			}
 
 			template<class GraphicsMath>
-			inline typename _Cairo_graphics_surfaces<GraphicsMath>::paths::abs_new_figure_data_type _Cairo_graphics_surfaces<GraphicsMath>::paths::move_abs_new_figure(abs_new_figure_data_type&& data) noexcept {
+			typename _Cairo_graphics_surfaces<GraphicsMath>::paths::abs_new_figure_data_type _Cairo_graphics_surfaces<GraphicsMath>::paths::move_abs_new_figure(abs_new_figure_data_type&& data) noexcept {
 				return data;
 			}
 
 			template<class GraphicsMath>
-			inline void _Cairo_graphics_surfaces<GraphicsMath>::paths::destroy(abs_new_figure_data_type& /*data*/) noexcept {
+			void _Cairo_graphics_surfaces<GraphicsMath>::paths::destroy(abs_new_figure_data_type& /*data*/) noexcept {
 				// Do nothing.
 			}
 
 			template<class GraphicsMath>
-			inline void _Cairo_graphics_surfaces<GraphicsMath>::paths::at(abs_new_figure_data_type& data, const basic_point_2d<GraphicsMath>& pt) {
+			void _Cairo_graphics_surfaces<GraphicsMath>::paths::at(abs_new_figure_data_type& data, const basic_point_2d<GraphicsMath>& pt) {
 				data.pt = pt;
 			}
 
 			template<class GraphicsMath>
-			inline basic_point_2d<GraphicsMath> _Cairo_graphics_surfaces<GraphicsMath>::paths::at(const abs_new_figure_data_type& data) noexcept {
+			basic_point_2d<GraphicsMath> _Cairo_graphics_surfaces<GraphicsMath>::paths::at(const abs_new_figure_data_type& data) noexcept {
 				return data.pt;
 			}
 
 			template<class GraphicsMath>
-			inline typename _Cairo_graphics_surfaces<GraphicsMath>::paths::rel_new_figure_data_type _Cairo_graphics_surfaces<GraphicsMath>::paths::create_rel_new_figure() {
+			typename _Cairo_graphics_surfaces<GraphicsMath>::paths::rel_new_figure_data_type _Cairo_graphics_surfaces<GraphicsMath>::paths::create_rel_new_figure() {
 				return rel_new_figure_data_type();
 			}
 
 			template<class GraphicsMath>
-			inline typename _Cairo_graphics_surfaces<GraphicsMath>::paths::rel_new_figure_data_type _Cairo_graphics_surfaces<GraphicsMath>::paths::create_rel_new_figure(const basic_point_2d<GraphicsMath>& pt) {
+			typename _Cairo_graphics_surfaces<GraphicsMath>::paths::rel_new_figure_data_type _Cairo_graphics_surfaces<GraphicsMath>::paths::create_rel_new_figure(const basic_point_2d<GraphicsMath>& pt) {
 				rel_new_figure_data_type result;
 				result.pt = pt;
 				return result;
 			}
 
 			template<class GraphicsMath>
-			inline typename _Cairo_graphics_surfaces<GraphicsMath>::paths::rel_new_figure_data_type _Cairo_graphics_surfaces<GraphicsMath>::paths::copy_rel_new_figure(const rel_new_figure_data_type& data) {
+			typename _Cairo_graphics_surfaces<GraphicsMath>::paths::rel_new_figure_data_type _Cairo_graphics_surfaces<GraphicsMath>::paths::copy_rel_new_figure(const rel_new_figure_data_type& data) {
 				return data;
 			}
 
 			template<class GraphicsMath>
-			inline typename _Cairo_graphics_surfaces<GraphicsMath>::paths::rel_new_figure_data_type _Cairo_graphics_surfaces<GraphicsMath>::paths::move_rel_new_figure(rel_new_figure_data_type&& data) noexcept {
+			typename _Cairo_graphics_surfaces<GraphicsMath>::paths::rel_new_figure_data_type _Cairo_graphics_surfaces<GraphicsMath>::paths::move_rel_new_figure(rel_new_figure_data_type&& data) noexcept {
 				return data;
 			}
 
 			template<class GraphicsMath>
-			inline void _Cairo_graphics_surfaces<GraphicsMath>::paths::destroy(rel_new_figure_data_type& /*data*/) noexcept {
+			void _Cairo_graphics_surfaces<GraphicsMath>::paths::destroy(rel_new_figure_data_type& /*data*/) noexcept {
 				// Do nothing
 			}
 
 			template<class GraphicsMath>
-			inline void _Cairo_graphics_surfaces<GraphicsMath>::paths::at(rel_new_figure_data_type& data, const basic_point_2d<GraphicsMath>& pt) {
+			void _Cairo_graphics_surfaces<GraphicsMath>::paths::at(rel_new_figure_data_type& data, const basic_point_2d<GraphicsMath>& pt) {
 				data.pt = pt;
 			}
 
 			template<class GraphicsMath>
-			inline basic_point_2d<GraphicsMath> _Cairo_graphics_surfaces<GraphicsMath>::paths::at(const rel_new_figure_data_type& data) noexcept {
+			basic_point_2d<GraphicsMath> _Cairo_graphics_surfaces<GraphicsMath>::paths::at(const rel_new_figure_data_type& data) noexcept {
 				return data.pt;
 			}
 
 			template<class GraphicsMath>
-			inline typename _Cairo_graphics_surfaces<GraphicsMath>::paths::close_figure_data_type _Cairo_graphics_surfaces<GraphicsMath>::paths::create_close_figure() {
+			typename _Cairo_graphics_surfaces<GraphicsMath>::paths::close_figure_data_type _Cairo_graphics_surfaces<GraphicsMath>::paths::create_close_figure() {
 				return close_figure_data_type();
 			}
 
 			template<class GraphicsMath>
-			inline typename _Cairo_graphics_surfaces<GraphicsMath>::paths::close_figure_data_type _Cairo_graphics_surfaces<GraphicsMath>::paths::copy_close_figure(const close_figure_data_type& data) {
+			typename _Cairo_graphics_surfaces<GraphicsMath>::paths::close_figure_data_type _Cairo_graphics_surfaces<GraphicsMath>::paths::copy_close_figure(const close_figure_data_type& data) {
 				return data;
 			}
 
 			template<class GraphicsMath>
-			inline typename _Cairo_graphics_surfaces<GraphicsMath>::paths::close_figure_data_type _Cairo_graphics_surfaces<GraphicsMath>::paths::move_close_figure(close_figure_data_type&& data) noexcept {
+			typename _Cairo_graphics_surfaces<GraphicsMath>::paths::close_figure_data_type _Cairo_graphics_surfaces<GraphicsMath>::paths::move_close_figure(close_figure_data_type&& data) noexcept {
 				return data;
 			}
 
 			template<class GraphicsMath>
-			inline void _Cairo_graphics_surfaces<GraphicsMath>::paths::destroy(close_figure_data_type& /*data*/) noexcept {
+			void _Cairo_graphics_surfaces<GraphicsMath>::paths::destroy(close_figure_data_type& /*data*/) noexcept {
 				// Do nothing.
 			}
 
 			template<class GraphicsMath>
-			inline typename _Cairo_graphics_surfaces<GraphicsMath>::paths::abs_matrix_data_type _Cairo_graphics_surfaces<GraphicsMath>::paths::create_abs_matrix() {
+			typename _Cairo_graphics_surfaces<GraphicsMath>::paths::abs_matrix_data_type _Cairo_graphics_surfaces<GraphicsMath>::paths::create_abs_matrix() {
 				return abs_matrix_data_type();
 			}
 
 			template<class GraphicsMath>
-			inline typename _Cairo_graphics_surfaces<GraphicsMath>::paths::abs_matrix_data_type _Cairo_graphics_surfaces<GraphicsMath>::paths::create_abs_matrix(const basic_matrix_2d<GraphicsMath>& m) {
+			typename _Cairo_graphics_surfaces<GraphicsMath>::paths::abs_matrix_data_type _Cairo_graphics_surfaces<GraphicsMath>::paths::create_abs_matrix(const basic_matrix_2d<GraphicsMath>& m) {
 				abs_matrix_data_type result;
 				result.m = m;
 				return result;
 			}
 
 			template<class GraphicsMath>
-			inline typename _Cairo_graphics_surfaces<GraphicsMath>::paths::abs_matrix_data_type _Cairo_graphics_surfaces<GraphicsMath>::paths::copy_abs_matrix(const abs_matrix_data_type& data) {
+			typename _Cairo_graphics_surfaces<GraphicsMath>::paths::abs_matrix_data_type _Cairo_graphics_surfaces<GraphicsMath>::paths::copy_abs_matrix(const abs_matrix_data_type& data) {
 				return data;
 			}
 
 			template<class GraphicsMath>
-			inline typename _Cairo_graphics_surfaces<GraphicsMath>::paths::abs_matrix_data_type _Cairo_graphics_surfaces<GraphicsMath>::paths::move_abs_matrix(abs_matrix_data_type&& data) noexcept {
+			typename _Cairo_graphics_surfaces<GraphicsMath>::paths::abs_matrix_data_type _Cairo_graphics_surfaces<GraphicsMath>::paths::move_abs_matrix(abs_matrix_data_type&& data) noexcept {
 				return data;
 			}
 
 			template<class GraphicsMath>
-			inline void _Cairo_graphics_surfaces<GraphicsMath>::paths::destroy(abs_matrix_data_type& /*data*/) noexcept {
+			void _Cairo_graphics_surfaces<GraphicsMath>::paths::destroy(abs_matrix_data_type& /*data*/) noexcept {
 				// Do nothing.
 			}
 
 			template<class GraphicsMath>
-			inline void _Cairo_graphics_surfaces<GraphicsMath>::paths::matrix(abs_matrix_data_type& data, const basic_matrix_2d<GraphicsMath>& m) {
+			void _Cairo_graphics_surfaces<GraphicsMath>::paths::matrix(abs_matrix_data_type& data, const basic_matrix_2d<GraphicsMath>& m) {
 				data.m = m;
 			}
 
 			template<class GraphicsMath>
-			inline basic_matrix_2d<GraphicsMath> _Cairo_graphics_surfaces<GraphicsMath>::paths::matrix(const abs_matrix_data_type& data) noexcept {
+			basic_matrix_2d<GraphicsMath> _Cairo_graphics_surfaces<GraphicsMath>::paths::matrix(const abs_matrix_data_type& data) noexcept {
 				return data.m;
 			}
 
 			template<class GraphicsMath>
-			inline typename _Cairo_graphics_surfaces<GraphicsMath>::paths::rel_matrix_data_type _Cairo_graphics_surfaces<GraphicsMath>::paths::create_rel_matrix() {
+			typename _Cairo_graphics_surfaces<GraphicsMath>::paths::rel_matrix_data_type _Cairo_graphics_surfaces<GraphicsMath>::paths::create_rel_matrix() {
 				return rel_matrix_data_type();
 			}
 
 			template<class GraphicsMath>
-			inline typename _Cairo_graphics_surfaces<GraphicsMath>::paths::rel_matrix_data_type _Cairo_graphics_surfaces<GraphicsMath>::paths::create_rel_matrix(const basic_matrix_2d<GraphicsMath>& m) {
+			typename _Cairo_graphics_surfaces<GraphicsMath>::paths::rel_matrix_data_type _Cairo_graphics_surfaces<GraphicsMath>::paths::create_rel_matrix(const basic_matrix_2d<GraphicsMath>& m) {
 				rel_matrix_data_type result;
 				result.m = m;
 				return result;
 			}
 
 			template<class GraphicsMath>
-			inline typename _Cairo_graphics_surfaces<GraphicsMath>::paths::rel_matrix_data_type _Cairo_graphics_surfaces<GraphicsMath>::paths::copy_rel_matrix(const rel_matrix_data_type& data) {
+			typename _Cairo_graphics_surfaces<GraphicsMath>::paths::rel_matrix_data_type _Cairo_graphics_surfaces<GraphicsMath>::paths::copy_rel_matrix(const rel_matrix_data_type& data) {
 				return data;
 			}
 
 			template<class GraphicsMath>
-			inline typename _Cairo_graphics_surfaces<GraphicsMath>::paths::rel_matrix_data_type _Cairo_graphics_surfaces<GraphicsMath>::paths::move_rel_matrix(rel_matrix_data_type&& data) noexcept {
+			typename _Cairo_graphics_surfaces<GraphicsMath>::paths::rel_matrix_data_type _Cairo_graphics_surfaces<GraphicsMath>::paths::move_rel_matrix(rel_matrix_data_type&& data) noexcept {
 				return data;
 			}
 
 			template<class GraphicsMath>
-			inline void _Cairo_graphics_surfaces<GraphicsMath>::paths::destroy(rel_matrix_data_type& /*data*/) noexcept {
+			void _Cairo_graphics_surfaces<GraphicsMath>::paths::destroy(rel_matrix_data_type& /*data*/) noexcept {
 				// Do nothing.
 			}
 
 			template<class GraphicsMath>
-			inline void _Cairo_graphics_surfaces<GraphicsMath>::paths::matrix(rel_matrix_data_type& data, const basic_matrix_2d<GraphicsMath>& m) {
+			void _Cairo_graphics_surfaces<GraphicsMath>::paths::matrix(rel_matrix_data_type& data, const basic_matrix_2d<GraphicsMath>& m) {
 				data.m = m;
 			}
 
 			template<class GraphicsMath>
-			inline basic_matrix_2d<GraphicsMath> _Cairo_graphics_surfaces<GraphicsMath>::paths::matrix(const rel_matrix_data_type& data) noexcept {
+			basic_matrix_2d<GraphicsMath> _Cairo_graphics_surfaces<GraphicsMath>::paths::matrix(const rel_matrix_data_type& data) noexcept {
 				return data.m;
 			}
 
 			template<class GraphicsMath>
-			inline typename _Cairo_graphics_surfaces<GraphicsMath>::paths::revert_matrix_data_type _Cairo_graphics_surfaces<GraphicsMath>::paths::create_revert_matrix() {
+			typename _Cairo_graphics_surfaces<GraphicsMath>::paths::revert_matrix_data_type _Cairo_graphics_surfaces<GraphicsMath>::paths::create_revert_matrix() {
 				return revert_matrix_data_type();
 			}
 
 			template<class GraphicsMath>
-			inline typename _Cairo_graphics_surfaces<GraphicsMath>::paths::revert_matrix_data_type _Cairo_graphics_surfaces<GraphicsMath>::paths::copy_revert_matrix(const revert_matrix_data_type& data) {
+			typename _Cairo_graphics_surfaces<GraphicsMath>::paths::revert_matrix_data_type _Cairo_graphics_surfaces<GraphicsMath>::paths::copy_revert_matrix(const revert_matrix_data_type& data) {
 				return data;
 			}
 
 			template<class GraphicsMath>
-			inline typename _Cairo_graphics_surfaces<GraphicsMath>::paths::revert_matrix_data_type _Cairo_graphics_surfaces<GraphicsMath>::paths::move_revert_matrix(revert_matrix_data_type&& data) noexcept {
+			typename _Cairo_graphics_surfaces<GraphicsMath>::paths::revert_matrix_data_type _Cairo_graphics_surfaces<GraphicsMath>::paths::move_revert_matrix(revert_matrix_data_type&& data) noexcept {
 				return data;
 			}
 
 			template<class GraphicsMath>
-			inline void _Cairo_graphics_surfaces<GraphicsMath>::paths::destroy(revert_matrix_data_type& /*data*/) noexcept {
+			void _Cairo_graphics_surfaces<GraphicsMath>::paths::destroy(revert_matrix_data_type& /*data*/) noexcept {
 				// Do nothing.
 			}
 
 			template<class GraphicsMath>
-			inline typename _Cairo_graphics_surfaces<GraphicsMath>::paths::abs_cubic_curve_data_type _Cairo_graphics_surfaces<GraphicsMath>::paths::create_abs_cubic_curve() {
+			typename _Cairo_graphics_surfaces<GraphicsMath>::paths::abs_cubic_curve_data_type _Cairo_graphics_surfaces<GraphicsMath>::paths::create_abs_cubic_curve() {
 				return abs_cubic_curve_data_type();
 			}
 
 			template<class GraphicsMath>
-			inline typename _Cairo_graphics_surfaces<GraphicsMath>::paths::abs_cubic_curve_data_type _Cairo_graphics_surfaces<GraphicsMath>::paths::create_abs_cubic_curve(const basic_point_2d<GraphicsMath>& cpt1, const basic_point_2d<GraphicsMath>& cpt2, const basic_point_2d<GraphicsMath>& ept) {
+			typename _Cairo_graphics_surfaces<GraphicsMath>::paths::abs_cubic_curve_data_type _Cairo_graphics_surfaces<GraphicsMath>::paths::create_abs_cubic_curve(const basic_point_2d<GraphicsMath>& cpt1, const basic_point_2d<GraphicsMath>& cpt2, const basic_point_2d<GraphicsMath>& ept) {
 				abs_cubic_curve_data_type result;
 				result.cpt1 = cpt1;
 				result.cpt2 = cpt2;
@@ -694,94 +1031,94 @@ namespace std::experimental::io2d {
 			}
 
 			template<class GraphicsMath>
-			inline typename _Cairo_graphics_surfaces<GraphicsMath>::paths::abs_cubic_curve_data_type _Cairo_graphics_surfaces<GraphicsMath>::paths::copy_abs_cubic_curve(const abs_cubic_curve_data_type& data) {
+			typename _Cairo_graphics_surfaces<GraphicsMath>::paths::abs_cubic_curve_data_type _Cairo_graphics_surfaces<GraphicsMath>::paths::copy_abs_cubic_curve(const abs_cubic_curve_data_type& data) {
 				return data;
 			}
 
 			template<class GraphicsMath>
-			inline typename _Cairo_graphics_surfaces<GraphicsMath>::paths::abs_cubic_curve_data_type _Cairo_graphics_surfaces<GraphicsMath>::paths::move_abs_cubic_curve(abs_cubic_curve_data_type&& data) noexcept {
+			typename _Cairo_graphics_surfaces<GraphicsMath>::paths::abs_cubic_curve_data_type _Cairo_graphics_surfaces<GraphicsMath>::paths::move_abs_cubic_curve(abs_cubic_curve_data_type&& data) noexcept {
 				return data;
 			}
 
 			template<class GraphicsMath>
-			inline void _Cairo_graphics_surfaces<GraphicsMath>::paths::destroy(abs_cubic_curve_data_type& /*data*/) noexcept {
+			void _Cairo_graphics_surfaces<GraphicsMath>::paths::destroy(abs_cubic_curve_data_type& /*data*/) noexcept {
 				// Do nothing.
 			}
 
 			template<class GraphicsMath>
-			inline void _Cairo_graphics_surfaces<GraphicsMath>::paths::control_pt1(abs_cubic_curve_data_type& data, const basic_point_2d<GraphicsMath>& pt) {
+			void _Cairo_graphics_surfaces<GraphicsMath>::paths::control_pt1(abs_cubic_curve_data_type& data, const basic_point_2d<GraphicsMath>& pt) {
 				data.cpt1 = pt;
 			}
 
 			template<class GraphicsMath>
-			inline void _Cairo_graphics_surfaces<GraphicsMath>::paths::control_pt2(abs_cubic_curve_data_type& data, const basic_point_2d<GraphicsMath>& pt) {
+			void _Cairo_graphics_surfaces<GraphicsMath>::paths::control_pt2(abs_cubic_curve_data_type& data, const basic_point_2d<GraphicsMath>& pt) {
 				data.cpt2 = pt;
 			}
 
 			template<class GraphicsMath>
-			inline void _Cairo_graphics_surfaces<GraphicsMath>::paths::end_pt(abs_cubic_curve_data_type& data, const basic_point_2d<GraphicsMath>& pt) {
+			void _Cairo_graphics_surfaces<GraphicsMath>::paths::end_pt(abs_cubic_curve_data_type& data, const basic_point_2d<GraphicsMath>& pt) {
 				data.ept = pt;
 			}
 
 			template<class GraphicsMath>
-			inline basic_point_2d<GraphicsMath> _Cairo_graphics_surfaces<GraphicsMath>::paths::control_pt1(const abs_cubic_curve_data_type& data) noexcept {
+			basic_point_2d<GraphicsMath> _Cairo_graphics_surfaces<GraphicsMath>::paths::control_pt1(const abs_cubic_curve_data_type& data) noexcept {
 				return data.cpt1;
 			}
 
 			template<class GraphicsMath>
-			inline basic_point_2d<GraphicsMath> _Cairo_graphics_surfaces<GraphicsMath>::paths::control_pt2(const abs_cubic_curve_data_type& data) noexcept {
+			basic_point_2d<GraphicsMath> _Cairo_graphics_surfaces<GraphicsMath>::paths::control_pt2(const abs_cubic_curve_data_type& data) noexcept {
 				return data.cpt2;
 			}
 
 			template<class GraphicsMath>
-			inline basic_point_2d<GraphicsMath> _Cairo_graphics_surfaces<GraphicsMath>::paths::end_pt(const abs_cubic_curve_data_type& data) noexcept {
+			basic_point_2d<GraphicsMath> _Cairo_graphics_surfaces<GraphicsMath>::paths::end_pt(const abs_cubic_curve_data_type& data) noexcept {
 				return data.ept;
 			}
 
 			template<class GraphicsMath>
-			inline typename _Cairo_graphics_surfaces<GraphicsMath>::paths::abs_line_data_type _Cairo_graphics_surfaces<GraphicsMath>::paths::create_abs_line() {
+			typename _Cairo_graphics_surfaces<GraphicsMath>::paths::abs_line_data_type _Cairo_graphics_surfaces<GraphicsMath>::paths::create_abs_line() {
 				return abs_line_data_type();
 			}
 
 			template<class GraphicsMath>
-			inline typename _Cairo_graphics_surfaces<GraphicsMath>::paths::abs_line_data_type _Cairo_graphics_surfaces<GraphicsMath>::paths::create_abs_line(const basic_point_2d<GraphicsMath>& pt) {
+			typename _Cairo_graphics_surfaces<GraphicsMath>::paths::abs_line_data_type _Cairo_graphics_surfaces<GraphicsMath>::paths::create_abs_line(const basic_point_2d<GraphicsMath>& pt) {
 				abs_line_data_type result;
 				result.pt = pt;
 				return result;
 			}
 
 			template<class GraphicsMath>
-			inline typename _Cairo_graphics_surfaces<GraphicsMath>::paths::abs_line_data_type _Cairo_graphics_surfaces<GraphicsMath>::paths::copy_abs_line(const abs_line_data_type& data) {
+			typename _Cairo_graphics_surfaces<GraphicsMath>::paths::abs_line_data_type _Cairo_graphics_surfaces<GraphicsMath>::paths::copy_abs_line(const abs_line_data_type& data) {
 				return data;
 			}
 
 			template<class GraphicsMath>
-			inline typename _Cairo_graphics_surfaces<GraphicsMath>::paths::abs_line_data_type _Cairo_graphics_surfaces<GraphicsMath>::paths::move_abs_line(abs_line_data_type&& data) noexcept {
+			typename _Cairo_graphics_surfaces<GraphicsMath>::paths::abs_line_data_type _Cairo_graphics_surfaces<GraphicsMath>::paths::move_abs_line(abs_line_data_type&& data) noexcept {
 				return data;
 			}
 
 			template<class GraphicsMath>
-			inline void _Cairo_graphics_surfaces<GraphicsMath>::paths::destroy(abs_line_data_type& /*data*/) noexcept {
+			void _Cairo_graphics_surfaces<GraphicsMath>::paths::destroy(abs_line_data_type& /*data*/) noexcept {
 				// Do nothing.
 			}
 
 			template<class GraphicsMath>
-			inline void _Cairo_graphics_surfaces<GraphicsMath>::paths::to(abs_line_data_type& data, const basic_point_2d<GraphicsMath>& pt) {
+			void _Cairo_graphics_surfaces<GraphicsMath>::paths::to(abs_line_data_type& data, const basic_point_2d<GraphicsMath>& pt) {
 				data.pt = pt;
 			}
 
 			template<class GraphicsMath>
-			inline basic_point_2d<GraphicsMath> _Cairo_graphics_surfaces<GraphicsMath>::paths::to(const abs_line_data_type& data) noexcept {
+			basic_point_2d<GraphicsMath> _Cairo_graphics_surfaces<GraphicsMath>::paths::to(const abs_line_data_type& data) noexcept {
 				return data.pt;
 			}
 
 			template<class GraphicsMath>
-			inline typename _Cairo_graphics_surfaces<GraphicsMath>::paths::abs_quadratic_curve_data_type _Cairo_graphics_surfaces<GraphicsMath>::paths::create_abs_quadratic_curve() {
+			typename _Cairo_graphics_surfaces<GraphicsMath>::paths::abs_quadratic_curve_data_type _Cairo_graphics_surfaces<GraphicsMath>::paths::create_abs_quadratic_curve() {
 				return abs_quadratic_curve_data_type();
 			}
 
 			template<class GraphicsMath>
-			inline typename _Cairo_graphics_surfaces<GraphicsMath>::paths::abs_quadratic_curve_data_type _Cairo_graphics_surfaces<GraphicsMath>::paths::create_abs_quadratic_curve(const basic_point_2d<GraphicsMath>& cpt, const basic_point_2d<GraphicsMath>& ept) {
+			typename _Cairo_graphics_surfaces<GraphicsMath>::paths::abs_quadratic_curve_data_type _Cairo_graphics_surfaces<GraphicsMath>::paths::create_abs_quadratic_curve(const basic_point_2d<GraphicsMath>& cpt, const basic_point_2d<GraphicsMath>& ept) {
 				abs_quadratic_curve_data_type result;
 				result.cpt = cpt;
 				result.ept = ept;
@@ -789,47 +1126,47 @@ namespace std::experimental::io2d {
 			}
 
 			template<class GraphicsMath>
-			inline typename _Cairo_graphics_surfaces<GraphicsMath>::paths::abs_quadratic_curve_data_type _Cairo_graphics_surfaces<GraphicsMath>::paths::copy_abs_quadratic_curve(const abs_quadratic_curve_data_type& data) {
+			typename _Cairo_graphics_surfaces<GraphicsMath>::paths::abs_quadratic_curve_data_type _Cairo_graphics_surfaces<GraphicsMath>::paths::copy_abs_quadratic_curve(const abs_quadratic_curve_data_type& data) {
 				return data;
 			}
 
 			template<class GraphicsMath>
-			inline typename _Cairo_graphics_surfaces<GraphicsMath>::paths::abs_quadratic_curve_data_type _Cairo_graphics_surfaces<GraphicsMath>::paths::move_abs_quadratic_curve(abs_quadratic_curve_data_type&& data) noexcept {
+			typename _Cairo_graphics_surfaces<GraphicsMath>::paths::abs_quadratic_curve_data_type _Cairo_graphics_surfaces<GraphicsMath>::paths::move_abs_quadratic_curve(abs_quadratic_curve_data_type&& data) noexcept {
 				return data;
 			}
 
 			template<class GraphicsMath>
-			inline void _Cairo_graphics_surfaces<GraphicsMath>::paths::destroy(abs_quadratic_curve_data_type& /*data*/) noexcept {
+			void _Cairo_graphics_surfaces<GraphicsMath>::paths::destroy(abs_quadratic_curve_data_type& /*data*/) noexcept {
 				// Do nothing.
 			}
 
 			template<class GraphicsMath>
-			inline void _Cairo_graphics_surfaces<GraphicsMath>::paths::control_pt(abs_quadratic_curve_data_type& data, const basic_point_2d<GraphicsMath>& pt) {
+			void _Cairo_graphics_surfaces<GraphicsMath>::paths::control_pt(abs_quadratic_curve_data_type& data, const basic_point_2d<GraphicsMath>& pt) {
 				data.cpt = pt;
 			}
 
 			template<class GraphicsMath>
-			inline void _Cairo_graphics_surfaces<GraphicsMath>::paths::end_pt(abs_quadratic_curve_data_type& data, const basic_point_2d<GraphicsMath>& pt) {
+			void _Cairo_graphics_surfaces<GraphicsMath>::paths::end_pt(abs_quadratic_curve_data_type& data, const basic_point_2d<GraphicsMath>& pt) {
 				data.ept = pt;
 			}
 
 			template<class GraphicsMath>
-			inline basic_point_2d<GraphicsMath> _Cairo_graphics_surfaces<GraphicsMath>::paths::control_pt(const abs_quadratic_curve_data_type& data) noexcept {
+			basic_point_2d<GraphicsMath> _Cairo_graphics_surfaces<GraphicsMath>::paths::control_pt(const abs_quadratic_curve_data_type& data) noexcept {
 				return data.cpt;
 			}
 
 			template<class GraphicsMath>
-			inline basic_point_2d<GraphicsMath> _Cairo_graphics_surfaces<GraphicsMath>::paths::end_pt(const abs_quadratic_curve_data_type& data) {
+			basic_point_2d<GraphicsMath> _Cairo_graphics_surfaces<GraphicsMath>::paths::end_pt(const abs_quadratic_curve_data_type& data) {
 				return data.ept;
 			}
 
 			template<class GraphicsMath>
-			inline typename _Cairo_graphics_surfaces<GraphicsMath>::paths::arc_data_type _Cairo_graphics_surfaces<GraphicsMath>::paths::create_arc() {
+			typename _Cairo_graphics_surfaces<GraphicsMath>::paths::arc_data_type _Cairo_graphics_surfaces<GraphicsMath>::paths::create_arc() {
 				return arc_data_type();
 			}
 
 			template<class GraphicsMath>
-			inline typename _Cairo_graphics_surfaces<GraphicsMath>::paths::arc_data_type _Cairo_graphics_surfaces<GraphicsMath>::paths::create_arc(const basic_point_2d<GraphicsMath>& rad, float rot, float sang) {
+			typename _Cairo_graphics_surfaces<GraphicsMath>::paths::arc_data_type _Cairo_graphics_surfaces<GraphicsMath>::paths::create_arc(const basic_point_2d<GraphicsMath>& rad, float rot, float sang) {
 				arc_data_type result;
 				result.radius = rad;
 				result.rotation = rot;
@@ -838,52 +1175,52 @@ namespace std::experimental::io2d {
 			}
 
 			template<class GraphicsMath>
-			inline typename _Cairo_graphics_surfaces<GraphicsMath>::paths::arc_data_type _Cairo_graphics_surfaces<GraphicsMath>::paths::copy_arc(const arc_data_type& data) {
+			typename _Cairo_graphics_surfaces<GraphicsMath>::paths::arc_data_type _Cairo_graphics_surfaces<GraphicsMath>::paths::copy_arc(const arc_data_type& data) {
 				return data;
 			}
 
 			template<class GraphicsMath>
-			inline typename _Cairo_graphics_surfaces<GraphicsMath>::paths::arc_data_type _Cairo_graphics_surfaces<GraphicsMath>::paths::move_arc(arc_data_type&& data) noexcept {
+			typename _Cairo_graphics_surfaces<GraphicsMath>::paths::arc_data_type _Cairo_graphics_surfaces<GraphicsMath>::paths::move_arc(arc_data_type&& data) noexcept {
 				return data;
 			}
 
 			template<class GraphicsMath>
-			inline void _Cairo_graphics_surfaces<GraphicsMath>::paths::destroy(arc_data_type& /*data*/) noexcept {
+			void _Cairo_graphics_surfaces<GraphicsMath>::paths::destroy(arc_data_type& /*data*/) noexcept {
 				// Do nothing.
 			}
 
 			template<class GraphicsMath>
-			inline void _Cairo_graphics_surfaces<GraphicsMath>::paths::radius(arc_data_type& data, const basic_point_2d<GraphicsMath>& pt) {
+			void _Cairo_graphics_surfaces<GraphicsMath>::paths::radius(arc_data_type& data, const basic_point_2d<GraphicsMath>& pt) {
 				data.radius = pt;
 			}
 
 			template<class GraphicsMath>
-			inline void _Cairo_graphics_surfaces<GraphicsMath>::paths::rotation(arc_data_type& data, float rot) {
+			void _Cairo_graphics_surfaces<GraphicsMath>::paths::rotation(arc_data_type& data, float rot) {
 				data.rotation = rot;
 			}
 
 			template<class GraphicsMath>
-			inline void _Cairo_graphics_surfaces<GraphicsMath>::paths::start_angle(arc_data_type& data, float sang) {
+			void _Cairo_graphics_surfaces<GraphicsMath>::paths::start_angle(arc_data_type& data, float sang) {
 				data.startAngle = sang;
 			}
 
 			template<class GraphicsMath>
-			inline basic_point_2d<GraphicsMath> _Cairo_graphics_surfaces<GraphicsMath>::paths::radius(const arc_data_type& data) noexcept {
+			basic_point_2d<GraphicsMath> _Cairo_graphics_surfaces<GraphicsMath>::paths::radius(const arc_data_type& data) noexcept {
 				return data.radius;
 			}
 
 			template<class GraphicsMath>
-			inline float _Cairo_graphics_surfaces<GraphicsMath>::paths::rotation(const arc_data_type& data) noexcept {
+			float _Cairo_graphics_surfaces<GraphicsMath>::paths::rotation(const arc_data_type& data) noexcept {
 				return data.rotation;
 			}
 
 			template<class GraphicsMath>
-			inline float _Cairo_graphics_surfaces<GraphicsMath>::paths::start_angle(const arc_data_type& data) noexcept {
+			float _Cairo_graphics_surfaces<GraphicsMath>::paths::start_angle(const arc_data_type& data) noexcept {
 				return data.startAngle;
 			}
 
 			template<class GraphicsMath>
-			inline basic_point_2d<GraphicsMath> _Cairo_graphics_surfaces<GraphicsMath>::paths::center(const arc_data_type& data, const basic_point_2d<GraphicsMath>& cpt, const basic_matrix_2d<GraphicsMath>& m) noexcept {
+			basic_point_2d<GraphicsMath> _Cairo_graphics_surfaces<GraphicsMath>::paths::center(const arc_data_type& data, const basic_point_2d<GraphicsMath>& cpt, const basic_matrix_2d<GraphicsMath>& m) noexcept {
 				auto lmtx = m;
 				lmtx.m20(0.0F); lmtx.m21(0.0F); // Eliminate translation.
 				auto centerOffset = point_for_angle<GraphicsMath>(two_pi<float> -data.startAngle, data.radius);
@@ -892,7 +1229,7 @@ namespace std::experimental::io2d {
 			}
 
 			template<class GraphicsMath>
-			inline basic_point_2d<GraphicsMath> _Cairo_graphics_surfaces<GraphicsMath>::paths::end_pt(const arc_data_type& data, const basic_point_2d<GraphicsMath>& cpt, const basic_matrix_2d<GraphicsMath>& m) noexcept {
+			basic_point_2d<GraphicsMath> _Cairo_graphics_surfaces<GraphicsMath>::paths::end_pt(const arc_data_type& data, const basic_point_2d<GraphicsMath>& cpt, const basic_matrix_2d<GraphicsMath>& m) noexcept {
 				auto lmtx = m;
 				auto tfrm = basic_matrix_2d<GraphicsMath>::create_rotate(data.startAngle + data.rotation);
 				lmtx.m20(0.0F); lmtx.m21(0.0F); // Eliminate translation.
@@ -902,12 +1239,12 @@ namespace std::experimental::io2d {
 			}
 
 			template<class GraphicsMath>
-			inline typename _Cairo_graphics_surfaces<GraphicsMath>::paths::rel_cubic_curve_data_type _Cairo_graphics_surfaces<GraphicsMath>::paths::create_rel_cubic_curve() {
+			typename _Cairo_graphics_surfaces<GraphicsMath>::paths::rel_cubic_curve_data_type _Cairo_graphics_surfaces<GraphicsMath>::paths::create_rel_cubic_curve() {
 				return rel_cubic_curve_data_type();
 			}
 
 			template<class GraphicsMath>
-			inline typename _Cairo_graphics_surfaces<GraphicsMath>::paths::rel_cubic_curve_data_type _Cairo_graphics_surfaces<GraphicsMath>::paths::create_rel_cubic_curve(const basic_point_2d<GraphicsMath>& cpt1, const basic_point_2d<GraphicsMath>& cpt2, const basic_point_2d<GraphicsMath>& ept) {
+			typename _Cairo_graphics_surfaces<GraphicsMath>::paths::rel_cubic_curve_data_type _Cairo_graphics_surfaces<GraphicsMath>::paths::create_rel_cubic_curve(const basic_point_2d<GraphicsMath>& cpt1, const basic_point_2d<GraphicsMath>& cpt2, const basic_point_2d<GraphicsMath>& ept) {
 				rel_cubic_curve_data_type result;
 				result.cpt1 = cpt1;
 				result.cpt2 = cpt2;
@@ -916,94 +1253,94 @@ namespace std::experimental::io2d {
 			}
 
 			template<class GraphicsMath>
-			inline typename _Cairo_graphics_surfaces<GraphicsMath>::paths::rel_cubic_curve_data_type _Cairo_graphics_surfaces<GraphicsMath>::paths::copy_rel_cubic_curve(const rel_cubic_curve_data_type& data) {
+			typename _Cairo_graphics_surfaces<GraphicsMath>::paths::rel_cubic_curve_data_type _Cairo_graphics_surfaces<GraphicsMath>::paths::copy_rel_cubic_curve(const rel_cubic_curve_data_type& data) {
 				return data;
 			}
 
 			template<class GraphicsMath>
-			inline typename _Cairo_graphics_surfaces<GraphicsMath>::paths::rel_cubic_curve_data_type _Cairo_graphics_surfaces<GraphicsMath>::paths::move_rel_cubic_curve(rel_cubic_curve_data_type&& data) noexcept {
+			typename _Cairo_graphics_surfaces<GraphicsMath>::paths::rel_cubic_curve_data_type _Cairo_graphics_surfaces<GraphicsMath>::paths::move_rel_cubic_curve(rel_cubic_curve_data_type&& data) noexcept {
 				return data;
 			}
 
 			template<class GraphicsMath>
-			inline void _Cairo_graphics_surfaces<GraphicsMath>::paths::destroy(rel_cubic_curve_data_type& /*data*/) noexcept {
+			void _Cairo_graphics_surfaces<GraphicsMath>::paths::destroy(rel_cubic_curve_data_type& /*data*/) noexcept {
 				// Do nothing.
 			}
 
 			template<class GraphicsMath>
-			inline void _Cairo_graphics_surfaces<GraphicsMath>::paths::control_pt1(rel_cubic_curve_data_type& data, const basic_point_2d<GraphicsMath>& pt) {
+			void _Cairo_graphics_surfaces<GraphicsMath>::paths::control_pt1(rel_cubic_curve_data_type& data, const basic_point_2d<GraphicsMath>& pt) {
 				data.cpt1 = pt;
 			}
 
 			template<class GraphicsMath>
-			inline void _Cairo_graphics_surfaces<GraphicsMath>::paths::control_pt2(rel_cubic_curve_data_type& data, const basic_point_2d<GraphicsMath>& pt) {
+			void _Cairo_graphics_surfaces<GraphicsMath>::paths::control_pt2(rel_cubic_curve_data_type& data, const basic_point_2d<GraphicsMath>& pt) {
 				data.cpt2 = pt;
 			}
 
 			template<class GraphicsMath>
-			inline void _Cairo_graphics_surfaces<GraphicsMath>::paths::end_pt(rel_cubic_curve_data_type& data, const basic_point_2d<GraphicsMath>& pt) {
+			void _Cairo_graphics_surfaces<GraphicsMath>::paths::end_pt(rel_cubic_curve_data_type& data, const basic_point_2d<GraphicsMath>& pt) {
 				data.ept = pt;
 			}
 
 			template<class GraphicsMath>
-			inline basic_point_2d<GraphicsMath> _Cairo_graphics_surfaces<GraphicsMath>::paths::control_pt1(const rel_cubic_curve_data_type& data) noexcept {
+			basic_point_2d<GraphicsMath> _Cairo_graphics_surfaces<GraphicsMath>::paths::control_pt1(const rel_cubic_curve_data_type& data) noexcept {
 				return data.cpt1;
 			}
 
 			template<class GraphicsMath>
-			inline basic_point_2d<GraphicsMath> _Cairo_graphics_surfaces<GraphicsMath>::paths::control_pt2(const rel_cubic_curve_data_type& data) noexcept {
+			basic_point_2d<GraphicsMath> _Cairo_graphics_surfaces<GraphicsMath>::paths::control_pt2(const rel_cubic_curve_data_type& data) noexcept {
 				return data.cpt2;
 			}
 
 			template<class GraphicsMath>
-			inline basic_point_2d<GraphicsMath> _Cairo_graphics_surfaces<GraphicsMath>::paths::end_pt(const rel_cubic_curve_data_type& data) noexcept {
+			basic_point_2d<GraphicsMath> _Cairo_graphics_surfaces<GraphicsMath>::paths::end_pt(const rel_cubic_curve_data_type& data) noexcept {
 				return data.ept;
 			}
 
 			template<class GraphicsMath>
-			inline typename _Cairo_graphics_surfaces<GraphicsMath>::paths::rel_line_data_type _Cairo_graphics_surfaces<GraphicsMath>::paths::create_rel_line() {
+			typename _Cairo_graphics_surfaces<GraphicsMath>::paths::rel_line_data_type _Cairo_graphics_surfaces<GraphicsMath>::paths::create_rel_line() {
 				return rel_line_data_type();
 			}
 
 			template<class GraphicsMath>
-			inline typename _Cairo_graphics_surfaces<GraphicsMath>::paths::rel_line_data_type _Cairo_graphics_surfaces<GraphicsMath>::paths::create_rel_line(const basic_point_2d<GraphicsMath>& pt) {
+			typename _Cairo_graphics_surfaces<GraphicsMath>::paths::rel_line_data_type _Cairo_graphics_surfaces<GraphicsMath>::paths::create_rel_line(const basic_point_2d<GraphicsMath>& pt) {
 				rel_line_data_type result;
 				result.pt = pt;
 				return result;
 			}
 
 			template<class GraphicsMath>
-			inline typename _Cairo_graphics_surfaces<GraphicsMath>::paths::rel_line_data_type _Cairo_graphics_surfaces<GraphicsMath>::paths::copy_rel_line(const rel_line_data_type& data) {
+			typename _Cairo_graphics_surfaces<GraphicsMath>::paths::rel_line_data_type _Cairo_graphics_surfaces<GraphicsMath>::paths::copy_rel_line(const rel_line_data_type& data) {
 				return data;
 			}
 
 			template<class GraphicsMath>
-			inline typename _Cairo_graphics_surfaces<GraphicsMath>::paths::rel_line_data_type _Cairo_graphics_surfaces<GraphicsMath>::paths::move_rel_line(rel_line_data_type&& data) noexcept {
+			typename _Cairo_graphics_surfaces<GraphicsMath>::paths::rel_line_data_type _Cairo_graphics_surfaces<GraphicsMath>::paths::move_rel_line(rel_line_data_type&& data) noexcept {
 				return data;
 			}
 
 			template<class GraphicsMath>
-			inline void _Cairo_graphics_surfaces<GraphicsMath>::paths::destroy(rel_line_data_type& /*data*/) noexcept {
+			void _Cairo_graphics_surfaces<GraphicsMath>::paths::destroy(rel_line_data_type& /*data*/) noexcept {
 				// Do nothing.
 			}
 
 			template<class GraphicsMath>
-			inline void _Cairo_graphics_surfaces<GraphicsMath>::paths::to(rel_line_data_type& data, const basic_point_2d<GraphicsMath>& pt) {
+			void _Cairo_graphics_surfaces<GraphicsMath>::paths::to(rel_line_data_type& data, const basic_point_2d<GraphicsMath>& pt) {
 				data.pt = pt;
 			}
 
 			template<class GraphicsMath>
-			inline basic_point_2d<GraphicsMath> _Cairo_graphics_surfaces<GraphicsMath>::paths::to(const rel_line_data_type& data) noexcept {
+			basic_point_2d<GraphicsMath> _Cairo_graphics_surfaces<GraphicsMath>::paths::to(const rel_line_data_type& data) noexcept {
 				return data.pt;
 			}
 
 			template<class GraphicsMath>
-			inline typename _Cairo_graphics_surfaces<GraphicsMath>::paths::rel_quadratic_curve_data_type _Cairo_graphics_surfaces<GraphicsMath>::paths::create_rel_quadratic_curve() {
+			typename _Cairo_graphics_surfaces<GraphicsMath>::paths::rel_quadratic_curve_data_type _Cairo_graphics_surfaces<GraphicsMath>::paths::create_rel_quadratic_curve() {
 				return rel_quadratic_curve_data_type();
 			}
 
 			template<class GraphicsMath>
-			inline typename _Cairo_graphics_surfaces<GraphicsMath>::paths::rel_quadratic_curve_data_type _Cairo_graphics_surfaces<GraphicsMath>::paths::create_rel_quadratic_curve(const basic_point_2d<GraphicsMath>& cpt, const basic_point_2d<GraphicsMath>& ept) {
+			typename _Cairo_graphics_surfaces<GraphicsMath>::paths::rel_quadratic_curve_data_type _Cairo_graphics_surfaces<GraphicsMath>::paths::create_rel_quadratic_curve(const basic_point_2d<GraphicsMath>& cpt, const basic_point_2d<GraphicsMath>& ept) {
 				rel_quadratic_curve_data_type result;
 				result.cpt = cpt;
 				result.ept = ept;
@@ -1011,37 +1348,37 @@ namespace std::experimental::io2d {
 			}
 
 			template<class GraphicsMath>
-			inline typename _Cairo_graphics_surfaces<GraphicsMath>::paths::rel_quadratic_curve_data_type _Cairo_graphics_surfaces<GraphicsMath>::paths::copy_rel_quadratic_curve(const rel_quadratic_curve_data_type& data) {
+			typename _Cairo_graphics_surfaces<GraphicsMath>::paths::rel_quadratic_curve_data_type _Cairo_graphics_surfaces<GraphicsMath>::paths::copy_rel_quadratic_curve(const rel_quadratic_curve_data_type& data) {
 				return data;
 			}
 
 			template<class GraphicsMath>
-			inline typename _Cairo_graphics_surfaces<GraphicsMath>::paths::rel_quadratic_curve_data_type _Cairo_graphics_surfaces<GraphicsMath>::paths::move_rel_quadratic_curve(rel_quadratic_curve_data_type&& data) noexcept {
+			typename _Cairo_graphics_surfaces<GraphicsMath>::paths::rel_quadratic_curve_data_type _Cairo_graphics_surfaces<GraphicsMath>::paths::move_rel_quadratic_curve(rel_quadratic_curve_data_type&& data) noexcept {
 				return data;
 			}
 
 			template<class GraphicsMath>
-			inline void _Cairo_graphics_surfaces<GraphicsMath>::paths::destroy(rel_quadratic_curve_data_type& /*data*/) noexcept {
+			void _Cairo_graphics_surfaces<GraphicsMath>::paths::destroy(rel_quadratic_curve_data_type& /*data*/) noexcept {
 				// Do nothing.
 			}
 
 			template<class GraphicsMath>
-			inline void _Cairo_graphics_surfaces<GraphicsMath>::paths::control_pt(rel_quadratic_curve_data_type& data, const basic_point_2d<GraphicsMath>& pt) {
+			void _Cairo_graphics_surfaces<GraphicsMath>::paths::control_pt(rel_quadratic_curve_data_type& data, const basic_point_2d<GraphicsMath>& pt) {
 				data.cpt = pt;
 			}
 
 			template<class GraphicsMath>
-			inline void _Cairo_graphics_surfaces<GraphicsMath>::paths::end_pt(rel_quadratic_curve_data_type& data, const basic_point_2d<GraphicsMath>& pt) {
+			void _Cairo_graphics_surfaces<GraphicsMath>::paths::end_pt(rel_quadratic_curve_data_type& data, const basic_point_2d<GraphicsMath>& pt) {
 				data.ept = pt;
 			}
 
 			template<class GraphicsMath>
-			inline basic_point_2d<GraphicsMath> _Cairo_graphics_surfaces<GraphicsMath>::paths::control_pt(const rel_quadratic_curve_data_type& data) noexcept {
+			basic_point_2d<GraphicsMath> _Cairo_graphics_surfaces<GraphicsMath>::paths::control_pt(const rel_quadratic_curve_data_type& data) noexcept {
 				return data.cpt;
 			}
 
 			template<class GraphicsMath>
-			inline basic_point_2d<GraphicsMath> _Cairo_graphics_surfaces<GraphicsMath>::paths::end_pt(const rel_quadratic_curve_data_type& data) noexcept {
+			basic_point_2d<GraphicsMath> _Cairo_graphics_surfaces<GraphicsMath>::paths::end_pt(const rel_quadratic_curve_data_type& data) noexcept {
 				return data.ept;
 			}
 		}
@@ -8,7 +8,7 @@ namespace std::experimental::io2d {
 			// image_surface
 
 			template<class GraphicsMath>
-			inline typename _Cairo_graphics_surfaces<GraphicsMath>::surfaces::image_surface_data_type _Cairo_graphics_surfaces<GraphicsMath>::surfaces::create_image_surface(io2d::format fmt, int width, int height) {
+			typename _Cairo_graphics_surfaces<GraphicsMath>::surfaces::image_surface_data_type _Cairo_graphics_surfaces<GraphicsMath>::surfaces::create_image_surface(io2d::format fmt, int width, int height) {
 				image_surface_data_type data;
 				data.surface = ::std::move(unique_ptr<cairo_surface_t, decltype(&cairo_surface_destroy)>(cairo_image_surface_create(_Format_to_cairo_format_t(fmt), width, height), &cairo_surface_destroy));
 				data.context = ::std::move(unique_ptr<cairo_t, decltype(&cairo_destroy)>(cairo_create(data.surface.get()), &cairo_destroy));
@@ -17,6 +17,31 @@ namespace std::experimental::io2d {
 				data.format = fmt;
 				return data;
 			}
+			// owner, if set, is released together with the cairo surface, which brushes made from the image may keep alive after the image is gone.
+			template <class GraphicsMath>
+			typename _Cairo_graphics_surfaces<GraphicsMath>::surfaces::image_surface_data_type _Cairo_graphics_surfaces<GraphicsMath>::surfaces::create_image_surface(io2d::format fmt, int width, int height, ::std::byte* data, int stride, ::std::shared_ptr<void> owner) {
+				const auto cairoFormat = _Format_to_cairo_format_t(fmt);
+				if (data == nullptr || width <= 0 || height <= 0 || cairoFormat == CAIRO_FORMAT_INVALID || stride < cairo_format_stride_for_width(cairoFormat, width) || stride % 4 != 0) {
+					throw ::std::system_error(::std::make_error_code(::std::errc::invalid_argument));
+				}
+				image_surface_data_type result;
+				result.surface = ::std::move(unique_ptr<cairo_surface_t, decltype(&cairo_surface_destroy)>(cairo_image_surface_create_for_data(reinterpret_cast<unsigned char*>(data), cairoFormat, width, height, stride), &cairo_surface_destroy));
+				_Throw_if_failed_cairo_status_t(cairo_surface_status(result.surface.get()));
+				if (owner != nullptr) {
+					auto heldOwner = new ::std::shared_ptr<void>(move(owner));
+					const auto status = cairo_surface_set_user_data(result.surface.get(), &_Surface_owner_key, heldOwner, [](void* p) { delete static_cast<::std::shared_ptr<void>*>(p); });
+					if (status != CAIRO_STATUS_SUCCESS) {
+						delete heldOwner;
+						_Throw_if_failed_cairo_status_t(status);
+					}
+				}
+				result.context = ::std::move(unique_ptr<cairo_t, decltype(&cairo_destroy)>(cairo_create(result.surface.get()), &cairo_destroy));
+				result.dimensions.x(width);
+				result.dimensions.y(height);
+				result.format = fmt;
+				result.external_memory = true;
+				return result;
+			}
 
 #ifdef _IO2D_Has_Magick
 
@@ -355,7 +380,7 @@ namespace std::experimental::io2d {
 				}
 			}
 			template <class result_type = unsigned char>
-			inline ::std::unique_ptr<result_type[]> _Convert_and_create_pixel_array_from_map_pixels(io2d::format fmt, unsigned char* mapData, int w, int h, int mapStride) {
+			::std::unique_ptr<result_type[]> _Convert_and_create_pixel_array_from_map_pixels(io2d::format fmt, unsigned char* mapData, int w, int h, int mapStride) {
 				//using result_type = unsigned char;
 				size_t pixelsArraySize = static_cast<size_t>(w * h * 4);
 				::std::unique_ptr<result_type[]> pixels(new result_type[pixelsArraySize]);
@@ -421,46 +446,11 @@ namespace std::experimental::io2d {
 				return pixels;
 			}
 
-#if defined(_Filesystem_support_test)
-			template<class GraphicsMath>
-			inline typename _Cairo_graphics_surfaces<GraphicsMath>::surfaces::image_surface_data_type _Cairo_graphics_surfaces<GraphicsMath>::surfaces::create_image_surface(filesystem::path p, image_file_format iff, io2d::format fmt) {
-				::std::error_code ec;
-				auto data = create_image_surface(p, iff, fmt, ec);
-				if (ec) {
-					throw ::std::system_error(ec);
-				}
-				return data;
-			}
-			template<class GraphicsMath>
-			inline typename _Cairo_graphics_surfaces<GraphicsMath>::surfaces::image_surface_data_type _Cairo_graphics_surfaces<GraphicsMath>::surfaces::create_image_surface(filesystem::path p, image_file_format iff, io2d::format fmt, ::std::error_code& ec) noexcept {
-				_Init_graphics_magic();
-				if (iff == image_file_format::unknown) {
-					ec = ::std::make_error_code(errc::not_supported);
-					return image_surface_data_type{};
-				}
-				ExceptionInfo exInfo;
-				GetExceptionInfo(&exInfo);
-
-				image_surface_data_type data;
-
-				unique_ptr<ImageInfo, decltype(&DestroyImageInfo)> imageInfo(CloneImageInfo(nullptr), &DestroyImageInfo);
-				imageInfo->depth = 8;
-				imageInfo->colorspace = TransparentColorspace;
-				auto pathStr = p.string();
-				if (pathStr.length() > MaxTextExtent - 1) {
-					ec = make_error_code(errc::filename_too_long);
-					DestroyExceptionInfo(&exInfo);
-					return image_surface_data_type{};
-				}
-				strncpy(imageInfo->filename, pathStr.c_str(), pathStr.length());
-				PixelPacket mattePixel{};
-				imageInfo->matte_color = mattePixel;
-				unique_ptr<Image, decltype(&DestroyImage)> image(ReadImage(imageInfo.get(), &exInfo), &DestroyImage);
-				if (image == nullptr) {
-					ec = _Graphics_magic_exception_type_to_error_code(&exInfo);
-					DestroyExceptionInfo(&exInfo);
-					return image_surface_data_type{};
-				}
+#ifdef _IO2D_Has_Magick
+			// Copies an image GraphicsMagick has decoded into a new surface of format fmt. Destroys exInfo.
+			template <class ImageSurfaceData>
+			ImageSurfaceData _Image_surface_data_from_magick_image(Image* image, io2d::format fmt, ExceptionInfo* exInfo, ::std::error_code& ec) noexcept {
+				ImageSurfaceData data;
 				auto width = image->columns;
 				auto height = image->rows;
 				//auto gamma = image->gamma;
@@ -472,19 +462,19 @@ namespace std::experimental::io2d {
 				data.format = fmt;
 
 				// Note: We don't own the pixels pointer.
-				PixelPacket* pixels = GetImagePixelsEx(image.get(), 0, 0, width, height, &exInfo);
+				PixelPacket* pixels = GetImagePixelsEx(image, 0, 0, width, height, exInfo);
 				if (pixels == nullptr) {
-					ec = _Graphics_magic_exception_type_to_error_code(&exInfo);
-					DestroyExceptionInfo(&exInfo);
-					return image_surface_data_type{};
+					ec = _Graphics_magic_exception_type_to_error_code(exInfo);
+					DestroyExceptionInfo(exInfo);
+					return ImageSurfaceData{};
 				}
 
-				DestroyExceptionInfo(&exInfo);
+				DestroyExceptionInfo(exInfo);
 
 				auto map = cairo_surface_map_to_image(data.surface.get(), nullptr);
 				auto mapStride = cairo_image_surface_get_stride(map);
 				auto mapData = cairo_image_surface_get_data(map);
-				const auto channelMaxValue = static_cast<float>(numeric_limits<decltype(mattePixel.red)>::max());
+				const auto channelMaxValue = static_cast<float>(numeric_limits<decltype(PixelPacket{}.red)>::max());
 				if (image->matte != 0) {
 					for (unsigned long y = 0; y < height; y++) {
 						for (unsigned long x = 0; x < width; x++) {
@@ -513,40 +503,75 @@ namespace std::experimental::io2d {
 				cairo_surface_mark_dirty(data.surface.get());
 				if (cairo_surface_status(data.surface.get()) != CAIRO_STATUS_SUCCESS) {
 					ec = ::std::make_error_code(errc::operation_canceled);
-					return image_surface_data_type{};
+					return ImageSurfaceData{};
 				}
 				ec.clear();
 				return data;
 			}
-#else
+
 			template<class GraphicsMath>
-			inline typename _Cairo_graphics_surfaces<GraphicsMath>::surfaces::image_surface_data_type _Cairo_graphics_surfaces<GraphicsMath>::surfaces::create_image_surface(::std::string p, image_file_format iff, io2d::format fmt) {
+			typename _Cairo_graphics_surfaces<GraphicsMath>::surfaces::image_surface_data_type _Cairo_graphics_surfaces<GraphicsMath>::surfaces::create_image_surface(const ::std::byte* bytes, size_t size, image_file_format iff, io2d::format fmt) {
 				::std::error_code ec;
-				ec.clear();
-				auto data = move(create_image_surface(p, iff, fmt, ec));
+				auto data = create_image_surface(bytes, size, iff, fmt, ec);
 				if (ec) {
 					throw ::std::system_error(ec);
 				}
 				return data;
 			}
-
-#ifdef _IO2D_Has_Magick
-			template <class GraphicsMath>
-			inline typename _Cairo_graphics_surfaces<GraphicsMath>::surfaces::image_surface_data_type _Cairo_graphics_surfaces<GraphicsMath>::surfaces::create_image_surface(::std::string p, image_file_format iff, io2d::format fmt, ::std::error_code& ec) noexcept {
+			// GraphicsMagick recognizes the encoded data by its signature, so iff only has to say that there is an image.
+			template<class GraphicsMath>
+			typename _Cairo_graphics_surfaces<GraphicsMath>::surfaces::image_surface_data_type _Cairo_graphics_surfaces<GraphicsMath>::surfaces::create_image_surface(const ::std::byte* bytes, size_t size, image_file_format iff, io2d::format fmt, ::std::error_code& ec) noexcept {
 				_Init_graphics_magic();
 				if (iff == image_file_format::unknown) {
 					ec = ::std::make_error_code(errc::not_supported);
 					return image_surface_data_type{};
 				}
+				if (bytes == nullptr || size == 0) {
+					ec = ::std::make_error_code(errc::invalid_argument);
+					return image_surface_data_type{};
+				}
 				ExceptionInfo exInfo;
 				GetExceptionInfo(&exInfo);
 
-				image_surface_data_type data;
+				unique_ptr<ImageInfo, decltype(&DestroyImageInfo)> imageInfo(CloneImageInfo(nullptr), &DestroyImageInfo);
+				imageInfo->depth = 8;
+				imageInfo->colorspace = TransparentColorspace;
+				PixelPacket mattePixel{};
+				imageInfo->matte_color = mattePixel;
+				unique_ptr<Image, decltype(&DestroyImage)> image(BlobToImage(imageInfo.get(), bytes, size, &exInfo), &DestroyImage);
+				if (image == nullptr) {
+					ec = _Graphics_magic_exception_type_to_error_code(&exInfo);
+					DestroyExceptionInfo(&exInfo);
+					return image_surface_data_type{};
+				}
+				return _Image_surface_data_from_magick_image<image_surface_data_type>(image.get(), fmt, &exInfo, ec);
+			}
+#endif	// _IO2D_Has_Magick
+
+#if defined(_Filesystem_support_test)
+			template<class GraphicsMath>
+			typename _Cairo_graphics_surfaces<GraphicsMath>::surfaces::image_surface_data_type _Cairo_graphics_surfaces<GraphicsMath>::surfaces::create_image_surface(filesystem::path p, image_file_format iff, io2d::format fmt) {
+				::std::error_code ec;
+				auto data = create_image_surface(p, iff, fmt, ec);
+				if (ec) {
+					throw ::std::system_error(ec);
+				}
+				return data;
+			}
+			template<class GraphicsMath>
+			typename _Cairo_graphics_surfaces<GraphicsMath>::surfaces::image_surface_data_type _Cairo_graphics_surfaces<GraphicsMath>::surfaces::create_image_surface(filesystem::path p, image_file_format iff, io2d::format fmt, ::std::error_code& ec) noexcept {
+				_Init_graphics_magic();
+				if (iff == image_file_format::unknown) {
+					ec = ::std::make_error_code(errc::not_supported);
+					return image_surface_data_type{};
+				}
+				ExceptionInfo exInfo;
+				GetExceptionInfo(&exInfo);
 
 				unique_ptr<ImageInfo, decltype(&DestroyImageInfo)> imageInfo(CloneImageInfo(nullptr), &DestroyImageInfo);
 				imageInfo->depth = 8;
 				imageInfo->colorspace = TransparentColorspace;
-				auto& pathStr = p;
+				auto pathStr = p.string();
 				if (pathStr.length() > MaxTextExtent - 1) {
 					ec = make_error_code(errc::filename_too_long);
 					DestroyExceptionInfo(&exInfo);
@@ -561,75 +586,84 @@ namespace std::experimental::io2d {
 					DestroyExceptionInfo(&exInfo);
 					return image_surface_data_type{};
 				}
-				auto width = image->columns;
-				auto height = image->rows;
-
-				data.surface = ::std::move(unique_ptr<cairo_surface_t, decltype(&cairo_surface_destroy)>(cairo_image_surface_create(_Format_to_cairo_format_t(fmt), width, height), &cairo_surface_destroy));
-				data.context = ::std::move(unique_ptr<cairo_t, decltype(&cairo_destroy)>(cairo_create(data.surface.get()), &cairo_destroy));
-				data.dimensions.x(width);
-				data.dimensions.y(height);
-				data.format = fmt;
+				return _Image_surface_data_from_magick_image<image_surface_data_type>(image.get(), fmt, &exInfo, ec);
+			}
+#else
+			template<class GraphicsMath>
+			typename _Cairo_graphics_surfaces<GraphicsMath>::surfaces::image_surface_data_type _Cairo_graphics_surfaces<GraphicsMath>::surfaces::create_image_surface(::std::string p, image_file_format iff, io2d::format fmt) {
+				::std::error_code ec;
+				ec.clear();
+				auto data = move(create_image_surface(p, iff, fmt, ec));
+				if (ec) {
+					throw ::std::system_error(ec);
+				}
+				return data;
+			}
 
-				// Note: We don't own the pixels pointer.
-				PixelPacket* pixels = GetImagePixelsEx(image.get(), 0, 0, width, height, &exInfo);
-				if (pixels == nullptr) {
-					ec = _Graphics_magic_exception_type_to_error_code(&exInfo);
-					DestroyExceptionInfo(&exInfo);
+#ifdef _IO2D_Has_Magick
+			template <class GraphicsMath>
+			typename _Cairo_graphics_surfaces<GraphicsMath>::surfaces::image_surface_data_type _Cairo_graphics_surfaces<GraphicsMath>::surfaces::create_image_surface(::std::string p, image_file_format iff, io2d::format fmt, ::std::error_code& ec) noexcept {
+				_Init_graphics_magic();
+				if (iff == image_file_format::unknown) {
+					ec = ::std::make_error_code(errc::not_supported);
 					return image_surface_data_type{};
 				}
+				ExceptionInfo exInfo;
+				GetExceptionInfo(&exInfo);
 
-				DestroyExceptionInfo(&exInfo);
-
-				auto map = cairo_surface_map_to_image(data.surface.get(), nullptr);
-				auto mapStride = cairo_image_surface_get_stride(map);
-				auto mapData = cairo_image_surface_get_data(map);
-				const auto channelMaxValue = static_cast<float>(numeric_limits<decltype(mattePixel.red)>::max());
-				if (image->matte != 0) {
-					for (unsigned long y = 0; y < height; y++) {
-						for (unsigned long x = 0; x < width; x++) {
-							const PixelPacket& currPixel = pixels[y * width + x];
-							auto red = static_cast<unsigned char>(currPixel.red * currPixel.opacity / channelMaxValue * 255);
-							auto green = static_cast<unsigned char>(currPixel.green * currPixel.opacity / channelMaxValue * 255);
-							auto blue = static_cast<unsigned char>(currPixel.blue * currPixel.opacity / channelMaxValue * 255);
-							auto alpha = static_cast<unsigned char>(currPixel.opacity / channelMaxValue * 255);
-							_Convert_and_set_pixel_to_io2d_format(fmt, mapData, y, x, mapStride, red, green, blue, alpha);
-						}
-					}
-				}
-				else {
-					for (unsigned long y = 0; y < height; y++) {
-						for (unsigned long x = 0; x < width; x++) {
-							const PixelPacket& currPixel = pixels[y * width + x];
-							auto red = static_cast<unsigned char>(currPixel.red / channelMaxValue * 255);
-							auto green = static_cast<unsigned char>(currPixel.green / channelMaxValue * 255);
-							auto blue = static_cast<unsigned char>(currPixel.blue / channelMaxValue * 255);
-							auto alpha = static_cast<unsigned char>(255);
-							_Convert_and_set_pixel_to_io2d_format(fmt, mapData, y, x, mapStride, red, green, blue, alpha);
-						}
-					}
+				unique_ptr<ImageInfo, decltype(&DestroyImageInfo)> imageInfo(CloneImageInfo(nullptr), &DestroyImageInfo);
+				imageInfo->depth = 8;
+				imageInfo->colorspace = TransparentColorspace;
+				auto& pathStr = p;
+				if (pathStr.length() > MaxTextExtent - 1) {
+					ec = make_error_code(errc::filename_too_long);
+					DestroyExceptionInfo(&exInfo);
+					return image_surface_data_type{};
 				}
-				cairo_surface_unmap_image(data.surface.get(), map);
-				cairo_surface_mark_dirty(data.surface.get());
-				if (cairo_surface_status(data.surface.get()) != CAIRO_STATUS_SUCCESS) {
-					ec = ::std::make_error_code(errc::operation_canceled);
+				strncpy(imageInfo->filename, pathStr.c_str(), pathStr.length());
+				PixelPacket mattePixel{};
+				imageInfo->matte_color = mattePixel;
+				unique_ptr<Image, decltype(&DestroyImage)> image(ReadImage(imageInfo.get(), &exInfo), &DestroyImage);
+				if (image == nullptr) {
+					ec = _Graphics_magic_exception_type_to_error_code(&exInfo);
+					DestroyExceptionInfo(&exInfo);
 					return image_surface_data_type{};
 				}
-				ec.clear();
-				return data;
+				return _Image_surface_data_from_magick_image<image_surface_data_type>(image.get(), fmt, &exInfo, ec);
 			}
 #endif	// _IO2D_Has_Magick
 #endif
 			template<class GraphicsMath>
-			inline typename _Cairo_graphics_surfaces<GraphicsMath>::surfaces::image_surface_data_type _Cairo_graphics_surfaces<GraphicsMath>::surfaces::move_image_surface(image_surface_data_type&& data) noexcept {
+			typename _Cairo_graphics_surfaces<GraphicsMath>::surfaces::image_surface_data_type _Cairo_graphics_surfaces<GraphicsMath>::surfaces::move_image_surface(image_surface_data_type&& data) noexcept {
 				return move(data);
 			}
+			// The new data references the same cairo surface and draws to it through a context of its own. The coverage cache is not shared.
 			template<class GraphicsMath>
-			inline void _Cairo_graphics_surfaces<GraphicsMath>::surfaces::destroy(image_surface_data_type& /*data*/) noexcept {
+			typename _Cairo_graphics_surfaces<GraphicsMath>::surfaces::image_surface_data_type _Cairo_graphics_surfaces<GraphicsMath>::surfaces::share_image_surface(const image_surface_data_type& data) {
+				image_surface_data_type result;
+				result.surface.reset(cairo_surface_reference(data.surface.get()));
+				result.context.reset(cairo_create(result.surface.get()));
+				_Throw_if_failed_cairo_status_t(cairo_status(result.context.get()));
+				result.dimensions = data.dimensions;
+				result.format = data.format;
+				return result;
+			}
+			template<class GraphicsMath>
+			bool _Cairo_graphics_surfaces<GraphicsMath>::surfaces::uses_external_memory(const image_surface_data_type& data) noexcept {
+				return data.external_memory;
+			}
+			template<class GraphicsMath>
+			void _Cairo_graphics_surfaces<GraphicsMath>::surfaces::destroy(image_surface_data_type& /*data*/) noexcept {
 				// Do nothing.
 			}
+			// The surface is referenced by data and by its own context. Any other reference means a brush still samples its pixels.
+			template<class GraphicsMath>
+			bool _Cairo_graphics_surfaces<GraphicsMath>::surfaces::is_recyclable(const image_surface_data_type& data) noexcept {
+				return data.surface != nullptr && data.context != nullptr && cairo_surface_get_reference_count(data.surface.get()) == 2;
+			}
 #if defined(_Filesystem_support_test)
 			template<class GraphicsMath>
-			inline void _Cairo_graphics_surfaces<GraphicsMath>::surfaces::save(image_surface_data_type& data, filesystem::path p, image_file_format iff) {
+			void _Cairo_graphics_surfaces<GraphicsMath>::surfaces::save(image_surface_data_type& data, filesystem::path p, image_file_format iff) {
 				_Init_graphics_magic();
 				::std::error_code ec;
 				save(data, p, iff, ec);
@@ -638,7 +672,7 @@ namespace std::experimental::io2d {
 				}
 			}
 			template<class GraphicsMath>
-			inline void _Cairo_graphics_surfaces<GraphicsMath>::surfaces::save(image_surface_data_type& data, filesystem::path p, image_file_format iff, error_code& ec) noexcept {
+			void _Cairo_graphics_surfaces<GraphicsMath>::surfaces::save(image_surface_data_type& data, filesystem::path p, image_file_format iff, error_code& ec) noexcept {
 				_Init_graphics_magic();
 				if (iff == image_file_format::unknown) {
 					ec = make_error_code(errc::not_supported);
@@ -824,7 +858,7 @@ namespace std::experimental::io2d {
 			}
 #else
 			template<class GraphicsMath>
-			inline void _Cairo_graphics_surfaces<GraphicsMath>::surfaces::save(image_surface_data_type& data, ::std::string p, image_file_format iff) {
+			void _Cairo_graphics_surfaces<GraphicsMath>::surfaces::save(image_surface_data_type& data, ::std::string p, image_file_format iff) {
 				_Init_graphics_magic();
 				::std::error_code ec;
 				save(data, p, iff, ec);
@@ -835,7 +869,7 @@ namespace std::experimental::io2d {
 
 #ifdef _IO2D_Has_Magick
 			template<class GraphicsMath>
-			inline void _Cairo_graphics_surfaces<GraphicsMath>::surfaces::save(image_surface_data_type& data, ::std::string p, image_file_format iff, error_code& ec) noexcept {
+			void _Cairo_graphics_surfaces<GraphicsMath>::surfaces::save(image_surface_data_type& data, ::std::string p, image_file_format iff, error_code& ec) noexcept {
 				_Init_graphics_magic();
 				if (iff == image_file_format::unknown) {
 					ec = make_error_code(errc::not_supported);
@@ -940,15 +974,15 @@ namespace std::experimental::io2d {
 #endif	// _IO2D_Has_Magick
 #endif
 			template<class GraphicsMath>
-			inline io2d::format _Cairo_graphics_surfaces<GraphicsMath>::surfaces::format(const image_surface_data_type& data) noexcept {
+			io2d::format _Cairo_graphics_surfaces<GraphicsMath>::surfaces::format(const image_surface_data_type& data) noexcept {
 				return data.format;
 			}
 			template<class GraphicsMath>
-			inline basic_display_point<GraphicsMath> _Cairo_graphics_surfaces<GraphicsMath>::surfaces::dimensions(const image_surface_data_type& data) noexcept {
+			basic_display_point<GraphicsMath> _Cairo_graphics_surfaces<GraphicsMath>::surfaces::dimensions(const image_surface_data_type& data) noexcept {
 				return data.dimensions;
 			}
 			template<class GraphicsMath>
-			inline void _Cairo_graphics_surfaces<GraphicsMath>::surfaces::clear(image_surface_data_type& data) {
+			void _Cairo_graphics_surfaces<GraphicsMath>::surfaces::clear(image_surface_data_type& data) {
 				auto ctx = data.context.get();
 				cairo_save(ctx);
 				cairo_set_operator(ctx, CAIRO_OPERATOR_CLEAR);
@@ -957,77 +991,309 @@ namespace std::experimental::io2d {
 				cairo_restore(ctx);
 			}
 			template<class GraphicsMath>
-			inline void _Cairo_graphics_surfaces<GraphicsMath>::surfaces::flush(image_surface_data_type& data) {
+			void _Cairo_graphics_surfaces<GraphicsMath>::surfaces::flush(image_surface_data_type& data) {
 				cairo_surface_flush(data.surface.get());
 			}
 			template<class GraphicsMath>
-			inline void _Cairo_graphics_surfaces<GraphicsMath>::surfaces::flush(image_surface_data_type& data, error_code& ec) noexcept {
+			void _Cairo_graphics_surfaces<GraphicsMath>::surfaces::flush(image_surface_data_type& data, error_code& ec) noexcept {
 				cairo_surface_flush(data.surface.get());
 				ec.clear();
 			}
 			template<class GraphicsMath>
-			inline void _Cairo_graphics_surfaces<GraphicsMath>::surfaces::mark_dirty(image_surface_data_type& data) {
+			void _Cairo_graphics_surfaces<GraphicsMath>::surfaces::mark_dirty(image_surface_data_type& data) {
 				cairo_surface_mark_dirty(data.surface.get());
 			}
 			template<class GraphicsMath>
-			inline void _Cairo_graphics_surfaces<GraphicsMath>::surfaces::mark_dirty(image_surface_data_type& data, error_code& ec) noexcept {
+			void _Cairo_graphics_surfaces<GraphicsMath>::surfaces::mark_dirty(image_surface_data_type& data, error_code& ec) noexcept {
 				cairo_surface_mark_dirty(data.surface.get());
 				ec.clear();
 			}
 			template<class GraphicsMath>
-			inline void _Cairo_graphics_surfaces<GraphicsMath>::surfaces::mark_dirty(image_surface_data_type& data, const basic_bounding_box<GraphicsMath>& extents) {
+			void _Cairo_graphics_surfaces<GraphicsMath>::surfaces::mark_dirty(image_surface_data_type& data, const basic_bounding_box<GraphicsMath>& extents) {
 				cairo_surface_mark_dirty_rectangle(data.surface.get(), _Float_to_int(extents.x()), _Float_to_int(extents.y()), _Float_to_int(extents.width()), _Float_to_int(extents.height()));
 			}
 			template<class GraphicsMath>
-			inline void _Cairo_graphics_surfaces<GraphicsMath>::surfaces::mark_dirty(image_surface_data_type& data, const basic_bounding_box<GraphicsMath>& extents, error_code& ec) noexcept {
+			void _Cairo_graphics_surfaces<GraphicsMath>::surfaces::mark_dirty(image_surface_data_type& data, const basic_bounding_box<GraphicsMath>& extents, error_code& ec) noexcept {
 				cairo_surface_mark_dirty_rectangle(data.surface.get(), _Float_to_int(extents.x()), _Float_to_int(extents.y()), _Float_to_int(extents.width()), _Float_to_int(extents.height()));
 				ec.clear();
 			}
 			template<class GraphicsMath>
-			inline void _Cairo_graphics_surfaces<GraphicsMath>::surfaces::paint(image_surface_data_type& data, const basic_brush<_Graphics_surfaces_type>& b, const basic_brush_props<_Graphics_surfaces_type>& bp, const basic_render_props<_Graphics_surfaces_type>& rp, const basic_clip_props<_Graphics_surfaces_type>& cl) {
+			void _Cairo_graphics_surfaces<GraphicsMath>::surfaces::paint(image_surface_data_type& data, const basic_brush<_Graphics_surfaces_type>& b, const basic_brush_props<_Graphics_surfaces_type>& bp, const basic_render_props<_Graphics_surfaces_type>& rp, const basic_clip_props<_Graphics_surfaces_type>& cl) {
 				auto context = data.context.get();
 				_Set_render_props(context, rp);
-				_Set_clip_props(context, cl);
+				const auto clipMask = _Set_clip_props_or_mask(context, data.dimensions, data.clip_masks, cl, rp.compositing());
 				_Set_brush_props(context, bp, b);
-				cairo_set_source(context, b.data().brush.get());
+				if (clipMask != nullptr) {
+					cairo_identity_matrix(context);
+					cairo_mask_surface(context, clipMask->surface.get(), clipMask->x, clipMask->y);
+					return;
+				}
 				cairo_paint(context);
 			}
 			template<class GraphicsMath>
-			inline void _Cairo_graphics_surfaces<GraphicsMath>::surfaces::stroke(image_surface_data_type& data, const basic_brush<_Graphics_surfaces_type>& b, const basic_interpreted_path<_Graphics_surfaces_type>& ip, const basic_brush_props<_Graphics_surfaces_type>& bp, const basic_stroke_props<_Graphics_surfaces_type>& sp, const basic_dashes<_Graphics_surfaces_type>& d, const basic_render_props<_Graphics_surfaces_type>& rp, const basic_clip_props<_Graphics_surfaces_type>& cl) {
+			void _Cairo_graphics_surfaces<GraphicsMath>::surfaces::stroke(image_surface_data_type& data, const basic_brush<_Graphics_surfaces_type>& b, const basic_interpreted_path<_Graphics_surfaces_type>& ip, const basic_brush_props<_Graphics_surfaces_type>& bp, const basic_stroke_props<_Graphics_surfaces_type>& sp, const basic_dashes<_Graphics_surfaces_type>& d, const basic_render_props<_Graphics_surfaces_type>& rp, const basic_clip_props<_Graphics_surfaces_type>& cl) {
+				if (_Is_culled(data.dimensions, ip.data().bounds, _Stroke_extent(sp), rp, cl)) {
+					return;
+				}
 				auto context = data.context.get();
 				_Set_render_props(context, rp);
 				_Set_clip_props(context, cl);
 				_Set_brush_props(context, bp, b);
 				_Set_stroke_props(context, sp, sp.max_miter_limit(), d);
-				cairo_set_source(context, b.data().brush.get());
 				cairo_new_path(context);
 				cairo_append_path(context, ip.data().path.get());
 				cairo_stroke(context);
 			}
 			template<class GraphicsMath>
-			inline void _Cairo_graphics_surfaces<GraphicsMath>::surfaces::fill(image_surface_data_type& data, const basic_brush<_Graphics_surfaces_type>& b, const basic_interpreted_path<_Graphics_surfaces_type>& ip, const basic_brush_props<_Graphics_surfaces_type>& bp, const basic_render_props<_Graphics_surfaces_type>& rp, const basic_clip_props<_Graphics_surfaces_type>& cl) {
+			void _Cairo_graphics_surfaces<GraphicsMath>::surfaces::fill(image_surface_data_type& data, const basic_brush<_Graphics_surfaces_type>& b, const basic_interpreted_path<_Graphics_surfaces_type>& ip, const basic_brush_props<_Graphics_surfaces_type>& bp, const basic_render_props<_Graphics_surfaces_type>& rp, const basic_clip_props<_Graphics_surfaces_type>& cl) {
+				if (_Is_culled(data.dimensions, ip.data().bounds, 0.0F, rp, cl)) {
+					return;
+				}
+				auto context = data.context.get();
+				_Set_render_props(context, rp);
+				const auto clipMask = _Set_clip_props_or_mask(context, data.dimensions, data.clip_masks, cl, rp.compositing());
+				_Set_brush_props(context, bp, b);
+				// A coverage mask only covers the path's bounds, so unbounded operators always fill the path itself.
+				if (clipMask == nullptr && data.coverage_cache != nullptr && !_Is_unbounded_operator(rp.compositing()) && _Fill_with_coverage_cache(context, *data.coverage_cache, ip.data().path, ip.data().bounds, rp.surface_matrix())) {
+					return;
+				}
+				cairo_new_path(context);
+				cairo_append_path(context, ip.data().path.get());
+				_Fill_through_clip_mask(context, clipMask);
+			}
+			// Rectangles and circles are added with cairo_rectangle and cairo_arc rather than through an interpreted path.
+			template<class GraphicsMath>
+			void _Cairo_graphics_surfaces<GraphicsMath>::surfaces::fill_rect(image_surface_data_type& data, const basic_brush<_Graphics_surfaces_type>& b, const basic_bounding_box<GraphicsMath>& bb, const basic_brush_props<_Graphics_surfaces_type>& bp, const basic_render_props<_Graphics_surfaces_type>& rp, const basic_clip_props<_Graphics_surfaces_type>& cl) {
+				if (_Is_culled(data.dimensions, bb, 0.0F, rp, cl) || _Fill_pixel_aligned_rect(data.surface.get(), b, bb, rp, cl)) {
+					return;
+				}
+				auto context = data.context.get();
+				_Set_render_props(context, rp);
+				const auto clipMask = _Set_clip_props_or_mask(context, data.dimensions, data.clip_masks, cl, rp.compositing());
+				_Set_brush_props(context, bp, b);
+				cairo_new_path(context);
+				cairo_rectangle(context, bb.x(), bb.y(), bb.width(), bb.height());
+				_Fill_through_clip_mask(context, clipMask);
+			}
+			template<class GraphicsMath>
+			void _Cairo_graphics_surfaces<GraphicsMath>::surfaces::stroke_rect(image_surface_data_type& data, const basic_brush<_Graphics_surfaces_type>& b, const basic_bounding_box<GraphicsMath>& bb, const basic_brush_props<_Graphics_surfaces_type>& bp, const basic_stroke_props<_Graphics_surfaces_type>& sp, const basic_dashes<_Graphics_surfaces_type>& d, const basic_render_props<_Graphics_surfaces_type>& rp, const basic_clip_props<_Graphics_surfaces_type>& cl) {
+				if (_Is_culled(data.dimensions, bb, _Stroke_extent(sp), rp, cl)) {
+					return;
+				}
 				auto context = data.context.get();
 				_Set_render_props(context, rp);
 				_Set_clip_props(context, cl);
 				_Set_brush_props(context, bp, b);
-				cairo_set_source(context, b.data().brush.get());
+				_Set_stroke_props(context, sp, sp.max_miter_limit(), d);
+				cairo_new_path(context);
+				cairo_rectangle(context, bb.x(), bb.y(), bb.width(), bb.height());
+				cairo_stroke(context);
+			}
+			template<class GraphicsMath>
+			void _Cairo_graphics_surfaces<GraphicsMath>::surfaces::fill_circle(image_surface_data_type& data, const basic_brush<_Graphics_surfaces_type>& b, const basic_circle<GraphicsMath>& c, const basic_brush_props<_Graphics_surfaces_type>& bp, const basic_render_props<_Graphics_surfaces_type>& rp, const basic_clip_props<_Graphics_surfaces_type>& cl) {
+				const auto center = c.center();
+				const float radius = c.radius();
+				if (_Is_culled(data.dimensions, basic_bounding_box<GraphicsMath>(center.x() - radius, center.y() - radius, 2.0F * radius, 2.0F * radius), 0.0F, rp, cl)) {
+					return;
+				}
+				auto context = data.context.get();
+				_Set_render_props(context, rp);
+				const auto clipMask = _Set_clip_props_or_mask(context, data.dimensions, data.clip_masks, cl, rp.compositing());
+				_Set_brush_props(context, bp, b);
+				cairo_new_path(context);
+				cairo_arc(context, center.x(), center.y(), radius, 0.0, two_pi<double>);
+				_Fill_through_clip_mask(context, clipMask);
+			}
+			// The path is appended once and filled with cairo_fill_preserve, so the stroke reuses it along with the render and clip state.
+			template<class GraphicsMath>
+			void _Cairo_graphics_surfaces<GraphicsMath>::surfaces::fill_stroke(image_surface_data_type& data, const basic_brush<_Graphics_surfaces_type>& fb, const basic_brush<_Graphics_surfaces_type>& sb, const basic_interpreted_path<_Graphics_surfaces_type>& ip, const basic_brush_props<_Graphics_surfaces_type>& bp, const basic_stroke_props<_Graphics_surfaces_type>& sp, const basic_dashes<_Graphics_surfaces_type>& d, const basic_render_props<_Graphics_surfaces_type>& rp, const basic_clip_props<_Graphics_surfaces_type>& cl) {
+				if (_Is_culled(data.dimensions, ip.data().bounds, _Stroke_extent(sp), rp, cl)) {
+					return;
+				}
+				auto context = data.context.get();
+				_Set_render_props(context, rp);
+				_Set_clip_props(context, cl);
+				_Set_brush_props(context, bp, fb);
+				_Set_stroke_props(context, sp, sp.max_miter_limit(), d);
 				cairo_new_path(context);
 				cairo_append_path(context, ip.data().path.get());
-				cairo_fill(context);
+				cairo_fill_preserve(context);
+				_Set_brush_props(context, bp, sb);
+				cairo_stroke(context);
+			}
+			// Render, clip and brush state is set once for every instance; only the transform and the source change between them. When several instances differ from
+			// the first only by a whole pixel translation, the path is rasterized once into an A8 coverage mask for the first instance's transform and that mask is
+			// stamped with cairo_mask_surface for each of them, which gives the same pixels as filling the path at each position.
+			template<class GraphicsMath>
+			void _Cairo_graphics_surfaces<GraphicsMath>::surfaces::fill_instances(image_surface_data_type& data, const basic_brush<_Graphics_surfaces_type>& b, const basic_interpreted_path<_Graphics_surfaces_type>& ip, const _Fill_instance_range<GraphicsMath>& instances, const basic_brush_props<_Graphics_surfaces_type>& bp, const basic_render_props<_Graphics_surfaces_type>& rp, const basic_clip_props<_Graphics_surfaces_type>& cl) {
+				if (instances.empty()) {
+					return;
+				}
+				auto context = data.context.get();
+				_Set_render_props(context, rp);
+				_Set_clip_props(context, cl);
+				cairo_set_fill_rule(context, _Fill_rule_to_cairo_fill_rule_t(bp.fill_rule()));
+				const auto& surfaceMatrix = rp.surface_matrix();
+				const auto& bounds = ip.data().bounds;
+				const bool solidBrush = (b.type() == brush_type::solid_color);
+				unique_ptr<cairo_pattern_t, decltype(&cairo_pattern_destroy)> pattern(nullptr, &cairo_pattern_destroy);
+				if (!solidBrush) {
+					pattern = _Create_brush_pattern(b, bp);
+				}
+
+				::std::vector<basic_matrix_2d<GraphicsMath>> matrices;
+				matrices.reserve(instances.size());
+				for (const auto& instance : instances) {
+					matrices.push_back(instance.matrix() * surfaceMatrix);
+				}
+				const auto& first = matrices.front();
+				auto isStampable = [&first](const basic_matrix_2d<GraphicsMath>& m) {
+					const float dx = m.m20() - first.m20();
+					const float dy = m.m21() - first.m21();
+					return m.m00() == first.m00() && m.m01() == first.m01() && m.m10() == first.m10() && m.m11() == first.m11() && dx == ::std::round(dx) && dy == ::std::round(dy);
+				};
+				// A stamp has no opacity of its own, so an instance's alpha must be folded into a solid source color for it to be stamped.
+				auto alphaInSource = [solidBrush](const basic_fill_instance<GraphicsMath>& instance) {
+					return instance.color().has_value() || solidBrush || instance.alpha() == 1.0F;
+				};
+
+				unique_ptr<cairo_surface_t, decltype(&cairo_surface_destroy)> stamp(nullptr, &cairo_surface_destroy);
+				int stampX = 0;
+				int stampY = 0;
+				if (!_Is_unbounded_operator(rp.compositing())) {
+					size_t stampCount = 0;
+					for (size_t i = 0; i < instances.size() && stampCount < 2; ++i) {
+						if (alphaInSource(instances[i]) && isStampable(matrices[i])) {
+							++stampCount;
+						}
+					}
+					const auto deviceBounds = _Transformed_bounds(bounds, first);
+					const float maxOrigin = 1.0e6F;
+					if (stampCount >= 2 && ::std::abs(deviceBounds.x()) < maxOrigin && ::std::abs(deviceBounds.y()) < maxOrigin && deviceBounds.width() < data.dimensions.x() && deviceBounds.height() < data.dimensions.y()) {
+						// One extra pixel on each side holds the antialiased edges.
+						stampX = static_cast<int>(::std::floor(deviceBounds.x())) - 1;
+						stampY = static_cast<int>(::std::floor(deviceBounds.y())) - 1;
+						const int stampWidth = static_cast<int>(::std::ceil(deviceBounds.x() + deviceBounds.width())) + 1 - stampX;
+						const int stampHeight = static_cast<int>(::std::ceil(deviceBounds.y() + deviceBounds.height())) + 1 - stampY;
+						stamp.reset(cairo_image_surface_create(CAIRO_FORMAT_A8, stampWidth, stampHeight));
+						unique_ptr<cairo_t, decltype(&cairo_destroy)> stampContext(cairo_create(stamp.get()), &cairo_destroy);
+						_Throw_if_failed_cairo_status_t(cairo_status(stampContext.get()));
+						const cairo_matrix_t cm{ first.m00(), first.m01(), first.m10(), first.m11(), first.m20(), first.m21() };
+						cairo_translate(stampContext.get(), -stampX, -stampY);
+						cairo_transform(stampContext.get(), &cm);
+						cairo_set_antialias(stampContext.get(), cairo_get_antialias(context));
+						cairo_set_fill_rule(stampContext.get(), cairo_get_fill_rule(context));
+						cairo_append_path(stampContext.get(), ip.data().path.get());
+						cairo_fill(stampContext.get());
+					}
+				}
+
+				for (size_t i = 0; i < instances.size(); ++i) {
+					const auto& instance = instances[i];
+					const auto& m = matrices[i];
+					if (_Is_culled(data.dimensions, bounds, 0.0F, m, surfaceMatrix, rp.compositing(), cl)) {
+						continue;
+					}
+					const cairo_matrix_t cm{ m.m00(), m.m01(), m.m10(), m.m11(), m.m20(), m.m21() };
+					cairo_set_matrix(context, &cm);
+					if (instance.color().has_value()) {
+						const auto& c = instance.color().value();
+						cairo_set_source_rgba(context, c.r(), c.g(), c.b(), c.a() * instance.alpha());
+					}
+					else if (solidBrush) {
+						const auto& c = b.data().color;
+						cairo_set_source_rgba(context, c.r(), c.g(), c.b(), c.a() * instance.alpha());
+					}
+					else {
+						// Locks the brush to this instance's user space, as fill would.
+						cairo_set_source(context, pattern.get());
+					}
+					if (stamp != nullptr && alphaInSource(instance) && isStampable(m)) {
+						cairo_identity_matrix(context);
+						cairo_mask_surface(context, stamp.get(), stampX + (m.m20() - first.m20()), stampY + (m.m21() - first.m21()));
+					}
+					else {
+						cairo_new_path(context);
+						cairo_append_path(context, ip.data().path.get());
+						if (alphaInSource(instance)) {
+							cairo_fill(context);
+						}
+						else {
+							cairo_save(context);
+							cairo_clip(context);
+							cairo_paint_with_alpha(context, instance.alpha());
+							cairo_restore(context);
+						}
+					}
+				}
 			}
 			template<class GraphicsMath>
-			inline void _Cairo_graphics_surfaces<GraphicsMath>::surfaces::mask(image_surface_data_type& data, const basic_brush<_Graphics_surfaces_type>& b, const basic_brush<_Graphics_surfaces_type>& mb, const basic_brush_props<_Graphics_surfaces_type>& bp, const basic_mask_props<_Graphics_surfaces_type>& mp, const basic_render_props<_Graphics_surfaces_type>& rp, const basic_clip_props<_Graphics_surfaces_type>& cl) {
+			void _Cairo_graphics_surfaces<GraphicsMath>::surfaces::mask(image_surface_data_type& data, const basic_brush<_Graphics_surfaces_type>& b, const basic_brush<_Graphics_surfaces_type>& mb, const basic_brush_props<_Graphics_surfaces_type>& bp, const basic_mask_props<_Graphics_surfaces_type>& mp, const basic_render_props<_Graphics_surfaces_type>& rp, const basic_clip_props<_Graphics_surfaces_type>& cl) {
 				auto context = data.context.get();
 				_Set_render_props(context, rp);
 				_Set_clip_props(context, cl);
 				_Set_brush_props(context, bp, b);
-				_Set_mask_props(mp, mb);
-				cairo_set_source(context, b.data().brush.get());
+				const auto maskPattern = _Create_brush_pattern(mb, mp.wrap_mode(), mp.filter(), mp.mask_matrix());
 				cairo_new_path(context);
-				cairo_mask(context, mb.data().brush.get());
+				cairo_mask(context, maskPattern.get());
+			}
+			// Rows are moved with memmove, bottom to top when the block moves down within one surface, so overlapping blocks are read before they are written.
+			template<class GraphicsMath>
+			void _Cairo_graphics_surfaces<GraphicsMath>::surfaces::copy_region(const image_surface_data_type& src, int x, int y, int width, int height, image_surface_data_type& dst, int dstX, int dstY) {
+				const auto srcSurface = src.surface.get();
+				const auto dstSurface = dst.surface.get();
+				cairo_surface_flush(srcSurface);
+				if (dstSurface != srcSurface) {
+					cairo_surface_flush(dstSurface);
+				}
+				const size_t bytesPerPixel = cairo_image_surface_get_format(dstSurface) == CAIRO_FORMAT_A8 ? 1 : 4;
+				const auto rowBytes = static_cast<size_t>(width) * bytesPerPixel;
+				const ptrdiff_t srcStride = cairo_image_surface_get_stride(srcSurface);
+				const ptrdiff_t dstStride = cairo_image_surface_get_stride(dstSurface);
+				auto srcRow = cairo_image_surface_get_data(srcSurface) + y * srcStride + static_cast<ptrdiff_t>(x * bytesPerPixel);
+				auto dstRow = cairo_image_surface_get_data(dstSurface) + dstY * dstStride + static_cast<ptrdiff_t>(dstX * bytesPerPixel);
+				if (dstSurface == srcSurface && dstY > y) {
+					for (int row = height - 1; row >= 0; --row) {
+						::std::memmove(dstRow + row * dstStride, srcRow + row * srcStride, rowBytes);
+					}
+				}
+				else {
+					for (int row = 0; row < height; ++row) {
+						::std::memmove(dstRow + row * dstStride, srcRow + row * srcStride, rowBytes);
+					}
+				}
+				cairo_surface_mark_dirty_rectangle(dstSurface, dstX, dstY, width, height);
+			}
+			template<class GraphicsMath>
+			::std::byte* _Cairo_graphics_surfaces<GraphicsMath>::surfaces::pixels(image_surface_data_type& data) noexcept {
+				return reinterpret_cast<::std::byte*>(cairo_image_surface_get_data(data.surface.get()));
+			}
+			template<class GraphicsMath>
+			int _Cairo_graphics_surfaces<GraphicsMath>::surfaces::stride(const image_surface_data_type& data) noexcept {
+				return cairo_image_surface_get_stride(data.surface.get());
+			}
+			template<class GraphicsMath>
+			void _Cairo_graphics_surfaces<GraphicsMath>::surfaces::coverage_cache_limit(image_surface_data_type& data, size_t bytes) {
+				if (bytes == 0) {
+					data.coverage_cache.reset();
+				}
+				else if (data.coverage_cache == nullptr) {
+					data.coverage_cache = make_unique<_Coverage_mask_cache>(bytes);
+				}
+				else {
+					data.coverage_cache->limit(bytes);
+				}
+			}
+			template<class GraphicsMath>
+			size_t _Cairo_graphics_surfaces<GraphicsMath>::surfaces::coverage_cache_limit(const image_surface_data_type& data) noexcept {
+				return data.coverage_cache == nullptr ? 0 : data.coverage_cache->limit();
+			}
+			template<class GraphicsMath>
+			coverage_cache_stats _Cairo_graphics_surfaces<GraphicsMath>::surfaces::coverage_cache_statistics(const image_surface_data_type& data) noexcept {
+				return data.coverage_cache == nullptr ? coverage_cache_stats() : data.coverage_cache->stats();
 			}
             template<class GraphicsMath>
-            inline _Interchange_buffer _Cairo_graphics_surfaces<GraphicsMath>::surfaces::_Copy_to_interchange_buffer(image_surface_data_type& data, _Interchange_buffer::pixel_layout layout, _Interchange_buffer::alpha_mode alpha) {
+            _Interchange_buffer _Cairo_graphics_surfaces<GraphicsMath>::surfaces::_Copy_to_interchange_buffer(image_surface_data_type& data, _Interchange_buffer::pixel_layout layout, _Interchange_buffer::alpha_mode alpha) {
                 auto fmt = data.format;
                 auto map = cairo_surface_map_to_image(data.surface.get(), nullptr);
                 auto stride = cairo_image_surface_get_stride(map);
@@ -25,7 +25,7 @@ namespace std::experimental::io2d {
 			// Helpers to set state when rendering
 
 			template <class GraphicsMath>
-			inline void _Set_render_props(cairo_t* context, const basic_render_props<_Cairo_graphics_surfaces<GraphicsMath>>& r) {
+			void _Set_render_props(cairo_t* context, const basic_render_props<_Cairo_graphics_surfaces<GraphicsMath>>& r) {
 				const auto& props = r;
 				const auto m = props.surface_matrix();
 				cairo_matrix_t cm{ m.m00(), m.m01(), m.m10(), m.m11(), m.m20(), m.m21() };
@@ -34,11 +34,52 @@ namespace std::experimental::io2d {
 				cairo_set_operator(context, _Compositing_operator_to_cairo_operator_t(props.compositing()));
 			}
 
+			// Returns true, with the device space rectangle in r, if the edges of bb all land on whole pixels under m.
 			template <class GraphicsMath>
-			inline void _Set_clip_props(cairo_t* context, const basic_clip_props<_Cairo_graphics_surfaces<GraphicsMath>>& c) {
+			bool _Pixel_aligned_rect(const basic_bounding_box<GraphicsMath>& bb, const cairo_matrix_t& m, cairo_rectangle_int_t& r) noexcept {
+				if (m.xy != 0.0 || m.yx != 0.0) {
+					return false;
+				}
+				const double x0 = m.xx * bb.x() + m.x0;
+				const double x1 = m.xx * (bb.x() + bb.width()) + m.x0;
+				const double y0 = m.yy * bb.y() + m.y0;
+				const double y1 = m.yy * (bb.y() + bb.height()) + m.y0;
+				const double edges[4] = { ::std::min(x0, x1), ::std::min(y0, y1), ::std::max(x0, x1), ::std::max(y0, y1) };
+				int whole[4];
+				for (int i = 0; i < 4; ++i) {
+					if (!(::std::abs(edges[i]) < 1.0e6 && ::std::abs(edges[i] - ::std::round(edges[i])) < 1.0 / 256.0)) {
+						return false;
+					}
+					whole[i] = static_cast<int>(::std::round(edges[i]));
+				}
+				r = { whole[0], whole[1], whole[2] - whole[0], whole[3] - whole[1] };
+				return true;
+			}
+
+			// Returns true, with the clip's device space rectangle in r, if c's clip was made from a bounding box whose edges all land on whole pixels under m.
+			template <class GraphicsMath>
+			bool _Pixel_aligned_clip_rect(const basic_clip_props<_Cairo_graphics_surfaces<GraphicsMath>>& c, const cairo_matrix_t& m, cairo_rectangle_int_t& r) noexcept {
+				const auto& rect = c.data().rect;
+				return rect.has_value() && _Pixel_aligned_rect(rect.value(), m, r);
+			}
+
+			template <class GraphicsMath>
+			void _Set_clip_props(cairo_t* context, const basic_clip_props<_Cairo_graphics_surfaces<GraphicsMath>>& c) {
 				cairo_reset_clip(context);
 				const auto& props = c.data();
 				if (props.clip.has_value()) {
+					cairo_matrix_t m;
+					cairo_get_matrix(context, &m);
+					cairo_rectangle_int_t r;
+					if (_Pixel_aligned_clip_rect(c, m, r)) {
+						// cairo clips to a whole pixel rectangle in device space exactly, without computing any coverage.
+						cairo_identity_matrix(context);
+						cairo_new_path(context);
+						cairo_rectangle(context, r.x, r.y, r.width, r.height);
+						cairo_clip(context);
+						cairo_set_matrix(context, &m);
+						return;
+					}
 					cairo_fill_rule_t fr = cairo_get_fill_rule(context);
 					cairo_set_fill_rule(context, _Fill_rule_to_cairo_fill_rule_t(props.fr));
 					cairo_new_path(context);
@@ -51,7 +92,7 @@ namespace std::experimental::io2d {
 			}
 
 			template <class GraphicsMath>
-			inline void _Set_stroke_props(cairo_t* context, const basic_stroke_props<_Cairo_graphics_surfaces<GraphicsMath>>& s, float miterMax, const basic_dashes<_Cairo_graphics_surfaces<GraphicsMath>>& ds) {
+			void _Set_stroke_props(cairo_t* context, const basic_stroke_props<_Cairo_graphics_surfaces<GraphicsMath>>& s, float miterMax, const basic_dashes<_Cairo_graphics_surfaces<GraphicsMath>>& ds) {
 				const auto& props = s.data();
 				cairo_set_line_width(context, props._Line_width);
 				cairo_set_line_cap(context, _Line_cap_to_cairo_line_cap_t(props._Line_cap));
@@ -60,70 +101,469 @@ namespace std::experimental::io2d {
 
 				const auto& d = ds.data();
 				const auto& dFloatVal = d.pattern;
-				vector<double> dashAsDouble(dFloatVal.size());
-				for (const auto& val : dFloatVal) {
-					dashAsDouble.push_back(static_cast<double>(val));
-				}
+				vector<double> dashAsDouble(dFloatVal.begin(), dFloatVal.end());
 				cairo_set_dash(context, dashAsDouble.data(), _Container_size_to_int(dashAsDouble), static_cast<double>(d.offset));
 				if (cairo_status(context) == CAIRO_STATUS_INVALID_DASH) {
 					_Throw_if_failed_cairo_status_t(CAIRO_STATUS_INVALID_DASH);
 				}
 			}
 
+			// Returns a pattern that draws b with the given wrap mode, filter and matrix. The brush's own pattern is never modified, so one brush can be used by
+			// any number of draws at once, including draws on different threads. Solid color brushes have no pattern, so one is created from their color.
 			template <class GraphicsMath>
-			inline void _Set_brush_props(cairo_t* context, const basic_brush_props<_Cairo_graphics_surfaces<GraphicsMath>>& bp, const basic_brush<_Cairo_graphics_surfaces<GraphicsMath>>& b) {
-				const auto& props = bp;
-				auto p = b.data().brush.get();
-				cairo_pattern_set_extend(p, _Extend_to_cairo_extend_t(props.wrap_mode()));
-				cairo_pattern_set_filter(p, _Filter_to_cairo_filter_t(props.filter()));
-				const auto& m = props.brush_matrix();
-				cairo_matrix_t cm{ m.m00(), m.m01(), m.m10(), m.m11(), m.m20(), m.m21() };
-				cairo_pattern_set_matrix(p, &cm);
-				cairo_set_fill_rule(context, _Fill_rule_to_cairo_fill_rule_t(props.fill_rule()));
-				//}
-			}
-
-			template <class GraphicsSurfaces>
-			inline void _Set_mask_props(const basic_mask_props<GraphicsSurfaces>& mp, const basic_brush<GraphicsSurfaces>& b) {
-				const auto& props = mp;
-				auto p = b.data().brush.get();
-				cairo_pattern_set_extend(p, _Extend_to_cairo_extend_t(props.wrap_mode()));
-				cairo_pattern_set_filter(p, _Filter_to_cairo_filter_t(props.filter()));
-				const auto& m = props.mask_matrix();
-				cairo_matrix_t cm{ m.m00(), m.m01(), m.m10(), m.m11(), m.m20(), m.m21() };
-				cairo_pattern_set_matrix(p, &cm);
+			unique_ptr<cairo_pattern_t, decltype(&cairo_pattern_destroy)> _Create_brush_pattern(const basic_brush<_Cairo_graphics_surfaces<GraphicsMath>>& b, io2d::wrap_mode w, io2d::filter f, const basic_matrix_2d<GraphicsMath>& m) {
+				const auto& data = b.data();
+				auto source = data.brush.get();
+				unique_ptr<cairo_pattern_t, decltype(&cairo_pattern_destroy)> p(nullptr, &cairo_pattern_destroy);
+				switch (data.brushType) {
+				case brush_type::solid_color:
+					p.reset(cairo_pattern_create_rgba(data.color.r(), data.color.g(), data.color.b(), data.color.a()));
+					return p;
+				case brush_type::surface:
+					p.reset(cairo_pattern_create_for_surface(data.imageSurface.get()));
+					break;
+				case brush_type::linear:
+				{
+					double x0, y0, x1, y1;
+					cairo_pattern_get_linear_points(source, &x0, &y0, &x1, &y1);
+					p.reset(cairo_pattern_create_linear(x0, y0, x1, y1));
+				} break;
+				case brush_type::radial:
+				{
+					double x0, y0, r0, x1, y1, r1;
+					cairo_pattern_get_radial_circles(source, &x0, &y0, &r0, &x1, &y1, &r1);
+					p.reset(cairo_pattern_create_radial(x0, y0, r0, x1, y1, r1));
+				} break;
+				}
+				_Throw_if_failed_cairo_status_t(cairo_pattern_status(p.get()));
+				if (data.brushType == brush_type::linear || data.brushType == brush_type::radial) {
+					int stopCount = 0;
+					cairo_pattern_get_color_stop_count(source, &stopCount);
+					for (int i = 0; i < stopCount; ++i) {
+						double offset, r, g, bl, a;
+						cairo_pattern_get_color_stop_rgba(source, i, &offset, &r, &g, &bl, &a);
+						cairo_pattern_add_color_stop_rgba(p.get(), offset, r, g, bl, a);
+					}
+				}
+				cairo_pattern_set_extend(p.get(), _Extend_to_cairo_extend_t(w));
+				cairo_pattern_set_filter(p.get(), _Filter_to_cairo_filter_t(f));
+				const cairo_matrix_t cm{ m.m00(), m.m01(), m.m10(), m.m11(), m.m20(), m.m21() };
+				cairo_pattern_set_matrix(p.get(), &cm);
+				return p;
+			}
+
+			template <class GraphicsMath>
+			unique_ptr<cairo_pattern_t, decltype(&cairo_pattern_destroy)> _Create_brush_pattern(const basic_brush<_Cairo_graphics_surfaces<GraphicsMath>>& b, const basic_brush_props<_Cairo_graphics_surfaces<GraphicsMath>>& bp) {
+				return _Create_brush_pattern(b, bp.wrap_mode(), bp.filter(), bp.brush_matrix());
+			}
+
+			template <class GraphicsMath>
+			unique_ptr<cairo_pattern_t, decltype(&cairo_pattern_destroy)> _Create_brush_pattern(const basic_brush<_Cairo_graphics_surfaces<GraphicsMath>>& b, const optional<basic_brush_props<_Cairo_graphics_surfaces<GraphicsMath>>>& bp) {
+				return _Create_brush_pattern(b, bp.value_or(basic_brush_props<_Cairo_graphics_surfaces<GraphicsMath>>()));
+			}
+
+			// Sets the fill rule and makes b the source of context. Solid colors are set directly, which needs no pattern object; other brushes use a pattern
+			// created by _Create_brush_pattern.
+			template <class GraphicsMath>
+			void _Set_brush_props(cairo_t* context, const basic_brush_props<_Cairo_graphics_surfaces<GraphicsMath>>& bp, const basic_brush<_Cairo_graphics_surfaces<GraphicsMath>>& b) {
+				cairo_set_fill_rule(context, _Fill_rule_to_cairo_fill_rule_t(bp.fill_rule()));
+				const auto& data = b.data();
+				if (data.brushType == brush_type::solid_color) {
+					cairo_set_source_rgba(context, data.color.r(), data.color.g(), data.color.b(), data.color.a());
+					return;
+				}
+				const auto p = _Create_brush_pattern(b, bp);
+				cairo_set_source(context, p.get());
+			}
+
+			// Helpers to skip draws that cannot touch any pixel
+
+			template <class GraphicsMath>
+			basic_bounding_box<GraphicsMath> _Transformed_bounds(const basic_bounding_box<GraphicsMath>& bb, const basic_matrix_2d<GraphicsMath>& m) noexcept {
+				basic_point_2d<GraphicsMath> pts[4] = { bb.top_left(), { bb.x() + bb.width(), bb.y() }, bb.bottom_right(), { bb.x(), bb.y() + bb.height() } };
+				m.transform_pts(pts, pts + 4, pts);
+				auto tl = pts[0];
+				auto br = pts[0];
+				for (const auto& pt : pts) {
+					tl = { ::std::min(tl.x(), pt.x()), ::std::min(tl.y(), pt.y()) };
+					br = { ::std::max(br.x(), pt.x()), ::std::max(br.y(), pt.y()) };
+				}
+				return basic_bounding_box<GraphicsMath>(tl, br);
+			}
+
+			// How far, in user space, a stroke can extend beyond the path it follows: half the line width, lengthened by miter joins and square caps.
+			template <class GraphicsMath>
+			float _Stroke_extent(const basic_stroke_props<_Cairo_graphics_surfaces<GraphicsMath>>& sp) noexcept {
+				float factor = 1.0F;
+				if (sp.line_join() == io2d::line_join::miter) {
+					factor = ::std::max(factor, ::std::min(sp.miter_limit(), sp.max_miter_limit()));
+				}
+				if (sp.line_cap() == io2d::line_cap::square) {
+					factor = ::std::max(factor, 1.41421356F);
+				}
+				return sp.line_width() / 2.0F * factor;
+			}
+
+			// cairo applies these operators to every pixel in the clip area, including those outside the geometry being drawn.
+			inline bool _Is_unbounded_operator(io2d::compositing_op op) noexcept {
+				switch (op) {
+				case io2d::compositing_op::in:
+				case io2d::compositing_op::out:
+				case io2d::compositing_op::dest_in:
+				case io2d::compositing_op::dest_atop:
+					return true;
+				default:
+					return false;
+				}
+			}
+
+			// Returns true if geometry whose user space bounds are bounds, grown by extent on every side, lies entirely outside the surface or the clip area
+			// once it is transformed by m, so drawing it cannot change any pixel. The clip is transformed by clipMatrix, the surface matrix it was set with.
+			// Draws using unbounded operators are never culled.
+			template <class GraphicsMath>
+			bool _Is_culled(const basic_display_point<GraphicsMath>& dimensions, const basic_bounding_box<GraphicsMath>& bounds, float extent, const basic_matrix_2d<GraphicsMath>& m, const basic_matrix_2d<GraphicsMath>& clipMatrix, io2d::compositing_op op, const basic_clip_props<_Cairo_graphics_surfaces<GraphicsMath>>& cl) noexcept {
+				if (_Is_unbounded_operator(op)) {
+					return false;
+				}
+				const basic_bounding_box<GraphicsMath> grown(bounds.x() - extent, bounds.y() - extent, bounds.width() + 2.0F * extent, bounds.height() + 2.0F * extent);
+				auto visible = basic_bounding_box<GraphicsMath>(0.0F, 0.0F, static_cast<float>(dimensions.x()), static_cast<float>(dimensions.y()));
+				const auto& clip = cl.data().clip;
+				if (clip.has_value()) {
+					visible = intersect(visible, _Transformed_bounds(clip.value().data().bounds, clipMatrix));
+				}
+				const auto overlap = intersect(visible, _Transformed_bounds(grown, m));
+				return !(overlap.width() > 0.0F && overlap.height() > 0.0F);
+			}
+
+			template <class GraphicsMath>
+			bool _Is_culled(const basic_display_point<GraphicsMath>& dimensions, const basic_bounding_box<GraphicsMath>& bounds, float extent, const basic_render_props<_Cairo_graphics_surfaces<GraphicsMath>>& rp, const basic_clip_props<_Cairo_graphics_surfaces<GraphicsMath>>& cl) noexcept {
+				const auto& m = rp.surface_matrix();
+				return _Is_culled(dimensions, bounds, extent, m, m, rp.compositing(), cl);
+			}
+
+			// Clip masks
+
+			inline const _Clip_mask* _Clip_mask_cache::find(const ::std::shared_ptr<cairo_path_t>& path, cairo_fill_rule_t fr, const cairo_matrix_t& m, cairo_antialias_t aa) noexcept {
+				for (auto it = _Masks.begin(); it != _Masks.end(); ++it) {
+					if (it->path == path.get() && !it->pathOwner.owner_before(path) && !path.owner_before(it->pathOwner) && it->fillRule == fr && it->antialias == aa &&
+						it->matrix.xx == m.xx && it->matrix.yx == m.yx && it->matrix.xy == m.xy && it->matrix.yy == m.yy && it->matrix.x0 == m.x0 && it->matrix.y0 == m.y0) {
+						_Masks.splice(_Masks.begin(), _Masks, it);
+						return &_Masks.front();
+					}
+				}
+				return nullptr;
+			}
+
+			inline const _Clip_mask* _Clip_mask_cache::insert(_Clip_mask&& mask) {
+				_Masks.push_front(move(mask));
+				if (_Masks.size() > _Max_masks) {
+					_Masks.pop_back();
+				}
+				return &_Masks.front();
+			}
+
+			// Applies c to context like _Set_clip_props, unless the clip can instead be drawn through a mask: then context is left unclipped and the mask is
+			// returned, rasterized for context's matrix and antialias mode only if masks does not already hold one for them. masks is created the first time
+			// a mask is needed. Whole pixel rectangles are cheaper as a clip, and draws using unbounded operators need a clip to bound the pixels they change.
+			template <class GraphicsMath>
+			const _Clip_mask* _Set_clip_props_or_mask(cairo_t* context, const basic_display_point<GraphicsMath>& dimensions, ::std::unique_ptr<_Clip_mask_cache>& masks, const basic_clip_props<_Cairo_graphics_surfaces<GraphicsMath>>& c, io2d::compositing_op op) {
+				const auto& props = c.data();
+				cairo_matrix_t m;
+				cairo_get_matrix(context, &m);
+				cairo_rectangle_int_t r;
+				if (!props.clip.has_value() || _Is_unbounded_operator(op) || _Pixel_aligned_clip_rect(c, m, r)) {
+					_Set_clip_props(context, c);
+					return nullptr;
+				}
+				const auto antialias = cairo_get_antialias(context);
+				const auto fillRule = _Fill_rule_to_cairo_fill_rule_t(props.fr);
+				const auto& path = props.clip.value().data().path;
+				const _Clip_mask* mask = masks == nullptr ? nullptr : masks->find(path, fillRule, m, antialias);
+				if (mask == nullptr) {
+					const basic_matrix_2d<GraphicsMath> clipMatrix(static_cast<float>(m.xx), static_cast<float>(m.yx), static_cast<float>(m.xy), static_cast<float>(m.yy), static_cast<float>(m.x0), static_cast<float>(m.y0));
+					const auto deviceBounds = intersect(_Transformed_bounds(props.clip.value().data().bounds, clipMatrix), basic_bounding_box<GraphicsMath>(0.0F, 0.0F, static_cast<float>(dimensions.x()), static_cast<float>(dimensions.y())));
+					if (!(deviceBounds.width() > 0.0F && deviceBounds.height() > 0.0F)) {
+						_Set_clip_props(context, c);
+						return nullptr;
+					}
+					// One extra pixel on each side holds the antialiased edges.
+					const int x = ::std::max(static_cast<int>(::std::floor(deviceBounds.x())) - 1, 0);
+					const int y = ::std::max(static_cast<int>(::std::floor(deviceBounds.y())) - 1, 0);
+					const int width = ::std::min(static_cast<int>(::std::ceil(deviceBounds.x() + deviceBounds.width())) + 1, dimensions.x()) - x;
+					const int height = ::std::min(static_cast<int>(::std::ceil(deviceBounds.y() + deviceBounds.height())) + 1, dimensions.y()) - y;
+					_Clip_mask newMask;
+					newMask.path = path.get();
+					newMask.pathOwner = path;
+					newMask.fillRule = fillRule;
+					newMask.matrix = m;
+					newMask.antialias = antialias;
+					newMask.x = x;
+					newMask.y = y;
+					newMask.surface.reset(cairo_image_surface_create(CAIRO_FORMAT_A8, width, height));
+					unique_ptr<cairo_t, decltype(&cairo_destroy)> maskContext(cairo_create(newMask.surface.get()), &cairo_destroy);
+					_Throw_if_failed_cairo_status_t(cairo_status(maskContext.get()));
+					cairo_translate(maskContext.get(), -x, -y);
+					cairo_transform(maskContext.get(), &m);
+					cairo_set_antialias(maskContext.get(), antialias);
+					cairo_set_fill_rule(maskContext.get(), fillRule);
+					cairo_append_path(maskContext.get(), path.get());
+					cairo_fill(maskContext.get());
+					maskContext.reset();
+					cairo_surface_flush(newMask.surface.get());
+					if (masks == nullptr) {
+						masks = make_unique<_Clip_mask_cache>();
+					}
+					mask = masks->insert(move(newMask));
+				}
+				cairo_reset_clip(context);
+				return mask;
+			}
+
+			// Fills context's current path. When clipMask is not null the path becomes the clip instead and the mask is painted through it, which covers the same
+			// pixels as filling the path inside the clip the mask was made from.
+			inline void _Fill_through_clip_mask(cairo_t* context, const _Clip_mask* clipMask) {
+				if (clipMask == nullptr) {
+					cairo_fill(context);
+					return;
+				}
+				cairo_clip(context);
+				cairo_identity_matrix(context);
+				cairo_mask_surface(context, clipMask->surface.get(), clipMask->x, clipMask->y);
+			}
+
+			// Writes b's color straight into the pixels bb covers when the result can only be a copy of that color: b is a solid color, the edges of bb land on
+			// whole pixels under the surface matrix, the clip is absent or also a whole pixel rectangle, and the operator is source, or over with an opaque
+			// color. Returns false, without drawing anything, otherwise.
+			template <class GraphicsMath>
+			bool _Fill_pixel_aligned_rect(cairo_surface_t* surface, const basic_brush<_Cairo_graphics_surfaces<GraphicsMath>>& b, const basic_bounding_box<GraphicsMath>& bb, const basic_render_props<_Cairo_graphics_surfaces<GraphicsMath>>& rp, const basic_clip_props<_Cairo_graphics_surfaces<GraphicsMath>>& cl) {
+				if (b.type() != brush_type::solid_color || cairo_surface_get_type(surface) != CAIRO_SURFACE_TYPE_IMAGE) {
+					return false;
+				}
+				const auto& color = b.data().color;
+				const bool opaque = color.a() >= 1.0F;
+				const auto op = rp.compositing();
+				if (!(op == io2d::compositing_op::source || (op == io2d::compositing_op::over && opaque))) {
+					return false;
+				}
+				const auto fmt = cairo_image_surface_get_format(surface);
+				if (!(fmt == CAIRO_FORMAT_ARGB32 || fmt == CAIRO_FORMAT_A8 || (fmt == CAIRO_FORMAT_RGB24 && opaque))) {
+					return false;
+				}
+				const auto m = rp.surface_matrix();
+				const cairo_matrix_t cm{ m.m00(), m.m01(), m.m10(), m.m11(), m.m20(), m.m21() };
+				cairo_rectangle_int_t r;
+				if (!_Pixel_aligned_rect(bb, cm, r)) {
+					return false;
+				}
+				int left = ::std::max(r.x, 0);
+				int top = ::std::max(r.y, 0);
+				int right = ::std::min(r.x + r.width, cairo_image_surface_get_width(surface));
+				int bottom = ::std::min(r.y + r.height, cairo_image_surface_get_height(surface));
+				if (cl.data().clip.has_value()) {
+					cairo_rectangle_int_t clipRect;
+					if (!_Pixel_aligned_clip_rect(cl, cm, clipRect)) {
+						return false;
+					}
+					left = ::std::max(left, clipRect.x);
+					top = ::std::max(top, clipRect.y);
+					right = ::std::min(right, clipRect.x + clipRect.width);
+					bottom = ::std::min(bottom, clipRect.y + clipRect.height);
+				}
+				if (left >= right || top >= bottom) {
+					return true;
+				}
+
+				// cairo stores colors premultiplied, rounding each channel this way.
+				auto channel = [](double v) {
+					return static_cast<uint32_t>(static_cast<uint32_t>(v * 65535.0 + 0.5) >> 8);
+				};
+				cairo_surface_flush(surface);
+				auto pixels = cairo_image_surface_get_data(surface);
+				const auto stride = cairo_image_surface_get_stride(surface);
+				if (fmt == CAIRO_FORMAT_A8) {
+					const auto alpha = static_cast<unsigned char>(channel(color.a()));
+					for (int y = top; y < bottom; ++y) {
+						::std::memset(pixels + y * stride + left, alpha, static_cast<size_t>(right - left));
+					}
+				}
+				else {
+					const double a = color.a();
+					const uint32_t pixel = (fmt == CAIRO_FORMAT_RGB24 ? 0xFF000000U : channel(a) << 24) | channel(color.r() * a) << 16 | channel(color.g() * a) << 8 | channel(color.b() * a);
+					for (int y = top; y < bottom; ++y) {
+						auto row = reinterpret_cast<uint32_t*>(pixels + y * stride);
+						::std::fill(row + left, row + right, pixel);
+					}
+				}
+				cairo_surface_mark_dirty_rectangle(surface, left, top, right - left, bottom - top);
+				return true;
+			}
+
+			// Coverage mask cache
+
+			inline bool _Coverage_mask_cache::_Key::operator==(const _Key& other) const noexcept {
+				return path == other.path && m00 == other.m00 && m01 == other.m01 && m10 == other.m10 && m11 == other.m11 && subpixelX == other.subpixelX &&
+					subpixelY == other.subpixelY && antialias == other.antialias && fillRule == other.fillRule;
+			}
+
+			inline size_t _Coverage_mask_cache::_Key_hash::operator()(const _Key& key) const noexcept {
+				size_t h = ::std::hash<const cairo_path_t*>()(key.path);
+				auto combine = [&h](size_t v) {
+					h ^= v + 0x9e3779b9 + (h << 6) + (h >> 2);
+				};
+				combine(::std::hash<float>()(key.m00));
+				combine(::std::hash<float>()(key.m01));
+				combine(::std::hash<float>()(key.m10));
+				combine(::std::hash<float>()(key.m11));
+				combine(static_cast<size_t>(key.subpixelX * _Subpixel_steps + key.subpixelY));
+				combine(static_cast<size_t>(key.antialias) * 2 + static_cast<size_t>(key.fillRule));
+				return h;
+			}
+
+			inline _Coverage_mask_cache::_Coverage_mask_cache(size_t limit) noexcept
+				: _Limit(limit) {
+			}
+
+			inline void _Coverage_mask_cache::_Erase(::std::list<_Entry>::iterator it) noexcept {
+				_Bytes -= it->bytes;
+				_Index.erase(it->key);
+				_Entries.erase(it);
+			}
+
+			inline cairo_surface_t* _Coverage_mask_cache::find(const _Key& key, const ::std::shared_ptr<cairo_path_t>& path, int& x, int& y) noexcept {
+				auto found = _Index.find(key);
+				if (found != _Index.end()) {
+					auto it = found->second;
+					// A different owner means the cached path was destroyed and this one reuses its address.
+					if (it->path.owner_before(path) || path.owner_before(it->path)) {
+						_Erase(it);
+					}
+					else {
+						_Entries.splice(_Entries.begin(), _Entries, it);
+						++_Hits;
+						x = it->x;
+						y = it->y;
+						return it->mask.get();
+					}
+				}
+				++_Misses;
+				return nullptr;
+			}
+
+			inline cairo_surface_t* _Coverage_mask_cache::insert(const _Key& key, const ::std::shared_ptr<cairo_path_t>& path, ::std::unique_ptr<cairo_surface_t, decltype(&cairo_surface_destroy)>&& mask, int x, int y, size_t bytes) {
+				auto found = _Index.find(key);
+				if (found != _Index.end()) {
+					_Erase(found->second);
+				}
+				while (!_Entries.empty() && _Bytes + bytes > _Limit) {
+					_Erase(::std::prev(_Entries.end()));
+					++_Evictions;
+				}
+				_Entries.push_front(_Entry{ key, path, ::std::move(mask), x, y, bytes });
+				_Index.emplace(key, _Entries.begin());
+				_Bytes += bytes;
+				return _Entries.front().mask.get();
+			}
+
+			inline void _Coverage_mask_cache::limit(size_t bytes) noexcept {
+				_Limit = bytes;
+				while (!_Entries.empty() && _Bytes > _Limit) {
+					_Erase(::std::prev(_Entries.end()));
+					++_Evictions;
+				}
+			}
+
+			inline size_t _Coverage_mask_cache::limit() const noexcept {
+				return _Limit;
+			}
+
+			inline coverage_cache_stats _Coverage_mask_cache::stats() const noexcept {
+				return coverage_cache_stats(_Entries.size(), _Bytes, _Hits, _Misses, _Evictions);
+			}
+
+			// Fills path, whose user space bounds are bounds, through a coverage mask from cache, rasterizing and caching the mask first if it is not there.
+			// m is the surface matrix; render, clip and brush state must already be set on context. Returns false without drawing anything when the mask
+			// would take more than a quarter of the cache, so that one large path cannot flush everything else out of it.
+			template <class GraphicsMath>
+			bool _Fill_with_coverage_cache(cairo_t* context, _Coverage_mask_cache& cache, const shared_ptr<cairo_path_t>& path, const basic_bounding_box<GraphicsMath>& bounds, const basic_matrix_2d<GraphicsMath>& m) {
+				const float maxTranslation = 1.0e6F;
+				if (path == nullptr || !(::std::abs(m.m20()) < maxTranslation && ::std::abs(m.m21()) < maxTranslation)) {
+					return false;
+				}
+				// Split the translation into whole pixels and the nearest subpixel step, carrying a step that rounds up to a whole pixel.
+				auto split = [](float t, int& whole, int& step) {
+					whole = static_cast<int>(::std::floor(t));
+					step = static_cast<int>(::std::round((t - static_cast<float>(whole)) * _Coverage_mask_cache::_Subpixel_steps));
+					if (step == _Coverage_mask_cache::_Subpixel_steps) {
+						++whole;
+						step = 0;
+					}
+				};
+				int wholeX;
+				int wholeY;
+				_Coverage_mask_cache::_Key key{ path.get(), m.m00(), m.m01(), m.m10(), m.m11(), 0, 0, cairo_get_antialias(context), cairo_get_fill_rule(context) };
+				split(m.m20(), wholeX, key.subpixelX);
+				split(m.m21(), wholeY, key.subpixelY);
+
+				int maskX = 0;
+				int maskY = 0;
+				auto mask = cache.find(key, path, maskX, maskY);
+				if (mask == nullptr) {
+					const auto stepSize = 1.0F / _Coverage_mask_cache::_Subpixel_steps;
+					const basic_matrix_2d<GraphicsMath> maskMatrix(m.m00(), m.m01(), m.m10(), m.m11(), key.subpixelX * stepSize, key.subpixelY * stepSize);
+					const auto deviceBounds = _Transformed_bounds(bounds, maskMatrix);
+					const float maxExtent = 16384.0F;
+					if (!(deviceBounds.width() < maxExtent && deviceBounds.height() < maxExtent)) {
+						return false;
+					}
+					// One extra pixel on each side holds the antialiased edges.
+					maskX = static_cast<int>(::std::floor(deviceBounds.x())) - 1;
+					maskY = static_cast<int>(::std::floor(deviceBounds.y())) - 1;
+					const int maskWidth = static_cast<int>(::std::ceil(deviceBounds.x() + deviceBounds.width())) + 1 - maskX;
+					const int maskHeight = static_cast<int>(::std::ceil(deviceBounds.y() + deviceBounds.height())) + 1 - maskY;
+					const size_t bytes = static_cast<size_t>(cairo_format_stride_for_width(CAIRO_FORMAT_A8, maskWidth)) * static_cast<size_t>(maskHeight);
+					if (bytes > cache.limit() / 4) {
+						return false;
+					}
+					unique_ptr<cairo_surface_t, decltype(&cairo_surface_destroy)> maskSurface(cairo_image_surface_create(CAIRO_FORMAT_A8, maskWidth, maskHeight), &cairo_surface_destroy);
+					unique_ptr<cairo_t, decltype(&cairo_destroy)> maskContext(cairo_create(maskSurface.get()), &cairo_destroy);
+					_Throw_if_failed_cairo_status_t(cairo_status(maskContext.get()));
+					const cairo_matrix_t cm{ maskMatrix.m00(), maskMatrix.m01(), maskMatrix.m10(), maskMatrix.m11(), maskMatrix.m20(), maskMatrix.m21() };
+					cairo_translate(maskContext.get(), -maskX, -maskY);
+					cairo_transform(maskContext.get(), &cm);
+					cairo_set_antialias(maskContext.get(), key.antialias);
+					cairo_set_fill_rule(maskContext.get(), key.fillRule);
+					cairo_append_path(maskContext.get(), path.get());
+					cairo_fill(maskContext.get());
+					maskContext.reset();
+					cairo_surface_flush(maskSurface.get());
+					mask = cache.insert(key, path, ::std::move(maskSurface), maskX, maskY, bytes);
+				}
+				cairo_new_path(context);
+				cairo_identity_matrix(context);
+				cairo_mask_surface(context, mask, wholeX + maskX, wholeY + maskY);
+				return true;
 			}
 
 			template<class GraphicsMath>
-			inline basic_display_point<GraphicsMath> _Cairo_graphics_surfaces<GraphicsMath>::surfaces::max_dimensions() noexcept {
+			basic_display_point<GraphicsMath> _Cairo_graphics_surfaces<GraphicsMath>::surfaces::max_dimensions() noexcept {
 				return basic_display_point<GraphicsMath>(16384, 16384); // This takes up 1 GB of RAM, you probably don't want to do this. 2048x2048 is the max size for hardware that meets 9_1 specs (i.e. quite low powered or really old). Probably much more reasonable.
 			}
-
 			template <class GraphicsMath>
-			inline basic_image_surface<_Cairo_graphics_surfaces<GraphicsMath>> _Cairo_graphics_surfaces<GraphicsMath>::surfaces::copy_surface(basic_image_surface<_Cairo_graphics_surfaces<GraphicsMath>>& sfc) noexcept {
-				basic_image_surface<_Cairo_graphics_surfaces> retSfc(sfc.format(), sfc.dimensions().x(), sfc.dimensions().y());
-				auto srcSfc = cairo_surface_map_to_image(sfc.data().surface.get(), nullptr);
-				auto destSfc = cairo_surface_map_to_image(retSfc.data().surface.get(), nullptr);
-				auto srcSize = cairo_image_surface_get_height(srcSfc) * cairo_image_surface_get_stride(srcSfc);
-				auto srcData = cairo_image_surface_get_data(srcSfc);
-				auto destData = cairo_image_surface_get_data(destSfc);
-				memcpy(destData, srcData, srcSize);
-				cairo_surface_unmap_image(retSfc.data().surface.get(), destSfc);
-				cairo_surface_unmap_image(sfc.data().surface.get(), srcSfc);
-				return retSfc;
+			int _Cairo_graphics_surfaces<GraphicsMath>::surfaces::stride_for_width(io2d::format fmt, int width) noexcept {
+				return cairo_format_stride_for_width(_Format_to_cairo_format_t(fmt), width);
 			}
 
 			template <class GraphicsMath>
-			inline basic_image_surface<_Cairo_graphics_surfaces<GraphicsMath>> _Cairo_graphics_surfaces<GraphicsMath>::surfaces::copy_surface(basic_output_surface<_Cairo_graphics_surfaces>& sfc) noexcept {
+			basic_image_surface<_Cairo_graphics_surfaces<GraphicsMath>> _Cairo_graphics_surfaces<GraphicsMath>::surfaces::copy_surface(basic_output_surface<_Cairo_graphics_surfaces>& sfc) noexcept {
 				basic_image_surface<_Cairo_graphics_surfaces> retSfc(sfc.format(), sfc.dimensions().x(), sfc.dimensions().y());
-				auto srcSfc = cairo_surface_map_to_image(sfc.data().surface.get(), nullptr);
+				auto srcSfc = cairo_surface_map_to_image(sfc.data()->data.back_buffer.surface.get(), nullptr);
 				auto destSfc = cairo_surface_map_to_image(retSfc.data().surface.get(), nullptr);
 				auto srcSize = cairo_image_surface_get_height(srcSfc) * cairo_image_surface_get_stride(srcSfc);
 				auto srcData = cairo_image_surface_get_data(srcSfc);
 				auto destData = cairo_image_surface_get_data(destSfc);
 				memcpy(destData, srcData, srcSize);
 				cairo_surface_unmap_image(retSfc.data().surface.get(), destSfc);
-				cairo_surface_unmap_image(sfc.data().surface.get(), srcSfc);
+				cairo_surface_unmap_image(sfc.data()->data.back_buffer.surface.get(), srcSfc);
 				return retSfc;
 			}
 		}
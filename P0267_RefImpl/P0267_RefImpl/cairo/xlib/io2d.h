@@ -17,6 +17,9 @@ namespace std::experimental::io2d {
         using default_graphics_math = _Graphics_math_float_impl;
         using default_graphics_surfaces = _Cairo::_Cairo_graphics_surfaces<default_graphics_math>;
         
+        using atlas_builder = basic_atlas_builder<default_graphics_surfaces>;
+        using atlas_sprite = basic_atlas_sprite<default_graphics_surfaces>;
+        using banded_renderer = basic_banded_renderer<default_graphics_surfaces>;
         using bounding_box = basic_bounding_box<default_graphics_math>;
         using brush = basic_brush<default_graphics_surfaces>;
         using brush_props = basic_brush_props<default_graphics_surfaces>;
@@ -25,15 +28,24 @@ namespace std::experimental::io2d {
         using dashes = basic_dashes<default_graphics_surfaces>;
         using display_point = basic_display_point<default_graphics_math>;
         using figure_items = basic_figure_items<default_graphics_surfaces>;
+        using fill_instance = basic_fill_instance<default_graphics_math>;
+        using image_atlas = basic_image_atlas<default_graphics_surfaces>;
+        using image_loader = basic_image_loader<default_graphics_surfaces>;
         using image_surface = basic_image_surface<default_graphics_surfaces>;
+        using image_surface_pool = basic_image_surface_pool<default_graphics_surfaces>;
+        using image_surface_pool_scope = basic_image_surface_pool_scope<default_graphics_surfaces>;
         using interpreted_path = basic_interpreted_path<default_graphics_surfaces>;
+        using mapped_pixels = basic_mapped_pixels<default_graphics_surfaces>;
         using mask_props = basic_mask_props<default_graphics_surfaces>;
         using matrix_2d = basic_matrix_2d<default_graphics_math>;
         using output_surface = basic_output_surface<default_graphics_surfaces>;
         using path_builder = basic_path_builder<default_graphics_surfaces>;
         using point_2d = basic_point_2d<default_graphics_math>;
         using render_props = basic_render_props<default_graphics_surfaces>;
+        template <size_t Capacity>
+        using static_path = basic_static_path<default_graphics_math, Capacity>;
         using stroke_props = basic_stroke_props<default_graphics_surfaces>;
+        using tiled_image_surface = basic_tiled_image_surface<default_graphics_surfaces>;
         using unmanaged_output_surface = basic_unmanaged_output_surface<default_graphics_surfaces>;
     }
 }
@@ -57,7 +57,7 @@ namespace std::experimental::io2d {
 
             
 			template<class GraphicsMath>
-			inline typename _Cairo_graphics_surfaces<GraphicsMath>::surfaces::output_surface_data_type _Cairo_graphics_surfaces<GraphicsMath>::surfaces::create_output_surface(int preferredWidth, int preferredHeight, io2d::format preferredFormat, io2d::scaling scl, io2d::refresh_style rr, float fps) {
+			typename _Cairo_graphics_surfaces<GraphicsMath>::surfaces::output_surface_data_type _Cairo_graphics_surfaces<GraphicsMath>::surfaces::create_output_surface(int preferredWidth, int preferredHeight, io2d::format preferredFormat, io2d::scaling scl, io2d::refresh_style rr, float fps) {
 				auto result = make_unique<_Output_surface_data>();
 				_Display_surface_data_type& data = result->data;
 				data.display_dimensions.x(preferredWidth);
@@ -77,13 +77,13 @@ namespace std::experimental::io2d {
 				return result.release();
 			}
 			template<class GraphicsMath>
-			inline typename _Cairo_graphics_surfaces<GraphicsMath>::surfaces::output_surface_data_type _Cairo_graphics_surfaces<GraphicsMath>::surfaces::create_output_surface(int preferredWidth, int preferredHeight, io2d::format preferredFormat, error_code& ec, io2d::scaling scl, io2d::refresh_style rr, float fps) noexcept {
+			typename _Cairo_graphics_surfaces<GraphicsMath>::surfaces::output_surface_data_type _Cairo_graphics_surfaces<GraphicsMath>::surfaces::create_output_surface(int preferredWidth, int preferredHeight, io2d::format preferredFormat, error_code& ec, io2d::scaling scl, io2d::refresh_style rr, float fps) noexcept {
 				auto result = make_unique<_Output_surface_data>();
 				_Display_surface_data_type& data = result->data;
 				data.display_dimensions.x(preferredWidth);
 				data.display_dimensions.y(preferredHeight);
 				data.rr = rr;
-				data.refresh_style = fps;
+				data.refresh_fps = fps;
 				data.scl = scl;
 				data.back_buffer.format = preferredFormat;
 				data.back_buffer.dimensions.x(preferredWidth);
@@ -99,13 +99,13 @@ namespace std::experimental::io2d {
 				return result.release();
 			}
 			template<class GraphicsMath>
-			inline typename _Cairo_graphics_surfaces<GraphicsMath>::surfaces::output_surface_data_type _Cairo_graphics_surfaces<GraphicsMath>::surfaces::create_output_surface(int preferredWidth, int preferredHeight, io2d::format preferredFormat, int preferredDisplayWidth, int preferredDisplayHeight, io2d::scaling scl, io2d::refresh_style rr, float fps) {
+			typename _Cairo_graphics_surfaces<GraphicsMath>::surfaces::output_surface_data_type _Cairo_graphics_surfaces<GraphicsMath>::surfaces::create_output_surface(int preferredWidth, int preferredHeight, io2d::format preferredFormat, int preferredDisplayWidth, int preferredDisplayHeight, io2d::scaling scl, io2d::refresh_style rr, float fps) {
 				auto result = make_unique<_Output_surface_data>();
 				_Display_surface_data_type& data = result->data;
 				data.display_dimensions.x(preferredDisplayWidth);
 				data.display_dimensions.y(preferredDisplayHeight);
 				data.rr = rr;
-				data.refresh_style = fps;
+				data.refresh_fps = fps;
 				data.scl = scl;
 				data.back_buffer.format = preferredFormat;
 				data.back_buffer.dimensions.x(preferredWidth);
@@ -119,13 +119,13 @@ namespace std::experimental::io2d {
 				return result.release();
 			}
 			template <class GraphicsMath>
-			inline typename _Cairo_graphics_surfaces<GraphicsMath>::surfaces::output_surface_data_type _Cairo_graphics_surfaces<GraphicsMath>::surfaces::create_output_surface(int preferredWidth, int preferredHeight, io2d::format preferredFormat, int preferredDisplayWidth, int preferredDisplayHeight, error_code& ec, io2d::scaling scl, io2d::refresh_style rr, float fps) noexcept {
+			typename _Cairo_graphics_surfaces<GraphicsMath>::surfaces::output_surface_data_type _Cairo_graphics_surfaces<GraphicsMath>::surfaces::create_output_surface(int preferredWidth, int preferredHeight, io2d::format preferredFormat, int preferredDisplayWidth, int preferredDisplayHeight, error_code& ec, io2d::scaling scl, io2d::refresh_style rr, float fps) noexcept {
 				auto result = make_unique<_Output_surface_data>();
 				_Display_surface_data_type& data = result->data;
 				data.display_dimensions.x(preferredDisplayWidth);
 				data.display_dimensions.y(preferredDisplayHeight);
 				data.rr = rr;
-				data.refresh_style = fps;
+				data.refresh_fps = fps;
 				data.scl = scl;
 				data.back_buffer.format = preferredFormat;
 				data.back_buffer.dimensions.x(preferredWidth);
@@ -141,21 +141,139 @@ namespace std::experimental::io2d {
 				return result.release();
 			}
 			template <class GraphicsMath>
-			inline typename _Cairo_graphics_surfaces<GraphicsMath>::surfaces::output_surface_data_type _Cairo_graphics_surfaces<GraphicsMath>::surfaces::move_output_surface(output_surface_data_type&& data) noexcept {
-                auto result = make_unique<output_surface_data_type>(move(data));
-				result->data.back_buffer = ::std::move(move_image_surface(::std::move(data->data.back_buffer)));
-				return result.release();
+			typename _Cairo_graphics_surfaces<GraphicsMath>::surfaces::output_surface_data_type _Cairo_graphics_surfaces<GraphicsMath>::surfaces::move_output_surface(output_surface_data_type&& data) noexcept {
+				auto result = data;
+				data = nullptr;
+				return result;
 			}
 			template <class GraphicsMath>
-			inline void _Cairo_graphics_surfaces<GraphicsMath>::surfaces::destroy(output_surface_data_type& data) noexcept {
+			void _Cairo_graphics_surfaces<GraphicsMath>::surfaces::destroy(output_surface_data_type& data) noexcept {
 				destroy(data->data.back_buffer);
                 delete data;
 			}
 
-			Bool _X11_if_xev_pred(::Display* display, ::XEvent* xev, XPointer arg);
+			template <class GraphicsMath>
+			Bool _X11_if_xev_pred(::Display* display, ::XEvent* xev, XPointer arg) {
+				assert(display != nullptr && xev != nullptr && arg != nullptr);
+				// arg is the output surface's output_surface_data_type.
+				const auto wndw = (*reinterpret_cast<typename _Cairo_graphics_surfaces<GraphicsMath>::surfaces::output_surface_data_type*>(arg))->data.wndw;
+				// If the display_surface window is invalid, we will never get a match so return False.
+				if (wndw == None) {
+					return False;
+				}
+				// Need to check for ExposureMask xevs, StructureNotifyMask xevs, and unmaskable xevs.
+				switch (xev->type) {
+				// ExposureMask xevs:
+				case Expose:
+				{
+					if (xev->xexpose.window == wndw) {
+						return True;
+					}
+				} break;
+				// StructureNotifyMask xevs:
+				case CirculateNotify:
+				{
+					if (xev->xcirculate.window == wndw) {
+						return True;
+					}
+				} break;
+				case ConfigureNotify:
+				{
+					if (xev->xconfigure.window == wndw) {
+						return True;
+					}
+				} break;
+				case DestroyNotify:
+				{
+					if (xev->xdestroywindow.window == wndw) {
+						return True;
+					}
+				} break;
+				case GravityNotify:
+				{
+					if (xev->xgravity.window == wndw) {
+						return True;
+					}
+				} break;
+				case MapNotify:
+				{
+					if (xev->xmap.window == wndw) {
+						return True;
+					}
+				} break;
+				case ReparentNotify:
+				{
+					if (xev->xreparent.window == wndw) {
+						return True;
+					}
+				} break;
+				case UnmapNotify:
+				{
+					if (xev->xunmap.window == wndw) {
+						return True;
+					}
+				} break;
+				// Might get them even though unrequested xevs (see http://www.x.org/releases/X11R7.7/doc/libX11/libX11/libX11.html#Event_Masks ):
+				case GraphicsExpose:
+				{
+					if (xev->xgraphicsexpose.drawable == static_cast<Drawable>(wndw)) {
+						return True;
+					}
+				} break;
+				case NoExpose:
+				{
+					if (xev->xnoexpose.drawable == static_cast<Drawable>(wndw)) {
+						return True;
+					}
+				} break;
+				// Unmasked xevs
+				case ClientMessage:
+				{
+					if (xev->xclient.window == wndw) {
+						return True;
+					}
+				} break;
+				case MappingNotify:
+				{
+					if (xev->xmapping.window == wndw) {
+						return True;
+					}
+				} break;
+				case SelectionClear:
+				{
+					if (xev->xselectionclear.window == wndw) {
+						return True;
+					}
+				} break;
+				case SelectionNotify:
+				{
+					if (xev->xselection.requestor == wndw) {
+						return True;
+					}
+				} break;
+				case SelectionRequest:
+				{
+					if (xev->xselectionrequest.owner == wndw) {
+						return True;
+					}
+				} break;
+				default:
+				{
+					// Per the X protocol, types 64 through 127 are reserved for extensions.
+					// We only care about non-extension xevs since we likely should be aware of those and should handle them.
+					// So we only return True if it is not an extension xev.
+					if (xev->type < 64 || xev->type > 127) {
+						// Return True so we can inspect it in the xev loop for diagnostic purposes.
+						return True;
+					}
+					return false;
+				}
+				}
+				return False;
+			}
 
 			template<class GraphicsMath>
-			inline int _Cairo_graphics_surfaces<GraphicsMath>::surfaces::begin_show(output_surface_data_type& osd, basic_output_surface<_Cairo_graphics_surfaces<GraphicsMath>>* instance, basic_output_surface<_Cairo_graphics_surfaces<GraphicsMath>>& sfc) {
+			int _Cairo_graphics_surfaces<GraphicsMath>::surfaces::begin_show(output_surface_data_type& osd, basic_output_surface<_Cairo_graphics_surfaces<GraphicsMath>>* instance, basic_output_surface<_Cairo_graphics_surfaces<GraphicsMath>>& sfc) {
 				_Display_surface_data_type& data = osd->data;
 				Display* display = data.display.get();
 				int screenNumber = DefaultScreen(display);
@@ -183,7 +301,7 @@ namespace std::experimental::io2d {
 					auto elapsedTimeIncrement = static_cast<float>(::std::chrono::duration_cast<::std::chrono::nanoseconds>(currentTime - previousTime).count());
 					data.elapsed_draw_time += elapsedTimeIncrement;
 					previousTime = currentTime;
-					while (XCheckIfEvent(data.display.get(), &xev, &_X11_if_xev_pred, reinterpret_cast<XPointer>(&osd))) {
+					while (XCheckIfEvent(data.display.get(), &xev, &_X11_if_xev_pred<GraphicsMath>, reinterpret_cast<XPointer>(&osd))) {
 						switch (xev.type) {
 							// ExposureMask events:
 						case Expose:
@@ -392,12 +510,12 @@ namespace std::experimental::io2d {
 			}
 
 			template<class GraphicsMath>
-			inline void _Cairo_graphics_surfaces<GraphicsMath>::surfaces::end_show(output_surface_data_type& osd) {
+			void _Cairo_graphics_surfaces<GraphicsMath>::surfaces::end_show(output_surface_data_type& osd) {
 				XDestroyWindow(osd->data.display.get(), osd->data.wndw);
 			}
 
 			template<class GraphicsMath>
-			inline void _Cairo_graphics_surfaces<GraphicsMath>::surfaces::display_dimensions(output_surface_data_type& osdp, const basic_display_point<GraphicsMath>& val) {
+			void _Cairo_graphics_surfaces<GraphicsMath>::surfaces::display_dimensions(output_surface_data_type& osdp, const basic_display_point<GraphicsMath>& val) {
                 _Output_surface_data &osd = *osdp;
 				Window rootWindow{};
 				int x{};
@@ -419,138 +537,170 @@ namespace std::experimental::io2d {
 			}
 
 			template<class GraphicsMath>
-			inline void _Cairo_graphics_surfaces<GraphicsMath>::surfaces::refresh_style(output_surface_data_type& data, io2d::refresh_style val) {
+			void _Cairo_graphics_surfaces<GraphicsMath>::surfaces::refresh_style(output_surface_data_type& data, io2d::refresh_style val) {
 				data->data.rr = val;
 			}
 			template<class GraphicsMath>
-			inline void _Cairo_graphics_surfaces<GraphicsMath>::surfaces::desired_frame_rate(output_surface_data_type& data, float val) {
+			void _Cairo_graphics_surfaces<GraphicsMath>::surfaces::desired_frame_rate(output_surface_data_type& data, float val) {
 				const float oneFramePerHour = 1.0f / (60.0f * 60.0f); // If you need a lower framerate than this, use as_needed and control the refresh by writing a timer that will trigger a refresh at your desired interval.
 				const float maxFPS = 120.0f; // It's unlikely to find a display output that operates higher than this.
 				data->data.refresh_fps = ::std::min(::std::max(val, oneFramePerHour), maxFPS);
 			}
 			template<class GraphicsMath>
-			inline io2d::refresh_style _Cairo_graphics_surfaces<GraphicsMath>::surfaces::refresh_style(const output_surface_data_type& data) noexcept {
+			io2d::refresh_style _Cairo_graphics_surfaces<GraphicsMath>::surfaces::refresh_style(const output_surface_data_type& data) noexcept {
 				return data->data.rr;
 			}
 			template<class GraphicsMath>
-			inline float _Cairo_graphics_surfaces<GraphicsMath>::surfaces::desired_frame_rate(const output_surface_data_type& data) noexcept {
+			float _Cairo_graphics_surfaces<GraphicsMath>::surfaces::desired_frame_rate(const output_surface_data_type& data) noexcept {
 				return data->data.refresh_fps;
 			}
 
 			template<class GraphicsMath>
-			inline void _Cairo_graphics_surfaces<GraphicsMath>::surfaces::flush(output_surface_data_type& data) {
+			void _Cairo_graphics_surfaces<GraphicsMath>::surfaces::flush(output_surface_data_type& data) {
 				cairo_surface_flush(data->data.back_buffer.surface.get());
 			}
 			template<class GraphicsMath>
-			inline void _Cairo_graphics_surfaces<GraphicsMath>::surfaces::flush(output_surface_data_type& data, error_code& ec) noexcept {
+			void _Cairo_graphics_surfaces<GraphicsMath>::surfaces::flush(output_surface_data_type& data, error_code& ec) noexcept {
 				cairo_surface_flush(data->data.back_buffer.surface.get());
 				ec.clear();
 			}
 			template<class GraphicsMath>
-			inline void _Cairo_graphics_surfaces<GraphicsMath>::surfaces::mark_dirty(output_surface_data_type& data) {
+			void _Cairo_graphics_surfaces<GraphicsMath>::surfaces::mark_dirty(output_surface_data_type& data) {
 				cairo_surface_mark_dirty(data->data.back_buffer.surface.get());
 			}
 			template<class GraphicsMath>
-			inline void _Cairo_graphics_surfaces<GraphicsMath>::surfaces::mark_dirty(output_surface_data_type& data, error_code& ec) noexcept {
+			void _Cairo_graphics_surfaces<GraphicsMath>::surfaces::mark_dirty(output_surface_data_type& data, error_code& ec) noexcept {
 				cairo_surface_mark_dirty(data->data.back_buffer.surface.get());
 				ec.clear();
 			}
 			template<class GraphicsMath>
-			inline void _Cairo_graphics_surfaces<GraphicsMath>::surfaces::mark_dirty(output_surface_data_type& data, const basic_bounding_box<GraphicsMath>& extents) {
+			void _Cairo_graphics_surfaces<GraphicsMath>::surfaces::mark_dirty(output_surface_data_type& data, const basic_bounding_box<GraphicsMath>& extents) {
 				cairo_surface_mark_dirty_rectangle(data->data.back_buffer.surface.get(), _Float_to_int(extents.x()), _Float_to_int(extents.y()), _Float_to_int(extents.width()), _Float_to_int(extents.height()));
 			}
 			template<class GraphicsMath>
-			inline void _Cairo_graphics_surfaces<GraphicsMath>::surfaces::mark_dirty(output_surface_data_type& data, const basic_bounding_box<GraphicsMath>& extents, error_code& ec) noexcept {
+			void _Cairo_graphics_surfaces<GraphicsMath>::surfaces::mark_dirty(output_surface_data_type& data, const basic_bounding_box<GraphicsMath>& extents, error_code& ec) noexcept {
 				cairo_surface_mark_dirty_rectangle(data->data.back_buffer.surface.get(), _Float_to_int(extents.x()), _Float_to_int(extents.y()), _Float_to_int(extents.width()), _Float_to_int(extents.height()));
 				ec.clear();
 			}
 
 			template<class GraphicsMath>
-			inline void _Cairo_graphics_surfaces<GraphicsMath>::surfaces::clear(output_surface_data_type& data) {
+			void _Cairo_graphics_surfaces<GraphicsMath>::surfaces::clear(output_surface_data_type& data) {
 				_Ds_clear<_Cairo_graphics_surfaces<GraphicsMath>>(data->data);
 			}
 			template <class GraphicsMath>
-			inline void _Cairo_graphics_surfaces<GraphicsMath>::surfaces::paint(output_surface_data_type& data, const basic_brush<_Graphics_surfaces_type>& b, const basic_brush_props<_Graphics_surfaces_type>& bp, const basic_render_props<_Graphics_surfaces_type>& rp, const basic_clip_props<_Graphics_surfaces_type>& cl) {
+			void _Cairo_graphics_surfaces<GraphicsMath>::surfaces::paint(output_surface_data_type& data, const basic_brush<_Graphics_surfaces_type>& b, const basic_brush_props<_Graphics_surfaces_type>& bp, const basic_render_props<_Graphics_surfaces_type>& rp, const basic_clip_props<_Graphics_surfaces_type>& cl) {
 				_Ds_paint<_Cairo_graphics_surfaces<GraphicsMath>>(data->data, b, bp, rp, cl);
 			}
 			template<class GraphicsMath>
-			inline void _Cairo_graphics_surfaces<GraphicsMath>::surfaces::stroke(output_surface_data_type& data, const basic_brush<_Graphics_surfaces_type>& b, const basic_interpreted_path<_Graphics_surfaces_type>& ip, const basic_brush_props<_Graphics_surfaces_type>& bp, const basic_stroke_props<_Graphics_surfaces_type>& sp, const basic_dashes<_Graphics_surfaces_type>& d, const basic_render_props<_Graphics_surfaces_type>& rp, const basic_clip_props<_Graphics_surfaces_type>& cl) {
+			void _Cairo_graphics_surfaces<GraphicsMath>::surfaces::stroke(output_surface_data_type& data, const basic_brush<_Graphics_surfaces_type>& b, const basic_interpreted_path<_Graphics_surfaces_type>& ip, const basic_brush_props<_Graphics_surfaces_type>& bp, const basic_stroke_props<_Graphics_surfaces_type>& sp, const basic_dashes<_Graphics_surfaces_type>& d, const basic_render_props<_Graphics_surfaces_type>& rp, const basic_clip_props<_Graphics_surfaces_type>& cl) {
 				_Ds_stroke<_Cairo_graphics_surfaces<GraphicsMath>>(data->data, b, ip, bp, sp, d, rp, cl);
 			}
 			template<class GraphicsMath>
-			inline void _Cairo_graphics_surfaces<GraphicsMath>::surfaces::fill(output_surface_data_type& data, const basic_brush<_Graphics_surfaces_type>& b, const basic_interpreted_path<_Graphics_surfaces_type>& ip, const basic_brush_props<_Graphics_surfaces_type>& bp, const basic_render_props<_Graphics_surfaces_type>& rp, const basic_clip_props<_Graphics_surfaces_type>& cl) {
+			void _Cairo_graphics_surfaces<GraphicsMath>::surfaces::fill(output_surface_data_type& data, const basic_brush<_Graphics_surfaces_type>& b, const basic_interpreted_path<_Graphics_surfaces_type>& ip, const basic_brush_props<_Graphics_surfaces_type>& bp, const basic_render_props<_Graphics_surfaces_type>& rp, const basic_clip_props<_Graphics_surfaces_type>& cl) {
 				_Ds_fill<_Cairo_graphics_surfaces<GraphicsMath>>(data->data, b, ip, bp, rp, cl);
 			}
 			template<class GraphicsMath>
-			inline void _Cairo_graphics_surfaces<GraphicsMath>::surfaces::mask(output_surface_data_type& data, const basic_brush<_Graphics_surfaces_type>& b, const basic_brush<_Graphics_surfaces_type>& mb, const basic_brush_props<_Graphics_surfaces_type>& bp, const basic_mask_props<_Graphics_surfaces_type>& mp, const basic_render_props<_Graphics_surfaces_type>& rp, const basic_clip_props<_Graphics_surfaces_type>& cl) {
+			void _Cairo_graphics_surfaces<GraphicsMath>::surfaces::fill_stroke(output_surface_data_type& data, const basic_brush<_Graphics_surfaces_type>& fb, const basic_brush<_Graphics_surfaces_type>& sb, const basic_interpreted_path<_Graphics_surfaces_type>& ip, const basic_brush_props<_Graphics_surfaces_type>& bp, const basic_stroke_props<_Graphics_surfaces_type>& sp, const basic_dashes<_Graphics_surfaces_type>& d, const basic_render_props<_Graphics_surfaces_type>& rp, const basic_clip_props<_Graphics_surfaces_type>& cl) {
+				_Ds_fill_stroke<_Cairo_graphics_surfaces<GraphicsMath>>(data->data, fb, sb, ip, bp, sp, d, rp, cl);
+			}
+			template<class GraphicsMath>
+			void _Cairo_graphics_surfaces<GraphicsMath>::surfaces::fill_instances(output_surface_data_type& data, const basic_brush<_Graphics_surfaces_type>& b, const basic_interpreted_path<_Graphics_surfaces_type>& ip, const _Fill_instance_range<GraphicsMath>& instances, const basic_brush_props<_Graphics_surfaces_type>& bp, const basic_render_props<_Graphics_surfaces_type>& rp, const basic_clip_props<_Graphics_surfaces_type>& cl) {
+				_Ds_fill_instances<_Cairo_graphics_surfaces<GraphicsMath>>(data->data, b, ip, instances, bp, rp, cl);
+			}
+			template<class GraphicsMath>
+			void _Cairo_graphics_surfaces<GraphicsMath>::surfaces::fill_rect(output_surface_data_type& data, const basic_brush<_Graphics_surfaces_type>& b, const basic_bounding_box<GraphicsMath>& bb, const basic_brush_props<_Graphics_surfaces_type>& bp, const basic_render_props<_Graphics_surfaces_type>& rp, const basic_clip_props<_Graphics_surfaces_type>& cl) {
+				_Ds_fill_rect<_Cairo_graphics_surfaces<GraphicsMath>>(data->data, b, bb, bp, rp, cl);
+			}
+			template<class GraphicsMath>
+			void _Cairo_graphics_surfaces<GraphicsMath>::surfaces::stroke_rect(output_surface_data_type& data, const basic_brush<_Graphics_surfaces_type>& b, const basic_bounding_box<GraphicsMath>& bb, const basic_brush_props<_Graphics_surfaces_type>& bp, const basic_stroke_props<_Graphics_surfaces_type>& sp, const basic_dashes<_Graphics_surfaces_type>& d, const basic_render_props<_Graphics_surfaces_type>& rp, const basic_clip_props<_Graphics_surfaces_type>& cl) {
+				_Ds_stroke_rect<_Cairo_graphics_surfaces<GraphicsMath>>(data->data, b, bb, bp, sp, d, rp, cl);
+			}
+			template<class GraphicsMath>
+			void _Cairo_graphics_surfaces<GraphicsMath>::surfaces::fill_circle(output_surface_data_type& data, const basic_brush<_Graphics_surfaces_type>& b, const basic_circle<GraphicsMath>& c, const basic_brush_props<_Graphics_surfaces_type>& bp, const basic_render_props<_Graphics_surfaces_type>& rp, const basic_clip_props<_Graphics_surfaces_type>& cl) {
+				_Ds_fill_circle<_Cairo_graphics_surfaces<GraphicsMath>>(data->data, b, c, bp, rp, cl);
+			}
+			template<class GraphicsMath>
+			void _Cairo_graphics_surfaces<GraphicsMath>::surfaces::mask(output_surface_data_type& data, const basic_brush<_Graphics_surfaces_type>& b, const basic_brush<_Graphics_surfaces_type>& mb, const basic_brush_props<_Graphics_surfaces_type>& bp, const basic_mask_props<_Graphics_surfaces_type>& mp, const basic_render_props<_Graphics_surfaces_type>& rp, const basic_clip_props<_Graphics_surfaces_type>& cl) {
 				_Ds_mask<_Cairo_graphics_surfaces<GraphicsMath>>(data->data, b, mb, bp, mp, rp, cl);
 			}
 			template<class GraphicsMath>
-			inline void _Cairo_graphics_surfaces<GraphicsMath>::surfaces::draw_callback(output_surface_data_type& data, function<void(basic_output_surface<_Graphics_surfaces_type>&)> fn) {
+			void _Cairo_graphics_surfaces<GraphicsMath>::surfaces::coverage_cache_limit(output_surface_data_type& data, size_t bytes) {
+				_Ds_coverage_cache_limit<_Cairo_graphics_surfaces<GraphicsMath>>(data->data, bytes);
+			}
+			template<class GraphicsMath>
+			size_t _Cairo_graphics_surfaces<GraphicsMath>::surfaces::coverage_cache_limit(const output_surface_data_type& data) noexcept {
+				return _Ds_coverage_cache_limit<_Cairo_graphics_surfaces<GraphicsMath>>(data->data);
+			}
+			template<class GraphicsMath>
+			coverage_cache_stats _Cairo_graphics_surfaces<GraphicsMath>::surfaces::coverage_cache_statistics(const output_surface_data_type& data) noexcept {
+				return _Ds_coverage_cache_statistics<_Cairo_graphics_surfaces<GraphicsMath>>(data->data);
+			}
+			template<class GraphicsMath>
+			void _Cairo_graphics_surfaces<GraphicsMath>::surfaces::draw_callback(output_surface_data_type& data, function<void(basic_output_surface<_Graphics_surfaces_type>&)> fn) {
 				data->draw_callback = fn;
 			}
 			template<class GraphicsMath>
-			inline void _Cairo_graphics_surfaces<GraphicsMath>::surfaces::size_change_callback(output_surface_data_type& data, function<void(basic_output_surface<_Graphics_surfaces_type>&)> fn) {
+			void _Cairo_graphics_surfaces<GraphicsMath>::surfaces::size_change_callback(output_surface_data_type& data, function<void(basic_output_surface<_Graphics_surfaces_type>&)> fn) {
 				data->size_change_callback = fn;
 			}
 			template<class GraphicsMath>
-			inline void _Cairo_graphics_surfaces<GraphicsMath>::surfaces::user_scaling_callback(output_surface_data_type& data, function<basic_bounding_box<GraphicsMath>(const basic_output_surface<_Graphics_surfaces_type>&, bool&)> fn) {
+			void _Cairo_graphics_surfaces<GraphicsMath>::surfaces::user_scaling_callback(output_surface_data_type& data, function<basic_bounding_box<GraphicsMath>(const basic_output_surface<_Graphics_surfaces_type>&, bool&)> fn) {
 				data->user_scaling_callback = fn;
 			}
 			template<class GraphicsMath>
-			inline void _Cairo_graphics_surfaces<GraphicsMath>::surfaces::dimensions(output_surface_data_type& data, const basic_display_point<GraphicsMath>& val) {
+			void _Cairo_graphics_surfaces<GraphicsMath>::surfaces::dimensions(output_surface_data_type& data, const basic_display_point<GraphicsMath>& val) {
 				_Ds_dimensions<_Cairo_graphics_surfaces<GraphicsMath>>(data->data, val);
 			}
 			template<class GraphicsMath>
-			inline void _Cairo_graphics_surfaces<GraphicsMath>::surfaces::scaling(output_surface_data_type& data, io2d::scaling val) {
+			void _Cairo_graphics_surfaces<GraphicsMath>::surfaces::scaling(output_surface_data_type& data, io2d::scaling val) {
 				_Ds_scaling<_Cairo_graphics_surfaces<GraphicsMath>>(data->data, val);
 			}
 			template<class GraphicsMath>
-			inline void _Cairo_graphics_surfaces<GraphicsMath>::surfaces::letterbox_brush(output_surface_data_type& data, const optional<basic_brush<_Graphics_surfaces_type>>& val, const optional<basic_brush_props<_Graphics_surfaces_type>>& bp) noexcept {
+			void _Cairo_graphics_surfaces<GraphicsMath>::surfaces::letterbox_brush(output_surface_data_type& data, const optional<basic_brush<_Graphics_surfaces_type>>& val, const optional<basic_brush_props<_Graphics_surfaces_type>>& bp) noexcept {
 				_Ds_letterbox_brush<_Cairo_graphics_surfaces<GraphicsMath>>(data->data, val, bp);
 			}
 			template<class GraphicsMath>
-			inline void _Cairo_graphics_surfaces<GraphicsMath>::surfaces::letterbox_brush_props(output_surface_data_type& data, const basic_brush_props<_Graphics_surfaces_type>& val) {
+			void _Cairo_graphics_surfaces<GraphicsMath>::surfaces::letterbox_brush_props(output_surface_data_type& data, const basic_brush_props<_Graphics_surfaces_type>& val) {
 				_Ds_letterbox_brush_props<_Cairo_graphics_surfaces<GraphicsMath>>(data->data, val);
 			}
 			template<class GraphicsMath>
-			inline void _Cairo_graphics_surfaces<GraphicsMath>::surfaces::auto_clear(output_surface_data_type& data, bool val) {
+			void _Cairo_graphics_surfaces<GraphicsMath>::surfaces::auto_clear(output_surface_data_type& data, bool val) {
 				_Ds_auto_clear<_Cairo_graphics_surfaces<GraphicsMath>>(data->data, val);
 			}
 			template<class GraphicsMath>
-			inline void _Cairo_graphics_surfaces<GraphicsMath>::surfaces::redraw_required(output_surface_data_type& data, bool val) {
+			void _Cairo_graphics_surfaces<GraphicsMath>::surfaces::redraw_required(output_surface_data_type& data, bool val) {
 				_Ds_redraw_required<_Cairo_graphics_surfaces<GraphicsMath>>(data->data, val);
 			}
 			template<class GraphicsMath>
-			inline io2d::format _Cairo_graphics_surfaces<GraphicsMath>::surfaces::format(const output_surface_data_type& data) noexcept {
+			io2d::format _Cairo_graphics_surfaces<GraphicsMath>::surfaces::format(const output_surface_data_type& data) noexcept {
 				return _Ds_format<_Cairo_graphics_surfaces<GraphicsMath>>(data->data);
 			}
 			template<class GraphicsMath>
-			inline basic_display_point<GraphicsMath> _Cairo_graphics_surfaces<GraphicsMath>::surfaces::dimensions(const output_surface_data_type& data) noexcept {
+			basic_display_point<GraphicsMath> _Cairo_graphics_surfaces<GraphicsMath>::surfaces::dimensions(const output_surface_data_type& data) noexcept {
 				return _Ds_dimensions<_Cairo_graphics_surfaces<GraphicsMath>>(data->data);
 			}
 			template<class GraphicsMath>
-			inline basic_display_point<GraphicsMath> _Cairo_graphics_surfaces<GraphicsMath>::surfaces::display_dimensions(const output_surface_data_type& data) noexcept {
+			basic_display_point<GraphicsMath> _Cairo_graphics_surfaces<GraphicsMath>::surfaces::display_dimensions(const output_surface_data_type& data) noexcept {
 				return _Ds_display_dimensions<_Cairo_graphics_surfaces<GraphicsMath>>(data->data);
 			}
 			template<class GraphicsMath>
-			inline io2d::scaling _Cairo_graphics_surfaces<GraphicsMath>::surfaces::scaling(output_surface_data_type& data) noexcept {
+			io2d::scaling _Cairo_graphics_surfaces<GraphicsMath>::surfaces::scaling(const output_surface_data_type& data) noexcept {
 				return _Ds_scaling<_Cairo_graphics_surfaces<GraphicsMath>>(data->data);
 			}
 			template<class GraphicsMath>
-			inline optional<basic_brush<_Cairo_graphics_surfaces<GraphicsMath>>> _Cairo_graphics_surfaces<GraphicsMath>::surfaces::letterbox_brush(const output_surface_data_type& data) noexcept {
+			optional<basic_brush<_Cairo_graphics_surfaces<GraphicsMath>>> _Cairo_graphics_surfaces<GraphicsMath>::surfaces::letterbox_brush(const output_surface_data_type& data) noexcept {
 				return _Ds_letterbox_brush<_Cairo_graphics_surfaces<GraphicsMath>>(data->data);
 			}
 			template<class GraphicsMath>
-			inline basic_brush_props<_Cairo_graphics_surfaces<GraphicsMath>> _Cairo_graphics_surfaces<GraphicsMath>::surfaces::letterbox_brush_props(const output_surface_data_type& data) noexcept {
+			basic_brush_props<_Cairo_graphics_surfaces<GraphicsMath>> _Cairo_graphics_surfaces<GraphicsMath>::surfaces::letterbox_brush_props(const output_surface_data_type& data) noexcept {
 				return _Ds_letterbox_brush_props<_Cairo_graphics_surfaces<GraphicsMath>>(data->data);
 			}
 			template<class GraphicsMath>
-			inline bool _Cairo_graphics_surfaces<GraphicsMath>::surfaces::auto_clear(const output_surface_data_type& data) noexcept {
+			bool _Cairo_graphics_surfaces<GraphicsMath>::surfaces::auto_clear(const output_surface_data_type& data) noexcept {
 				return _Ds_auto_clear<_Cairo_graphics_surfaces<GraphicsMath>>(data->data);
 			}
 			template<class GraphicsMath>
-			inline bool _Cairo_graphics_surfaces<GraphicsMath>::surfaces::redraw_required(const output_surface_data_type& data) noexcept {
+			bool _Cairo_graphics_surfaces<GraphicsMath>::surfaces::redraw_required(const output_surface_data_type& data) noexcept {
 				return _Ds_redraw_required<_Cairo_graphics_surfaces<GraphicsMath>>(data->data);
 			}
 		}
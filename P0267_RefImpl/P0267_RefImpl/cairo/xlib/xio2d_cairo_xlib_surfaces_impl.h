@@ -5,7 +5,7 @@ namespace std::experimental::io2d {
         namespace _Cairo {
             
             template <class GraphicsMath>
-            inline void _Create_display_surface_and_context(typename _Cairo_graphics_surfaces<GraphicsMath>::surfaces::_Display_surface_data_type& data) {
+            void _Create_display_surface_and_context(typename _Cairo_graphics_surfaces<GraphicsMath>::surfaces::_Display_surface_data_type& data) {
                 if (data.wndw != None) {
                     data.display_surface = ::std::move(::std::unique_ptr<cairo_surface_t, decltype(&cairo_surface_destroy)>(cairo_xlib_surface_create(data.display.get(), data.wndw, data.visual, data.display_dimensions.x(), data.display_dimensions.y()), &cairo_surface_destroy));
                     _Throw_if_failed_cairo_status_t(cairo_surface_status(data.display_surface.get()));
@@ -15,110 +15,142 @@ namespace std::experimental::io2d {
             }
             
             template <class GraphicsSurfaces>
-            inline void _Ds_clear(typename GraphicsSurfaces::surfaces::_Display_surface_data_type& data) {
+            void _Ds_clear(typename GraphicsSurfaces::surfaces::_Display_surface_data_type& data) {
                 GraphicsSurfaces::surfaces::clear(data.back_buffer);
             }
             template <class GraphicsSurfaces>
-            inline void _Ds_paint(typename GraphicsSurfaces::surfaces::_Display_surface_data_type& data, const basic_brush<GraphicsSurfaces>& b, const basic_brush_props<GraphicsSurfaces>& bp, const basic_render_props<GraphicsSurfaces>& rp, const basic_clip_props<GraphicsSurfaces>& cl) {
+            void _Ds_paint(typename GraphicsSurfaces::surfaces::_Display_surface_data_type& data, const basic_brush<GraphicsSurfaces>& b, const basic_brush_props<GraphicsSurfaces>& bp, const basic_render_props<GraphicsSurfaces>& rp, const basic_clip_props<GraphicsSurfaces>& cl) {
                 GraphicsSurfaces::surfaces::paint(data.back_buffer, b, bp, rp, cl);
             }
             template <class GraphicsSurfaces>
-            inline void _Ds_stroke(typename GraphicsSurfaces::surfaces::_Display_surface_data_type& data, const basic_brush<GraphicsSurfaces>& b, const basic_interpreted_path<GraphicsSurfaces>& ip, const basic_brush_props<GraphicsSurfaces>& bp, const basic_stroke_props<GraphicsSurfaces>& sp, const basic_dashes<GraphicsSurfaces>& d, const basic_render_props<GraphicsSurfaces>& rp, const basic_clip_props<GraphicsSurfaces>& cl) {
+            void _Ds_stroke(typename GraphicsSurfaces::surfaces::_Display_surface_data_type& data, const basic_brush<GraphicsSurfaces>& b, const basic_interpreted_path<GraphicsSurfaces>& ip, const basic_brush_props<GraphicsSurfaces>& bp, const basic_stroke_props<GraphicsSurfaces>& sp, const basic_dashes<GraphicsSurfaces>& d, const basic_render_props<GraphicsSurfaces>& rp, const basic_clip_props<GraphicsSurfaces>& cl) {
                 GraphicsSurfaces::surfaces::stroke(data.back_buffer, b, ip, bp, sp, d, rp, cl);
             }
             template <class GraphicsSurfaces>
-            inline void _Ds_fill(typename GraphicsSurfaces::surfaces::_Display_surface_data_type& data, const basic_brush<GraphicsSurfaces>& b, const basic_interpreted_path<GraphicsSurfaces>& ip, const basic_brush_props<GraphicsSurfaces>& bp, const basic_render_props<GraphicsSurfaces>& rp, const basic_clip_props<GraphicsSurfaces>& cl) {
+            void _Ds_fill(typename GraphicsSurfaces::surfaces::_Display_surface_data_type& data, const basic_brush<GraphicsSurfaces>& b, const basic_interpreted_path<GraphicsSurfaces>& ip, const basic_brush_props<GraphicsSurfaces>& bp, const basic_render_props<GraphicsSurfaces>& rp, const basic_clip_props<GraphicsSurfaces>& cl) {
                 GraphicsSurfaces::surfaces::fill(data.back_buffer, b, ip, bp, rp, cl);
             }
             template <class GraphicsSurfaces>
-            inline void _Ds_mask(typename GraphicsSurfaces::surfaces::_Display_surface_data_type& data, const basic_brush<GraphicsSurfaces>& b, const basic_brush<GraphicsSurfaces>& mb, const basic_brush_props<GraphicsSurfaces>& bp, const basic_mask_props<GraphicsSurfaces>& mp, const basic_render_props<GraphicsSurfaces>& rp, const basic_clip_props<GraphicsSurfaces>& cl) {
+            void _Ds_fill_stroke(typename GraphicsSurfaces::surfaces::_Display_surface_data_type& data, const basic_brush<GraphicsSurfaces>& fb, const basic_brush<GraphicsSurfaces>& sb, const basic_interpreted_path<GraphicsSurfaces>& ip, const basic_brush_props<GraphicsSurfaces>& bp, const basic_stroke_props<GraphicsSurfaces>& sp, const basic_dashes<GraphicsSurfaces>& d, const basic_render_props<GraphicsSurfaces>& rp, const basic_clip_props<GraphicsSurfaces>& cl) {
+                GraphicsSurfaces::surfaces::fill_stroke(data.back_buffer, fb, sb, ip, bp, sp, d, rp, cl);
+            }
+            template <class GraphicsSurfaces>
+            void _Ds_fill_instances(typename GraphicsSurfaces::surfaces::_Display_surface_data_type& data, const basic_brush<GraphicsSurfaces>& b, const basic_interpreted_path<GraphicsSurfaces>& ip, const _Fill_instance_range<typename GraphicsSurfaces::graphics_math_type>& instances, const basic_brush_props<GraphicsSurfaces>& bp, const basic_render_props<GraphicsSurfaces>& rp, const basic_clip_props<GraphicsSurfaces>& cl) {
+                GraphicsSurfaces::surfaces::fill_instances(data.back_buffer, b, ip, instances, bp, rp, cl);
+            }
+            template <class GraphicsSurfaces>
+            void _Ds_fill_rect(typename GraphicsSurfaces::surfaces::_Display_surface_data_type& data, const basic_brush<GraphicsSurfaces>& b, const basic_bounding_box<typename GraphicsSurfaces::graphics_math_type>& bb, const basic_brush_props<GraphicsSurfaces>& bp, const basic_render_props<GraphicsSurfaces>& rp, const basic_clip_props<GraphicsSurfaces>& cl) {
+                GraphicsSurfaces::surfaces::fill_rect(data.back_buffer, b, bb, bp, rp, cl);
+            }
+            template <class GraphicsSurfaces>
+            void _Ds_stroke_rect(typename GraphicsSurfaces::surfaces::_Display_surface_data_type& data, const basic_brush<GraphicsSurfaces>& b, const basic_bounding_box<typename GraphicsSurfaces::graphics_math_type>& bb, const basic_brush_props<GraphicsSurfaces>& bp, const basic_stroke_props<GraphicsSurfaces>& sp, const basic_dashes<GraphicsSurfaces>& d, const basic_render_props<GraphicsSurfaces>& rp, const basic_clip_props<GraphicsSurfaces>& cl) {
+                GraphicsSurfaces::surfaces::stroke_rect(data.back_buffer, b, bb, bp, sp, d, rp, cl);
+            }
+            template <class GraphicsSurfaces>
+            void _Ds_fill_circle(typename GraphicsSurfaces::surfaces::_Display_surface_data_type& data, const basic_brush<GraphicsSurfaces>& b, const basic_circle<typename GraphicsSurfaces::graphics_math_type>& c, const basic_brush_props<GraphicsSurfaces>& bp, const basic_render_props<GraphicsSurfaces>& rp, const basic_clip_props<GraphicsSurfaces>& cl) {
+                GraphicsSurfaces::surfaces::fill_circle(data.back_buffer, b, c, bp, rp, cl);
+            }
+            template <class GraphicsSurfaces>
+            void _Ds_mask(typename GraphicsSurfaces::surfaces::_Display_surface_data_type& data, const basic_brush<GraphicsSurfaces>& b, const basic_brush<GraphicsSurfaces>& mb, const basic_brush_props<GraphicsSurfaces>& bp, const basic_mask_props<GraphicsSurfaces>& mp, const basic_render_props<GraphicsSurfaces>& rp, const basic_clip_props<GraphicsSurfaces>& cl) {
                 GraphicsSurfaces::surfaces::mask(data.back_buffer, b, mb, bp, mp, rp, cl);
             }
             template <class GraphicsSurfaces>
-            inline void _Ds_dimensions(typename GraphicsSurfaces::surfaces::_Display_surface_data_type& data, const basic_display_point<typename GraphicsSurfaces::graphics_math_type>& val) {
+            void _Ds_coverage_cache_limit(typename GraphicsSurfaces::surfaces::_Display_surface_data_type& data, size_t bytes) {
+                GraphicsSurfaces::surfaces::coverage_cache_limit(data.back_buffer, bytes);
+            }
+            template <class GraphicsSurfaces>
+            size_t _Ds_coverage_cache_limit(const typename GraphicsSurfaces::surfaces::_Display_surface_data_type& data) noexcept {
+                return GraphicsSurfaces::surfaces::coverage_cache_limit(data.back_buffer);
+            }
+            template <class GraphicsSurfaces>
+            coverage_cache_stats _Ds_coverage_cache_statistics(const typename GraphicsSurfaces::surfaces::_Display_surface_data_type& data) noexcept {
+                return GraphicsSurfaces::surfaces::coverage_cache_statistics(data.back_buffer);
+            }
+            template <class GraphicsSurfaces>
+            void _Ds_dimensions(typename GraphicsSurfaces::surfaces::_Display_surface_data_type& data, const basic_display_point<typename GraphicsSurfaces::graphics_math_type>& val) {
                 if (val != data.back_buffer.dimensions) {
                     // Recreate the render target that is drawn to the displayed surface
                     data.back_buffer = ::std::move(GraphicsSurfaces::surfaces::create_image_surface(data.back_buffer.format, val.x(), val.y()));
                 }
             }
             template <class GraphicsSurfaces>
-            inline void _Ds_display_dimensions(typename GraphicsSurfaces::surfaces::_Display_surface_data_type& data, const basic_display_point<typename GraphicsSurfaces::graphics_math_type>& val) {
+            void _Ds_display_dimensions(typename GraphicsSurfaces::surfaces::_Display_surface_data_type& data, const basic_display_point<typename GraphicsSurfaces::graphics_math_type>& val) {
                 data.display_dimensions = val;
                 if (data.unmanaged) {
                     cairo_xlib_surface_set_size(data.display_surface.get(), val.x(), val.y());
                 }
             }
             template <class GraphicsSurfaces>
-            inline void _Ds_scaling(typename GraphicsSurfaces::surfaces::_Display_surface_data_type& data, io2d::scaling val) {
+            void _Ds_scaling(typename GraphicsSurfaces::surfaces::_Display_surface_data_type& data, io2d::scaling val) {
                 data.scl = val;
             }
             template <class GraphicsSurfaces>
-            inline void _Ds_letterbox_brush(typename GraphicsSurfaces::surfaces::_Display_surface_data_type& data, const optional<basic_brush<GraphicsSurfaces>>& val, const optional<basic_brush_props<GraphicsSurfaces>>& bp) noexcept {
+            void _Ds_letterbox_brush(typename GraphicsSurfaces::surfaces::_Display_surface_data_type& data, const optional<basic_brush<GraphicsSurfaces>>& val, const optional<basic_brush_props<GraphicsSurfaces>>& bp) noexcept {
                 data.letterbox_brush_is_default = !val.has_value();
                 data._Letterbox_brush = (val.has_value() ? val.value() : data._Default_letterbox_brush);
                 data._Letterbox_brush_props = (bp.has_value() ? bp.value() : basic_brush_props<GraphicsSurfaces>());
                 
             }
             template <class GraphicsSurfaces>
-            inline void _Ds_letterbox_brush_props(typename GraphicsSurfaces::surfaces::_Display_surface_data_type& data, const basic_brush_props<GraphicsSurfaces>& val) {
+            void _Ds_letterbox_brush_props(typename GraphicsSurfaces::surfaces::_Display_surface_data_type& data, const basic_brush_props<GraphicsSurfaces>& val) {
                 data._Letterbox_brush_props = val;
             }
             template <class GraphicsSurfaces>
-            inline void _Ds_auto_clear(typename GraphicsSurfaces::surfaces::_Display_surface_data_type& data, bool val) {
+            void _Ds_auto_clear(typename GraphicsSurfaces::surfaces::_Display_surface_data_type& data, bool val) {
                 data.auto_clear = val;
             }
             template <class GraphicsSurfaces>
-            inline void _Ds_redraw_required(typename GraphicsSurfaces::surfaces::_Display_surface_data_type& data, bool val) {
+            void _Ds_redraw_required(typename GraphicsSurfaces::surfaces::_Display_surface_data_type& data, bool val) {
                 data.redraw_required = val;
             }
             template <class GraphicsSurfaces>
-            inline io2d::format _Ds_format(const typename GraphicsSurfaces::surfaces::_Display_surface_data_type& data) noexcept {
+            io2d::format _Ds_format(const typename GraphicsSurfaces::surfaces::_Display_surface_data_type& data) noexcept {
                 return data.back_buffer.format;
             }
             template <class GraphicsSurfaces>
-            inline basic_display_point<typename GraphicsSurfaces::graphics_math_type> _Ds_dimensions(const typename GraphicsSurfaces::surfaces::_Display_surface_data_type& data) noexcept {
+            basic_display_point<typename GraphicsSurfaces::graphics_math_type> _Ds_dimensions(const typename GraphicsSurfaces::surfaces::_Display_surface_data_type& data) noexcept {
                 return data.back_buffer.dimensions;
             }
             template <class GraphicsSurfaces>
-            inline basic_display_point<typename GraphicsSurfaces::graphics_math_type> _Ds_max_dimensions() noexcept {
+            basic_display_point<typename GraphicsSurfaces::graphics_math_type> _Ds_max_dimensions() noexcept {
                 return GraphicsSurfaces::surfaces::max_dimensions();
             }
             template <class GraphicsSurfaces>
-            inline basic_display_point<typename GraphicsSurfaces::graphics_math_type> _Ds_display_dimensions(const typename GraphicsSurfaces::surfaces::_Display_surface_data_type& data) noexcept {
+            basic_display_point<typename GraphicsSurfaces::graphics_math_type> _Ds_display_dimensions(const typename GraphicsSurfaces::surfaces::_Display_surface_data_type& data) noexcept {
                 return data.display_dimensions;
             }
             template <class GraphicsSurfaces>
-            inline basic_display_point<typename GraphicsSurfaces::graphics_math_type> _Ds_max_display_dimensions() noexcept {
+            basic_display_point<typename GraphicsSurfaces::graphics_math_type> _Ds_max_display_dimensions() noexcept {
                 return GraphicsSurfaces::max_display_dimensions();
             }
             template <class GraphicsSurfaces>
-            inline io2d::scaling _Ds_scaling(typename GraphicsSurfaces::surfaces::_Display_surface_data_type& data) noexcept {
+            io2d::scaling _Ds_scaling(const typename GraphicsSurfaces::surfaces::_Display_surface_data_type& data) noexcept {
                 return data.scl;
             }
             template <class GraphicsSurfaces>
-            inline optional<basic_brush<GraphicsSurfaces>> _Ds_letterbox_brush(const typename GraphicsSurfaces::surfaces::_Display_surface_data_type& data) noexcept {
+            optional<basic_brush<GraphicsSurfaces>> _Ds_letterbox_brush(const typename GraphicsSurfaces::surfaces::_Display_surface_data_type& data) noexcept {
                 return (data.letterbox_brush_is_default ? optional<basic_brush<GraphicsSurfaces>>() : optional<basic_brush<GraphicsSurfaces>>(data._Letterbox_brush));
             }
             template <class GraphicsSurfaces>
-            inline basic_brush_props<GraphicsSurfaces> _Ds_letterbox_brush_props(const typename GraphicsSurfaces::surfaces::_Display_surface_data_type& data) noexcept {
-                return data._Letterbox_brush_props;
+            basic_brush_props<GraphicsSurfaces> _Ds_letterbox_brush_props(const typename GraphicsSurfaces::surfaces::_Display_surface_data_type& data) noexcept {
+                return data._Letterbox_brush_props.value_or(basic_brush_props<GraphicsSurfaces>());
             }
             template <class GraphicsSurfaces>
-            inline bool _Ds_auto_clear(const typename GraphicsSurfaces::surfaces::_Display_surface_data_type& data) noexcept {
+            bool _Ds_auto_clear(const typename GraphicsSurfaces::surfaces::_Display_surface_data_type& data) noexcept {
                 return data.auto_clear;
             }
             template <class GraphicsSurfaces>
-            inline bool _Ds_redraw_required(const typename GraphicsSurfaces::surfaces::_Display_surface_data_type& data) noexcept {
+            bool _Ds_redraw_required(const typename GraphicsSurfaces::surfaces::_Display_surface_data_type& data) noexcept {
                 return data.redraw_required;
             }
             
             template <class GraphicsMath>
-            inline basic_display_point<GraphicsMath> _Cairo_graphics_surfaces<GraphicsMath>::surfaces::max_display_dimensions() noexcept {
+            basic_display_point<GraphicsMath> _Cairo_graphics_surfaces<GraphicsMath>::surfaces::max_display_dimensions() noexcept {
                 return basic_display_point<GraphicsMath>(16384, 16384); // This takes up 1 GB of RAM, you probably don't want to do this. 2048x2048 is the max size for hardware that meets 9_1 specs (i.e. quite low powered or really old). Probably much more reasonable.
             }
             
             template <class OutputDataType>
-            inline void _Render_for_scaling_uniform_or_letterbox(OutputDataType& osd) {
+            void _Render_for_scaling_uniform_or_letterbox(OutputDataType& osd) {
                 const cairo_filter_t cairoFilter = CAIRO_FILTER_GOOD;
                 
                 auto& data = osd.data;
@@ -166,25 +198,8 @@ namespace std::experimental::io2d {
                                 cairo_set_source_rgb(displayContext, 0.0, 0.0, 0.0);
                             }
                             else {
-                                auto pttn = data._Letterbox_brush.value().data().brush.get();
-                                if (data._Letterbox_brush_props == nullopt) {
-                                    cairo_pattern_set_extend(pttn, CAIRO_EXTEND_NONE);
-                                    cairo_pattern_set_filter(pttn, CAIRO_FILTER_GOOD);
-                                    cairo_matrix_t cPttnMatrix;
-                                    cairo_matrix_init_identity(&cPttnMatrix);
-                                    cairo_pattern_set_matrix(pttn, &cPttnMatrix);
-                                    cairo_set_source(displayContext, pttn);
-                                }
-                                else {
-                                    const auto& props = data._Letterbox_brush_props.value();
-                                    cairo_pattern_set_extend(pttn, _Extend_to_cairo_extend_t(props.wrap_mode()));
-                                    cairo_pattern_set_filter(pttn, _Filter_to_cairo_filter_t(props.filter()));
-                                    cairo_matrix_t cPttnMatrix;
-                                    const auto& m = props.brush_matrix();
-                                    cairo_matrix_init(&cPttnMatrix, m.m00(), m.m01(), m.m10(), m.m11(), m.m20(), m.m21());
-                                    cairo_pattern_set_matrix(pttn, &cPttnMatrix);
-                                    cairo_set_source(displayContext, pttn);
-                                }
+                                const auto pttn = _Create_brush_pattern(data._Letterbox_brush.value(), data._Letterbox_brush_props);
+                                cairo_set_source(displayContext, pttn.get());
                             }
                             cairo_fill(displayContext);
                         }
@@ -216,26 +231,8 @@ namespace std::experimental::io2d {
                                 //cairo_paint(_Native_context.get());
                             }
                             else {
-                                auto pttn = data._Letterbox_brush.value().data().brush.get();
-                                if (data._Letterbox_brush_props == nullopt) {
-                                    cairo_pattern_set_extend(pttn, CAIRO_EXTEND_NONE);
-                                    cairo_pattern_set_filter(pttn, CAIRO_FILTER_GOOD);
-                                    cairo_matrix_t cPttnMatrix;
-                                    cairo_matrix_init_identity(&cPttnMatrix);
-                                    cairo_pattern_set_matrix(pttn, &cPttnMatrix);
-                                    cairo_set_source(displayContext, pttn);
-                                    //cairo_paint(_Native_context.get());
-                                }
-                                else {
-                                    const auto& props = data._Letterbox_brush_props.value();
-                                    cairo_pattern_set_extend(pttn, _Extend_to_cairo_extend_t(props.wrap_mode()));
-                                    cairo_pattern_set_filter(pttn, _Filter_to_cairo_filter_t(props.filter()));
-                                    cairo_matrix_t cPttnMatrix;
-                                    const auto& m = props.brush_matrix();
-                                    cairo_matrix_init(&cPttnMatrix, m.m00(), m.m01(), m.m10(), m.m11(), m.m20(), m.m21());
-                                    cairo_pattern_set_matrix(pttn, &cPttnMatrix);
-                                    cairo_set_source(displayContext, pttn);
-                                }
+                                const auto pttn = _Create_brush_pattern(data._Letterbox_brush.value(), data._Letterbox_brush_props);
+                                cairo_set_source(displayContext, pttn.get());
                             }
                             cairo_fill(displayContext); // Draws the letterbox brush into the appropriate triangles using the appropriate brush_props, etc., settings.
                         }
@@ -244,7 +241,7 @@ namespace std::experimental::io2d {
             }
             template <class GraphicsMath>
             template <class OutputDataType, class OutputSurfaceType>
-            inline void _Cairo_graphics_surfaces<GraphicsMath>::surfaces::_Render_to_native_surface(OutputDataType& osdp, OutputSurfaceType& sfc) {
+            void _Cairo_graphics_surfaces<GraphicsMath>::surfaces::_Render_to_native_surface(OutputDataType& osdp, OutputSurfaceType& sfc) {
                 auto& osd = *osdp;
                 const cairo_filter_t cairoFilter = CAIRO_FILTER_GOOD;
                 auto& data = osd.data;
@@ -266,27 +263,9 @@ namespace std::experimental::io2d {
                             cairo_paint(displayContext);
                         }
                         else {
-                            auto pttn = data._Letterbox_brush.value().data().brush.get();
-                            if (data._Letterbox_brush_props == nullopt) {
-                                cairo_pattern_set_extend(pttn, CAIRO_EXTEND_NONE);
-                                cairo_pattern_set_filter(pttn, CAIRO_FILTER_GOOD);
-                                cairo_matrix_t cPttnMatrix;
-                                cairo_matrix_init_identity(&cPttnMatrix);
-                                cairo_pattern_set_matrix(pttn, &cPttnMatrix);
-                                cairo_set_source(displayContext, pttn);
-                                cairo_paint(displayContext);
-                            }
-                            else {
-                                const basic_brush_props<_Cairo_graphics_surfaces<GraphicsMath>>& props = data._Letterbox_brush_props.value();
-                                cairo_pattern_set_extend(pttn, _Extend_to_cairo_extend_t(props.wrap_mode()));
-                                cairo_pattern_set_filter(pttn, _Filter_to_cairo_filter_t(props.filter()));
-                                cairo_matrix_t cPttnMatrix;
-                                const auto& m = props.brush_matrix();
-                                cairo_matrix_init(&cPttnMatrix, m.m00(), m.m01(), m.m10(), m.m11(), m.m20(), m.m21());
-                                cairo_pattern_set_matrix(pttn, &cPttnMatrix);
-                                cairo_set_source(displayContext, pttn);
-                                cairo_paint(displayContext);
-                            }
+                            const auto pttn = _Create_brush_pattern(data._Letterbox_brush.value(), data._Letterbox_brush_props);
+                            cairo_set_source(displayContext, pttn.get());
+                            cairo_paint(displayContext);
                         }
                     }
                     cairo_matrix_t ctm;
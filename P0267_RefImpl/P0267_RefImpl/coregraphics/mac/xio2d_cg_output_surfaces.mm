@@ -116,7 +116,7 @@ basic_display_point<GraphicsMath> _GS::surfaces::display_dimensions(const output
     return {int(bounds.size.width), int(bounds.size.height)};
 }
     
-io2d::scaling _GS::surfaces::scaling(output_surface_data_type& data) noexcept
+io2d::scaling _GS::surfaces::scaling(const output_surface_data_type& data) noexcept
 {
     return data->scaling;
 }
@@ -184,10 +184,49 @@ void _GS::surfaces::fill(output_surface_data_type& data, const basic_brush<_GS>&
     _Fill(data->draw_buffer.get(), b, ip, bp, rp, cl);
 }
     
+void _GS::surfaces::fill_rect(output_surface_data_type& data, const basic_brush<_GS>& b, const basic_bounding_box<GraphicsMath>& bb, const basic_brush_props<_GS>& bp, const basic_render_props<_GS>& rp, const basic_clip_props<_GS>& cl)
+{
+    _FillRect(data->draw_buffer.get(), b, bb, bp, rp, cl);
+}
+
+void _GS::surfaces::stroke_rect(output_surface_data_type& data, const basic_brush<_GS>& b, const basic_bounding_box<GraphicsMath>& bb, const basic_brush_props<_GS>& bp, const basic_stroke_props<_GS>& sp, const basic_dashes<_GS>& d, const basic_render_props<_GS>& rp, const basic_clip_props<_GS>& cl)
+{
+    _StrokeRect(data->draw_buffer.get(), b, bb, bp, sp, d, rp, cl);
+}
+
+void _GS::surfaces::fill_circle(output_surface_data_type& data, const basic_brush<_GS>& b, const basic_circle<GraphicsMath>& c, const basic_brush_props<_GS>& bp, const basic_render_props<_GS>& rp, const basic_clip_props<_GS>& cl)
+{
+    _FillCircle(data->draw_buffer.get(), b, c, bp, rp, cl);
+}
+
+void _GS::surfaces::fill_instances(output_surface_data_type& data, const basic_brush<_GS>& b, const basic_interpreted_path<_GS>& ip, const _Fill_instance_range<GraphicsMath>& instances, const basic_brush_props<_GS>& bp, const basic_render_props<_GS>& rp, const basic_clip_props<_GS>& cl)
+{
+    _FillInstances(data->draw_buffer.get(), b, ip, instances, bp, rp, cl);
+}
+
+void _GS::surfaces::fill_stroke(output_surface_data_type& data, const basic_brush<_GS>& fb, const basic_brush<_GS>& sb, const basic_interpreted_path<_GS>& ip, const basic_brush_props<_GS>& bp, const basic_stroke_props<_GS>& sp, const basic_dashes<_GS>& d, const basic_render_props<_GS>& rp, const basic_clip_props<_GS>& cl)
+{
+    _FillStroke(data->draw_buffer.get(), fb, sb, ip, bp, sp, d, rp, cl);
+}
+    
 void _GS::surfaces::mask(output_surface_data_type& data, const basic_brush<_GS>& b, const basic_brush<_GS>& mb, const basic_brush_props<_GS>& bp, const basic_mask_props<_GS>& mp, const basic_render_props<_GS>& rp, const basic_clip_props<_GS>& cl)
 {
     _Mask(data->draw_buffer.get(), b, mb, bp, mp, rp, cl);
 }
+
+void _GS::surfaces::coverage_cache_limit(output_surface_data_type&, size_t) noexcept
+{
+}
+
+size_t _GS::surfaces::coverage_cache_limit(const output_surface_data_type&) noexcept
+{
+    return 0;
+}
+
+coverage_cache_stats _GS::surfaces::coverage_cache_statistics(const output_surface_data_type&) noexcept
+{
+    return coverage_cache_stats();
+}
     
 static void _NSAppBootstrap()
 {
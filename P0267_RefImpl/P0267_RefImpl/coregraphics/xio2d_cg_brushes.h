@@ -41,6 +41,43 @@ _GS::brushes::create_brush(basic_image_surface<_GS>&& img) {
     return data;
 }
 
+// CGBitmapContextCreateImage shares the bitmap's pixels until either side is written to, so the brush keeps the image's contents as they were
+// when it was created and the image stays usable as a draw target.
+inline _GS::brushes::brush_data_type
+_GS::brushes::create_brush(const basic_image_surface<_GS>& img) {
+    _Surface surface_data;
+    surface_data.image.reset( CGBitmapContextCreateImage(img.data().context.get()) );
+    if( surface_data.image == nullptr )
+        throw ::std::runtime_error("error");
+    surface_data.width = (int)CGImageGetWidth(surface_data.image.get());
+    surface_data.height = (int)CGImageGetHeight(surface_data.image.get());
+    
+    brush_data_type data;
+    data.brush = std::make_shared<typename brush_data_type::brush_t>( ::std::move(surface_data) );
+    data.brushType = brush_type::surface;
+    return data;
+}
+
+// The cropped image shares the pixels of the source image, and the texture drawing code treats its bounds as the edges of the surface.
+inline _GS::brushes::brush_data_type
+_GS::brushes::create_brush(const brush_data_type& surfaceBrush, const basic_bounding_box<GraphicsMath>& bb) {
+    if( surfaceBrush.brushType != brush_type::surface )
+        throw ::std::system_error(::std::make_error_code(::std::errc::invalid_argument));
+    const auto &source_data = std::get<_Surface>(*surfaceBrush.brush);
+    
+    _Surface surface_data;
+    surface_data.image.reset( CGImageCreateWithImageInRect(source_data.image.get(), CGRectMake(bb.x(), bb.y(), bb.width(), bb.height())) );
+    if( surface_data.image == nullptr )
+        throw ::std::runtime_error("error");
+    surface_data.width = (int)CGImageGetWidth(surface_data.image.get());
+    surface_data.height = (int)CGImageGetHeight(surface_data.image.get());
+    
+    brush_data_type data;
+    data.brush = std::make_shared<typename brush_data_type::brush_t>( ::std::move(surface_data) );
+    data.brushType = brush_type::surface;
+    return data;
+}
+
 template <class InputIterator>
 inline _GS::brushes::brush_data_type
 _GS::brushes::create_brush(const basic_point_2d<GraphicsMath>& begin, const basic_point_2d<GraphicsMath>& end, InputIterator first, InputIterator last) {
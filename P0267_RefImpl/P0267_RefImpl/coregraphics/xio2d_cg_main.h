@@ -197,17 +197,23 @@ struct paths {
     struct _InterpretedPath {
         using path_t = remove_pointer_t<CGPathRef>;
         ::std::shared_ptr<path_t> path; // will stay nullptr for empty path
+        _Flattened_path_cache_ptr<::std::shared_ptr<path_t>> flattened; // created by the first flatten call
     };
     using interpreted_path_data_type = _InterpretedPath;
     static interpreted_path_data_type create_interpreted_path() noexcept;
     template <class ForwardIterator>
     static interpreted_path_data_type create_interpreted_path(ForwardIterator first, ForwardIterator last);
+    template <size_t Capacity>
+    static interpreted_path_data_type create_interpreted_path(const basic_static_path<graphics_math_type, Capacity>& sp);
     static interpreted_path_data_type create_interpreted_path(const bounding_box& bb);
     static interpreted_path_data_type create_interpreted_path(initializer_list<typename basic_figure_items<graphics_surfaces_type>::figure_item> il);    
     static interpreted_path_data_type copy_interpreted_path(const interpreted_path_data_type&) noexcept;
     static interpreted_path_data_type move_interpreted_path(interpreted_path_data_type&&) noexcept;
     static void destroy(interpreted_path_data_type&) noexcept;
     static bool is_empty(const interpreted_path_data_type&) noexcept;
+    static interpreted_path_data_type flatten(const interpreted_path_data_type& data, float tolerance, float scale);
+    static basic_bounding_box<GraphicsMath> bounds(const interpreted_path_data_type& data) noexcept;
+    static interpreted_path_data_type stroke_outline(const interpreted_path_data_type& data, const basic_stroke_props<_GS>& sp, const basic_dashes<_GS>& d, float tolerance, float scale);
 };
     
 struct brushes {
@@ -243,7 +249,7 @@ struct brushes {
         
         unique_ptr<bitmap_t, decltype(&CGContextRelease)> bitmap{ nullptr, &CGContextRelease };
         unique_ptr<image_t, decltype(&CGImageRelease)> image{ nullptr, &CGImageRelease };
-        mutable unique_ptr<_Pad> pad;
+        mutable shared_ptr<const _Pad> pad;
         int width = 0;
         int height = 0;
     };
@@ -261,6 +267,8 @@ struct brushes {
     static brush_data_type create_brush(const basic_circle<GraphicsMath>& start, const basic_circle<GraphicsMath>& end, InputIterator first, InputIterator last);
     static brush_data_type create_brush(const basic_circle<GraphicsMath>& start, const basic_circle<GraphicsMath>& end, ::std::initializer_list<gradient_stop> il);
     static brush_data_type create_brush(basic_image_surface<_GS>&& img);
+    static brush_data_type create_brush(const basic_image_surface<_GS>& img);
+    static brush_data_type create_brush(const brush_data_type& surfaceBrush, const basic_bounding_box<GraphicsMath>& bb);
     static brush_data_type copy_brush(const brush_data_type& data);
     static brush_data_type move_brush(brush_data_type&& data) noexcept;
     static void destroy(brush_data_type& data) noexcept;
@@ -383,9 +391,12 @@ struct surfaces {
         ::std::unique_ptr<context_t, decltype(&CGContextRelease)> context{ nullptr, &CGContextRelease };
         basic_display_point<GraphicsMath> dimensions;
         io2d::format format;
+        // Set when the pixels live in memory the caller or a mapped file provides.
+        bool external_memory = false;
     };
     using image_surface_data_type = _Image_surface_data;
     static image_surface_data_type create_image_surface(io2d::format fmt, int width, int height);
+    static image_surface_data_type create_image_surface(io2d::format fmt, int width, int height, ::std::byte* data, int stride, ::std::shared_ptr<void> owner);
 #ifdef _IO2D_Has_Filesystem
     static image_surface_data_type create_image_surface(const filesystem::path &p, image_file_format iff, io2d::format fmt);
     static image_surface_data_type create_image_surface(const filesystem::path &p, image_file_format iff, io2d::format fmt, ::std::error_code& ec) noexcept;
@@ -393,8 +404,13 @@ struct surfaces {
     static image_surface_data_type create_image_surface(const string &p, image_file_format iff, io2d::format fmt);
     static image_surface_data_type create_image_surface(const string &p, image_file_format iff, io2d::format fmt, ::std::error_code& ec) noexcept;
 #endif    
+    static image_surface_data_type create_image_surface(const ::std::byte* bytes, size_t size, image_file_format iff, io2d::format fmt);
+    static image_surface_data_type create_image_surface(const ::std::byte* bytes, size_t size, image_file_format iff, io2d::format fmt, ::std::error_code& ec) noexcept;
     static image_surface_data_type move_image_surface(image_surface_data_type&& data) noexcept;
+    static image_surface_data_type share_image_surface(const image_surface_data_type& data);
+    static bool uses_external_memory(const image_surface_data_type& data) noexcept;
     static void destroy(image_surface_data_type& data) noexcept;
+    static bool is_recyclable(const image_surface_data_type& data) noexcept;
 #ifdef _IO2D_Has_Filesystem
     static void save(image_surface_data_type& data, const filesystem::path &p, image_file_format iff);
     static void save(image_surface_data_type& data, const filesystem::path &p, image_file_format iff, error_code& ec) noexcept;
@@ -403,6 +419,7 @@ struct surfaces {
     static void save(image_surface_data_type& data, const string &p, image_file_format iff, error_code& ec) noexcept;
 #endif
     static basic_display_point<GraphicsMath> max_dimensions() noexcept;
+    static int stride_for_width(io2d::format fmt, int width) noexcept;
     static io2d::format format(const image_surface_data_type& data) noexcept;
     static basic_display_point<GraphicsMath> dimensions(const image_surface_data_type& data) noexcept;
     static void clear(image_surface_data_type& data);
@@ -415,7 +432,18 @@ struct surfaces {
     static void paint(image_surface_data_type& data, const basic_brush<_GS>& b, const basic_brush_props<_GS>& bp, const basic_render_props<_GS>& rp, const basic_clip_props<_GS>& cl);
     static void stroke(image_surface_data_type& data, const basic_brush<_GS>& b, const basic_interpreted_path<_GS>& ip, const basic_brush_props<_GS>& bp, const basic_stroke_props<_GS>& sp, const basic_dashes<_GS>& d, const basic_render_props<_GS>& rp, const basic_clip_props<_GS>& cl);
     static void fill(image_surface_data_type& data, const basic_brush<_GS>& b, const basic_interpreted_path<_GS>& ip, const basic_brush_props<_GS>& bp, const basic_render_props<_GS>& rp, const basic_clip_props<_GS>& cl);
+    static void fill_rect(image_surface_data_type& data, const basic_brush<_GS>& b, const basic_bounding_box<GraphicsMath>& bb, const basic_brush_props<_GS>& bp, const basic_render_props<_GS>& rp, const basic_clip_props<_GS>& cl);
+    static void stroke_rect(image_surface_data_type& data, const basic_brush<_GS>& b, const basic_bounding_box<GraphicsMath>& bb, const basic_brush_props<_GS>& bp, const basic_stroke_props<_GS>& sp, const basic_dashes<_GS>& d, const basic_render_props<_GS>& rp, const basic_clip_props<_GS>& cl);
+    static void fill_circle(image_surface_data_type& data, const basic_brush<_GS>& b, const basic_circle<GraphicsMath>& c, const basic_brush_props<_GS>& bp, const basic_render_props<_GS>& rp, const basic_clip_props<_GS>& cl);
+    static void fill_instances(image_surface_data_type& data, const basic_brush<_GS>& b, const basic_interpreted_path<_GS>& ip, const _Fill_instance_range<GraphicsMath>& instances, const basic_brush_props<_GS>& bp, const basic_render_props<_GS>& rp, const basic_clip_props<_GS>& cl);
+    static void fill_stroke(image_surface_data_type& data, const basic_brush<_GS>& fb, const basic_brush<_GS>& sb, const basic_interpreted_path<_GS>& ip, const basic_brush_props<_GS>& bp, const basic_stroke_props<_GS>& sp, const basic_dashes<_GS>& d, const basic_render_props<_GS>& rp, const basic_clip_props<_GS>& cl);
     static void mask(image_surface_data_type& data, const basic_brush<_GS>& b, const basic_brush<_GS>& mb, const basic_brush_props<_GS>& bp, const basic_mask_props<_GS>& mp, const basic_render_props<_GS>& rp, const basic_clip_props<_GS>& cl);
+    static void copy_region(const image_surface_data_type& src, int x, int y, int width, int height, image_surface_data_type& dst, int dstX, int dstY);
+    static ::std::byte* pixels(image_surface_data_type& data) noexcept;
+    static int stride(const image_surface_data_type& data) noexcept;
+    static void coverage_cache_limit(image_surface_data_type& data, size_t bytes) noexcept;
+    static size_t coverage_cache_limit(const image_surface_data_type& data) noexcept;
+    static coverage_cache_stats coverage_cache_statistics(const image_surface_data_type& data) noexcept;
     static _Interchange_buffer _Copy_to_interchange_buffer(image_surface_data_type& data, _Interchange_buffer::pixel_layout layout, _Interchange_buffer::alpha_mode alpha);
                     
     struct _OutputSurfaceCocoa;
@@ -444,7 +472,15 @@ struct surfaces {
     static void paint(output_surface_data_type& data, const basic_brush<_GS>& b, const basic_brush_props<_GS>& bp, const basic_render_props<_GS>& rp, const basic_clip_props<_GS>& cl);
     static void stroke(output_surface_data_type& data, const basic_brush<_GS>& b, const basic_interpreted_path<_GS>& ip, const basic_brush_props<_GS>& bp, const basic_stroke_props<_GS>& sp, const basic_dashes<_GS>& d, const basic_render_props<_GS>& rp, const basic_clip_props<_GS>& cl);
     static void fill(output_surface_data_type& data, const basic_brush<_GS>& b, const basic_interpreted_path<_GS>& ip, const basic_brush_props<_GS>& bp, const basic_render_props<_GS>& rp, const basic_clip_props<_GS>& cl);
+    static void fill_rect(output_surface_data_type& data, const basic_brush<_GS>& b, const basic_bounding_box<GraphicsMath>& bb, const basic_brush_props<_GS>& bp, const basic_render_props<_GS>& rp, const basic_clip_props<_GS>& cl);
+    static void stroke_rect(output_surface_data_type& data, const basic_brush<_GS>& b, const basic_bounding_box<GraphicsMath>& bb, const basic_brush_props<_GS>& bp, const basic_stroke_props<_GS>& sp, const basic_dashes<_GS>& d, const basic_render_props<_GS>& rp, const basic_clip_props<_GS>& cl);
+    static void fill_circle(output_surface_data_type& data, const basic_brush<_GS>& b, const basic_circle<GraphicsMath>& c, const basic_brush_props<_GS>& bp, const basic_render_props<_GS>& rp, const basic_clip_props<_GS>& cl);
+    static void fill_instances(output_surface_data_type& data, const basic_brush<_GS>& b, const basic_interpreted_path<_GS>& ip, const _Fill_instance_range<GraphicsMath>& instances, const basic_brush_props<_GS>& bp, const basic_render_props<_GS>& rp, const basic_clip_props<_GS>& cl);
+    static void fill_stroke(output_surface_data_type& data, const basic_brush<_GS>& fb, const basic_brush<_GS>& sb, const basic_interpreted_path<_GS>& ip, const basic_brush_props<_GS>& bp, const basic_stroke_props<_GS>& sp, const basic_dashes<_GS>& d, const basic_render_props<_GS>& rp, const basic_clip_props<_GS>& cl);
     static void mask(output_surface_data_type& data, const basic_brush<_GS>& b, const basic_brush<_GS>& mb, const basic_brush_props<_GS>& bp, const basic_mask_props<_GS>& mp, const basic_render_props<_GS>& rp, const basic_clip_props<_GS>& cl);
+    static void coverage_cache_limit(output_surface_data_type& data, size_t bytes) noexcept;
+    static size_t coverage_cache_limit(const output_surface_data_type& data) noexcept;
+    static coverage_cache_stats coverage_cache_statistics(const output_surface_data_type& data) noexcept;
     static void draw_callback(output_surface_data_type& data, function<void(basic_output_surface<_GS>&)>);
     static void size_change_callback(output_surface_data_type& data, function<void(basic_output_surface<_GS>&)>);
 //  static void user_scaling_callback(output_surface_data_type& data, function<basic_bounding_box<GraphicsMath>(const basic_output_surface<_Graphics_surfaces_type>&, bool&)>);
@@ -457,7 +493,7 @@ struct surfaces {
 //  static io2d::format format(const output_surface_data_type& data) noexcept;
     static basic_display_point<GraphicsMath> dimensions(const output_surface_data_type& data) noexcept;
     static basic_display_point<GraphicsMath> display_dimensions(const output_surface_data_type& data) noexcept;
-    static io2d::scaling scaling(output_surface_data_type& data) noexcept;
+    static io2d::scaling scaling(const output_surface_data_type& data) noexcept;
 //  static optional<basic_brush<_Graphics_surfaces_type>> letterbox_brush(const output_surface_data_type& data) noexcept;
 //  static basic_brush_props<_Graphics_surfaces_type> letterbox_brush_props(const output_surface_data_type& data) noexcept;
     static bool auto_clear(const output_surface_data_type& data) noexcept;
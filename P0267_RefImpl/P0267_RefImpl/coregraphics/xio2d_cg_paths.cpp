@@ -208,6 +208,103 @@ void _PathInterperationContext::Insert( const basic_figure_items<_GS>::figure_it
     visit([&](auto&& arg) { Add(*this, arg); }, figure);
 }
 
+// CoreGraphics has no flattening API, so curves are split into uniform line segments, with the number of segments given by Wang's formula for
+// the requested tolerance at the given scale.
+struct _PathFlatteningContext {
+    CGMutablePathRef path;
+    CGPoint position;
+    float tolerance; // user coordinate space
+};
+
+static int FlatteningSegmentCount(CGPoint d0, CGPoint d1, float degreeFactor, float tolerance) noexcept {
+    const auto len = max(hypot(d0.x, d0.y), hypot(d1.x, d1.y));
+    return clamp(int(ceil(sqrt(degreeFactor * len / tolerance))), 1, 1 << 16);
+}
+
+static void FlattenElement(void *info, const CGPathElement *element) {
+    auto &ctx = *static_cast<_PathFlatteningContext*>(info);
+    const auto p0 = ctx.position;
+    switch( element->type ) {
+        case kCGPathElementMoveToPoint:
+            CGPathMoveToPoint(ctx.path, nullptr, element->points[0].x, element->points[0].y);
+            ctx.position = element->points[0];
+            break;
+        case kCGPathElementAddLineToPoint:
+            CGPathAddLineToPoint(ctx.path, nullptr, element->points[0].x, element->points[0].y);
+            ctx.position = element->points[0];
+            break;
+        case kCGPathElementAddQuadCurveToPoint: {
+            const auto p1 = element->points[0], p2 = element->points[1];
+            const CGPoint d = {p0.x - 2 * p1.x + p2.x, p0.y - 2 * p1.y + p2.y};
+            const auto n = FlatteningSegmentCount(d, d, 0.25f, ctx.tolerance);
+            for( int i = 1; i < n; ++i ) {
+                const CGFloat t = CGFloat(i) / n, mt = 1 - t;
+                CGPathAddLineToPoint(ctx.path, nullptr,
+                                     mt * mt * p0.x + 2 * mt * t * p1.x + t * t * p2.x,
+                                     mt * mt * p0.y + 2 * mt * t * p1.y + t * t * p2.y);
+            }
+            CGPathAddLineToPoint(ctx.path, nullptr, p2.x, p2.y);
+            ctx.position = p2;
+            break;
+        }
+        case kCGPathElementAddCurveToPoint: {
+            const auto p1 = element->points[0], p2 = element->points[1], p3 = element->points[2];
+            const CGPoint d0 = {p0.x - 2 * p1.x + p2.x, p0.y - 2 * p1.y + p2.y};
+            const CGPoint d1 = {p1.x - 2 * p2.x + p3.x, p1.y - 2 * p2.y + p3.y};
+            const auto n = FlatteningSegmentCount(d0, d1, 0.75f, ctx.tolerance);
+            for( int i = 1; i < n; ++i ) {
+                const CGFloat t = CGFloat(i) / n, mt = 1 - t;
+                const CGFloat a = mt * mt * mt, b = 3 * mt * mt * t, c = 3 * mt * t * t, e = t * t * t;
+                CGPathAddLineToPoint(ctx.path, nullptr,
+                                     a * p0.x + b * p1.x + c * p2.x + e * p3.x,
+                                     a * p0.y + b * p1.y + c * p2.y + e * p3.y);
+            }
+            CGPathAddLineToPoint(ctx.path, nullptr, p3.x, p3.y);
+            ctx.position = p3;
+            break;
+        }
+        case kCGPathElementCloseSubpath:
+            CGPathCloseSubpath(ctx.path);
+            ctx.position = CGPathGetCurrentPoint(ctx.path);
+            break;
+    }
+}
+
+_GS::paths::interpreted_path_data_type
+_GS::paths::flatten(const interpreted_path_data_type& data, float tolerance, float scale) {
+    if( is_empty(data) )
+        return data;
+    auto cache = data.flattened.get();
+    interpreted_path_data_type result;
+    result.path = cache->get(tolerance, scale, [&data, tolerance, scale]{
+        _PathFlatteningContext context{CGPathCreateMutable(), CGPointZero, scale > 0.0f ? tolerance / scale : tolerance};
+        CGPathApply(data.path.get(), &context, FlattenElement);
+        return shared_ptr<interpreted_path_data_type::path_t>(context.path, CGPathRelease);
+    });
+    return result;
+}
+
+// CoreGraphics strokes paths to outlines itself. Its outlines keep curves (including round joins and caps) as curves, so tolerance and scale are not needed.
+_GS::paths::interpreted_path_data_type
+_GS::paths::stroke_outline(const interpreted_path_data_type& data, const basic_stroke_props<_GS>& sp, const basic_dashes<_GS>& d, float /*tolerance*/, float /*scale*/) {
+    if( is_empty(data) )
+        return {};
+    const auto &pattern = d.data().pattern;
+    if( any_of(begin(pattern), end(pattern), [](double len){ return len < 0.0; }) ||
+        (!pattern.empty() && all_of(begin(pattern), end(pattern), [](double len){ return len == 0.0; })) )
+        throw system_error(make_error_code(errc::invalid_argument));
+    auto source = data.path;
+    if( !pattern.empty() ) {
+        vector<CGFloat> lengths(begin(pattern), end(pattern));
+        if( lengths.size() % 2 == 1 )
+            lengths.insert(end(lengths), begin(pattern), end(pattern));
+        source = shared_ptr<interpreted_path_data_type::path_t>(CGPathCreateCopyByDashingPath(data.path.get(), nullptr, d.data().offset, lengths.data(), lengths.size()), CGPathRelease);
+    }
+    interpreted_path_data_type result;
+    result.path = shared_ptr<interpreted_path_data_type::path_t>(CGPathCreateCopyByStrokingPath(source.get(), nullptr, sp.line_width(), _ToCG(sp.line_cap()), _ToCG(sp.line_join()), min(sp.miter_limit(), sp.max_miter_limit())), CGPathRelease);
+    return result;
+}
+
 } // namespace _CoreGraphics
 } // inline namespace v1
 } // std::experimental::io2d
@@ -30,7 +30,36 @@ _GS::paths::create_interpreted_path(ForwardIterator first, ForwardIterator last)
     data.path = shared_ptr<typename interpreted_path_data_type::path_t>(context.path, CGPathRelease);
     return data;
 }
-    
+
+// The segments of a basic_static_path have already been resolved, so no interpretation context is needed.
+template <size_t Capacity>
+inline _GS::paths::interpreted_path_data_type
+_GS::paths::create_interpreted_path(const basic_static_path<graphics_math_type, Capacity>& sp) {
+    using segment_type = typename basic_static_path<graphics_math_type, Capacity>::segment_type;
+    if( sp.empty() )
+        return {};
+    auto path = CGPathCreateMutable();
+    for( const auto &seg: sp ) {
+        switch( seg.type ) {
+            case segment_type::new_figure:
+                CGPathMoveToPoint(path, nullptr, seg.pts[0].x(), seg.pts[0].y());
+                break;
+            case segment_type::line:
+                CGPathAddLineToPoint(path, nullptr, seg.pts[0].x(), seg.pts[0].y());
+                break;
+            case segment_type::cubic_curve:
+                CGPathAddCurveToPoint(path, nullptr, seg.pts[0].x(), seg.pts[0].y(), seg.pts[1].x(), seg.pts[1].y(), seg.pts[2].x(), seg.pts[2].y());
+                break;
+            case segment_type::close_figure:
+                CGPathCloseSubpath(path);
+                break;
+        }
+    }
+    interpreted_path_data_type data;
+    data.path = shared_ptr<typename interpreted_path_data_type::path_t>(path, CGPathRelease);
+    return data;
+}
+
 inline _GS::paths::interpreted_path_data_type
 _GS::paths::create_interpreted_path(const bounding_box& bb) {
     using bf = basic_figure_items<graphics_surfaces_type>;
@@ -71,6 +100,13 @@ inline bool
 _GS::paths::is_empty(const interpreted_path_data_type& data) noexcept {
     return data.path == nullptr || CGPathIsEmpty(data.path.get());
 }
+
+inline basic_bounding_box<GraphicsMath>
+_GS::paths::bounds(const interpreted_path_data_type& data) noexcept {
+    if( is_empty(data) )
+        return {};
+    return _FromCG(CGPathGetPathBoundingBox(data.path.get()));
+}
     
 } // namespace _CoreGraphics
 } // inline namespace v1
@@ -18,25 +18,50 @@ static void SetDashProps( CGContextRef ctx, const basic_dashes<_GS>& d ) noexcep
 static void SetRenderProps( CGContextRef ctx, const basic_render_props<_GS>& rp ) noexcept;
 static void SetClipProps( CGContextRef ctx, const basic_clip_props<_GS>& cp ) noexcept; 
 static void PerformPaint(CGContextRef ctx, const basic_brush<_GS>& b, const basic_brush_props<_GS>& bp);
+static void PerformFill(CGContextRef ctx, const basic_brush<_GS>& b, const basic_interpreted_path<_GS>& ip, const basic_brush_props<_GS>& bp);
+static void PerformClippedPaint(CGContextRef ctx, const basic_brush<_GS>& b, const basic_brush_props<_GS>& bp);
 static bool IsEmpty(CGRect rc);
     
 CGContextRef _CreateBitmap(io2d::format fmt, int width, int height) noexcept
+{
+    return _CreateBitmap(fmt, width, height, nullptr, 0, nullptr);
+}
+
+static CGContextRef CreateBitmapWithData(io2d::format fmt, int width, int height, void *data, size_t stride, void *release_info, CGBitmapContextReleaseDataCallback release) noexcept
 {
     switch (fmt) {
         case format::argb32:
 #if TARGET_OS_IOS
-            return CGBitmapContextCreate(nullptr, width, height, 8, 0, _RGBColorSpace(), kCGImageByteOrder32Little | kCGImageAlphaPremultipliedFirst | kCGImageAlphaFirst);
+            return CGBitmapContextCreateWithData(data, width, height, 8, stride, _RGBColorSpace(), kCGImageByteOrder32Little | kCGImageAlphaPremultipliedFirst | kCGImageAlphaFirst, release, release_info);
 #else
-            return CGBitmapContextCreate(nullptr, width, height, 8, 0, _RGBColorSpace(), kCGImageByteOrder32Little | kCGImageAlphaPremultipliedFirst);            
+            return CGBitmapContextCreateWithData(data, width, height, 8, stride, _RGBColorSpace(), kCGImageByteOrder32Little | kCGImageAlphaPremultipliedFirst, release, release_info);
 #endif            
         case format::xrgb32:
-            return CGBitmapContextCreate(nullptr, width, height, 8, 0, _RGBColorSpace(), kCGImageByteOrder32Little | kCGImageAlphaNoneSkipFirst);
+            return CGBitmapContextCreateWithData(data, width, height, 8, stride, _RGBColorSpace(), kCGImageByteOrder32Little | kCGImageAlphaNoneSkipFirst, release, release_info);
         case format::a8:
-            return CGBitmapContextCreate(nullptr, width, height, 8, 0, _GrayColorSpace(), kCGImageAlphaOnly);            
+            return CGBitmapContextCreateWithData(data, width, height, 8, stride, _GrayColorSpace(), kCGImageAlphaOnly, release, release_info);
         default:
             return nullptr;
     }
 }
+
+// With data set the context draws into that memory instead of allocating its own; a stride of 0 lets CoreGraphics choose one. owner, if set, is
+// released once CoreGraphics no longer needs the memory.
+CGContextRef _CreateBitmap(io2d::format fmt, int width, int height, void *data, size_t stride, const ::std::shared_ptr<void> &owner) noexcept
+{
+    if( owner == nullptr )
+        return CreateBitmapWithData(fmt, width, height, data, stride, nullptr, nullptr);
+    
+    auto held_owner = new (::std::nothrow) ::std::shared_ptr<void>(owner);
+    if( held_owner == nullptr )
+        return nullptr;
+    auto context = CreateBitmapWithData(fmt, width, height, data, stride, held_owner, [](void *release_info, void *) {
+        delete static_cast<::std::shared_ptr<void>*>(release_info);
+    });
+    if( context == nullptr )
+        delete held_owner;
+    return context;
+}
     
 CGContextRef _LoadBitmap(const string &p, image_file_format iff, io2d::format fmt, ::std::error_code& ec)
 {
@@ -46,7 +71,12 @@ CGContextRef _LoadBitmap(const string &p, image_file_format iff, io2d::format fm
     if( contents.empty() )
         return nullptr;
     
-    auto data = CFDataCreateWithBytesNoCopy(nullptr, contents.data(), contents.size(), kCFAllocatorNull);
+    return _DecodeBitmap(contents.data(), contents.size(), iff, fmt, ec);
+}
+
+CGContextRef _DecodeBitmap(const void *bytes, size_t size, image_file_format iff, io2d::format fmt, ::std::error_code& /*ec*/)
+{
+    auto data = CFDataCreateWithBytesNoCopy(nullptr, static_cast<const UInt8*>(bytes), static_cast<CFIndex>(size), kCFAllocatorNull);
     _AutoRelease data_release{data};
     if( !data )
         return nullptr;
@@ -188,33 +218,153 @@ void _Fill(CGContextRef ctx,
     _GStateGuard state_guard{ctx};
     SetRenderProps(ctx, rp);
     SetClipProps(ctx, cl);
+    PerformFill(ctx, b, ip, bp);
+}
+    
+// Solid color brushes use CoreGraphics' own rectangle and ellipse calls, which skip building a path. Other brushes
+// clip to the shape and paint.
+void _FillRect(CGContextRef ctx,
+               const basic_brush<_GS>& b,
+               const basic_bounding_box<GraphicsMath>& bb,
+               const basic_brush_props<_GS>& bp,
+               const basic_render_props<_GS>& rp,
+               const basic_clip_props<_GS>& cl)
+{
+    const auto rect = CGRectMake(bb.x(), bb.y(), bb.width(), bb.height());
+    if( CGRectIsEmpty(rect) )
+        return;
+    _GStateGuard state_guard{ctx};
+    SetRenderProps(ctx, rp);
+    SetClipProps(ctx, cl);
     
     if( b.type() == brush_type::solid_color ) {
         const auto &solid_color_brush = std::get<_GS::brushes::_SolidColor>(*b.data().brush);
         CGContextSetFillColorWithColor(ctx, solid_color_brush.color.get());
-        CGContextAddPath(ctx, ip.data().path.get());
-        CGContextFillPath(ctx);
+        CGContextFillRect(ctx, rect);
     }
-    else if( b.type() == brush_type::linear ) {
-        const auto &linear_brush = std::get<_GS::brushes::_Linear>(*b.data().brush);
-        CGContextAddPath(ctx, ip.data().path.get());
-        CGContextClip(ctx);
-        _DrawLinearGradient(ctx, linear_brush, bp.wrap_mode(), bp.brush_matrix());
+    else {
+        CGContextAddRect(ctx, rect);
+        PerformClippedPaint(ctx, b, bp);
     }
-    else if( b.type() == brush_type::radial ) {
-        const auto &radial_brush = std::get<_GS::brushes::_Radial>(*b.data().brush);
-        CGContextAddPath(ctx, ip.data().path.get());
-        CGContextClip(ctx);
-        _DrawRadialGradient(ctx, radial_brush, bp.wrap_mode(), bp.brush_matrix());
+}
+
+void _StrokeRect(CGContextRef ctx,
+                 const basic_brush<_GS>& b,
+                 const basic_bounding_box<GraphicsMath>& bb,
+                 const basic_brush_props<_GS>& bp,
+                 const basic_stroke_props<_GS>& sp,
+                 const basic_dashes<_GS>& d,
+                 const basic_render_props<_GS>& rp,
+                 const basic_clip_props<_GS>& cl)
+{
+    const auto rect = CGRectMake(bb.x(), bb.y(), bb.width(), bb.height());
+    _GStateGuard state_guard{ctx};
+    SetRenderProps(ctx, rp);
+    SetStrokeProps(ctx, sp);
+    SetDashProps(ctx, d);
+    SetClipProps(ctx, cl);
+    
+    if( b.type() == brush_type::solid_color ) {
+        const auto &solid_color_brush = std::get<_GS::brushes::_SolidColor>(*b.data().brush);
+        CGContextSetStrokeColorWithColor(ctx, solid_color_brush.color.get());
+        CGContextStrokeRect(ctx, rect);
     }
-    else if( b.type() == brush_type::surface ) {
-        const auto &surface_brush = std::get<_GS::brushes::_Surface>(*b.data().brush);
-        CGContextAddPath(ctx, ip.data().path.get());
-        CGContextClip(ctx);
-        _DrawTexture(ctx, surface_brush, bp.filter(), bp.wrap_mode(), bp.brush_matrix());
+    else {
+        CGContextAddRect(ctx, rect);
+        CGContextReplacePathWithStrokedPath(ctx);
+        PerformClippedPaint(ctx, b, bp);
+    }
+}
+
+void _FillCircle(CGContextRef ctx,
+                 const basic_brush<_GS>& b,
+                 const basic_circle<GraphicsMath>& c,
+                 const basic_brush_props<_GS>& bp,
+                 const basic_render_props<_GS>& rp,
+                 const basic_clip_props<_GS>& cl)
+{
+    if( c.radius() <= 0.f )
+        return;
+    const auto center = c.center();
+    const auto rect = CGRectMake(center.x() - c.radius(), center.y() - c.radius(), 2. * c.radius(), 2. * c.radius());
+    _GStateGuard state_guard{ctx};
+    SetRenderProps(ctx, rp);
+    SetClipProps(ctx, cl);
+    
+    if( b.type() == brush_type::solid_color ) {
+        const auto &solid_color_brush = std::get<_GS::brushes::_SolidColor>(*b.data().brush);
+        CGContextSetFillColorWithColor(ctx, solid_color_brush.color.get());
+        CGContextFillEllipseInRect(ctx, rect);
+    }
+    else {
+        CGContextAddEllipseInRect(ctx, rect);
+        PerformClippedPaint(ctx, b, bp);
+    }
+}
+    
+// The render and clip state is set once; each instance only concatenates its matrix and sets its alpha inside its own
+// graphics state, so the path is reused as is for every instance.
+void _FillInstances(CGContextRef ctx,
+                    const basic_brush<_GS>& b,
+                    const basic_interpreted_path<_GS>& ip,
+                    const _Fill_instance_range<GraphicsMath>& instances,
+                    const basic_brush_props<_GS>& bp,
+                    const basic_render_props<_GS>& rp,
+                    const basic_clip_props<_GS>& cl)
+{
+    if( instances.empty() || _GS::paths::is_empty(ip.data()) )
+        return;
+    _GStateGuard state_guard{ctx};
+    SetRenderProps(ctx, rp);
+    SetClipProps(ctx, cl);
+    
+    for( const auto &instance: instances ) {
+        _GStateGuard instance_guard{ctx};
+        CGContextConcatCTM(ctx, _ToCG(instance.matrix()));
+        CGContextSetAlpha(ctx, instance.alpha());
+        if( instance.color().has_value() ) {
+            const auto &c = instance.color().value();
+            CGContextSetRGBFillColor(ctx, c.r(), c.g(), c.b(), c.a());
+            CGContextAddPath(ctx, ip.data().path.get());
+            CGContextFillPath(ctx);
+        }
+        else {
+            PerformFill(ctx, b, ip, bp);
+        }
     }
 }
     
+// Two solid color brushes can be drawn with a single kCGPathFillStroke. Other brushes are drawn by clipping to the path,
+// so they go through _Fill and _Stroke separately.
+void _FillStroke(CGContextRef ctx,
+                 const basic_brush<_GS>& fb,
+                 const basic_brush<_GS>& sb,
+                 const basic_interpreted_path<_GS>& ip,
+                 const basic_brush_props<_GS>& bp,
+                 const basic_stroke_props<_GS>& sp,
+                 const basic_dashes<_GS>& d,
+                 const basic_render_props<_GS>& rp,
+                 const basic_clip_props<_GS>& cl)
+{
+    if( fb.type() != brush_type::solid_color || sb.type() != brush_type::solid_color ) {
+        _Fill(ctx, fb, ip, bp, rp, cl);
+        _Stroke(ctx, sb, ip, bp, sp, d, rp, cl);
+        return;
+    }
+    if( _GS::paths::is_empty(ip.data()) )
+        return;
+    _GStateGuard state_guard{ctx};
+    SetRenderProps(ctx, rp);
+    SetStrokeProps(ctx, sp);
+    SetDashProps(ctx, d);
+    SetClipProps(ctx, cl);
+
+    CGContextSetFillColorWithColor(ctx, std::get<_GS::brushes::_SolidColor>(*fb.data().brush).color.get());
+    CGContextSetStrokeColorWithColor(ctx, std::get<_GS::brushes::_SolidColor>(*sb.data().brush).color.get());
+    CGContextAddPath(ctx, ip.data().path.get());
+    CGContextDrawPath(ctx, kCGPathFillStroke);
+}
+    
 void _Mask(CGContextRef ctx,
            const basic_brush<_GS>& b,
            const basic_brush<_GS>& mb,
@@ -356,6 +506,34 @@ CGColorRef _CreateColorFromBitmapLocation(CGContextRef ctx, int x, int y)
     return CGColorCreate(CGBitmapContextGetColorSpace(ctx), components);
 }
     
+static void PerformFill(CGContextRef ctx, const basic_brush<_GS>& b, const basic_interpreted_path<_GS>& ip, const basic_brush_props<_GS>& bp)
+{
+    if( b.type() == brush_type::solid_color ) {
+        const auto &solid_color_brush = std::get<_GS::brushes::_SolidColor>(*b.data().brush);
+        CGContextSetFillColorWithColor(ctx, solid_color_brush.color.get());
+        CGContextAddPath(ctx, ip.data().path.get());
+        CGContextFillPath(ctx);
+    }
+    else if( b.type() == brush_type::linear ) {
+        const auto &linear_brush = std::get<_GS::brushes::_Linear>(*b.data().brush);
+        CGContextAddPath(ctx, ip.data().path.get());
+        CGContextClip(ctx);
+        _DrawLinearGradient(ctx, linear_brush, bp.wrap_mode(), bp.brush_matrix());
+    }
+    else if( b.type() == brush_type::radial ) {
+        const auto &radial_brush = std::get<_GS::brushes::_Radial>(*b.data().brush);
+        CGContextAddPath(ctx, ip.data().path.get());
+        CGContextClip(ctx);
+        _DrawRadialGradient(ctx, radial_brush, bp.wrap_mode(), bp.brush_matrix());
+    }
+    else if( b.type() == brush_type::surface ) {
+        const auto &surface_brush = std::get<_GS::brushes::_Surface>(*b.data().brush);
+        CGContextAddPath(ctx, ip.data().path.get());
+        CGContextClip(ctx);
+        _DrawTexture(ctx, surface_brush, bp.filter(), bp.wrap_mode(), bp.brush_matrix());
+    }
+}
+
 static void PerformPaint(CGContextRef ctx, const basic_brush<_GS>& b, const basic_brush_props<_GS>& bp)
 {
     if( b.type() == brush_type::solid_color ) {
@@ -377,6 +555,13 @@ static void PerformPaint(CGContextRef ctx, const basic_brush<_GS>& b, const basi
     }        
 }
 
+// Clips to the current path, then paints a non solid color brush through it.
+static void PerformClippedPaint(CGContextRef ctx, const basic_brush<_GS>& b, const basic_brush_props<_GS>& bp)
+{
+    CGContextClip(ctx);
+    PerformPaint(ctx, b, bp);
+}
+
 static bool IsEmpty(CGRect rc)
 {
     return rc.size.width < 0.5 || rc.size.height < 0.5;        
@@ -7,7 +7,9 @@
 namespace std::experimental::io2d { inline namespace v1 { namespace _CoreGraphics {
 
 CGContextRef _CreateBitmap(io2d::format fmt, int width, int height) noexcept;
+CGContextRef _CreateBitmap(io2d::format fmt, int width, int height, void *data, size_t stride, const ::std::shared_ptr<void> &owner) noexcept;
 CGContextRef _LoadBitmap(const string &p, image_file_format iff, io2d::format fmt, ::std::error_code& ec);
+CGContextRef _DecodeBitmap(const void *bytes, size_t size, image_file_format iff, io2d::format fmt, ::std::error_code& ec);
 CGColorRef _CreateColorFromBitmapLocation(CGContextRef ctx, int x, int y);
     
 void _WriteBitmap(CGContextRef ctx, const string &p, image_file_format iff, ::std::error_code &ec);
@@ -15,12 +17,24 @@ void _Clear(CGContextRef ctx, CGColorRef with_color, CGRect in_rect );
 void _Stroke(CGContextRef ctx, const basic_brush<_GS>& b, const basic_interpreted_path<_GS>& ip, const basic_brush_props<_GS>& bp, const basic_stroke_props<_GS>& sp, const basic_dashes<_GS>& d, const basic_render_props<_GS>& rp, const basic_clip_props<_GS>& cl);
 void _Paint(CGContextRef ctx, const basic_brush<_GS>& b, const basic_brush_props<_GS>& bp, const basic_render_props<_GS>& rp, const basic_clip_props<_GS>& cl);
 void _Fill(CGContextRef ctx, const basic_brush<_GS>& b, const basic_interpreted_path<_GS>& ip, const basic_brush_props<_GS>& bp, const basic_render_props<_GS>& rp, const basic_clip_props<_GS>& cl);
+void _FillRect(CGContextRef ctx, const basic_brush<_GS>& b, const basic_bounding_box<GraphicsMath>& bb, const basic_brush_props<_GS>& bp, const basic_render_props<_GS>& rp, const basic_clip_props<_GS>& cl);
+void _StrokeRect(CGContextRef ctx, const basic_brush<_GS>& b, const basic_bounding_box<GraphicsMath>& bb, const basic_brush_props<_GS>& bp, const basic_stroke_props<_GS>& sp, const basic_dashes<_GS>& d, const basic_render_props<_GS>& rp, const basic_clip_props<_GS>& cl);
+void _FillCircle(CGContextRef ctx, const basic_brush<_GS>& b, const basic_circle<GraphicsMath>& c, const basic_brush_props<_GS>& bp, const basic_render_props<_GS>& rp, const basic_clip_props<_GS>& cl);
+void _FillInstances(CGContextRef ctx, const basic_brush<_GS>& b, const basic_interpreted_path<_GS>& ip, const _Fill_instance_range<GraphicsMath>& instances, const basic_brush_props<_GS>& bp, const basic_render_props<_GS>& rp, const basic_clip_props<_GS>& cl);
+void _FillStroke(CGContextRef ctx, const basic_brush<_GS>& fb, const basic_brush<_GS>& sb, const basic_interpreted_path<_GS>& ip, const basic_brush_props<_GS>& bp, const basic_stroke_props<_GS>& sp, const basic_dashes<_GS>& d, const basic_render_props<_GS>& rp, const basic_clip_props<_GS>& cl);
 void _Mask(CGContextRef ctx, const basic_brush<_GS>& b, const basic_brush<_GS>& mb, const basic_brush_props<_GS>& bp, const basic_mask_props<_GS>& mp, const basic_render_props<_GS>& rp, const basic_clip_props<_GS>& cl);    
 _Interchange_buffer _CopyToInterchangeBuffer(CGContextRef ctx, _Interchange_buffer::pixel_layout layout, _Interchange_buffer::alpha_mode alpha);    
     
 inline basic_display_point<GraphicsMath> _GS::surfaces::max_dimensions() noexcept {
     return basic_display_point<GraphicsMath>(16384, 16384);
 }
+
+inline int _GS::surfaces::stride_for_width(io2d::format fmt, int width) noexcept {
+    if( fmt == io2d::format::invalid || width <= 0 )
+        return -1;
+    const int bytes_per_pixel = fmt == io2d::format::a8 ? 1 : 4;
+    return (width * bytes_per_pixel + 3) & ~3;
+}
             
 inline _GS::surfaces::image_surface_data_type _GS::surfaces::create_image_surface(io2d::format fmt, int width, int height) {
     auto context = _CreateBitmap(fmt, width, height);
@@ -37,6 +51,25 @@ inline _GS::surfaces::image_surface_data_type _GS::surfaces::create_image_surfac
     data.format = fmt;
     return data;
 }
+
+inline _GS::surfaces::image_surface_data_type _GS::surfaces::create_image_surface(io2d::format fmt, int width, int height, ::std::byte* data, int stride, ::std::shared_ptr<void> owner) {
+    if( data == nullptr || width <= 0 || height <= 0 || stride < stride_for_width(fmt, width) )
+        throw ::std::system_error(::std::make_error_code(::std::errc::invalid_argument));
+    auto context = _CreateBitmap(fmt, width, height, data, size_t(stride), owner);
+    if( context == nullptr )
+        throw ::std::runtime_error("Failed to create an image surface");
+
+    CGContextConcatCTM(context, CGAffineTransform{ 1., 0., 0., -1., 0., double(height) } );
+    CGContextSetAllowsAntialiasing(context, true);
+    
+    image_surface_data_type result;
+    result.context.reset(context);
+    result.dimensions.x(width);
+    result.dimensions.y(height);
+    result.format = fmt;
+    result.external_memory = true;
+    return result;
+}
     
 inline _GS::surfaces::image_surface_data_type
 #ifdef _IO2D_Has_Filesystem
@@ -77,15 +110,71 @@ _GS::surfaces::create_image_surface(const string &p, image_file_format iff, io2d
     return data;
 }
 
+inline _GS::surfaces::image_surface_data_type _GS::surfaces::create_image_surface(const ::std::byte* bytes, size_t size, image_file_format iff, io2d::format fmt) {
+    ::std::error_code ec;
+    auto data = create_image_surface(bytes, size, iff, fmt, ec);
+    if( ec )
+        throw ::std::system_error(ec);
+    return data;
+}
+
+inline _GS::surfaces::image_surface_data_type _GS::surfaces::create_image_surface(const ::std::byte* bytes, size_t size, image_file_format iff, io2d::format fmt, ::std::error_code& ec) noexcept {
+    if( bytes == nullptr || size == 0 ) {
+        ec = make_error_code(errc::invalid_argument);
+        return {};
+    }
+    auto context = _DecodeBitmap(bytes, size, iff, fmt, ec);
+    if( !context ) {
+        ec = make_error_code(errc::invalid_argument);
+        return {};
+    }
+
+    auto width = (int)CGBitmapContextGetWidth(context);
+    auto height = (int)CGBitmapContextGetHeight(context);
+    
+    CGContextConcatCTM(context, CGAffineTransform{ 1., 0., 0., -1., 0., double(height) } );
+    CGContextSetAllowsAntialiasing(context, true);
+    
+    image_surface_data_type data;
+    data.context.reset(context);
+    data.dimensions.x(width);
+    data.dimensions.y(height);
+    data.format = fmt;
+    ec.clear();
+    return data;
+}
+
 inline _GS::surfaces::image_surface_data_type
 _GS::surfaces::move_image_surface(image_surface_data_type&& data) noexcept {
     return move(data);
 }
     
+// Both datas draw through the same bitmap context, which saves and restores its state around every call.
+inline _GS::surfaces::image_surface_data_type
+_GS::surfaces::share_image_surface(const image_surface_data_type& data) {
+    image_surface_data_type result;
+    result.context.reset(CGContextRetain(data.context.get()));
+    result.dimensions = data.dimensions;
+    result.format = data.format;
+    return result;
+}
+
+inline bool
+_GS::surfaces::uses_external_memory(const image_surface_data_type& data) noexcept {
+    return data.external_memory;
+}
+
 inline void
 _GS::surfaces::destroy(image_surface_data_type& /*data*/) noexcept {
     // Do nothing.
 }
+
+// Surface brushes copy the bitmap's pixels on write, so only a context taken by a consuming brush, or shared by copy_surface, stops the data
+// being reused.
+inline bool
+_GS::surfaces::is_recyclable(const image_surface_data_type& data) noexcept {
+    return data.context != nullptr && CFGetRetainCount(data.context.get()) == 1;
+}
             
 inline basic_display_point<GraphicsMath>
 _GS::surfaces::dimensions(const image_surface_data_type& data) noexcept {
@@ -145,6 +234,31 @@ inline void
 _GS::surfaces::fill(image_surface_data_type& data, const basic_brush<_GS>& b, const basic_interpreted_path<_GS>& ip, const basic_brush_props<_GS>& bp, const basic_render_props<_GS>& rp, const basic_clip_props<_GS>& cl) {
     _Fill(data.context.get(), b, ip, bp, rp, cl);
 }
+
+inline void
+_GS::surfaces::fill_rect(image_surface_data_type& data, const basic_brush<_GS>& b, const basic_bounding_box<GraphicsMath>& bb, const basic_brush_props<_GS>& bp, const basic_render_props<_GS>& rp, const basic_clip_props<_GS>& cl) {
+    _FillRect(data.context.get(), b, bb, bp, rp, cl);
+}
+
+inline void
+_GS::surfaces::stroke_rect(image_surface_data_type& data, const basic_brush<_GS>& b, const basic_bounding_box<GraphicsMath>& bb, const basic_brush_props<_GS>& bp, const basic_stroke_props<_GS>& sp, const basic_dashes<_GS>& d, const basic_render_props<_GS>& rp, const basic_clip_props<_GS>& cl) {
+    _StrokeRect(data.context.get(), b, bb, bp, sp, d, rp, cl);
+}
+
+inline void
+_GS::surfaces::fill_circle(image_surface_data_type& data, const basic_brush<_GS>& b, const basic_circle<GraphicsMath>& c, const basic_brush_props<_GS>& bp, const basic_render_props<_GS>& rp, const basic_clip_props<_GS>& cl) {
+    _FillCircle(data.context.get(), b, c, bp, rp, cl);
+}
+
+inline void
+_GS::surfaces::fill_instances(image_surface_data_type& data, const basic_brush<_GS>& b, const basic_interpreted_path<_GS>& ip, const _Fill_instance_range<GraphicsMath>& instances, const basic_brush_props<_GS>& bp, const basic_render_props<_GS>& rp, const basic_clip_props<_GS>& cl) {
+    _FillInstances(data.context.get(), b, ip, instances, bp, rp, cl);
+}
+
+inline void
+_GS::surfaces::fill_stroke(image_surface_data_type& data, const basic_brush<_GS>& fb, const basic_brush<_GS>& sb, const basic_interpreted_path<_GS>& ip, const basic_brush_props<_GS>& bp, const basic_stroke_props<_GS>& sp, const basic_dashes<_GS>& d, const basic_render_props<_GS>& rp, const basic_clip_props<_GS>& cl) {
+    _FillStroke(data.context.get(), fb, sb, ip, bp, sp, d, rp, cl);
+}
     
 inline void
 _GS::surfaces::paint(image_surface_data_type& data, const basic_brush<_GS>& b, const basic_brush_props<_GS>& bp, const basic_render_props<_GS>& rp, const basic_clip_props<_GS>& cl) {
@@ -156,6 +270,53 @@ _GS::surfaces::mask(image_surface_data_type& data, const basic_brush<_GS>& b, co
     _Mask(data.context.get(), b, mb, bp, mp, rp, cl);
 }
 
+// Bitmap contexts keep their rows top to bottom in memory whatever the CTM, so the block is moved row by row, bottom to top when it moves down
+// within one bitmap.
+inline void
+_GS::surfaces::copy_region(const image_surface_data_type& src, int x, int y, int width, int height, image_surface_data_type& dst, int dstX, int dstY) {
+    const auto srcContext = src.context.get();
+    const auto dstContext = dst.context.get();
+    const size_t bytesPerPixel = CGBitmapContextGetBitsPerPixel(dstContext) / 8;
+    const auto rowBytes = static_cast<size_t>(width) * bytesPerPixel;
+    const auto srcStride = static_cast<ptrdiff_t>(CGBitmapContextGetBytesPerRow(srcContext));
+    const auto dstStride = static_cast<ptrdiff_t>(CGBitmapContextGetBytesPerRow(dstContext));
+    auto srcRow = static_cast<const uint8_t*>(CGBitmapContextGetData(srcContext)) + y * srcStride + static_cast<ptrdiff_t>(x * bytesPerPixel);
+    auto dstRow = static_cast<uint8_t*>(CGBitmapContextGetData(dstContext)) + dstY * dstStride + static_cast<ptrdiff_t>(dstX * bytesPerPixel);
+    if (dstContext == srcContext && dstY > y) {
+        for (int row = height - 1; row >= 0; --row)
+            memmove(dstRow + row * dstStride, srcRow + row * srcStride, rowBytes);
+    }
+    else {
+        for (int row = 0; row < height; ++row)
+            memmove(dstRow + row * dstStride, srcRow + row * srcStride, rowBytes);
+    }
+}
+
+inline ::std::byte*
+_GS::surfaces::pixels(image_surface_data_type& data) noexcept {
+    return static_cast<::std::byte*>(CGBitmapContextGetData(data.context.get()));
+}
+
+inline int
+_GS::surfaces::stride(const image_surface_data_type& data) noexcept {
+    return static_cast<int>(CGBitmapContextGetBytesPerRow(data.context.get()));
+}
+
+// CoreGraphics keeps no coverage masks between draws, so the cache is always empty and its limit is ignored.
+inline void
+_GS::surfaces::coverage_cache_limit(image_surface_data_type&, size_t) noexcept {
+}
+
+inline size_t
+_GS::surfaces::coverage_cache_limit(const image_surface_data_type&) noexcept {
+    return 0;
+}
+
+inline coverage_cache_stats
+_GS::surfaces::coverage_cache_statistics(const image_surface_data_type&) noexcept {
+    return coverage_cache_stats();
+}
+
 inline _Interchange_buffer
 _GS::surfaces::_Copy_to_interchange_buffer(image_surface_data_type& data, _Interchange_buffer::pixel_layout layout, _Interchange_buffer::alpha_mode alpha)
 {
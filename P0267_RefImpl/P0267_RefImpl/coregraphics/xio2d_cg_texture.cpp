@@ -128,6 +128,14 @@ static void DrawReflectedTexture(CGContextRef ctx, const _GS::brushes::_Surface
 static _GS::brushes::_Surface::_Pad BuildPad(CGImageRef image, CGContextRef orig_ctx)
 {
     _GS::brushes::_Surface::_Pad pad;
+    
+    // Brushes that share another surface's pixels have no bitmap of their own, so the corner colors are read from a copy of the image.
+    unique_ptr<_GS::brushes::_Surface::bitmap_t, decltype(&CGContextRelease)> image_ctx{ nullptr, &CGContextRelease };
+    if( orig_ctx == nullptr ) {
+        image_ctx.reset( _CreateBitmap(format::argb32, (int)CGImageGetWidth(image), (int)CGImageGetHeight(image)) );
+        CGContextDrawImage(image_ctx.get(), CGRectMake(0, 0, CGImageGetWidth(image), CGImageGetHeight(image)), image);
+        orig_ctx = image_ctx.get();
+    }
  
     auto image_info = CGBitmapContextGetBitmapInfo(orig_ctx);
     auto image_width = CGBitmapContextGetWidth(orig_ctx);
@@ -185,8 +193,13 @@ static void DrawPaddedTexture(CGContextRef ctx, const _GS::brushes::_Surface &su
     const auto distant_far = 2000.;
     const auto eps = 0.7;
 
-    if( surface.pad == nullptr )
-        surface.pad = make_unique<_GS::brushes::_Surface::_Pad>(BuildPad(surface.image.get(), surface.bitmap.get()));
+    // A brush can be drawn from several threads at once, so the lazily built pad is published atomically. Threads that race here
+    // each build an identical pad and one of them is kept.
+    auto pad = atomic_load(&surface.pad);
+    if( pad == nullptr ) {
+        pad = make_shared<const _GS::brushes::_Surface::_Pad>(BuildPad(surface.image.get(), surface.bitmap.get()));
+        atomic_store(&surface.pad, pad);
+    }
 
     CGContextSetInterpolationQuality(ctx, _ToCG(fi));
     CGContextConcatCTM(ctx, _ToCG(m.inverse()) );
@@ -194,23 +207,23 @@ static void DrawPaddedTexture(CGContextRef ctx, const _GS::brushes::_Surface &su
     CGContextSaveGState(ctx);
     CGContextConcatCTM(ctx, { 1., 0., 0., -1., 0., double(surface.height) } );
     CGContextDrawImage(ctx, CGRectMake(0, 0, surface.width, surface.height), surface.image.get());
-    CGContextDrawImage(ctx, CGRectMake(surface.width - eps, 0, distant_far, surface.height), surface.pad->right.get());
-    CGContextDrawImage(ctx, CGRectMake(-distant_far, 0, distant_far + eps, surface.height), surface.pad->left.get());
+    CGContextDrawImage(ctx, CGRectMake(surface.width - eps, 0, distant_far, surface.height), pad->right.get());
+    CGContextDrawImage(ctx, CGRectMake(-distant_far, 0, distant_far + eps, surface.height), pad->left.get());
     CGContextRestoreGState(ctx);
 
-    CGContextDrawImage(ctx, CGRectMake(0, -distant_far, surface.width, distant_far + eps), surface.pad->top.get());
-    CGContextDrawImage(ctx, CGRectMake(0, surface.height - eps, surface.width, distant_far), surface.pad->bottom.get());
+    CGContextDrawImage(ctx, CGRectMake(0, -distant_far, surface.width, distant_far + eps), pad->top.get());
+    CGContextDrawImage(ctx, CGRectMake(0, surface.height - eps, surface.width, distant_far), pad->bottom.get());
     
-    CGContextSetFillColorWithColor(ctx, surface.pad->top_right.get());
+    CGContextSetFillColorWithColor(ctx, pad->top_right.get());
     CGContextFillRect(ctx, CGRectMake(surface.width - eps, -distant_far, distant_far, distant_far + eps));
 
-    CGContextSetFillColorWithColor(ctx, surface.pad->top_left.get());
+    CGContextSetFillColorWithColor(ctx, pad->top_left.get());
     CGContextFillRect(ctx, CGRectMake(-distant_far, -distant_far, distant_far + eps, distant_far + eps));
 
-    CGContextSetFillColorWithColor(ctx, surface.pad->bottom_left.get());
+    CGContextSetFillColorWithColor(ctx, pad->bottom_left.get());
     CGContextFillRect(ctx, CGRectMake(-distant_far, surface.height - eps, distant_far + eps, distant_far));
 
-    CGContextSetFillColorWithColor(ctx, surface.pad->bottom_right.get());
+    CGContextSetFillColorWithColor(ctx, pad->bottom_right.get());
     CGContextFillRect(ctx, CGRectMake(surface.width - eps, surface.height - eps, distant_far, distant_far));
 }
 
@@ -0,0 +1,69 @@
+#pragma once
+#include "xio2d.h"
+#include "xbrushes.h"
+#include "xsurfaces.h"
+
+namespace std::experimental::io2d {
+	inline namespace v1 {
+		template <class GraphicsSurfaces>
+		class basic_atlas_builder;
+
+		// A handle to one image packed into a basic_image_atlas. brush() samples only the image's region of its atlas page, with the image's top left
+		// corner at the brush origin, so it can be drawn like a brush made from the image itself.
+		template <class GraphicsSurfaces>
+		class basic_atlas_sprite {
+		public:
+			using graphics_math_type = typename GraphicsSurfaces::graphics_math_type;
+		private:
+			basic_brush<GraphicsSurfaces> _Brush;
+			size_t _Page;
+			basic_bounding_box<graphics_math_type> _Bounds;
+		public:
+			basic_atlas_sprite(const basic_brush<GraphicsSurfaces>& b, size_t page, const basic_bounding_box<graphics_math_type>& bounds);
+
+			const basic_brush<GraphicsSurfaces>& brush() const noexcept;
+			size_t page() const noexcept;
+			basic_bounding_box<graphics_math_type> bounds() const noexcept;
+			basic_display_point<graphics_math_type> dimensions() const noexcept;
+		};
+
+		// The pages produced by basic_atlas_builder::build and a sprite for every image that was added, in the order the images were added.
+		template <class GraphicsSurfaces>
+		class basic_image_atlas {
+			friend basic_atlas_builder<GraphicsSurfaces>;
+
+			::std::vector<basic_brush<GraphicsSurfaces>> _Pages;
+			::std::vector<basic_atlas_sprite<GraphicsSurfaces>> _Sprites;
+
+			basic_image_atlas(::std::vector<basic_brush<GraphicsSurfaces>>&& pages, ::std::vector<basic_atlas_sprite<GraphicsSurfaces>>&& sprites) noexcept;
+		public:
+			size_t size() const noexcept;
+			const basic_atlas_sprite<GraphicsSurfaces>& sprite(size_t index) const;
+			size_t page_count() const noexcept;
+			const basic_brush<GraphicsSurfaces>& page(size_t index) const;
+		};
+
+		// Packs images into as few surfaces of at most page_dimensions() as it can, using skyline bottom left packing with the images sorted by height.
+		// padding() transparent pixels are left between neighbouring images so that filtering at the edge of one sprite never reads another.
+		template <class GraphicsSurfaces>
+		class basic_atlas_builder {
+		public:
+			using graphics_math_type = typename GraphicsSurfaces::graphics_math_type;
+		private:
+			basic_display_point<graphics_math_type> _Page_dimensions;
+			io2d::format _Format;
+			int _Padding;
+			::std::vector<basic_image_surface<GraphicsSurfaces>> _Images;
+		public:
+			explicit basic_atlas_builder(const basic_display_point<graphics_math_type>& pageDimensions = basic_display_point<graphics_math_type>(2048, 2048), io2d::format fmt = io2d::format::argb32, int padding = 1);
+
+			size_t add(basic_image_surface<GraphicsSurfaces>&& img);
+			size_t size() const noexcept;
+			basic_display_point<graphics_math_type> page_dimensions() const noexcept;
+			io2d::format format() const noexcept;
+			int padding() const noexcept;
+
+			basic_image_atlas<GraphicsSurfaces> build();
+		};
+	}
+}
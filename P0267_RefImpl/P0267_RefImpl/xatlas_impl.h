@@ -0,0 +1,254 @@
+#pragma once
+#include "xatlas.h"
+
+namespace std::experimental::io2d {
+	inline namespace v1 {
+		// Skyline bottom left rectangle packer. The skyline is the top edge of the packed area, kept as a list of horizontal segments ordered by x and covering
+		// the full width. A rectangle is placed on the segment where its bottom edge ends up lowest, preferring narrower segments to keep gaps small.
+		class _Skyline_packer {
+			struct _Segment {
+				int x;
+				int y;
+				int width;
+			};
+			int _Width;
+			int _Height;
+			int _Used_width = 0;
+			int _Used_height = 0;
+			::std::vector<_Segment> _Skyline;
+
+			// Returns the y at which a width by height rectangle with its left edge on segment index rests, or -1 if it does not fit there.
+			int _Fit(size_t index, int width, int height) const noexcept {
+				const int x = _Skyline[index].x;
+				if (x + width > _Width) {
+					return -1;
+				}
+				int y = 0;
+				int widthLeft = width;
+				for (size_t i = index; widthLeft > 0; ++i) {
+					y = ::std::max(y, _Skyline[i].y);
+					if (y + height > _Height) {
+						return -1;
+					}
+					widthLeft -= _Skyline[i].width;
+				}
+				return y;
+			}
+		public:
+			_Skyline_packer(int width, int height)
+				: _Width(width)
+				, _Height(height)
+				, _Skyline{ { 0, 0, width } } {
+			}
+
+			bool insert(int width, int height, int& x, int& y) {
+				size_t bestIndex = _Skyline.size();
+				int bestBottom = numeric_limits<int>::max();
+				int bestWidth = numeric_limits<int>::max();
+				for (size_t i = 0; i < _Skyline.size(); ++i) {
+					const int fitY = _Fit(i, width, height);
+					if (fitY < 0) {
+						continue;
+					}
+					if (fitY + height < bestBottom || (fitY + height == bestBottom && _Skyline[i].width < bestWidth)) {
+						bestIndex = i;
+						bestBottom = fitY + height;
+						bestWidth = _Skyline[i].width;
+					}
+				}
+				if (bestIndex == _Skyline.size()) {
+					return false;
+				}
+				x = _Skyline[bestIndex].x;
+				y = bestBottom - height;
+
+				// Raise the skyline under the new rectangle, then trim or remove the segments it now covers.
+				_Skyline.insert(_Skyline.begin() + static_cast<ptrdiff_t>(bestIndex), _Segment{ x, bestBottom, width });
+				for (size_t i = bestIndex + 1; i < _Skyline.size();) {
+					const auto& previous = _Skyline[i - 1];
+					const int overlap = previous.x + previous.width - _Skyline[i].x;
+					if (overlap <= 0) {
+						break;
+					}
+					_Skyline[i].x += overlap;
+					_Skyline[i].width -= overlap;
+					if (_Skyline[i].width > 0) {
+						break;
+					}
+					_Skyline.erase(_Skyline.begin() + static_cast<ptrdiff_t>(i));
+				}
+				for (size_t i = 1; i < _Skyline.size();) {
+					if (_Skyline[i - 1].y == _Skyline[i].y) {
+						_Skyline[i - 1].width += _Skyline[i].width;
+						_Skyline.erase(_Skyline.begin() + static_cast<ptrdiff_t>(i));
+					}
+					else {
+						++i;
+					}
+				}
+				_Used_width = ::std::max(_Used_width, x + width);
+				_Used_height = ::std::max(_Used_height, bestBottom);
+				return true;
+			}
+
+			int used_width() const noexcept {
+				return _Used_width;
+			}
+			int used_height() const noexcept {
+				return _Used_height;
+			}
+		};
+
+		template <class GraphicsSurfaces>
+		basic_atlas_sprite<GraphicsSurfaces>::basic_atlas_sprite(const basic_brush<GraphicsSurfaces>& b, size_t page, const basic_bounding_box<graphics_math_type>& bounds)
+			: _Brush(b)
+			, _Page(page)
+			, _Bounds(bounds) {
+		}
+		template <class GraphicsSurfaces>
+		const basic_brush<GraphicsSurfaces>& basic_atlas_sprite<GraphicsSurfaces>::brush() const noexcept {
+			return _Brush;
+		}
+		template <class GraphicsSurfaces>
+		size_t basic_atlas_sprite<GraphicsSurfaces>::page() const noexcept {
+			return _Page;
+		}
+		template <class GraphicsSurfaces>
+		basic_bounding_box<typename basic_atlas_sprite<GraphicsSurfaces>::graphics_math_type> basic_atlas_sprite<GraphicsSurfaces>::bounds() const noexcept {
+			return _Bounds;
+		}
+		template <class GraphicsSurfaces>
+		basic_display_point<typename basic_atlas_sprite<GraphicsSurfaces>::graphics_math_type> basic_atlas_sprite<GraphicsSurfaces>::dimensions() const noexcept {
+			return basic_display_point<graphics_math_type>(static_cast<int>(_Bounds.width()), static_cast<int>(_Bounds.height()));
+		}
+
+		template <class GraphicsSurfaces>
+		basic_image_atlas<GraphicsSurfaces>::basic_image_atlas(::std::vector<basic_brush<GraphicsSurfaces>>&& pages, ::std::vector<basic_atlas_sprite<GraphicsSurfaces>>&& sprites) noexcept
+			: _Pages(move(pages))
+			, _Sprites(move(sprites)) {
+		}
+		template <class GraphicsSurfaces>
+		size_t basic_image_atlas<GraphicsSurfaces>::size() const noexcept {
+			return _Sprites.size();
+		}
+		template <class GraphicsSurfaces>
+		const basic_atlas_sprite<GraphicsSurfaces>& basic_image_atlas<GraphicsSurfaces>::sprite(size_t index) const {
+			return _Sprites.at(index);
+		}
+		template <class GraphicsSurfaces>
+		size_t basic_image_atlas<GraphicsSurfaces>::page_count() const noexcept {
+			return _Pages.size();
+		}
+		template <class GraphicsSurfaces>
+		const basic_brush<GraphicsSurfaces>& basic_image_atlas<GraphicsSurfaces>::page(size_t index) const {
+			return _Pages.at(index);
+		}
+
+		template <class GraphicsSurfaces>
+		basic_atlas_builder<GraphicsSurfaces>::basic_atlas_builder(const basic_display_point<graphics_math_type>& pageDimensions, io2d::format fmt, int padding)
+			: _Page_dimensions(pageDimensions)
+			, _Format(fmt)
+			, _Padding(padding) {
+			if (pageDimensions.x() <= 0 || pageDimensions.y() <= 0 || padding < 0) {
+				throw ::std::system_error(::std::make_error_code(::std::errc::invalid_argument));
+			}
+		}
+		template <class GraphicsSurfaces>
+		size_t basic_atlas_builder<GraphicsSurfaces>::add(basic_image_surface<GraphicsSurfaces>&& img) {
+			const auto dimensions = img.dimensions();
+			if (dimensions.x() > _Page_dimensions.x() || dimensions.y() > _Page_dimensions.y()) {
+				throw ::std::system_error(::std::make_error_code(::std::errc::invalid_argument));
+			}
+			_Images.push_back(move(img));
+			return _Images.size() - 1;
+		}
+		template <class GraphicsSurfaces>
+		size_t basic_atlas_builder<GraphicsSurfaces>::size() const noexcept {
+			return _Images.size();
+		}
+		template <class GraphicsSurfaces>
+		basic_display_point<typename basic_atlas_builder<GraphicsSurfaces>::graphics_math_type> basic_atlas_builder<GraphicsSurfaces>::page_dimensions() const noexcept {
+			return _Page_dimensions;
+		}
+		template <class GraphicsSurfaces>
+		io2d::format basic_atlas_builder<GraphicsSurfaces>::format() const noexcept {
+			return _Format;
+		}
+		template <class GraphicsSurfaces>
+		int basic_atlas_builder<GraphicsSurfaces>::padding() const noexcept {
+			return _Padding;
+		}
+
+		// Packs and copies every added image, leaving the builder empty. Each page is cropped to the area actually used.
+		template <class GraphicsSurfaces>
+		basic_image_atlas<GraphicsSurfaces> basic_atlas_builder<GraphicsSurfaces>::build() {
+			using bounding_box_type = basic_bounding_box<graphics_math_type>;
+			struct _Placement {
+				size_t page;
+				int x;
+				int y;
+			};
+			::std::vector<size_t> order(_Images.size());
+			for (size_t i = 0; i < order.size(); ++i) {
+				order[i] = i;
+			}
+			::std::stable_sort(order.begin(), order.end(), [this](size_t lhs, size_t rhs) {
+				const auto l = _Images[lhs].dimensions();
+				const auto r = _Images[rhs].dimensions();
+				return l.y() > r.y() || (l.y() == r.y() && l.x() > r.x());
+			});
+
+			// The padding is reserved to the right of and below each image. The packers are that much larger so the last row and column do not need it.
+			::std::vector<_Skyline_packer> packers;
+			::std::vector<_Placement> placements(_Images.size());
+			for (auto index : order) {
+				const auto dimensions = _Images[index].dimensions();
+				const int width = dimensions.x() + _Padding;
+				const int height = dimensions.y() + _Padding;
+				auto& placement = placements[index];
+				bool placed = false;
+				for (size_t page = 0; page < packers.size() && !placed; ++page) {
+					if (packers[page].insert(width, height, placement.x, placement.y)) {
+						placement.page = page;
+						placed = true;
+					}
+				}
+				if (!placed) {
+					packers.emplace_back(_Page_dimensions.x() + _Padding, _Page_dimensions.y() + _Padding);
+					packers.back().insert(width, height, placement.x, placement.y);
+					placement.page = packers.size() - 1;
+				}
+			}
+
+			::std::vector<basic_image_surface<GraphicsSurfaces>> surfaces;
+			for (const auto& packer : packers) {
+				surfaces.emplace_back(_Format, ::std::max(packer.used_width() - _Padding, 1), ::std::max(packer.used_height() - _Padding, 1));
+				surfaces.back().paint(basic_brush<GraphicsSurfaces>(rgba_color::transparent_black), nullopt, basic_render_props<GraphicsSurfaces>(antialias::none, basic_matrix_2d<graphics_math_type>{}, compositing_op::source));
+			}
+			// Copying with the source operator keeps each image's pixels exactly, alpha included.
+			const basic_render_props<GraphicsSurfaces> copyProps(antialias::none, basic_matrix_2d<graphics_math_type>{}, compositing_op::source);
+			::std::vector<bounding_box_type> bounds(_Images.size());
+			for (size_t i = 0; i < _Images.size(); ++i) {
+				const auto& placement = placements[i];
+				const auto dimensions = _Images[i].dimensions();
+				bounds[i] = bounding_box_type(static_cast<float>(placement.x), static_cast<float>(placement.y), static_cast<float>(dimensions.x()), static_cast<float>(dimensions.y()));
+				const basic_brush_props<GraphicsSurfaces> copyBrushProps(io2d::wrap_mode::none, io2d::filter::nearest, io2d::fill_rule::winding, basic_matrix_2d<graphics_math_type>::create_translate(basic_point_2d<graphics_math_type>(-bounds[i].x(), -bounds[i].y())));
+				surfaces[placement.page].fill(basic_brush<GraphicsSurfaces>(move(_Images[i])), basic_interpreted_path<GraphicsSurfaces>(bounds[i]), copyBrushProps, copyProps);
+			}
+			_Images.clear();
+
+			::std::vector<basic_brush<GraphicsSurfaces>> pages;
+			pages.reserve(surfaces.size());
+			for (auto& surface : surfaces) {
+				pages.emplace_back(move(surface));
+			}
+			::std::vector<basic_atlas_sprite<GraphicsSurfaces>> sprites;
+			sprites.reserve(bounds.size());
+			for (size_t i = 0; i < bounds.size(); ++i) {
+				const auto page = placements[i].page;
+				sprites.emplace_back(basic_brush<GraphicsSurfaces>(pages[page], bounds[i]), page, bounds[i]);
+			}
+			return basic_image_atlas<GraphicsSurfaces>(move(pages), move(sprites));
+		}
+	}
+}
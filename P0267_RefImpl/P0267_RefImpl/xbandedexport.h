@@ -0,0 +1,45 @@
+#pragma once
+#include "xio2d.h"
+#include "xsurfaces.h"
+#include <iosfwd>
+
+namespace std::experimental::io2d {
+	inline namespace v1 {
+		// Renders an image of any height, and of any width, without ever holding more than one band of band_height() rows. Each band is drawn into
+		// image surfaces no wider than max_dimensions() and its rows are then handed to a PNG or TIFF encoder that writes them out as they arrive, so
+		// memory use is one band plus the encoder's state. TIFF files switch to BigTIFF when they would not fit in four gigabytes.
+		//
+		// The draw function is called as draw(surface, rp, cl) for every piece of every band. rp translates canvas coordinates to the piece and cl
+		// clips to the piece's area in canvas coordinates, so drawing with them places everything where it belongs in the whole image. A draw function
+		// with a matrix of its own should use its matrix followed by rp.surface_matrix(). Pieces start out transparent black.
+		template <class GraphicsSurfaces>
+		class basic_banded_renderer {
+		public:
+			using graphics_math_type = typename GraphicsSurfaces::graphics_math_type;
+		private:
+			io2d::format _Format;
+			basic_display_point<graphics_math_type> _Dimensions;
+			int _Band_height;
+
+			template <class Encoder, class Draw>
+			void _Render(Encoder& encoder, Draw&& draw) const;
+		public:
+			basic_banded_renderer(io2d::format fmt, int width, int height, int bandHeight = 256);
+
+			io2d::format format() const noexcept;
+			basic_display_point<graphics_math_type> dimensions() const noexcept;
+			int band_height() const noexcept;
+
+			// Only image_file_format::png and image_file_format::tiff can be streamed.
+#ifdef _Filesystem_support_test
+			template <class Draw>
+			void save(filesystem::path p, image_file_format iff, Draw&& draw) const;
+#else
+			template <class Draw>
+			void save(::std::string f, image_file_format iff, Draw&& draw) const;
+#endif
+			template <class Draw>
+			void save(::std::ostream& os, image_file_format iff, Draw&& draw) const;
+		};
+	}
+}
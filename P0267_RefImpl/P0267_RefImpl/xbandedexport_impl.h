@@ -0,0 +1,493 @@
+#pragma once
+#include "xbandedexport.h"
+#include <array>
+#include <cstring>
+#include <fstream>
+#include <ostream>
+
+#ifdef _IO2D_Has_Zlib
+#include <zlib.h>
+#endif
+
+namespace std::experimental::io2d {
+	inline namespace v1 {
+		inline void _Put_be32(unsigned char* p, uint32_t value) noexcept {
+			p[0] = static_cast<unsigned char>(value >> 24);
+			p[1] = static_cast<unsigned char>(value >> 16);
+			p[2] = static_cast<unsigned char>(value >> 8);
+			p[3] = static_cast<unsigned char>(value);
+		}
+		inline void _Put_le(::std::vector<unsigned char>& out, size_t offset, uint64_t value, size_t bytes) noexcept {
+			for (size_t i = 0; i < bytes; ++i) {
+				out[offset + i] = static_cast<unsigned char>(value >> (8 * i));
+			}
+		}
+
+		class _Crc32 {
+			uint32_t _Value = 0xFFFFFFFFu;
+
+			static const ::std::array<uint32_t, 256>& _Table() noexcept {
+				static const auto table = [] {
+					::std::array<uint32_t, 256> result{};
+					for (uint32_t n = 0; n < 256; ++n) {
+						uint32_t c = n;
+						for (int k = 0; k < 8; ++k) {
+							c = (c & 1) != 0 ? 0xEDB88320u ^ (c >> 1) : c >> 1;
+						}
+						result[n] = c;
+					}
+					return result;
+				}();
+				return table;
+			}
+		public:
+			void update(const unsigned char* data, size_t size) noexcept {
+				const auto& table = _Table();
+				for (size_t i = 0; i < size; ++i) {
+					_Value = table[(_Value ^ data[i]) & 0xFFu] ^ (_Value >> 8);
+				}
+			}
+			uint32_t value() const noexcept {
+				return _Value ^ 0xFFFFFFFFu;
+			}
+		};
+
+		// Writes a PNG one row at a time; fill row() and call write_row() for each row from the top down, then call finish(). The rows are deflated
+		// with zlib when it is available and otherwise kept in stored deflate blocks, which every decoder reads but which are as large as the pixels.
+		class _Png_stream_encoder {
+			static constexpr size_t _Idat_size = 64 * 1024;
+
+			::std::ostream& _Stream;
+			// The filter type byte, always None, followed by the row.
+			::std::vector<unsigned char> _Row;
+			// Deflated data waiting to be written as an IDAT chunk.
+			::std::vector<unsigned char> _Idat;
+#ifdef _IO2D_Has_Zlib
+			z_stream _Deflate{};
+
+			void _Deflate_row(int flush);
+#else
+			::std::vector<unsigned char> _Block;
+			uint32_t _Adler_a = 1;
+			uint32_t _Adler_b = 0;
+
+			void _Write_block(bool last);
+#endif
+			void _Write_chunk(const char* type, const unsigned char* data, size_t size);
+		public:
+			_Png_stream_encoder(::std::ostream& os, int width, int height, int channels);
+			_Png_stream_encoder(const _Png_stream_encoder&) = delete;
+			_Png_stream_encoder& operator=(const _Png_stream_encoder&) = delete;
+			~_Png_stream_encoder() noexcept;
+
+			unsigned char* row() noexcept {
+				return _Row.data() + 1;
+			}
+			void write_row();
+			void finish();
+		};
+
+		inline void _Png_stream_encoder::_Write_chunk(const char* type, const unsigned char* data, size_t size) {
+			unsigned char header[8];
+			_Put_be32(header, static_cast<uint32_t>(size));
+			::std::memcpy(header + 4, type, 4);
+			_Crc32 crc;
+			crc.update(header + 4, 4);
+			crc.update(data, size);
+			unsigned char trailer[4];
+			_Put_be32(trailer, crc.value());
+			_Stream.write(reinterpret_cast<const char*>(header), sizeof(header));
+			_Stream.write(reinterpret_cast<const char*>(data), static_cast<::std::streamsize>(size));
+			_Stream.write(reinterpret_cast<const char*>(trailer), sizeof(trailer));
+		}
+
+		inline _Png_stream_encoder::_Png_stream_encoder(::std::ostream& os, int width, int height, int channels)
+			: _Stream(os)
+			, _Row(static_cast<size_t>(width) * static_cast<size_t>(channels) + 1) {
+			_Idat.reserve(_Idat_size);
+#ifdef _IO2D_Has_Zlib
+			if (deflateInit(&_Deflate, Z_DEFAULT_COMPRESSION) != Z_OK) {
+				throw ::std::bad_alloc();
+			}
+#else
+			_Block.reserve(0xFFFF);
+			// A zlib header for a deflate stream with a 32K window and no preset dictionary.
+			_Idat.push_back(0x78);
+			_Idat.push_back(0x01);
+#endif
+			static const unsigned char signature[8] = { 0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n' };
+			_Stream.write(reinterpret_cast<const char*>(signature), sizeof(signature));
+			unsigned char ihdr[13];
+			_Put_be32(ihdr, static_cast<uint32_t>(width));
+			_Put_be32(ihdr + 4, static_cast<uint32_t>(height));
+			ihdr[8] = 8;
+			ihdr[9] = channels == 4 ? 6 : channels == 3 ? 2 : channels == 2 ? 4 : 0;
+			ihdr[10] = 0;
+			ihdr[11] = 0;
+			ihdr[12] = 0;
+			_Write_chunk("IHDR", ihdr, sizeof(ihdr));
+		}
+
+		inline _Png_stream_encoder::~_Png_stream_encoder() noexcept {
+#ifdef _IO2D_Has_Zlib
+			deflateEnd(&_Deflate);
+#endif
+		}
+
+#ifdef _IO2D_Has_Zlib
+		inline void _Png_stream_encoder::_Deflate_row(int flush) {
+			unsigned char buffer[16 * 1024];
+			int result = Z_OK;
+			do {
+				_Deflate.next_out = buffer;
+				_Deflate.avail_out = sizeof(buffer);
+				result = deflate(&_Deflate, flush);
+				if (result == Z_STREAM_ERROR) {
+					throw ::std::system_error(::std::make_error_code(::std::errc::io_error), "Could not deflate the PNG rows.");
+				}
+				_Idat.insert(_Idat.end(), buffer, buffer + (sizeof(buffer) - _Deflate.avail_out));
+				if (_Idat.size() >= _Idat_size) {
+					_Write_chunk("IDAT", _Idat.data(), _Idat.size());
+					_Idat.clear();
+				}
+			} while (_Deflate.avail_out == 0 || (flush == Z_FINISH && result != Z_STREAM_END));
+		}
+
+		inline void _Png_stream_encoder::write_row() {
+			_Deflate.next_in = _Row.data();
+			_Deflate.avail_in = static_cast<uInt>(_Row.size());
+			_Deflate_row(Z_NO_FLUSH);
+		}
+
+		inline void _Png_stream_encoder::finish() {
+			_Deflate.next_in = nullptr;
+			_Deflate.avail_in = 0;
+			_Deflate_row(Z_FINISH);
+			if (!_Idat.empty()) {
+				_Write_chunk("IDAT", _Idat.data(), _Idat.size());
+				_Idat.clear();
+			}
+			_Write_chunk("IEND", nullptr, 0);
+			_Stream.flush();
+		}
+#else
+		inline void _Png_stream_encoder::_Write_block(bool last) {
+			const auto size = static_cast<uint32_t>(_Block.size());
+			_Idat.push_back(last ? 1 : 0);
+			_Idat.push_back(static_cast<unsigned char>(size));
+			_Idat.push_back(static_cast<unsigned char>(size >> 8));
+			_Idat.push_back(static_cast<unsigned char>(~size));
+			_Idat.push_back(static_cast<unsigned char>(~size >> 8));
+			_Idat.insert(_Idat.end(), _Block.begin(), _Block.end());
+			_Block.clear();
+			if (_Idat.size() >= _Idat_size) {
+				_Write_chunk("IDAT", _Idat.data(), _Idat.size());
+				_Idat.clear();
+			}
+		}
+
+		inline void _Png_stream_encoder::write_row() {
+			for (const auto value : _Row) {
+				_Adler_a = (_Adler_a + value) % 65521u;
+				_Adler_b = (_Adler_b + _Adler_a) % 65521u;
+			}
+			size_t written = 0;
+			while (written < _Row.size()) {
+				const auto count = ::std::min(_Row.size() - written, static_cast<size_t>(0xFFFF) - _Block.size());
+				_Block.insert(_Block.end(), _Row.begin() + static_cast<ptrdiff_t>(written), _Row.begin() + static_cast<ptrdiff_t>(written + count));
+				written += count;
+				if (_Block.size() == 0xFFFF) {
+					_Write_block(false);
+				}
+			}
+		}
+
+		inline void _Png_stream_encoder::finish() {
+			_Write_block(true);
+			unsigned char adler[4];
+			_Put_be32(adler, (_Adler_b << 16) | _Adler_a);
+			_Idat.insert(_Idat.end(), adler, adler + 4);
+			_Write_chunk("IDAT", _Idat.data(), _Idat.size());
+			_Idat.clear();
+			_Write_chunk("IEND", nullptr, 0);
+			_Stream.flush();
+		}
+#endif
+
+		// Writes an uncompressed TIFF one row at a time, with one strip per rowsPerStrip rows. Since every strip's size is known up front, the header
+		// and the image file directory come first and the rows follow, so the stream never has to seek. Files that would not fit the 32-bit offsets
+		// of a classic TIFF are written as BigTIFF.
+		class _Tiff_stream_encoder {
+			struct _Field {
+				uint16_t tag;
+				uint16_t type;
+				::std::vector<uint64_t> values;
+			};
+			static constexpr uint16_t _Short = 3;
+			static constexpr uint16_t _Long = 4;
+			static constexpr uint16_t _Long8 = 16;
+
+			::std::ostream& _Stream;
+			::std::vector<unsigned char> _Row;
+
+			static uint64_t _Type_size(uint16_t type) noexcept {
+				return type == _Short ? 2 : type == _Long ? 4 : 8;
+			}
+		public:
+			_Tiff_stream_encoder(::std::ostream& os, int width, int height, int channels, int rowsPerStrip);
+
+			unsigned char* row() noexcept {
+				return _Row.data();
+			}
+			void write_row() {
+				_Stream.write(reinterpret_cast<const char*>(_Row.data()), static_cast<::std::streamsize>(_Row.size()));
+			}
+			void finish() {
+				_Stream.flush();
+			}
+		};
+
+		inline _Tiff_stream_encoder::_Tiff_stream_encoder(::std::ostream& os, int width, int height, int channels, int rowsPerStrip)
+			: _Stream(os)
+			, _Row(static_cast<size_t>(width) * static_cast<size_t>(channels)) {
+			const uint64_t rowBytes = _Row.size();
+			const uint64_t stripCount = (static_cast<uint64_t>(height) + static_cast<uint64_t>(rowsPerStrip) - 1) / static_cast<uint64_t>(rowsPerStrip);
+			const uint64_t dataSize = rowBytes * static_cast<uint64_t>(height);
+			for (const bool big : { false, true }) {
+				const uint16_t offsetType = big ? _Long8 : _Long;
+				::std::vector<_Field> fields = {
+					{ 256, _Long, { static_cast<uint64_t>(width) } },
+					{ 257, _Long, { static_cast<uint64_t>(height) } },
+					{ 258, _Short, ::std::vector<uint64_t>(static_cast<size_t>(channels), 8) },
+					{ 259, _Short, { 1 } },
+					{ 262, _Short, { channels >= 3 ? 2u : 1u } },
+					{ 273, offsetType, ::std::vector<uint64_t>(static_cast<size_t>(stripCount)) },
+					{ 277, _Short, { static_cast<uint64_t>(channels) } },
+					{ 278, _Long, { static_cast<uint64_t>(rowsPerStrip) } },
+					{ 279, offsetType, ::std::vector<uint64_t>(static_cast<size_t>(stripCount)) },
+					{ 284, _Short, { 1 } }
+				};
+				if (channels == 2 || channels == 4) {
+					// Unassociated alpha, since the rows are no longer premultiplied.
+					fields.push_back({ 338, _Short, { 2 } });
+				}
+				const uint64_t headerSize = big ? 16 : 8;
+				const uint64_t entrySize = big ? 20 : 12;
+				const uint64_t countSize = big ? 8 : 2;
+				const uint64_t inlineSize = big ? 8 : 4;
+				uint64_t position = headerSize + countSize + entrySize * fields.size() + inlineSize;
+				::std::vector<uint64_t> valueOffsets;
+				for (const auto& field : fields) {
+					const auto size = _Type_size(field.type) * field.values.size();
+					if (size > inlineSize) {
+						valueOffsets.push_back(position);
+						position += size + size % 2;
+					}
+					else {
+						valueOffsets.push_back(0);
+					}
+				}
+				const uint64_t dataStart = position;
+				if (!big && dataStart + dataSize > 0xFFFFFFFFu) {
+					continue;
+				}
+				for (uint64_t strip = 0; strip < stripCount; ++strip) {
+					const auto firstRow = strip * static_cast<uint64_t>(rowsPerStrip);
+					fields[5].values[static_cast<size_t>(strip)] = dataStart + firstRow * rowBytes;
+					fields[8].values[static_cast<size_t>(strip)] = ::std::min(static_cast<uint64_t>(rowsPerStrip), static_cast<uint64_t>(height) - firstRow) * rowBytes;
+				}
+
+				::std::vector<unsigned char> out(static_cast<size_t>(dataStart));
+				out[0] = 'I';
+				out[1] = 'I';
+				if (big) {
+					_Put_le(out, 2, 43, 2);
+					_Put_le(out, 4, 8, 2);
+					_Put_le(out, 6, 0, 2);
+					_Put_le(out, 8, headerSize, 8);
+				}
+				else {
+					_Put_le(out, 2, 42, 2);
+					_Put_le(out, 4, headerSize, 4);
+				}
+				_Put_le(out, static_cast<size_t>(headerSize), fields.size(), static_cast<size_t>(countSize));
+				auto entry = static_cast<size_t>(headerSize + countSize);
+				for (size_t i = 0; i < fields.size(); ++i) {
+					const auto& field = fields[i];
+					const auto valueSize = static_cast<size_t>(_Type_size(field.type));
+					_Put_le(out, entry, field.tag, 2);
+					_Put_le(out, entry + 2, field.type, 2);
+					_Put_le(out, entry + 4, field.values.size(), big ? 8 : 4);
+					auto valuePosition = entry + (big ? 12 : 8);
+					if (valueOffsets[i] != 0) {
+						_Put_le(out, valuePosition, valueOffsets[i], static_cast<size_t>(inlineSize));
+						valuePosition = static_cast<size_t>(valueOffsets[i]);
+					}
+					for (const auto value : field.values) {
+						_Put_le(out, valuePosition, value, valueSize);
+						valuePosition += valueSize;
+					}
+					entry += static_cast<size_t>(entrySize);
+				}
+				// The offset of the next image file directory stays zero; there is only one image.
+				_Stream.write(reinterpret_cast<const char*>(out.data()), static_cast<::std::streamsize>(out.size()));
+				return;
+			}
+		}
+
+		inline int _Banded_channels(io2d::format fmt) noexcept {
+			return fmt == io2d::format::argb32 ? 4 : fmt == io2d::format::xrgb32 ? 3 : 2;
+		}
+
+		// Turns a row of premultiplied native endian ARGB, XRGB or A8 pixels into RGBA, RGB or gray and alpha bytes. A8 pixels are written the way
+		// save() writes them, as a gray level equal to their alpha.
+		inline void _Banded_convert_row(io2d::format fmt, const ::std::byte* source, int width, unsigned char* destination) noexcept {
+			switch (fmt) {
+			case io2d::format::argb32:
+			{
+				for (int x = 0; x < width; ++x) {
+					uint32_t pixel;
+					::std::memcpy(&pixel, source + x * 4, 4);
+					const uint32_t a = pixel >> 24;
+					auto* out = destination + x * 4;
+					if (a == 0) {
+						out[0] = out[1] = out[2] = out[3] = 0;
+						continue;
+					}
+					const auto unpremultiply = [a](uint32_t c) { return static_cast<unsigned char>(::std::min((c * 255u + a / 2u) / a, 255u)); };
+					out[0] = unpremultiply((pixel >> 16) & 0xFFu);
+					out[1] = unpremultiply((pixel >> 8) & 0xFFu);
+					out[2] = unpremultiply(pixel & 0xFFu);
+					out[3] = static_cast<unsigned char>(a);
+				}
+			} break;
+			case io2d::format::xrgb32:
+			{
+				for (int x = 0; x < width; ++x) {
+					uint32_t pixel;
+					::std::memcpy(&pixel, source + x * 4, 4);
+					auto* out = destination + x * 3;
+					out[0] = static_cast<unsigned char>(pixel >> 16);
+					out[1] = static_cast<unsigned char>(pixel >> 8);
+					out[2] = static_cast<unsigned char>(pixel);
+				}
+			} break;
+			default:
+			{
+				for (int x = 0; x < width; ++x) {
+					destination[x * 2] = static_cast<unsigned char>(source[x]);
+					destination[x * 2 + 1] = static_cast<unsigned char>(source[x]);
+				}
+			} break;
+			}
+		}
+
+		template <class GraphicsSurfaces>
+		basic_banded_renderer<GraphicsSurfaces>::basic_banded_renderer(io2d::format fmt, int width, int height, int bandHeight)
+			: _Format(fmt)
+			, _Dimensions(width, height)
+			, _Band_height(::std::min(bandHeight, height)) {
+			if ((fmt != io2d::format::argb32 && fmt != io2d::format::xrgb32 && fmt != io2d::format::a8) || width <= 0 || height <= 0 || bandHeight <= 0 ||
+				_Band_height > basic_image_surface<GraphicsSurfaces>::max_dimensions().y()) {
+				throw ::std::system_error(::std::make_error_code(::std::errc::invalid_argument));
+			}
+		}
+
+		template <class GraphicsSurfaces>
+		io2d::format basic_banded_renderer<GraphicsSurfaces>::format() const noexcept {
+			return _Format;
+		}
+		template <class GraphicsSurfaces>
+		basic_display_point<typename basic_banded_renderer<GraphicsSurfaces>::graphics_math_type> basic_banded_renderer<GraphicsSurfaces>::dimensions() const noexcept {
+			return _Dimensions;
+		}
+		template <class GraphicsSurfaces>
+		int basic_banded_renderer<GraphicsSurfaces>::band_height() const noexcept {
+			return _Band_height;
+		}
+
+		// Every piece of a band draws straight into one buffer of whole rows, each starting a multiple of four pixels along the row so that its
+		// memory stays aligned, which leaves the rows ready for the encoder without copying the pieces together.
+		template <class GraphicsSurfaces>
+		template <class Encoder, class Draw>
+		void basic_banded_renderer<GraphicsSurfaces>::_Render(Encoder& encoder, Draw&& draw) const {
+			const int width = _Dimensions.x();
+			const int height = _Dimensions.y();
+			const auto maxWidth = basic_image_surface<GraphicsSurfaces>::max_dimensions().x();
+			const int pieceWidth = maxWidth > 4 ? maxWidth - maxWidth % 4 : maxWidth;
+			const int stride = basic_image_surface<GraphicsSurfaces>::stride_for_width(_Format, width);
+			const size_t bytesPerPixel = _Format == io2d::format::a8 ? 1 : 4;
+			::std::vector<::std::byte> band(static_cast<size_t>(stride) * static_cast<size_t>(_Band_height));
+			::std::vector<basic_image_surface<GraphicsSurfaces>> pieces;
+			for (int x = 0; x < width; x += pieceWidth) {
+				pieces.emplace_back(_Format, ::std::min(pieceWidth, width - x), _Band_height, band.data() + static_cast<size_t>(x) * bytesPerPixel, stride);
+			}
+			for (int y = 0; y < height; y += _Band_height) {
+				const int rows = ::std::min(_Band_height, height - y);
+				::std::fill(band.begin(), band.end(), ::std::byte{ 0 });
+				for (size_t i = 0; i < pieces.size(); ++i) {
+					auto& piece = pieces[i];
+					const int x = static_cast<int>(i) * pieceWidth;
+					piece.mark_dirty();
+					basic_render_props<GraphicsSurfaces> rp;
+					rp.surface_matrix(basic_matrix_2d<graphics_math_type>::create_translate(basic_point_2d<graphics_math_type>(static_cast<float>(-x), static_cast<float>(-y))));
+					const basic_clip_props<GraphicsSurfaces> cl(basic_bounding_box<graphics_math_type>(static_cast<float>(x), static_cast<float>(y), static_cast<float>(piece.dimensions().x()), static_cast<float>(rows)));
+					draw(piece, static_cast<const basic_render_props<GraphicsSurfaces>&>(rp), cl);
+					piece.flush();
+				}
+				for (int row = 0; row < rows; ++row) {
+					_Banded_convert_row(_Format, band.data() + static_cast<size_t>(row) * static_cast<size_t>(stride), width, encoder.row());
+					encoder.write_row();
+				}
+			}
+			encoder.finish();
+		}
+
+		template <class GraphicsSurfaces>
+		template <class Draw>
+		void basic_banded_renderer<GraphicsSurfaces>::save(::std::ostream& os, image_file_format iff, Draw&& draw) const {
+			if (iff == image_file_format::png) {
+				_Png_stream_encoder encoder(os, _Dimensions.x(), _Dimensions.y(), _Banded_channels(_Format));
+				_Render(encoder, draw);
+			}
+			else if (iff == image_file_format::tiff) {
+				_Tiff_stream_encoder encoder(os, _Dimensions.x(), _Dimensions.y(), _Banded_channels(_Format), _Band_height);
+				_Render(encoder, draw);
+			}
+			else {
+				throw ::std::system_error(::std::make_error_code(::std::errc::not_supported), "Only PNG and TIFF images can be rendered in bands.");
+			}
+			if (!os) {
+				throw ::std::system_error(::std::make_error_code(::std::errc::io_error), "Could not write the banded image.");
+			}
+		}
+
+#ifdef _Filesystem_support_test
+		template <class GraphicsSurfaces>
+		template <class Draw>
+		void basic_banded_renderer<GraphicsSurfaces>::save(filesystem::path p, image_file_format iff, Draw&& draw) const {
+			if (iff != image_file_format::png && iff != image_file_format::tiff) {
+				throw ::std::system_error(::std::make_error_code(::std::errc::not_supported), "Only PNG and TIFF images can be rendered in bands.");
+			}
+			::std::ofstream ofs(p.string(), ::std::ios::binary | ::std::ios::trunc);
+			if (!ofs) {
+				throw ::std::system_error(::std::make_error_code(::std::errc::io_error), "Could not create the file for a banded image.");
+			}
+			save(ofs, iff, ::std::forward<Draw>(draw));
+		}
+#else
+		template <class GraphicsSurfaces>
+		template <class Draw>
+		void basic_banded_renderer<GraphicsSurfaces>::save(::std::string f, image_file_format iff, Draw&& draw) const {
+			if (iff != image_file_format::png && iff != image_file_format::tiff) {
+				throw ::std::system_error(::std::make_error_code(::std::errc::not_supported), "Only PNG and TIFF images can be rendered in bands.");
+			}
+			::std::ofstream ofs(f, ::std::ios::binary | ::std::ios::trunc);
+			if (!ofs) {
+				throw ::std::system_error(::std::make_error_code(::std::errc::io_error), "Could not create the file for a banded image.");
+			}
+			save(ofs, iff, ::std::forward<Draw>(draw));
+		}
+#endif
+	}
+}
@@ -78,6 +78,15 @@ namespace std {
 
 					basic_brush(basic_image_surface<GraphicsSurfaces>&& img);
 
+					// Creates a surface brush that shares ownership of img's pixels instead of taking them, so img stays usable as a draw target and no copy is made.
+					// Drawing to img while the brush is being drawn with on another thread is a data race. Whether later drawing to img shows through the brush
+					// depends on the backend.
+					basic_brush(const basic_image_surface<GraphicsSurfaces>& img);
+
+					// Creates a surface brush that samples only the bb region of the surface brush b, with the top left corner of bb at the brush origin.
+					// Wrap modes and filtering treat the edges of bb as the edges of the surface. b's surface is shared, not copied.
+					basic_brush(const basic_brush& b, const basic_bounding_box<graphics_math_type>& bb);
+
 					brush_type type() const noexcept;
 				};
 			}
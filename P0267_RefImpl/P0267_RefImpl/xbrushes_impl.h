@@ -29,43 +29,51 @@ namespace std::experimental::io2d {
 		}
 
 		template<class GraphicsSurfaces>
-		inline const typename basic_brush<GraphicsSurfaces>::data_type& basic_brush<GraphicsSurfaces>::data() const noexcept {
+		const typename basic_brush<GraphicsSurfaces>::data_type& basic_brush<GraphicsSurfaces>::data() const noexcept {
 			return _Data;
 		}
 
 		template<class GraphicsSurfaces>
-		inline typename basic_brush<GraphicsSurfaces>::data_type& basic_brush<GraphicsSurfaces>::data() noexcept {
+		typename basic_brush<GraphicsSurfaces>::data_type& basic_brush<GraphicsSurfaces>::data() noexcept {
 			return _Data;
 		}
 
 		template<class GraphicsSurfaces>
-		inline basic_brush<GraphicsSurfaces>::basic_brush(const rgba_color & c)
+		basic_brush<GraphicsSurfaces>::basic_brush(const rgba_color & c)
 			: _Data(GraphicsSurfaces::brushes::create_brush(c)) {
 		}
 		template<class GraphicsSurfaces>
-		inline basic_brush<GraphicsSurfaces>::basic_brush(const basic_point_2d<graphics_math_type>& begin, const basic_point_2d<graphics_math_type>& end, ::std::initializer_list<gradient_stop> il)
+		basic_brush<GraphicsSurfaces>::basic_brush(const basic_point_2d<graphics_math_type>& begin, const basic_point_2d<graphics_math_type>& end, ::std::initializer_list<gradient_stop> il)
 			: _Data(GraphicsSurfaces::brushes::create_brush(begin, end, il)) {
 		}
 		template<class GraphicsSurfaces>
 		template<class InputIterator>
-		inline std::experimental::io2d::v1::basic_brush<GraphicsSurfaces>::basic_brush(const basic_point_2d<graphics_math_type>& begin, const basic_point_2d<graphics_math_type>& end, InputIterator first, InputIterator last)
+		std::experimental::io2d::v1::basic_brush<GraphicsSurfaces>::basic_brush(const basic_point_2d<graphics_math_type>& begin, const basic_point_2d<graphics_math_type>& end, InputIterator first, InputIterator last)
 			: _Data(GraphicsSurfaces::brushes::create_brush(begin, end, first, last)) {
 		}
 		template<class GraphicsSurfaces>
-		inline basic_brush<GraphicsSurfaces>::basic_brush(const basic_circle<graphics_math_type>& start, const basic_circle<graphics_math_type>& end, ::std::initializer_list<gradient_stop> il)
+		basic_brush<GraphicsSurfaces>::basic_brush(const basic_circle<graphics_math_type>& start, const basic_circle<graphics_math_type>& end, ::std::initializer_list<gradient_stop> il)
 			: _Data(GraphicsSurfaces::brushes::create_brush(start, end, il)) {
 		}
 		template<class GraphicsSurfaces>
 		template<class InputIterator>
-		inline basic_brush<GraphicsSurfaces>::basic_brush(const basic_circle<graphics_math_type>& start, const basic_circle<graphics_math_type>& end, InputIterator first, InputIterator last)
+		basic_brush<GraphicsSurfaces>::basic_brush(const basic_circle<graphics_math_type>& start, const basic_circle<graphics_math_type>& end, InputIterator first, InputIterator last)
 			: _Data(GraphicsSurfaces::brushes::create_brush(start, end, first, last)) {
 		}
 		template<class GraphicsSurfaces>
-		inline basic_brush<GraphicsSurfaces>::basic_brush(basic_image_surface<GraphicsSurfaces>&& img)
+		basic_brush<GraphicsSurfaces>::basic_brush(basic_image_surface<GraphicsSurfaces>&& img)
 			: _Data(GraphicsSurfaces::brushes::create_brush(move(img))) {
 		}
 		template<class GraphicsSurfaces>
-		inline brush_type basic_brush<GraphicsSurfaces>::type() const noexcept {
+		basic_brush<GraphicsSurfaces>::basic_brush(const basic_image_surface<GraphicsSurfaces>& img)
+			: _Data(GraphicsSurfaces::brushes::create_brush(img)) {
+		}
+		template<class GraphicsSurfaces>
+		basic_brush<GraphicsSurfaces>::basic_brush(const basic_brush& b, const basic_bounding_box<graphics_math_type>& bb)
+			: _Data(GraphicsSurfaces::brushes::create_brush(b.data(), bb)) {
+		}
+		template<class GraphicsSurfaces>
+		brush_type basic_brush<GraphicsSurfaces>::type() const noexcept {
 			return GraphicsSurfaces::brushes::get_brush_type(_Data);
 		}
 	}
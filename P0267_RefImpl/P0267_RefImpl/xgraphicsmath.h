@@ -11,62 +11,62 @@ namespace std {
 				private:
 					data_type _Data;
 				public:
-					const data_type& data() const noexcept;
-					data_type& data() noexcept;
+					constexpr const data_type& data() const noexcept;
+					constexpr data_type& data() noexcept;
 
 					// \ref{\iotwod.\pointtwod.cons}, constructors:
-					basic_point_2d() noexcept;
-					basic_point_2d(float xval, float yval) noexcept;
-					basic_point_2d(const typename GraphicsMath::point_2d_data_type& data) noexcept;
+					constexpr basic_point_2d() noexcept;
+					constexpr basic_point_2d(float xval, float yval) noexcept;
+					constexpr basic_point_2d(const typename GraphicsMath::point_2d_data_type& data) noexcept;
 
-					void x(float val) noexcept;
-					void y(float val) noexcept;
-					float x() const noexcept;
-					float y() const noexcept;
+					constexpr void x(float val) noexcept;
+					constexpr void y(float val) noexcept;
+					constexpr float x() const noexcept;
+					constexpr float y() const noexcept;
 
 					// \ref{\iotwod.\pointtwod.observers}, observers:
-					float dot(const basic_point_2d& other) const noexcept;
+					constexpr float dot(const basic_point_2d& other) const noexcept;
 					float magnitude() const noexcept;
-					float magnitude_squared() const noexcept;
+					constexpr float magnitude_squared() const noexcept;
 					float angular_direction() const noexcept;
 					basic_point_2d to_unit() const noexcept;
 					//basic_point_2d zero() noexcept;
 
 					// \ref{\iotwod.\pointtwod.member.ops}, member operators:
-					basic_point_2d& operator+=(const basic_point_2d& rhs) noexcept;
-					basic_point_2d& operator+=(float rhs) noexcept;
-					basic_point_2d& operator-=(const basic_point_2d& rhs) noexcept;
-					basic_point_2d& operator-=(float rhs) noexcept;
-					basic_point_2d& operator*=(const basic_point_2d& rhs) noexcept;
-					basic_point_2d& operator*=(float rhs) noexcept;
-					basic_point_2d& operator/=(const basic_point_2d& rhs) noexcept;
-					basic_point_2d& operator/=(float rhs) noexcept;
+					constexpr basic_point_2d& operator+=(const basic_point_2d& rhs) noexcept;
+					constexpr basic_point_2d& operator+=(float rhs) noexcept;
+					constexpr basic_point_2d& operator-=(const basic_point_2d& rhs) noexcept;
+					constexpr basic_point_2d& operator-=(float rhs) noexcept;
+					constexpr basic_point_2d& operator*=(const basic_point_2d& rhs) noexcept;
+					constexpr basic_point_2d& operator*=(float rhs) noexcept;
+					constexpr basic_point_2d& operator/=(const basic_point_2d& rhs) noexcept;
+					constexpr basic_point_2d& operator/=(float rhs) noexcept;
 				};
 
 				template <class GraphicsMath>
-				bool operator==(const basic_point_2d<GraphicsMath>& lhs, const basic_point_2d<GraphicsMath>& rhs) noexcept;
+				constexpr bool operator==(const basic_point_2d<GraphicsMath>& lhs, const basic_point_2d<GraphicsMath>& rhs) noexcept;
 				template <class GraphicsMath>
-				bool operator!=(const basic_point_2d<GraphicsMath>& lhs, const basic_point_2d<GraphicsMath>& rhs) noexcept;
+				constexpr bool operator!=(const basic_point_2d<GraphicsMath>& lhs, const basic_point_2d<GraphicsMath>& rhs) noexcept;
 				template <class GraphicsMath>
-				basic_point_2d<GraphicsMath> operator+(const basic_point_2d<GraphicsMath>& val) noexcept;
+				constexpr basic_point_2d<GraphicsMath> operator+(const basic_point_2d<GraphicsMath>& val) noexcept;
 				template <class GraphicsMath>
-				basic_point_2d<GraphicsMath> operator+(const basic_point_2d<GraphicsMath>& lhs, const basic_point_2d<GraphicsMath>& rhs) noexcept;
+				constexpr basic_point_2d<GraphicsMath> operator+(const basic_point_2d<GraphicsMath>& lhs, const basic_point_2d<GraphicsMath>& rhs) noexcept;
 				template <class GraphicsMath>
-				basic_point_2d<GraphicsMath> operator-(const basic_point_2d<GraphicsMath>& val) noexcept;
+				constexpr basic_point_2d<GraphicsMath> operator-(const basic_point_2d<GraphicsMath>& val) noexcept;
 				template <class GraphicsMath>
-				basic_point_2d<GraphicsMath> operator-(const basic_point_2d<GraphicsMath>& lhs, const basic_point_2d<GraphicsMath>& rhs) noexcept;
+				constexpr basic_point_2d<GraphicsMath> operator-(const basic_point_2d<GraphicsMath>& lhs, const basic_point_2d<GraphicsMath>& rhs) noexcept;
 				template <class GraphicsMath>
-				basic_point_2d<GraphicsMath> operator*(const basic_point_2d<GraphicsMath>& lhs, float rhs) noexcept;
+				constexpr basic_point_2d<GraphicsMath> operator*(const basic_point_2d<GraphicsMath>& lhs, float rhs) noexcept;
 				template <class GraphicsMath>
-				basic_point_2d<GraphicsMath> operator*(float lhs, const basic_point_2d<GraphicsMath>& rhs) noexcept;
+				constexpr basic_point_2d<GraphicsMath> operator*(float lhs, const basic_point_2d<GraphicsMath>& rhs) noexcept;
 				template <class GraphicsMath>
-				basic_point_2d<GraphicsMath> operator*(const basic_point_2d<GraphicsMath>& lhs, const basic_point_2d<GraphicsMath>& rhs) noexcept;
+				constexpr basic_point_2d<GraphicsMath> operator*(const basic_point_2d<GraphicsMath>& lhs, const basic_point_2d<GraphicsMath>& rhs) noexcept;
 				template <class GraphicsMath>
-				basic_point_2d<GraphicsMath> operator/(const basic_point_2d<GraphicsMath>& lhs, float rhs) noexcept;
+				constexpr basic_point_2d<GraphicsMath> operator/(const basic_point_2d<GraphicsMath>& lhs, float rhs) noexcept;
 				template <class GraphicsMath>
-				basic_point_2d<GraphicsMath> operator/(float lhs, const basic_point_2d<GraphicsMath>& rhs) noexcept;
+				constexpr basic_point_2d<GraphicsMath> operator/(float lhs, const basic_point_2d<GraphicsMath>& rhs) noexcept;
 				template <class GraphicsMath>
-				basic_point_2d<GraphicsMath> operator/(const basic_point_2d<GraphicsMath>& lhs, const basic_point_2d<GraphicsMath>& rhs) noexcept;
+				constexpr basic_point_2d<GraphicsMath> operator/(const basic_point_2d<GraphicsMath>& lhs, const basic_point_2d<GraphicsMath>& rhs) noexcept;
 
 				template <class GraphicsMath>
 				class basic_matrix_2d {
@@ -75,63 +75,66 @@ namespace std {
 				private:
 					data_type _Data;
 				public:
-					const data_type& data() const noexcept;
-					data_type& data() noexcept;
-
-					basic_matrix_2d() noexcept;
-					basic_matrix_2d(float v00, float v01, float v10, float v11, float v20, float v21) noexcept;
-					basic_matrix_2d(const typename GraphicsMath::matrix_2d_data_type& val) noexcept;
-
-					void m00(float val) noexcept;
-					void m01(float val) noexcept;
-					void m10(float val) noexcept;
-					void m11(float val) noexcept;
-					void m20(float val) noexcept;
-					void m21(float val) noexcept;
-
-					float m00() const noexcept;
-					float m01() const noexcept;
-					float m10() const noexcept;
-					float m11() const noexcept;
-					float m20() const noexcept;
-					float m21() const noexcept;
+					constexpr const data_type& data() const noexcept;
+					constexpr data_type& data() noexcept;
+
+					constexpr basic_matrix_2d() noexcept;
+					constexpr basic_matrix_2d(float v00, float v01, float v10, float v11, float v20, float v21) noexcept;
+					constexpr basic_matrix_2d(const typename GraphicsMath::matrix_2d_data_type& val) noexcept;
+
+					constexpr void m00(float val) noexcept;
+					constexpr void m01(float val) noexcept;
+					constexpr void m10(float val) noexcept;
+					constexpr void m11(float val) noexcept;
+					constexpr void m20(float val) noexcept;
+					constexpr void m21(float val) noexcept;
+
+					constexpr float m00() const noexcept;
+					constexpr float m01() const noexcept;
+					constexpr float m10() const noexcept;
+					constexpr float m11() const noexcept;
+					constexpr float m20() const noexcept;
+					constexpr float m21() const noexcept;
 
 					// \ref{\iotwod.\matrixtwod.staticfactories}, static factory functions:
-					static basic_matrix_2d create_translate(const basic_point_2d<GraphicsMath>& val) noexcept;
-					static basic_matrix_2d create_scale(const basic_point_2d<GraphicsMath>& val) noexcept;
+					static constexpr basic_matrix_2d create_translate(const basic_point_2d<GraphicsMath>& val) noexcept;
+					static constexpr basic_matrix_2d create_scale(const basic_point_2d<GraphicsMath>& val) noexcept;
 					static basic_matrix_2d create_rotate(float radians) noexcept;
 					static basic_matrix_2d create_rotate(float radians, const basic_point_2d<GraphicsMath>& origin) noexcept;
 					static basic_matrix_2d create_reflect(float radians) noexcept;
-					static basic_matrix_2d create_shear_x(float factor) noexcept;
-					static basic_matrix_2d create_shear_y(float factor) noexcept;
+					static constexpr basic_matrix_2d create_shear_x(float factor) noexcept;
+					static constexpr basic_matrix_2d create_shear_y(float factor) noexcept;
 
 					// \ref{\iotwod.\matrixtwod.modifiers}, modifiers:
-					basic_matrix_2d& translate(const basic_point_2d<GraphicsMath>& v) noexcept;
-					basic_matrix_2d& scale(const basic_point_2d<GraphicsMath>& v) noexcept;
+					constexpr basic_matrix_2d& translate(const basic_point_2d<GraphicsMath>& v) noexcept;
+					constexpr basic_matrix_2d& scale(const basic_point_2d<GraphicsMath>& v) noexcept;
 					basic_matrix_2d& rotate(float radians) noexcept;
 					basic_matrix_2d& rotate(float radians, const basic_point_2d<GraphicsMath>& origin) noexcept;
 					basic_matrix_2d& reflect(float radians) noexcept;
-					basic_matrix_2d& shear_x(float factor) noexcept;
-					basic_matrix_2d& shear_y(float factor) noexcept;
+					constexpr basic_matrix_2d& shear_x(float factor) noexcept;
+					constexpr basic_matrix_2d& shear_y(float factor) noexcept;
 
 					// \ref{\iotwod.\matrixtwod.observers}, observers:
-					bool is_finite() const noexcept;
-					bool is_invertible() const noexcept;
-					float determinant() const noexcept;
-					basic_matrix_2d inverse() const noexcept;
-					basic_point_2d<GraphicsMath> transform_pt(const basic_point_2d<GraphicsMath>& pt) const noexcept;
-
-					basic_matrix_2d& operator*=(const basic_matrix_2d& other) noexcept;
+					constexpr bool is_finite() const noexcept;
+					constexpr bool is_invertible() const noexcept;
+					constexpr float determinant() const noexcept;
+					constexpr basic_matrix_2d inverse() const noexcept;
+					constexpr basic_point_2d<GraphicsMath> transform_pt(const basic_point_2d<GraphicsMath>& pt) const noexcept;
+					// Transforms every point in [first, last) and writes the results to result. Contiguous ranges given as pointers are transformed in batches by GraphicsMath::transform_pts.
+					template <class InputIterator, class OutputIterator>
+					OutputIterator transform_pts(InputIterator first, InputIterator last, OutputIterator result) const;
+
+					constexpr basic_matrix_2d& operator*=(const basic_matrix_2d& other) noexcept;
 				};
 
 				template <class GraphicsMath>
-				basic_matrix_2d<GraphicsMath> operator*(const basic_matrix_2d<GraphicsMath>& lhs, const basic_matrix_2d<GraphicsMath>& rhs) noexcept;
+				constexpr basic_matrix_2d<GraphicsMath> operator*(const basic_matrix_2d<GraphicsMath>& lhs, const basic_matrix_2d<GraphicsMath>& rhs) noexcept;
 				template <class GraphicsMath>
-				basic_point_2d<GraphicsMath> operator*(const basic_point_2d<GraphicsMath>& lhs, const basic_matrix_2d<GraphicsMath>& rhs) noexcept;
+				constexpr basic_point_2d<GraphicsMath> operator*(const basic_point_2d<GraphicsMath>& lhs, const basic_matrix_2d<GraphicsMath>& rhs) noexcept;
 				template <class GraphicsMath>
-				bool operator==(const basic_matrix_2d<GraphicsMath>& lhs, const basic_matrix_2d<GraphicsMath>& rhs) noexcept;
+				constexpr bool operator==(const basic_matrix_2d<GraphicsMath>& lhs, const basic_matrix_2d<GraphicsMath>& rhs) noexcept;
 				template <class GraphicsMath>
-				bool operator!=(const basic_matrix_2d<GraphicsMath>& lhs, const basic_matrix_2d<GraphicsMath>& rhs) noexcept;
+				constexpr bool operator!=(const basic_matrix_2d<GraphicsMath>& lhs, const basic_matrix_2d<GraphicsMath>& rhs) noexcept;
 
 				template <class GraphicsMath>
 				class basic_display_point {
@@ -140,24 +143,24 @@ namespace std {
 				private:
 					data_type _Data;
 				public:
-					const data_type& data() const noexcept;
-					data_type& data() noexcept;
+					constexpr const data_type& data() const noexcept;
+					constexpr data_type& data() noexcept;
 
 					// \ref{\iotwod.\pointtwod.cons}, constructors:
-					basic_display_point() noexcept;
-					basic_display_point(int xval, int yval) noexcept;
-					basic_display_point(const typename GraphicsMath::display_point_data_type& val) noexcept;
-
-					void x(int val) noexcept;
-					void y(int val) noexcept;
-					int x() const noexcept;
-					int y() const noexcept;
+					constexpr basic_display_point() noexcept;
+					constexpr basic_display_point(int xval, int yval) noexcept;
+					constexpr basic_display_point(const typename GraphicsMath::display_point_data_type& val) noexcept;
+
+					constexpr void x(int val) noexcept;
+					constexpr void y(int val) noexcept;
+					constexpr int x() const noexcept;
+					constexpr int y() const noexcept;
 				};
 
 				template <class GraphicsMath>
-				bool operator==(const basic_display_point<GraphicsMath>& lhs, const basic_display_point<GraphicsMath>& rhs) noexcept;
+				constexpr bool operator==(const basic_display_point<GraphicsMath>& lhs, const basic_display_point<GraphicsMath>& rhs) noexcept;
 				template <class GraphicsMath>
-				bool operator!=(const basic_display_point<GraphicsMath>& lhs, const basic_display_point<GraphicsMath>& rhs) noexcept;
+				constexpr bool operator!=(const basic_display_point<GraphicsMath>& lhs, const basic_display_point<GraphicsMath>& rhs) noexcept;
 
 				template <class GraphicsMath>
 				class basic_bounding_box {
@@ -166,32 +169,32 @@ namespace std {
 				private:
 					data_type _Data;
 				public:
-					const data_type& data() const noexcept;
-					data_type& data() noexcept;
-					basic_bounding_box() noexcept;
-					basic_bounding_box(float x, float y, float width, float height) noexcept;
-					basic_bounding_box(const basic_point_2d<GraphicsMath>& tl, const basic_point_2d<GraphicsMath>& br) noexcept;
-					basic_bounding_box(const typename GraphicsMath::bounding_box_data_type& val) noexcept;
-
-					void x(float val) noexcept;
-					void y(float val) noexcept;
-					void width(float val) noexcept;
-					void height(float val) noexcept;
-					void top_left(const basic_point_2d<GraphicsMath>& val) noexcept;
-					void bottom_right(const basic_point_2d<GraphicsMath>& val) noexcept;
-
-					float x() const noexcept;
-					float y() const noexcept;
-					float width() const noexcept;
-					float height() const noexcept;
-					basic_point_2d<GraphicsMath> top_left() const noexcept;
-					basic_point_2d<GraphicsMath> bottom_right() const noexcept;
+					constexpr const data_type& data() const noexcept;
+					constexpr data_type& data() noexcept;
+					constexpr basic_bounding_box() noexcept;
+					constexpr basic_bounding_box(float x, float y, float width, float height) noexcept;
+					constexpr basic_bounding_box(const basic_point_2d<GraphicsMath>& tl, const basic_point_2d<GraphicsMath>& br) noexcept;
+					constexpr basic_bounding_box(const typename GraphicsMath::bounding_box_data_type& val) noexcept;
+
+					constexpr void x(float val) noexcept;
+					constexpr void y(float val) noexcept;
+					constexpr void width(float val) noexcept;
+					constexpr void height(float val) noexcept;
+					constexpr void top_left(const basic_point_2d<GraphicsMath>& val) noexcept;
+					constexpr void bottom_right(const basic_point_2d<GraphicsMath>& val) noexcept;
+
+					constexpr float x() const noexcept;
+					constexpr float y() const noexcept;
+					constexpr float width() const noexcept;
+					constexpr float height() const noexcept;
+					constexpr basic_point_2d<GraphicsMath> top_left() const noexcept;
+					constexpr basic_point_2d<GraphicsMath> bottom_right() const noexcept;
 				};
 
 				template <class GraphicsMath>
-				bool operator==(const basic_bounding_box<GraphicsMath>& lhs, const basic_bounding_box<GraphicsMath>& rhs) noexcept;
+				constexpr bool operator==(const basic_bounding_box<GraphicsMath>& lhs, const basic_bounding_box<GraphicsMath>& rhs) noexcept;
 				template <class GraphicsMath>
-				bool operator!=(const basic_bounding_box<GraphicsMath>& lhs, const basic_bounding_box<GraphicsMath>& rhs) noexcept;
+				constexpr bool operator!=(const basic_bounding_box<GraphicsMath>& lhs, const basic_bounding_box<GraphicsMath>& rhs) noexcept;
 
 				template <class GraphicsMath>
 				class basic_circle {
@@ -199,27 +202,33 @@ namespace std {
 				private:
 					data_type _Data;
 				public:
-					const data_type& data() const noexcept;
-					data_type& data() noexcept;
+					constexpr const data_type& data() const noexcept;
+					constexpr data_type& data() noexcept;
 
-					basic_circle() noexcept;
-					basic_circle(const basic_point_2d<GraphicsMath>& ctr, float rad) noexcept;
-					basic_circle(const typename GraphicsMath::circle_data_type& val) noexcept;
+					constexpr basic_circle() noexcept;
+					constexpr basic_circle(const basic_point_2d<GraphicsMath>& ctr, float rad) noexcept;
+					constexpr basic_circle(const typename GraphicsMath::circle_data_type& val) noexcept;
 
-					void center(const basic_point_2d<GraphicsMath>& ctr) noexcept;
-					void radius(float r) noexcept;
+					constexpr void center(const basic_point_2d<GraphicsMath>& ctr) noexcept;
+					constexpr void radius(float r) noexcept;
 
-					basic_point_2d<GraphicsMath> center() const noexcept;
-					float radius() const noexcept;
+					constexpr basic_point_2d<GraphicsMath> center() const noexcept;
+					constexpr float radius() const noexcept;
 				};
 
 				template <class GraphicsMath>
-				bool operator==(const basic_circle<GraphicsMath>& lhs, const basic_circle<GraphicsMath>& rhs) noexcept;
+				constexpr bool operator==(const basic_circle<GraphicsMath>& lhs, const basic_circle<GraphicsMath>& rhs) noexcept;
 				template <class GraphicsMath>
-				bool operator!=(const basic_circle<GraphicsMath>& lhs, const basic_circle<GraphicsMath>& rhs) noexcept;
+				constexpr bool operator!=(const basic_circle<GraphicsMath>& lhs, const basic_circle<GraphicsMath>& rhs) noexcept;
 
 				// Standalone math functions
 
+				template <class GraphicsMath>
+				constexpr basic_bounding_box<GraphicsMath> unite(const basic_bounding_box<GraphicsMath>& lhs, const basic_bounding_box<GraphicsMath>& rhs) noexcept;
+
+				template <class GraphicsMath>
+				constexpr basic_bounding_box<GraphicsMath> intersect(const basic_bounding_box<GraphicsMath>& lhs, const basic_bounding_box<GraphicsMath>& rhs) noexcept;
+
 				template <class GraphicsMath>
 				float angle_for_point(const basic_point_2d<GraphicsMath>& ctr, const basic_point_2d<GraphicsMath>& pt) noexcept;
 
@@ -4,38 +4,38 @@
 namespace std::experimental::io2d {
 	inline namespace v1 {
 		template<class GraphicsMath>
-		inline const typename basic_point_2d<GraphicsMath>::data_type& basic_point_2d<GraphicsMath>::data() const noexcept {
+		inline constexpr const typename basic_point_2d<GraphicsMath>::data_type& basic_point_2d<GraphicsMath>::data() const noexcept {
 			return _Data;
 		}
 		template<class GraphicsMath>
-		inline typename basic_point_2d<GraphicsMath>::data_type& basic_point_2d<GraphicsMath>::data() noexcept {
+		inline constexpr typename basic_point_2d<GraphicsMath>::data_type& basic_point_2d<GraphicsMath>::data() noexcept {
 			return _Data;
 		}
 		template <class GraphicsMath>
-		inline basic_point_2d<GraphicsMath>::basic_point_2d() noexcept
+		inline constexpr basic_point_2d<GraphicsMath>::basic_point_2d() noexcept
 			: _Data(GraphicsMath::create_point_2d()) {}
 		template <class GraphicsMath>
-		inline basic_point_2d<GraphicsMath>::basic_point_2d(float xval, float yval) noexcept
+		inline constexpr basic_point_2d<GraphicsMath>::basic_point_2d(float xval, float yval) noexcept
 			: _Data(GraphicsMath::create_point_2d(xval, yval)) {
 		}
 		template <class GraphicsMath>
-		inline basic_point_2d<GraphicsMath>::basic_point_2d(const typename GraphicsMath::point_2d_data_type& data) noexcept
+		inline constexpr basic_point_2d<GraphicsMath>::basic_point_2d(const typename GraphicsMath::point_2d_data_type& data) noexcept
 			: _Data(data) {
 		}
 		template <class GraphicsMath>
-		inline void basic_point_2d<GraphicsMath>::x(float xval) noexcept {
+		inline constexpr void basic_point_2d<GraphicsMath>::x(float xval) noexcept {
 			GraphicsMath::x(_Data, xval);
 		}
 		template <class GraphicsMath>
-		inline void basic_point_2d<GraphicsMath>::y(float yval) noexcept {
+		inline constexpr void basic_point_2d<GraphicsMath>::y(float yval) noexcept {
 			GraphicsMath::y(_Data, yval);
 		}
 		template <class GraphicsMath>
-		inline float basic_point_2d<GraphicsMath>::x() const noexcept {
+		inline constexpr float basic_point_2d<GraphicsMath>::x() const noexcept {
 			return GraphicsMath::x(_Data);
 		}
 		template <class GraphicsMath>
-		inline float basic_point_2d<GraphicsMath>::y() const noexcept {
+		inline constexpr float basic_point_2d<GraphicsMath>::y() const noexcept {
 			return GraphicsMath::y(_Data);
 		}
 		template <class GraphicsMath>
@@ -43,11 +43,11 @@ namespace std::experimental::io2d {
 			return GraphicsMath::magnitude(_Data);
 		}
 		template <class GraphicsMath>
-		inline float basic_point_2d<GraphicsMath>::magnitude_squared() const noexcept {
+		inline constexpr float basic_point_2d<GraphicsMath>::magnitude_squared() const noexcept {
 			return GraphicsMath::magnitude_squared(_Data);
 		}
 		template <class GraphicsMath>
-		inline float basic_point_2d<GraphicsMath>::dot(const basic_point_2d<GraphicsMath>& other) const noexcept {
+		inline constexpr float basic_point_2d<GraphicsMath>::dot(const basic_point_2d<GraphicsMath>& other) const noexcept {
 			return GraphicsMath::dot(_Data, other._Data);
 		}
 		template <class GraphicsMath>
@@ -60,110 +60,110 @@ namespace std::experimental::io2d {
 		//}
 		template <class GraphicsMath>
 		inline basic_point_2d<GraphicsMath> basic_point_2d<GraphicsMath>::to_unit() const noexcept {
-			return point_2d(GraphicsMath::to_unit(_Data));
+			return basic_point_2d<GraphicsMath>(GraphicsMath::to_unit(_Data));
 		}
 		template <class GraphicsMath>
-		inline bool operator==(const basic_point_2d<GraphicsMath>& lhs, const basic_point_2d<GraphicsMath>& rhs) noexcept {
+		inline constexpr bool operator==(const basic_point_2d<GraphicsMath>& lhs, const basic_point_2d<GraphicsMath>& rhs) noexcept {
 			return GraphicsMath::equal(lhs.data(), rhs.data());
 		}
 		template <class GraphicsMath>
-		inline bool operator!=(const basic_point_2d<GraphicsMath>& lhs, const basic_point_2d<GraphicsMath>& rhs) noexcept {
+		inline constexpr bool operator!=(const basic_point_2d<GraphicsMath>& lhs, const basic_point_2d<GraphicsMath>& rhs) noexcept {
 			return GraphicsMath::not_equal(lhs.data(), rhs.data());
 		}
 		template <class GraphicsMath>
-		inline basic_point_2d<GraphicsMath> operator+(const basic_point_2d<GraphicsMath>& lhs) noexcept {
+		inline constexpr basic_point_2d<GraphicsMath> operator+(const basic_point_2d<GraphicsMath>& lhs) noexcept {
 			return lhs;
 		}
 		template <class GraphicsMath>
-		inline basic_point_2d<GraphicsMath> operator+(const basic_point_2d<GraphicsMath>& lhs, const basic_point_2d<GraphicsMath>& rhs) noexcept {
+		inline constexpr basic_point_2d<GraphicsMath> operator+(const basic_point_2d<GraphicsMath>& lhs, const basic_point_2d<GraphicsMath>& rhs) noexcept {
 			return basic_point_2d<GraphicsMath>(GraphicsMath::add(lhs.data(), rhs.data()));
 		}
 		template <class GraphicsMath>
-		inline basic_point_2d<GraphicsMath> operator+(const basic_point_2d<GraphicsMath>& lhs, float rhs) noexcept {
+		inline constexpr basic_point_2d<GraphicsMath> operator+(const basic_point_2d<GraphicsMath>& lhs, float rhs) noexcept {
 			return basic_point_2d<GraphicsMath>(GraphicsMath::add(lhs.data(), rhs));
 		}
 		template <class GraphicsMath>
-		inline basic_point_2d<GraphicsMath> operator+(float lhs, const basic_point_2d<GraphicsMath>& rhs) noexcept {
+		inline constexpr basic_point_2d<GraphicsMath> operator+(float lhs, const basic_point_2d<GraphicsMath>& rhs) noexcept {
 			return basic_point_2d<GraphicsMath>(GraphicsMath::add(lhs, rhs.data()));
 		}
 		template <class GraphicsMath>
-		inline basic_point_2d<GraphicsMath>& basic_point_2d<GraphicsMath>::operator+=(const basic_point_2d<GraphicsMath>& rhs) noexcept {
+		inline constexpr basic_point_2d<GraphicsMath>& basic_point_2d<GraphicsMath>::operator+=(const basic_point_2d<GraphicsMath>& rhs) noexcept {
 			_Data = GraphicsMath::add(_Data, rhs._Data);
 			return *this;
 		}
 		template <class GraphicsMath>
-		inline basic_point_2d<GraphicsMath>& basic_point_2d<GraphicsMath>::operator+=(float rhs) noexcept {
+		inline constexpr basic_point_2d<GraphicsMath>& basic_point_2d<GraphicsMath>::operator+=(float rhs) noexcept {
 			_Data = GraphicsMath::add(_Data, rhs);
 			return *this;
 		}
 		template <class GraphicsMath>
-		inline basic_point_2d<GraphicsMath> operator-(const basic_point_2d<GraphicsMath>& lhs) noexcept {
+		inline constexpr basic_point_2d<GraphicsMath> operator-(const basic_point_2d<GraphicsMath>& lhs) noexcept {
 			return basic_point_2d<GraphicsMath>(GraphicsMath::negate(lhs.data()));
 		}
 		template <class GraphicsMath>
-		inline basic_point_2d<GraphicsMath> operator-(const basic_point_2d<GraphicsMath>& lhs, const basic_point_2d<GraphicsMath>& rhs) noexcept {
+		inline constexpr basic_point_2d<GraphicsMath> operator-(const basic_point_2d<GraphicsMath>& lhs, const basic_point_2d<GraphicsMath>& rhs) noexcept {
 			return basic_point_2d<GraphicsMath>(GraphicsMath::subtract(lhs.data(), rhs.data()));
 		}
 		template <class GraphicsMath>
-		inline basic_point_2d<GraphicsMath> operator-(const basic_point_2d<GraphicsMath>& lhs, float rhs) noexcept {
+		inline constexpr basic_point_2d<GraphicsMath> operator-(const basic_point_2d<GraphicsMath>& lhs, float rhs) noexcept {
 			return basic_point_2d<GraphicsMath>(GraphicsMath::subtract(lhs.data(), rhs));
 		}
 		template <class GraphicsMath>
-		inline basic_point_2d<GraphicsMath> operator-(float lhs, const basic_point_2d<GraphicsMath>& rhs) noexcept {
+		inline constexpr basic_point_2d<GraphicsMath> operator-(float lhs, const basic_point_2d<GraphicsMath>& rhs) noexcept {
 			return basic_point_2d<GraphicsMath>(GraphicsMath::subtract(lhs, rhs.data()));
 		}
 		template <class GraphicsMath>
-		inline basic_point_2d<GraphicsMath>& basic_point_2d<GraphicsMath>::operator-=(const basic_point_2d<GraphicsMath>& rhs) noexcept {
+		inline constexpr basic_point_2d<GraphicsMath>& basic_point_2d<GraphicsMath>::operator-=(const basic_point_2d<GraphicsMath>& rhs) noexcept {
 			_Data = GraphicsMath::subtract(_Data, rhs.data());
 			return *this;
 		}
 		template <class GraphicsMath>
-		inline basic_point_2d<GraphicsMath>& basic_point_2d<GraphicsMath>::operator-=(float rhs) noexcept {
+		inline constexpr basic_point_2d<GraphicsMath>& basic_point_2d<GraphicsMath>::operator-=(float rhs) noexcept {
 			_Data = GraphicsMath::subtract(_Data, rhs);
 			return *this;
 		}
 		template <class GraphicsMath>
-		inline basic_point_2d<GraphicsMath>& basic_point_2d<GraphicsMath>::operator*=(float rhs) noexcept {
+		inline constexpr basic_point_2d<GraphicsMath>& basic_point_2d<GraphicsMath>::operator*=(float rhs) noexcept {
 			_Data = GraphicsMath::multiply(_Data, rhs);
 			return *this;
 		}
 		template <class GraphicsMath>
-		inline basic_point_2d<GraphicsMath>& basic_point_2d<GraphicsMath>::operator*=(const basic_point_2d<GraphicsMath>& rhs) noexcept {
+		inline constexpr basic_point_2d<GraphicsMath>& basic_point_2d<GraphicsMath>::operator*=(const basic_point_2d<GraphicsMath>& rhs) noexcept {
 			_Data = GraphicsMath::multiply(_Data, rhs.data());
 			return *this;
 		}
 		template <class GraphicsMath>
-		inline basic_point_2d<GraphicsMath> operator*(const basic_point_2d<GraphicsMath>& lhs, float rhs) noexcept {
+		inline constexpr basic_point_2d<GraphicsMath> operator*(const basic_point_2d<GraphicsMath>& lhs, float rhs) noexcept {
 			return basic_point_2d<GraphicsMath>(GraphicsMath::multiply(lhs.data(), rhs));
 		}
 		template <class GraphicsMath>
-		inline basic_point_2d<GraphicsMath> operator*(float lhs, const basic_point_2d<GraphicsMath>& rhs) noexcept {
+		inline constexpr basic_point_2d<GraphicsMath> operator*(float lhs, const basic_point_2d<GraphicsMath>& rhs) noexcept {
 			return basic_point_2d<GraphicsMath>(GraphicsMath::multiply(lhs, rhs.data()));
 		}
 		template <class GraphicsMath>
-		inline basic_point_2d<GraphicsMath> operator*(const basic_point_2d<GraphicsMath>& lhs, const basic_point_2d<GraphicsMath>& rhs) noexcept {
+		inline constexpr basic_point_2d<GraphicsMath> operator*(const basic_point_2d<GraphicsMath>& lhs, const basic_point_2d<GraphicsMath>& rhs) noexcept {
 			return basic_point_2d<GraphicsMath>(GraphicsMath::multiply(lhs.data(), rhs.data()));
 		}
 		template <class GraphicsMath>
-		inline basic_point_2d<GraphicsMath>& basic_point_2d<GraphicsMath>::operator/=(float rhs) noexcept {
+		inline constexpr basic_point_2d<GraphicsMath>& basic_point_2d<GraphicsMath>::operator/=(float rhs) noexcept {
 			_Data = GraphicsMath::divide(_Data, rhs);
 			return *this;
 		}
 		template <class GraphicsMath>
-		inline basic_point_2d<GraphicsMath>& basic_point_2d<GraphicsMath>::operator/=(const basic_point_2d<GraphicsMath>& rhs) noexcept {
+		inline constexpr basic_point_2d<GraphicsMath>& basic_point_2d<GraphicsMath>::operator/=(const basic_point_2d<GraphicsMath>& rhs) noexcept {
 			_Data = GraphicsMath::divide(_Data, rhs.data());
 			return *this;
 		}
 		template <class GraphicsMath>
-		inline basic_point_2d<GraphicsMath> operator/(const basic_point_2d<GraphicsMath>& lhs, float rhs) noexcept {
+		inline constexpr basic_point_2d<GraphicsMath> operator/(const basic_point_2d<GraphicsMath>& lhs, float rhs) noexcept {
 			return basic_point_2d<GraphicsMath>(GraphicsMath::divide(lhs.data(), rhs));
 		}
 		template <class GraphicsMath>
-		inline basic_point_2d<GraphicsMath> operator/(float lhs, const basic_point_2d<GraphicsMath>& rhs) noexcept {
+		inline constexpr basic_point_2d<GraphicsMath> operator/(float lhs, const basic_point_2d<GraphicsMath>& rhs) noexcept {
 			return basic_point_2d<GraphicsMath>(GraphicsMath::divide(lhs, rhs.data()));
 		}
 		template <class GraphicsMath>
-		inline basic_point_2d<GraphicsMath> operator/(const basic_point_2d<GraphicsMath>& lhs, const basic_point_2d<GraphicsMath>& rhs) noexcept {
+		inline constexpr basic_point_2d<GraphicsMath> operator/(const basic_point_2d<GraphicsMath>& lhs, const basic_point_2d<GraphicsMath>& rhs) noexcept {
 			return basic_point_2d<GraphicsMath>(GraphicsMath::divide(lhs.data(), rhs.data()));
 		}
 
@@ -172,78 +172,78 @@ namespace std::experimental::io2d {
 		//
 
 		template <class GraphicsMath>
-		inline const typename basic_matrix_2d<GraphicsMath>::data_type& basic_matrix_2d<GraphicsMath>::data() const noexcept {
+		inline constexpr const typename basic_matrix_2d<GraphicsMath>::data_type& basic_matrix_2d<GraphicsMath>::data() const noexcept {
 			return _Data;
 		}
 		template<class GraphicsMath>
-		inline typename basic_matrix_2d<GraphicsMath>::data_type& basic_matrix_2d<GraphicsMath>::data() noexcept {
+		inline constexpr typename basic_matrix_2d<GraphicsMath>::data_type& basic_matrix_2d<GraphicsMath>::data() noexcept {
 			return _Data;
 		}
 		template <class GraphicsMath>
-		inline basic_matrix_2d<GraphicsMath>::basic_matrix_2d() noexcept
+		inline constexpr basic_matrix_2d<GraphicsMath>::basic_matrix_2d() noexcept
 			: _Data(GraphicsMath::create_matrix_2d()) {}
 		template <class GraphicsMath>
-		inline basic_matrix_2d<GraphicsMath>::basic_matrix_2d(float v00, float v01, float v10, float v11, float v20, float v21) noexcept
+		inline constexpr basic_matrix_2d<GraphicsMath>::basic_matrix_2d(float v00, float v01, float v10, float v11, float v20, float v21) noexcept
 			: _Data(GraphicsMath::create_matrix_2d(v00, v01, v10, v11, v20, v21)) {
 		}
 		template <class GraphicsMath>
-		inline basic_matrix_2d<GraphicsMath>::basic_matrix_2d(const typename GraphicsMath::matrix_2d_data_type& val) noexcept
+		inline constexpr basic_matrix_2d<GraphicsMath>::basic_matrix_2d(const typename GraphicsMath::matrix_2d_data_type& val) noexcept
 			: _Data(val) {
 		}
 		template <class GraphicsMath>
-		inline void basic_matrix_2d<GraphicsMath>::m00(float val) noexcept {
+		inline constexpr void basic_matrix_2d<GraphicsMath>::m00(float val) noexcept {
 			GraphicsMath::m00(_Data, val);
 		}
 		template <class GraphicsMath>
-		inline void basic_matrix_2d<GraphicsMath>::m01(float val) noexcept {
+		inline constexpr void basic_matrix_2d<GraphicsMath>::m01(float val) noexcept {
 			GraphicsMath::m01(_Data, val);
 		}
 		template <class GraphicsMath>
-		inline void basic_matrix_2d<GraphicsMath>::m10(float val) noexcept {
+		inline constexpr void basic_matrix_2d<GraphicsMath>::m10(float val) noexcept {
 			GraphicsMath::m10(_Data, val);
 		}
 		template <class GraphicsMath>
-		inline void basic_matrix_2d<GraphicsMath>::m11(float val) noexcept {
+		inline constexpr void basic_matrix_2d<GraphicsMath>::m11(float val) noexcept {
 			GraphicsMath::m11(_Data, val);
 		}
 		template <class GraphicsMath>
-		inline void basic_matrix_2d<GraphicsMath>::m20(float val) noexcept {
+		inline constexpr void basic_matrix_2d<GraphicsMath>::m20(float val) noexcept {
 			GraphicsMath::m20(_Data, val);
 		}
 		template <class GraphicsMath>
-		inline void basic_matrix_2d<GraphicsMath>::m21(float val) noexcept {
+		inline constexpr void basic_matrix_2d<GraphicsMath>::m21(float val) noexcept {
 			GraphicsMath::m21(_Data, val);
 		}
 		template <class GraphicsMath>
-		inline float basic_matrix_2d<GraphicsMath>::m00() const noexcept {
+		inline constexpr float basic_matrix_2d<GraphicsMath>::m00() const noexcept {
 			return GraphicsMath::m00(_Data);
 		}
 		template <class GraphicsMath>
-		inline float basic_matrix_2d<GraphicsMath>::m01() const noexcept {
+		inline constexpr float basic_matrix_2d<GraphicsMath>::m01() const noexcept {
 			return GraphicsMath::m01(_Data);
 		}
 		template <class GraphicsMath>
-		inline float basic_matrix_2d<GraphicsMath>::m10() const noexcept {
+		inline constexpr float basic_matrix_2d<GraphicsMath>::m10() const noexcept {
 			return GraphicsMath::m10(_Data);
 		}
 		template <class GraphicsMath>
-		inline float basic_matrix_2d<GraphicsMath>::m11() const noexcept {
+		inline constexpr float basic_matrix_2d<GraphicsMath>::m11() const noexcept {
 			return GraphicsMath::m11(_Data);
 		}
 		template <class GraphicsMath>
-		inline float basic_matrix_2d<GraphicsMath>::m20() const noexcept {
+		inline constexpr float basic_matrix_2d<GraphicsMath>::m20() const noexcept {
 			return GraphicsMath::m20(_Data);
 		}
 		template <class GraphicsMath>
-		inline float basic_matrix_2d<GraphicsMath>::m21() const noexcept {
+		inline constexpr float basic_matrix_2d<GraphicsMath>::m21() const noexcept {
 			return GraphicsMath::m21(_Data);
 		}
 		template <class GraphicsMath>
-		inline basic_matrix_2d<GraphicsMath> basic_matrix_2d<GraphicsMath>::create_translate(const basic_point_2d<GraphicsMath>& value) noexcept {
+		inline constexpr basic_matrix_2d<GraphicsMath> basic_matrix_2d<GraphicsMath>::create_translate(const basic_point_2d<GraphicsMath>& value) noexcept {
 			return basic_matrix_2d<GraphicsMath>(GraphicsMath::create_translate(value.data()));
 		}
 		template <class GraphicsMath>
-		inline basic_matrix_2d<GraphicsMath> basic_matrix_2d<GraphicsMath>::create_scale(const basic_point_2d<GraphicsMath>& value) noexcept {
+		inline constexpr basic_matrix_2d<GraphicsMath> basic_matrix_2d<GraphicsMath>::create_scale(const basic_point_2d<GraphicsMath>& value) noexcept {
 			return basic_matrix_2d<GraphicsMath>(GraphicsMath::create_scale(value.data()));
 		}
 		template <class GraphicsMath>
@@ -259,20 +259,20 @@ namespace std::experimental::io2d {
 			return basic_matrix_2d<GraphicsMath>(GraphicsMath::create_reflect(radians));
 		}
 		template <class GraphicsMath>
-		inline basic_matrix_2d<GraphicsMath> basic_matrix_2d<GraphicsMath>::create_shear_x(float factor) noexcept {
+		inline constexpr basic_matrix_2d<GraphicsMath> basic_matrix_2d<GraphicsMath>::create_shear_x(float factor) noexcept {
 			return basic_matrix_2d<GraphicsMath>(GraphicsMath::create_shear_x(factor));
 		}
 		template <class GraphicsMath>
-		inline basic_matrix_2d<GraphicsMath> basic_matrix_2d<GraphicsMath>::create_shear_y(float factor) noexcept {
+		inline constexpr basic_matrix_2d<GraphicsMath> basic_matrix_2d<GraphicsMath>::create_shear_y(float factor) noexcept {
 			return basic_matrix_2d<GraphicsMath>(GraphicsMath::create_shear_y(factor));
 		}
 		template <class GraphicsMath>
-		inline basic_matrix_2d<GraphicsMath>& basic_matrix_2d<GraphicsMath>::translate(const basic_point_2d<GraphicsMath>& val) noexcept {
+		inline constexpr basic_matrix_2d<GraphicsMath>& basic_matrix_2d<GraphicsMath>::translate(const basic_point_2d<GraphicsMath>& val) noexcept {
 			GraphicsMath::translate(_Data, val.data());
 			return *this;
 		}
 		template <class GraphicsMath>
-		inline basic_matrix_2d<GraphicsMath>& basic_matrix_2d<GraphicsMath>::scale(const basic_point_2d<GraphicsMath>& val) noexcept {
+		inline constexpr basic_matrix_2d<GraphicsMath>& basic_matrix_2d<GraphicsMath>::scale(const basic_point_2d<GraphicsMath>& val) noexcept {
 			GraphicsMath::scale(_Data, val.data());
 			return *this;
 		}
@@ -292,100 +292,118 @@ namespace std::experimental::io2d {
 			return *this;
 		}
 		template <class GraphicsMath>
-		inline basic_matrix_2d<GraphicsMath>& basic_matrix_2d<GraphicsMath>::shear_x(float factor) noexcept {
+		inline constexpr basic_matrix_2d<GraphicsMath>& basic_matrix_2d<GraphicsMath>::shear_x(float factor) noexcept {
 			GraphicsMath::shear_x(_Data, factor);
 			return *this;
 		}
 		template <class GraphicsMath>
-		inline basic_matrix_2d<GraphicsMath>& basic_matrix_2d<GraphicsMath>::shear_y(float factor) noexcept {
+		inline constexpr basic_matrix_2d<GraphicsMath>& basic_matrix_2d<GraphicsMath>::shear_y(float factor) noexcept {
 			GraphicsMath::shear_y(_Data, factor);
 			return *this;
 		}
 		template <class GraphicsMath>
-		inline bool basic_matrix_2d<GraphicsMath>::is_invertible() const noexcept {
+		inline constexpr bool basic_matrix_2d<GraphicsMath>::is_invertible() const noexcept {
 			return GraphicsMath::is_invertible(_Data);
 		}
 		template <class GraphicsMath>
-		inline basic_matrix_2d<GraphicsMath> basic_matrix_2d<GraphicsMath>::inverse() const noexcept {
+		inline constexpr basic_matrix_2d<GraphicsMath> basic_matrix_2d<GraphicsMath>::inverse() const noexcept {
 			return basic_matrix_2d<GraphicsMath>(GraphicsMath::inverse(_Data));
 		}
 		template <class GraphicsMath>
-		inline bool basic_matrix_2d<GraphicsMath>::is_finite() const noexcept {
+		inline constexpr bool basic_matrix_2d<GraphicsMath>::is_finite() const noexcept {
 			return GraphicsMath::is_finite(_Data);
 		}
 		template <class GraphicsMath>
-		inline float basic_matrix_2d<GraphicsMath>::determinant() const noexcept {
+		inline constexpr float basic_matrix_2d<GraphicsMath>::determinant() const noexcept {
 			return GraphicsMath::determinant(_Data);
 		}
 		template <class GraphicsMath>
-		inline basic_point_2d<GraphicsMath> basic_matrix_2d<GraphicsMath>::transform_pt(const basic_point_2d<GraphicsMath>& pt) const noexcept {
+		inline constexpr basic_point_2d<GraphicsMath> basic_matrix_2d<GraphicsMath>::transform_pt(const basic_point_2d<GraphicsMath>& pt) const noexcept {
 			return basic_point_2d<GraphicsMath>(GraphicsMath::transform_pt(_Data, pt.data()));
 		}
 		template <class GraphicsMath>
-		inline basic_matrix_2d<GraphicsMath>& basic_matrix_2d<GraphicsMath>::operator*=(const basic_matrix_2d<GraphicsMath>& rhs) noexcept {
+		template <class InputIterator, class OutputIterator>
+		inline OutputIterator basic_matrix_2d<GraphicsMath>::transform_pts(InputIterator first, InputIterator last, OutputIterator result) const {
+			using point_type = basic_point_2d<GraphicsMath>;
+			using point_data_type = typename GraphicsMath::point_2d_data_type;
+			if constexpr (::std::is_pointer_v<InputIterator> && ::std::is_same_v<::std::remove_cv_t<::std::remove_pointer_t<InputIterator>>, point_type> && ::std::is_same_v<OutputIterator, point_type*>) {
+				static_assert(sizeof(point_type) == sizeof(point_data_type), "basic_point_2d must be layout compatible with its data_type.");
+				const auto count = last - first;
+				GraphicsMath::transform_pts(_Data, reinterpret_cast<const point_data_type*>(first), reinterpret_cast<const point_data_type*>(last), reinterpret_cast<point_data_type*>(result));
+				return result + count;
+			}
+			else {
+				for (; first != last; ++first, ++result) {
+					*result = point_type(GraphicsMath::transform_pt(_Data, (*first).data()));
+				}
+				return result;
+			}
+		}
+		template <class GraphicsMath>
+		inline constexpr basic_matrix_2d<GraphicsMath>& basic_matrix_2d<GraphicsMath>::operator*=(const basic_matrix_2d<GraphicsMath>& rhs) noexcept {
 			_Data = GraphicsMath::multiply(_Data, rhs._Data);
 			return *this;
 		}
 		template <class GraphicsMath>
-		inline basic_matrix_2d<GraphicsMath> operator*(const basic_matrix_2d<GraphicsMath>& lhs, const basic_matrix_2d<GraphicsMath>& rhs) noexcept {
+		inline constexpr basic_matrix_2d<GraphicsMath> operator*(const basic_matrix_2d<GraphicsMath>& lhs, const basic_matrix_2d<GraphicsMath>& rhs) noexcept {
 			return basic_matrix_2d<GraphicsMath>(GraphicsMath::multiply(lhs.data(), rhs.data()));
 		}
 		template <class GraphicsMath>
-		inline bool operator==(const basic_matrix_2d<GraphicsMath>& lhs, const basic_matrix_2d<GraphicsMath>& rhs) noexcept {
+		inline constexpr bool operator==(const basic_matrix_2d<GraphicsMath>& lhs, const basic_matrix_2d<GraphicsMath>& rhs) noexcept {
 			return GraphicsMath::equal(lhs.data(), rhs.data());
 		}
 		template <class GraphicsMath>
-		inline bool operator!=(const basic_matrix_2d<GraphicsMath>& lhs, const basic_matrix_2d<GraphicsMath>& rhs) noexcept {
+		inline constexpr bool operator!=(const basic_matrix_2d<GraphicsMath>& lhs, const basic_matrix_2d<GraphicsMath>& rhs) noexcept {
 			return GraphicsMath::not_equal(lhs.data(), rhs.data());
 		}
 		template <class GraphicsMath>
-		inline basic_point_2d<GraphicsMath> operator*(const basic_point_2d<GraphicsMath>& pt, const basic_matrix_2d<GraphicsMath>& m) noexcept {
+		inline constexpr basic_point_2d<GraphicsMath> operator*(const basic_point_2d<GraphicsMath>& pt, const basic_matrix_2d<GraphicsMath>& m) noexcept {
 			return basic_point_2d<GraphicsMath>(GraphicsMath::transform_pt(m.data(), pt.data()));
 		}
 
 		// basic_display_point
 		template <class GraphicsMath>
-		inline const typename basic_display_point<GraphicsMath>::data_type& basic_display_point<GraphicsMath>::data() const noexcept {
+		inline constexpr const typename basic_display_point<GraphicsMath>::data_type& basic_display_point<GraphicsMath>::data() const noexcept {
 			return _Data;
 		}
 		template<class GraphicsMath>
-		inline typename basic_display_point<GraphicsMath>::data_type& basic_display_point<GraphicsMath>::data() noexcept {
+		inline constexpr typename basic_display_point<GraphicsMath>::data_type& basic_display_point<GraphicsMath>::data() noexcept {
 			return _Data;
 		}
 		template <class GraphicsMath>
-		inline basic_display_point<GraphicsMath>::basic_display_point() noexcept
+		inline constexpr basic_display_point<GraphicsMath>::basic_display_point() noexcept
 			: _Data(GraphicsMath::create_display_point()) {
 		}
 		template <class GraphicsMath>
-		inline basic_display_point<GraphicsMath>::basic_display_point(int x, int y) noexcept
+		inline constexpr basic_display_point<GraphicsMath>::basic_display_point(int x, int y) noexcept
 			: _Data(GraphicsMath::create_display_point(x, y)) {
 		}
 		template <class GraphicsMath>
-		inline basic_display_point<GraphicsMath>::basic_display_point(const typename GraphicsMath::display_point_data_type& val) noexcept
+		inline constexpr basic_display_point<GraphicsMath>::basic_display_point(const typename GraphicsMath::display_point_data_type& val) noexcept
 			: _Data(val) {
 		}
 		template <class GraphicsMath>
-		inline void basic_display_point<GraphicsMath>::x(int val) noexcept {
+		inline constexpr void basic_display_point<GraphicsMath>::x(int val) noexcept {
 			GraphicsMath::x(_Data, val);
 		}
 		template <class GraphicsMath>
-		inline void basic_display_point<GraphicsMath>::y(int val) noexcept {
+		inline constexpr void basic_display_point<GraphicsMath>::y(int val) noexcept {
 			GraphicsMath::y(_Data, val);
 		}
 		template <class GraphicsMath>
-		inline int basic_display_point<GraphicsMath>::x() const noexcept {
+		inline constexpr int basic_display_point<GraphicsMath>::x() const noexcept {
 			return GraphicsMath::x(_Data);
 		}
 		template <class GraphicsMath>
-		inline int basic_display_point<GraphicsMath>::y() const noexcept {
+		inline constexpr int basic_display_point<GraphicsMath>::y() const noexcept {
 			return GraphicsMath::y(_Data);
 		}
 		template <class GraphicsMath>
-		inline bool operator==(const basic_display_point<GraphicsMath>& lhs, const basic_display_point<GraphicsMath>& rhs) noexcept {
+		inline constexpr bool operator==(const basic_display_point<GraphicsMath>& lhs, const basic_display_point<GraphicsMath>& rhs) noexcept {
 			return GraphicsMath::equal(lhs.data(), rhs.data());
 		}
 		template <class GraphicsMath>
-		inline bool operator!=(const basic_display_point<GraphicsMath>& lhs, const basic_display_point<GraphicsMath>& rhs) noexcept {
+		inline constexpr bool operator!=(const basic_display_point<GraphicsMath>& lhs, const basic_display_point<GraphicsMath>& rhs) noexcept {
 			return GraphicsMath::not_equal(lhs.data(), rhs.data());
 		}
 
@@ -399,6 +417,16 @@ namespace std::experimental::io2d {
 			return basic_point_2d<GraphicsMath>(GraphicsMath::point_for_angle(ang, rad.data()));
 		}
 
+		template <class GraphicsMath>
+		inline constexpr basic_bounding_box<GraphicsMath> unite(const basic_bounding_box<GraphicsMath>& lhs, const basic_bounding_box<GraphicsMath>& rhs) noexcept {
+			return basic_bounding_box<GraphicsMath>(GraphicsMath::unite(lhs.data(), rhs.data()));
+		}
+
+		template <class GraphicsMath>
+		inline constexpr basic_bounding_box<GraphicsMath> intersect(const basic_bounding_box<GraphicsMath>& lhs, const basic_bounding_box<GraphicsMath>& rhs) noexcept {
+			return basic_bounding_box<GraphicsMath>(GraphicsMath::intersect(lhs.data(), rhs.data()));
+		}
+
 		template <class GraphicsMath>
 		inline float angle_for_point(const basic_point_2d<GraphicsMath>& ctr, const basic_point_2d<GraphicsMath>& pt) noexcept {
 			return GraphicsMath::angle_for_point(ctr.data(), pt.data());
@@ -422,89 +450,89 @@ namespace std::experimental::io2d {
 		// GraphicsMath
 
 		template<class GraphicsMath>
-		inline const typename basic_bounding_box<GraphicsMath>::data_type& basic_bounding_box<GraphicsMath>::data() const noexcept {
+		inline constexpr const typename basic_bounding_box<GraphicsMath>::data_type& basic_bounding_box<GraphicsMath>::data() const noexcept {
 			return _Data;
 		}
 
 		template<class GraphicsMath>
-		inline typename basic_bounding_box<GraphicsMath>::data_type& basic_bounding_box<GraphicsMath>::data() noexcept {
+		inline constexpr typename basic_bounding_box<GraphicsMath>::data_type& basic_bounding_box<GraphicsMath>::data() noexcept {
 			return _Data;
 		}
 
 		template <class GraphicsMath>
-		inline basic_bounding_box<GraphicsMath>::basic_bounding_box() noexcept
+		inline constexpr basic_bounding_box<GraphicsMath>::basic_bounding_box() noexcept
 			: _Data(GraphicsMath::create_bounding_box()) { }
 		template <class GraphicsMath>
-		inline basic_bounding_box<GraphicsMath>::basic_bounding_box(float x, float y, float w, float h) noexcept
+		inline constexpr basic_bounding_box<GraphicsMath>::basic_bounding_box(float x, float y, float w, float h) noexcept
 			: _Data(GraphicsMath::create_bounding_box(x, y, w, h)) { }
 		template <class GraphicsMath>
-		inline basic_bounding_box<GraphicsMath>::basic_bounding_box(const basic_point_2d<GraphicsMath>& tl, const basic_point_2d<GraphicsMath>& br) noexcept
+		inline constexpr basic_bounding_box<GraphicsMath>::basic_bounding_box(const basic_point_2d<GraphicsMath>& tl, const basic_point_2d<GraphicsMath>& br) noexcept
 			: _Data(GraphicsMath::create_bounding_box(tl.x(), tl.y(), ::std::max(0.0f, br.x() - tl.x()), ::std::max(0.0f, br.y() - tl.y()))) { }
 		template <class GraphicsMath>
-		inline basic_bounding_box<GraphicsMath>::basic_bounding_box(const typename GraphicsMath::bounding_box_data_type& val) noexcept
+		inline constexpr basic_bounding_box<GraphicsMath>::basic_bounding_box(const typename GraphicsMath::bounding_box_data_type& val) noexcept
 			: _Data(val) { }
 		template <class GraphicsMath>
-		inline void basic_bounding_box<GraphicsMath>::x(float value) noexcept {
+		inline constexpr void basic_bounding_box<GraphicsMath>::x(float value) noexcept {
 			GraphicsMath::x(_Data, value);
 		}
 		template <class GraphicsMath>
-		inline void basic_bounding_box<GraphicsMath>::y(float value) noexcept {
+		inline constexpr void basic_bounding_box<GraphicsMath>::y(float value) noexcept {
 			GraphicsMath::y(_Data, value);
 		}
 		template <class GraphicsMath>
-		inline void basic_bounding_box<GraphicsMath>::width(float value) noexcept {
+		inline constexpr void basic_bounding_box<GraphicsMath>::width(float value) noexcept {
 			GraphicsMath::width(_Data, value);
 		}
 		template <class GraphicsMath>
-		inline void basic_bounding_box<GraphicsMath>::height(float value) noexcept {
+		inline constexpr void basic_bounding_box<GraphicsMath>::height(float value) noexcept {
 			GraphicsMath::height(_Data, value);
 		}
 		template <class GraphicsMath>
-		inline void basic_bounding_box<GraphicsMath>::top_left(const basic_point_2d<GraphicsMath>& value) noexcept {
+		inline constexpr void basic_bounding_box<GraphicsMath>::top_left(const basic_point_2d<GraphicsMath>& value) noexcept {
 			GraphicsMath::top_left(_Data, value);
 		}
 		template <class GraphicsMath>
-		inline void basic_bounding_box<GraphicsMath>::bottom_right(const basic_point_2d<GraphicsMath>& value) noexcept {
+		inline constexpr void basic_bounding_box<GraphicsMath>::bottom_right(const basic_point_2d<GraphicsMath>& value) noexcept {
 			GraphicsMath::bottom_right(_Data, value.data());
 		}
 
 		template <class GraphicsMath>
-		inline float basic_bounding_box<GraphicsMath>::x() const noexcept {
+		inline constexpr float basic_bounding_box<GraphicsMath>::x() const noexcept {
 			return GraphicsMath::x(_Data);
 		}
 
 		template <class GraphicsMath>
-		inline float basic_bounding_box<GraphicsMath>::y() const noexcept {
+		inline constexpr float basic_bounding_box<GraphicsMath>::y() const noexcept {
 			return GraphicsMath::y(_Data);
 		}
 
 		template <class GraphicsMath>
-		inline float basic_bounding_box<GraphicsMath>::width() const noexcept {
+		inline constexpr float basic_bounding_box<GraphicsMath>::width() const noexcept {
 			return GraphicsMath::width(_Data);
 		}
 
 		template <class GraphicsMath>
-		inline float basic_bounding_box<GraphicsMath>::height() const noexcept {
+		inline constexpr float basic_bounding_box<GraphicsMath>::height() const noexcept {
 			return GraphicsMath::height(_Data);
 		}
 
 		template <class GraphicsMath>
-		inline basic_point_2d<GraphicsMath> basic_bounding_box<GraphicsMath>::top_left() const noexcept {
+		inline constexpr basic_point_2d<GraphicsMath> basic_bounding_box<GraphicsMath>::top_left() const noexcept {
 			return basic_point_2d<GraphicsMath>(GraphicsMath::top_left(_Data));
 		}
 
 		template <class GraphicsMath>
-		inline basic_point_2d<GraphicsMath> basic_bounding_box<GraphicsMath>::bottom_right() const noexcept {
+		inline constexpr basic_point_2d<GraphicsMath> basic_bounding_box<GraphicsMath>::bottom_right() const noexcept {
 			return basic_point_2d<GraphicsMath>(GraphicsMath::bottom_right(_Data));
 		}
 
 		template <class GraphicsMath>
-		inline bool operator==(const basic_bounding_box<GraphicsMath>& lhs, const basic_bounding_box<GraphicsMath>& rhs)
+		inline constexpr bool operator==(const basic_bounding_box<GraphicsMath>& lhs, const basic_bounding_box<GraphicsMath>& rhs)
 			noexcept {
 			return GraphicsMath::equal(lhs.data(), rhs.data());
 		}
 		template <class GraphicsMath>
-		inline bool operator!=(const basic_bounding_box<GraphicsMath>& lhs, const basic_bounding_box<GraphicsMath>& rhs)
+		inline constexpr bool operator!=(const basic_bounding_box<GraphicsMath>& lhs, const basic_bounding_box<GraphicsMath>& rhs)
 			noexcept {
 			return GraphicsMath::not_equal(lhs.data(), rhs.data());
 		}
@@ -513,46 +541,46 @@ namespace std::experimental::io2d {
 		// basic_circle
 
 		template <class GraphicsMath>
-		inline const typename basic_circle<GraphicsMath>::data_type& basic_circle<GraphicsMath>::data() const noexcept {
+		inline constexpr const typename basic_circle<GraphicsMath>::data_type& basic_circle<GraphicsMath>::data() const noexcept {
 			return _Data;
 		}
 		template<class GraphicsMath>
-		inline typename basic_circle<GraphicsMath>::data_type& basic_circle<GraphicsMath>::data() noexcept {
+		inline constexpr typename basic_circle<GraphicsMath>::data_type& basic_circle<GraphicsMath>::data() noexcept {
 			return _Data;
 		}
 		template <class GraphicsMath>
-		inline basic_circle<GraphicsMath>::basic_circle() noexcept
+		inline constexpr basic_circle<GraphicsMath>::basic_circle() noexcept
 			: _Data(GraphicsMath::create_circle()) {}
 		template <class GraphicsMath>
-		inline basic_circle<GraphicsMath>::basic_circle(const basic_point_2d<GraphicsMath>& ctr, float r) noexcept
+		inline constexpr basic_circle<GraphicsMath>::basic_circle(const basic_point_2d<GraphicsMath>& ctr, float r) noexcept
 			: _Data(GraphicsMath::create_circle(ctr.data(), r)) {}
 		template <class GraphicsMath>
-		inline basic_circle<GraphicsMath>::basic_circle(const typename GraphicsMath::circle_data_type& val) noexcept
+		inline constexpr basic_circle<GraphicsMath>::basic_circle(const typename GraphicsMath::circle_data_type& val) noexcept
 			: _Data(val) {}
 		template <class GraphicsMath>
-		inline void basic_circle<GraphicsMath>::center(const basic_point_2d<GraphicsMath>& ctr) noexcept {
+		inline constexpr void basic_circle<GraphicsMath>::center(const basic_point_2d<GraphicsMath>& ctr) noexcept {
 			GraphicsMath::center(_Data, ctr.data());
 		}
 		template <class GraphicsMath>
-		inline void basic_circle<GraphicsMath>::radius(float r) noexcept {
+		inline constexpr void basic_circle<GraphicsMath>::radius(float r) noexcept {
 			GraphicsMath::radius(_Data, r);
 		}
 
 		template <class GraphicsMath>
-		inline basic_point_2d<GraphicsMath> basic_circle<GraphicsMath>::center() const noexcept {
+		inline constexpr basic_point_2d<GraphicsMath> basic_circle<GraphicsMath>::center() const noexcept {
 			return basic_point_2d<GraphicsMath>(GraphicsMath::center(_Data));
 		}
 		template <class GraphicsMath>
-		inline float basic_circle<GraphicsMath>::radius() const noexcept {
+		inline constexpr float basic_circle<GraphicsMath>::radius() const noexcept {
 			return GraphicsMath::radius(_Data);
 		}
 
 		template <class GraphicsMath>
-		inline bool operator==(const basic_circle<GraphicsMath>& lhs, const basic_circle<GraphicsMath>& rhs) noexcept {
+		inline constexpr bool operator==(const basic_circle<GraphicsMath>& lhs, const basic_circle<GraphicsMath>& rhs) noexcept {
 			return GraphicsMath::equal(lhs.data(), rhs.data());
 		}
 		template <class GraphicsMath>
-		inline bool operator!=(const basic_circle<GraphicsMath>& lhs, const basic_circle<GraphicsMath>& rhs) noexcept {
+		inline constexpr bool operator!=(const basic_circle<GraphicsMath>& lhs, const basic_circle<GraphicsMath>& rhs) noexcept {
 			return GraphicsMath::not_equal(lhs.data(), rhs.data());
 		}
 	}
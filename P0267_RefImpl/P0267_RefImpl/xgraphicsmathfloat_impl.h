@@ -2,37 +2,43 @@
 #include "xio2d.h"
 #include "xgraphicsmathfloat.h"
 #include <limits>
+#if defined(_IO2D_Has_SSE2)
+#include <emmintrin.h>
+#endif
+#if defined(_IO2D_Has_AVX)
+#include <immintrin.h>
+#endif
 
 namespace std::experimental::io2d {
 	inline namespace v1 {
-		inline typename _Graphics_math_float_impl::point_2d_data_type _Graphics_math_float_impl::create_point_2d() noexcept {
+		inline constexpr typename _Graphics_math_float_impl::point_2d_data_type _Graphics_math_float_impl::create_point_2d() noexcept {
 			return create_point_2d(0.0f, 0.0f);
 		}
 
-		inline typename _Graphics_math_float_impl::point_2d_data_type _Graphics_math_float_impl::create_point_2d(float x, float y) noexcept {
+		inline constexpr typename _Graphics_math_float_impl::point_2d_data_type _Graphics_math_float_impl::create_point_2d(float x, float y) noexcept {
 			auto result = _Graphics_math_float_impl::point_2d_data_type();
 			result._X = x;
 			result._Y = y;
 			return result;
 		}
 
-		inline void _Graphics_math_float_impl::x(typename _Graphics_math_float_impl::point_2d_data_type& val, float x) noexcept {
+		inline constexpr void _Graphics_math_float_impl::x(typename _Graphics_math_float_impl::point_2d_data_type& val, float x) noexcept {
 			val._X = x;
 		}
 
-		inline void _Graphics_math_float_impl::y(typename _Graphics_math_float_impl::point_2d_data_type& val, float y) noexcept {
+		inline constexpr void _Graphics_math_float_impl::y(typename _Graphics_math_float_impl::point_2d_data_type& val, float y) noexcept {
 			val._Y = y;
 		}
 
-		inline float _Graphics_math_float_impl::x(const typename _Graphics_math_float_impl::point_2d_data_type& val) noexcept {
+		inline constexpr float _Graphics_math_float_impl::x(const typename _Graphics_math_float_impl::point_2d_data_type& val) noexcept {
 			return val._X;
 		}
 
-		inline float _Graphics_math_float_impl::y(const typename _Graphics_math_float_impl::point_2d_data_type& val) noexcept {
+		inline constexpr float _Graphics_math_float_impl::y(const typename _Graphics_math_float_impl::point_2d_data_type& val) noexcept {
 			return val._Y;
 		}
 
-		inline float _Graphics_math_float_impl::dot(const typename _Graphics_math_float_impl::point_2d_data_type& a, const typename _Graphics_math_float_impl::point_2d_data_type& b) noexcept {
+		inline constexpr float _Graphics_math_float_impl::dot(const typename _Graphics_math_float_impl::point_2d_data_type& a, const typename _Graphics_math_float_impl::point_2d_data_type& b) noexcept {
 			return a._X * b._X + a._Y * b._Y;
 		}
 
@@ -40,7 +46,7 @@ namespace std::experimental::io2d {
 			return ::std::sqrt(val._X * val._X + val._Y * val._Y);
 		}
 
-		inline float _Graphics_math_float_impl::magnitude_squared(const typename _Graphics_math_float_impl::point_2d_data_type& val) noexcept {
+		inline constexpr float _Graphics_math_float_impl::magnitude_squared(const typename _Graphics_math_float_impl::point_2d_data_type& val) noexcept {
 			return val._X * val._X + val._Y * val._Y;
 		}
 
@@ -60,103 +66,103 @@ namespace std::experimental::io2d {
 			return result;
 		}
 
-		inline typename _Graphics_math_float_impl::point_2d_data_type _Graphics_math_float_impl::add(const typename _Graphics_math_float_impl::point_2d_data_type& lhs, const typename _Graphics_math_float_impl::point_2d_data_type& rhs) noexcept {
-			_Graphics_math_float_impl::point_2d_data_type result;
+		inline constexpr typename _Graphics_math_float_impl::point_2d_data_type _Graphics_math_float_impl::add(const typename _Graphics_math_float_impl::point_2d_data_type& lhs, const typename _Graphics_math_float_impl::point_2d_data_type& rhs) noexcept {
+			_Graphics_math_float_impl::point_2d_data_type result{};
 			result._X = lhs._X + rhs._X;
 			result._Y = lhs._Y + rhs._Y;
 			return result;
 		}
 
-		inline typename _Graphics_math_float_impl::point_2d_data_type _Graphics_math_float_impl::add(const typename _Graphics_math_float_impl::point_2d_data_type& lhs, float rhs) noexcept {
-			_Graphics_math_float_impl::point_2d_data_type result;
+		inline constexpr typename _Graphics_math_float_impl::point_2d_data_type _Graphics_math_float_impl::add(const typename _Graphics_math_float_impl::point_2d_data_type& lhs, float rhs) noexcept {
+			_Graphics_math_float_impl::point_2d_data_type result{};
 			result._X = lhs._X + rhs;
 			result._Y = lhs._Y + rhs;
 			return result;
 		}
 
-		inline typename _Graphics_math_float_impl::point_2d_data_type _Graphics_math_float_impl::add(float lhs, const typename _Graphics_math_float_impl::point_2d_data_type& rhs) noexcept {
-			_Graphics_math_float_impl::point_2d_data_type result;
+		inline constexpr typename _Graphics_math_float_impl::point_2d_data_type _Graphics_math_float_impl::add(float lhs, const typename _Graphics_math_float_impl::point_2d_data_type& rhs) noexcept {
+			_Graphics_math_float_impl::point_2d_data_type result{};
 			result._X = lhs + rhs._X;
 			result._Y = lhs + rhs._Y;
 			return result;
 		}
 
-		inline typename _Graphics_math_float_impl::point_2d_data_type _Graphics_math_float_impl::subtract(const typename _Graphics_math_float_impl::point_2d_data_type& lhs, const typename _Graphics_math_float_impl::point_2d_data_type& rhs) noexcept {
-			_Graphics_math_float_impl::point_2d_data_type result;
+		inline constexpr typename _Graphics_math_float_impl::point_2d_data_type _Graphics_math_float_impl::subtract(const typename _Graphics_math_float_impl::point_2d_data_type& lhs, const typename _Graphics_math_float_impl::point_2d_data_type& rhs) noexcept {
+			_Graphics_math_float_impl::point_2d_data_type result{};
 			result._X = lhs._X - rhs._X;
 			result._Y = lhs._Y - rhs._Y;
 			return result;
 		}
 
-		inline typename _Graphics_math_float_impl::point_2d_data_type _Graphics_math_float_impl::subtract(const typename _Graphics_math_float_impl::point_2d_data_type& lhs, float rhs) noexcept {
-			_Graphics_math_float_impl::point_2d_data_type result;
+		inline constexpr typename _Graphics_math_float_impl::point_2d_data_type _Graphics_math_float_impl::subtract(const typename _Graphics_math_float_impl::point_2d_data_type& lhs, float rhs) noexcept {
+			_Graphics_math_float_impl::point_2d_data_type result{};
 			result._X = lhs._X - rhs;
 			result._Y = lhs._Y - rhs;
 			return result;
 		}
 
-		inline typename _Graphics_math_float_impl::point_2d_data_type _Graphics_math_float_impl::subtract(float lhs, const typename _Graphics_math_float_impl::point_2d_data_type& rhs) noexcept {
-			_Graphics_math_float_impl::point_2d_data_type result;
+		inline constexpr typename _Graphics_math_float_impl::point_2d_data_type _Graphics_math_float_impl::subtract(float lhs, const typename _Graphics_math_float_impl::point_2d_data_type& rhs) noexcept {
+			_Graphics_math_float_impl::point_2d_data_type result{};
 			result._X = lhs - rhs._X;
 			result._Y = lhs - rhs._Y;
 			return result;
 		}
 
-		inline typename _Graphics_math_float_impl::point_2d_data_type _Graphics_math_float_impl::multiply(const typename _Graphics_math_float_impl::point_2d_data_type& lhs, const typename _Graphics_math_float_impl::point_2d_data_type& rhs) noexcept {
-			_Graphics_math_float_impl::point_2d_data_type result;
+		inline constexpr typename _Graphics_math_float_impl::point_2d_data_type _Graphics_math_float_impl::multiply(const typename _Graphics_math_float_impl::point_2d_data_type& lhs, const typename _Graphics_math_float_impl::point_2d_data_type& rhs) noexcept {
+			_Graphics_math_float_impl::point_2d_data_type result{};
 			result._X = lhs._X * rhs._X;
 			result._Y = lhs._Y * rhs._Y;
 			return result;
 		}
 
-		inline typename _Graphics_math_float_impl::point_2d_data_type _Graphics_math_float_impl::multiply(const typename _Graphics_math_float_impl::point_2d_data_type& lhs, float rhs) noexcept {
-			_Graphics_math_float_impl::point_2d_data_type result;
+		inline constexpr typename _Graphics_math_float_impl::point_2d_data_type _Graphics_math_float_impl::multiply(const typename _Graphics_math_float_impl::point_2d_data_type& lhs, float rhs) noexcept {
+			_Graphics_math_float_impl::point_2d_data_type result{};
 			result._X = lhs._X * rhs;
 			result._Y = lhs._Y * rhs;
 			return result;
 		}
 
-		inline typename _Graphics_math_float_impl::point_2d_data_type _Graphics_math_float_impl::multiply(float lhs, const typename _Graphics_math_float_impl::point_2d_data_type& rhs) noexcept {
-			_Graphics_math_float_impl::point_2d_data_type result;
+		inline constexpr typename _Graphics_math_float_impl::point_2d_data_type _Graphics_math_float_impl::multiply(float lhs, const typename _Graphics_math_float_impl::point_2d_data_type& rhs) noexcept {
+			_Graphics_math_float_impl::point_2d_data_type result{};
 			result._X = lhs * rhs._X;
 			result._Y = lhs * rhs._Y;
 			return result;
 		}
 
-		inline typename _Graphics_math_float_impl::point_2d_data_type _Graphics_math_float_impl::divide(const typename _Graphics_math_float_impl::point_2d_data_type& lhs, const typename _Graphics_math_float_impl::point_2d_data_type& rhs) noexcept {
-			_Graphics_math_float_impl::point_2d_data_type result;
+		inline constexpr typename _Graphics_math_float_impl::point_2d_data_type _Graphics_math_float_impl::divide(const typename _Graphics_math_float_impl::point_2d_data_type& lhs, const typename _Graphics_math_float_impl::point_2d_data_type& rhs) noexcept {
+			_Graphics_math_float_impl::point_2d_data_type result{};
 			result._X = lhs._X / rhs._X;
 			result._Y = lhs._Y / rhs._Y;
 			return result;
 		}
 
-		inline typename _Graphics_math_float_impl::point_2d_data_type _Graphics_math_float_impl::divide(const typename _Graphics_math_float_impl::point_2d_data_type& lhs, float rhs) noexcept {
-			_Graphics_math_float_impl::point_2d_data_type result;
+		inline constexpr typename _Graphics_math_float_impl::point_2d_data_type _Graphics_math_float_impl::divide(const typename _Graphics_math_float_impl::point_2d_data_type& lhs, float rhs) noexcept {
+			_Graphics_math_float_impl::point_2d_data_type result{};
 			result._X = lhs._X / rhs;
 			result._Y = lhs._Y / rhs;
 			return result;
 		}
 
-		inline typename _Graphics_math_float_impl::point_2d_data_type _Graphics_math_float_impl::divide(float lhs, const typename _Graphics_math_float_impl::point_2d_data_type& rhs) noexcept {
-			_Graphics_math_float_impl::point_2d_data_type result;
+		inline constexpr typename _Graphics_math_float_impl::point_2d_data_type _Graphics_math_float_impl::divide(float lhs, const typename _Graphics_math_float_impl::point_2d_data_type& rhs) noexcept {
+			_Graphics_math_float_impl::point_2d_data_type result{};
 			result._X = lhs / rhs._X;
 			result._Y = lhs / rhs._Y;
 			return result;
 		}
 
-		inline bool _Graphics_math_float_impl::equal(const typename _Graphics_math_float_impl::point_2d_data_type& lhs, const typename _Graphics_math_float_impl::point_2d_data_type& rhs) noexcept {
+		inline constexpr bool _Graphics_math_float_impl::equal(const typename _Graphics_math_float_impl::point_2d_data_type& lhs, const typename _Graphics_math_float_impl::point_2d_data_type& rhs) noexcept {
 			return lhs._X == rhs._X&& lhs._Y == rhs._Y;
 		}
 
-		inline bool _Graphics_math_float_impl::not_equal(const typename _Graphics_math_float_impl::point_2d_data_type& lhs, const typename _Graphics_math_float_impl::point_2d_data_type& rhs) noexcept {
+		inline constexpr bool _Graphics_math_float_impl::not_equal(const typename _Graphics_math_float_impl::point_2d_data_type& lhs, const typename _Graphics_math_float_impl::point_2d_data_type& rhs) noexcept {
 			return !equal(lhs, rhs);
 		}
 
-		inline typename _Graphics_math_float_impl::point_2d_data_type _Graphics_math_float_impl::negate(const typename _Graphics_math_float_impl::point_2d_data_type& val) noexcept {
+		inline constexpr typename _Graphics_math_float_impl::point_2d_data_type _Graphics_math_float_impl::negate(const typename _Graphics_math_float_impl::point_2d_data_type& val) noexcept {
 			return create_point_2d(-val._X, -val._Y);
 		}
 
-		inline typename _Graphics_math_float_impl::matrix_2d_data_type _Graphics_math_float_impl::create_matrix_2d() noexcept {
+		inline constexpr typename _Graphics_math_float_impl::matrix_2d_data_type _Graphics_math_float_impl::create_matrix_2d() noexcept {
 			auto result = matrix_2d_data_type();
 			result.m00 = 1.0f;
 			result.m01 = 0.0f;
@@ -169,7 +175,7 @@ namespace std::experimental::io2d {
 			result.m22 = 1.0f;
 			return result;
 		}
-		inline typename _Graphics_math_float_impl::matrix_2d_data_type _Graphics_math_float_impl::create_matrix_2d(float v00, float v01, float v10, float v11, float v20, float v21) noexcept {
+		inline constexpr typename _Graphics_math_float_impl::matrix_2d_data_type _Graphics_math_float_impl::create_matrix_2d(float v00, float v01, float v10, float v11, float v20, float v21) noexcept {
 			auto result = matrix_2d_data_type();
 			result.m00 = v00;
 			result.m01 = v01;
@@ -182,46 +188,46 @@ namespace std::experimental::io2d {
 			result.m22 = 1.0f;
 			return result;
 		}
-		inline void _Graphics_math_float_impl::m00(matrix_2d_data_type& mtx, float val) noexcept {
+		inline constexpr void _Graphics_math_float_impl::m00(matrix_2d_data_type& mtx, float val) noexcept {
 			mtx.m00 = val;
 		}
-		inline void _Graphics_math_float_impl::m01(matrix_2d_data_type& mtx, float val) noexcept {
+		inline constexpr void _Graphics_math_float_impl::m01(matrix_2d_data_type& mtx, float val) noexcept {
 			mtx.m01 = val;
 		}
-		inline void _Graphics_math_float_impl::m10(matrix_2d_data_type& mtx, float val) noexcept {
+		inline constexpr void _Graphics_math_float_impl::m10(matrix_2d_data_type& mtx, float val) noexcept {
 			mtx.m10 = val;
 		}
-		inline void _Graphics_math_float_impl::m11(matrix_2d_data_type& mtx, float val) noexcept {
+		inline constexpr void _Graphics_math_float_impl::m11(matrix_2d_data_type& mtx, float val) noexcept {
 			mtx.m11 = val;
 		}
-		inline void _Graphics_math_float_impl::m20(matrix_2d_data_type& mtx, float val) noexcept {
+		inline constexpr void _Graphics_math_float_impl::m20(matrix_2d_data_type& mtx, float val) noexcept {
 			mtx.m20 = val;
 		}
-		inline void _Graphics_math_float_impl::m21(matrix_2d_data_type& mtx, float val) noexcept {
+		inline constexpr void _Graphics_math_float_impl::m21(matrix_2d_data_type& mtx, float val) noexcept {
 			mtx.m21 = val;
 		}
-		inline float _Graphics_math_float_impl::m00(const matrix_2d_data_type& mtx) noexcept {
+		inline constexpr float _Graphics_math_float_impl::m00(const matrix_2d_data_type& mtx) noexcept {
 			return mtx.m00;
 		}
-		inline float _Graphics_math_float_impl::m01(const matrix_2d_data_type& mtx) noexcept {
+		inline constexpr float _Graphics_math_float_impl::m01(const matrix_2d_data_type& mtx) noexcept {
 			return mtx.m01;
 		}
-		inline float _Graphics_math_float_impl::m10(const matrix_2d_data_type& mtx) noexcept {
+		inline constexpr float _Graphics_math_float_impl::m10(const matrix_2d_data_type& mtx) noexcept {
 			return mtx.m10;
 		}
-		inline float _Graphics_math_float_impl::m11(const matrix_2d_data_type& mtx) noexcept {
+		inline constexpr float _Graphics_math_float_impl::m11(const matrix_2d_data_type& mtx) noexcept {
 			return mtx.m11;
 		}
-		inline float _Graphics_math_float_impl::m20(const matrix_2d_data_type& mtx) noexcept {
+		inline constexpr float _Graphics_math_float_impl::m20(const matrix_2d_data_type& mtx) noexcept {
 			return mtx.m20;
 		}
-		inline float _Graphics_math_float_impl::m21(const matrix_2d_data_type& mtx) noexcept {
+		inline constexpr float _Graphics_math_float_impl::m21(const matrix_2d_data_type& mtx) noexcept {
 			return mtx.m21;
 		}
-		inline typename _Graphics_math_float_impl::matrix_2d_data_type _Graphics_math_float_impl::create_translate(const typename _Graphics_math_float_impl::point_2d_data_type& val) noexcept {
+		inline constexpr typename _Graphics_math_float_impl::matrix_2d_data_type _Graphics_math_float_impl::create_translate(const typename _Graphics_math_float_impl::point_2d_data_type& val) noexcept {
 			return create_matrix_2d(1.0f, 0.0f, 0.0f, 1.0f, val._X, val._Y);
 		}
-		inline typename _Graphics_math_float_impl::matrix_2d_data_type _Graphics_math_float_impl::create_scale(const typename _Graphics_math_float_impl::point_2d_data_type& val) noexcept {
+		inline constexpr typename _Graphics_math_float_impl::matrix_2d_data_type _Graphics_math_float_impl::create_scale(const typename _Graphics_math_float_impl::point_2d_data_type& val) noexcept {
 			return create_matrix_2d(val._X, 0.0f, 0.0f, val._Y, 0.0f, 0.0f);
 		}
 		inline typename _Graphics_math_float_impl::matrix_2d_data_type _Graphics_math_float_impl::create_rotate(float radians) noexcept {
@@ -241,16 +247,16 @@ namespace std::experimental::io2d {
 			cosine = _Round_floating_point_to_zero(cosine);
 			return create_matrix_2d(cosine, sine, sine, -cosine, 0.0f, 0.0f);
 		}
-		inline typename _Graphics_math_float_impl::matrix_2d_data_type _Graphics_math_float_impl::create_shear_x(float factor) noexcept {
+		inline constexpr typename _Graphics_math_float_impl::matrix_2d_data_type _Graphics_math_float_impl::create_shear_x(float factor) noexcept {
 			return create_matrix_2d(1.0f, 0.0f, factor, 1.0f, 0.0f, 0.0f);
 		}
-		inline typename _Graphics_math_float_impl::matrix_2d_data_type _Graphics_math_float_impl::create_shear_y(float factor) noexcept {
+		inline constexpr typename _Graphics_math_float_impl::matrix_2d_data_type _Graphics_math_float_impl::create_shear_y(float factor) noexcept {
 			return create_matrix_2d(1.0f, factor, 0.0f, 1.0f, 0.0f, 0.0f);
 		}
-		inline void _Graphics_math_float_impl::translate(matrix_2d_data_type& mtx, const _Graphics_math_float_impl::point_2d_data_type& v) noexcept {
+		inline constexpr void _Graphics_math_float_impl::translate(matrix_2d_data_type& mtx, const _Graphics_math_float_impl::point_2d_data_type& v) noexcept {
 			mtx = multiply(mtx, create_translate(v));
 		}
-		inline void _Graphics_math_float_impl::scale(matrix_2d_data_type& mtx, const point_2d_data_type& scl) noexcept {
+		inline constexpr void _Graphics_math_float_impl::scale(matrix_2d_data_type& mtx, const point_2d_data_type& scl) noexcept {
 			mtx = multiply(mtx, create_scale(scl));
 		}
 		inline void _Graphics_math_float_impl::rotate(matrix_2d_data_type& mtx, float radians) noexcept {
@@ -262,20 +268,20 @@ namespace std::experimental::io2d {
 		inline void _Graphics_math_float_impl::reflect(matrix_2d_data_type& mtx, float radians) noexcept {
 			mtx = multiply(mtx, create_reflect(radians));
 		}
-		inline void _Graphics_math_float_impl::shear_x(matrix_2d_data_type& mtx, float factor) noexcept {
+		inline constexpr void _Graphics_math_float_impl::shear_x(matrix_2d_data_type& mtx, float factor) noexcept {
 			mtx = multiply(mtx, create_shear_x(factor));
 		}
-		inline void _Graphics_math_float_impl::shear_y(matrix_2d_data_type& mtx, float factor) noexcept {
+		inline constexpr void _Graphics_math_float_impl::shear_y(matrix_2d_data_type& mtx, float factor) noexcept {
 			mtx = multiply(mtx, create_shear_y(factor));
 		}
-		inline bool _Is_finite_check(float val) noexcept {
+		inline constexpr bool _Is_finite_check(float val) noexcept {
 			float infinity = ::std::numeric_limits<float>::infinity();
 			return val != infinity &&
 				val != -infinity &&
 				!(val != val);
 			// This checks for both types of NaN. Compilers are not supposed to optimize this away but there were some in the past that incorrectly did. The only way to be sure is to check the documentation and any compiler switches you may be using.
 		}
-		inline bool _Graphics_math_float_impl::is_finite(const matrix_2d_data_type& mtx) noexcept {
+		inline constexpr bool _Graphics_math_float_impl::is_finite(const matrix_2d_data_type& mtx) noexcept {
 			static_assert(::std::numeric_limits<float>::is_iec559 == true, "This implementation relies on IEEE 754 floating point behavior.");
 			return ::std::numeric_limits<float>::is_iec559 &&
 				_Is_finite_check(mtx.m00) &&
@@ -286,15 +292,15 @@ namespace std::experimental::io2d {
 				_Is_finite_check(mtx.m21);
 		}
 
-		inline bool _Graphics_math_float_impl::is_invertible(const matrix_2d_data_type& mtx) noexcept {
+		inline constexpr bool _Graphics_math_float_impl::is_invertible(const matrix_2d_data_type& mtx) noexcept {
 			return (mtx.m00 * mtx.m11 - mtx.m01 * mtx.m10) != 0.0f;
 		}
 
-		inline float _Graphics_math_float_impl::determinant(const matrix_2d_data_type& mtx) noexcept {
+		inline constexpr float _Graphics_math_float_impl::determinant(const matrix_2d_data_type& mtx) noexcept {
 			return mtx.m00 * mtx.m11 - mtx.m01 * mtx.m10;
 		}
 
-		inline _Graphics_math_float_impl::matrix_2d_data_type _Graphics_math_float_impl::inverse(const matrix_2d_data_type& mtx) noexcept {
+		inline constexpr _Graphics_math_float_impl::matrix_2d_data_type _Graphics_math_float_impl::inverse(const matrix_2d_data_type& mtx) noexcept {
 			auto inverseDeterminant = 1.0F / determinant(mtx);
 			return create_matrix_2d(
 				(mtx.m11 * 1.0F - 0.0F * mtx.m21) * inverseDeterminant,
@@ -306,13 +312,67 @@ namespace std::experimental::io2d {
 			);
 		}
 
-		inline _Graphics_math_float_impl::point_2d_data_type _Graphics_math_float_impl::transform_pt(const matrix_2d_data_type& mtx, const _Graphics_math_float_impl::point_2d_data_type& pt) noexcept {
+		inline constexpr _Graphics_math_float_impl::point_2d_data_type _Graphics_math_float_impl::transform_pt(const matrix_2d_data_type& mtx, const _Graphics_math_float_impl::point_2d_data_type& pt) noexcept {
 			auto x = _Round_floating_point_to_zero(mtx.m00 * pt._X + mtx.m10 * pt._Y + mtx.m20);
 			auto y = _Round_floating_point_to_zero(mtx.m01 * pt._X + mtx.m11 * pt._Y + mtx.m21);
 			return create_point_2d(x, y);
 		}
 
-		inline _Graphics_math_float_impl::matrix_2d_data_type _Graphics_math_float_impl::multiply(const matrix_2d_data_type& lhs, const matrix_2d_data_type& rhs) noexcept {
+#if defined(_IO2D_Has_SSE2)
+		// Vector equivalent of _Round_floating_point_to_zero.
+		inline __m128 _Round_floating_point_to_zero_m128(__m128 v) noexcept {
+			const __m128 signMask = _mm_set1_ps(-0.0F);
+			const __m128 tiny = _mm_cmplt_ps(_mm_andnot_ps(signMask, v), _mm_set1_ps(::std::numeric_limits<float>::epsilon() * 1000.0F));
+			return _mm_or_ps(_mm_andnot_ps(tiny, v), _mm_and_ps(tiny, _mm_and_ps(v, signMask)));
+		}
+#endif
+#if defined(_IO2D_Has_AVX)
+		inline __m256 _Round_floating_point_to_zero_m256(__m256 v) noexcept {
+			const __m256 signMask = _mm256_set1_ps(-0.0F);
+			const __m256 tiny = _mm256_cmp_ps(_mm256_andnot_ps(signMask, v), _mm256_set1_ps(::std::numeric_limits<float>::epsilon() * 1000.0F), _CMP_LT_OQ);
+			return _mm256_or_ps(_mm256_andnot_ps(tiny, v), _mm256_and_ps(tiny, _mm256_and_ps(v, signMask)));
+		}
+#endif
+
+		inline void _Graphics_math_float_impl::transform_pts(const matrix_2d_data_type& mtx, const point_2d_data_type* first, const point_2d_data_type* last, point_2d_data_type* result) noexcept {
+			static_assert(sizeof(point_2d_data_type) == 2 * sizeof(float), "transform_pts relies on points being packed pairs of floats.");
+			const auto count = static_cast<size_t>(last - first);
+			size_t i = 0;
+			// The third column of the matrix is always { 0, 0, 1 } so only the six affine values take part. Each lane pair holds one (x, y) point: x' = m00 * x + m10 * y + m20, y' = m01 * x + m11 * y + m21.
+#if defined(_IO2D_Has_AVX)
+			{
+				const __m256 col0 = _mm256_setr_ps(mtx.m00, mtx.m01, mtx.m00, mtx.m01, mtx.m00, mtx.m01, mtx.m00, mtx.m01);
+				const __m256 col1 = _mm256_setr_ps(mtx.m10, mtx.m11, mtx.m10, mtx.m11, mtx.m10, mtx.m11, mtx.m10, mtx.m11);
+				const __m256 trns = _mm256_setr_ps(mtx.m20, mtx.m21, mtx.m20, mtx.m21, mtx.m20, mtx.m21, mtx.m20, mtx.m21);
+				for (; i + 4 <= count; i += 4) {
+					const __m256 pts = _mm256_loadu_ps(reinterpret_cast<const float*>(first + i));
+					const __m256 xs = _mm256_moveldup_ps(pts);
+					const __m256 ys = _mm256_movehdup_ps(pts);
+					const __m256 r = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(col0, xs), _mm256_mul_ps(col1, ys)), trns);
+					_mm256_storeu_ps(reinterpret_cast<float*>(result + i), _Round_floating_point_to_zero_m256(r));
+				}
+			}
+#endif
+#if defined(_IO2D_Has_SSE2)
+			{
+				const __m128 col0 = _mm_setr_ps(mtx.m00, mtx.m01, mtx.m00, mtx.m01);
+				const __m128 col1 = _mm_setr_ps(mtx.m10, mtx.m11, mtx.m10, mtx.m11);
+				const __m128 trns = _mm_setr_ps(mtx.m20, mtx.m21, mtx.m20, mtx.m21);
+				for (; i + 2 <= count; i += 2) {
+					const __m128 pts = _mm_loadu_ps(reinterpret_cast<const float*>(first + i));
+					const __m128 xs = _mm_shuffle_ps(pts, pts, _MM_SHUFFLE(2, 2, 0, 0));
+					const __m128 ys = _mm_shuffle_ps(pts, pts, _MM_SHUFFLE(3, 3, 1, 1));
+					const __m128 r = _mm_add_ps(_mm_add_ps(_mm_mul_ps(col0, xs), _mm_mul_ps(col1, ys)), trns);
+					_mm_storeu_ps(reinterpret_cast<float*>(result + i), _Round_floating_point_to_zero_m128(r));
+				}
+			}
+#endif
+			for (; i < count; i++) {
+				result[i] = transform_pt(mtx, first[i]);
+			}
+		}
+
+		inline constexpr _Graphics_math_float_impl::matrix_2d_data_type _Graphics_math_float_impl::multiply(const matrix_2d_data_type& lhs, const matrix_2d_data_type& rhs) noexcept {
 			return create_matrix_2d(
 				(lhs.m00 * rhs.m00) + (lhs.m01 * rhs.m10),
 				(lhs.m00 * rhs.m01) + (lhs.m01 * rhs.m11),
@@ -323,123 +383,134 @@ namespace std::experimental::io2d {
 			);
 		}
 
-		inline bool _Graphics_math_float_impl::equal(const matrix_2d_data_type& lhs, const matrix_2d_data_type& rhs) noexcept {
+		inline constexpr bool _Graphics_math_float_impl::equal(const matrix_2d_data_type& lhs, const matrix_2d_data_type& rhs) noexcept {
 			return lhs.m00 == rhs.m00 && lhs.m01 == rhs.m01 &&
 				lhs.m10 == rhs.m10 && lhs.m11 == rhs.m11 &&
 				lhs.m20 == rhs.m20 && lhs.m21 == rhs.m21;
 		}
 
-		inline bool _Graphics_math_float_impl::not_equal(const matrix_2d_data_type& lhs, const matrix_2d_data_type& rhs) noexcept {
+		inline constexpr bool _Graphics_math_float_impl::not_equal(const matrix_2d_data_type& lhs, const matrix_2d_data_type& rhs) noexcept {
 			return !equal(lhs, rhs);
 		}
 
-		inline typename _Graphics_math_float_impl::display_point_data_type _Graphics_math_float_impl::create_display_point() noexcept {
+		inline constexpr typename _Graphics_math_float_impl::display_point_data_type _Graphics_math_float_impl::create_display_point() noexcept {
 			return display_point_data_type{ 0, 0 };
 		}
-		inline typename _Graphics_math_float_impl::display_point_data_type _Graphics_math_float_impl::create_display_point(int x, int y) noexcept {
+		inline constexpr typename _Graphics_math_float_impl::display_point_data_type _Graphics_math_float_impl::create_display_point(int x, int y) noexcept {
 			return display_point_data_type{ x, y };
 		}
-		inline void _Graphics_math_float_impl::x(typename _Graphics_math_float_impl::display_point_data_type& data, int x) noexcept {
+		inline constexpr void _Graphics_math_float_impl::x(typename _Graphics_math_float_impl::display_point_data_type& data, int x) noexcept {
 			data.x = x;
 		}
-		inline void _Graphics_math_float_impl::y(typename _Graphics_math_float_impl::display_point_data_type& data, int y) noexcept {
+		inline constexpr void _Graphics_math_float_impl::y(typename _Graphics_math_float_impl::display_point_data_type& data, int y) noexcept {
 			data.y = y;
 		}
-		inline int _Graphics_math_float_impl::x(const typename _Graphics_math_float_impl::display_point_data_type& data) noexcept {
+		inline constexpr int _Graphics_math_float_impl::x(const typename _Graphics_math_float_impl::display_point_data_type& data) noexcept {
 			return data.x;
 		}
-		inline int _Graphics_math_float_impl::y(const typename _Graphics_math_float_impl::display_point_data_type& data) noexcept {
+		inline constexpr int _Graphics_math_float_impl::y(const typename _Graphics_math_float_impl::display_point_data_type& data) noexcept {
 			return data.y;
 		}
-		inline bool _Graphics_math_float_impl::equal(const typename _Graphics_math_float_impl::display_point_data_type& lhs, const typename _Graphics_math_float_impl::display_point_data_type& rhs) noexcept {
+		inline constexpr bool _Graphics_math_float_impl::equal(const typename _Graphics_math_float_impl::display_point_data_type& lhs, const typename _Graphics_math_float_impl::display_point_data_type& rhs) noexcept {
 			return lhs.x == rhs.x && lhs.y == rhs.y;
 		}
-		inline bool _Graphics_math_float_impl::not_equal(const typename _Graphics_math_float_impl::display_point_data_type& lhs, const typename _Graphics_math_float_impl::display_point_data_type& rhs) noexcept {
+		inline constexpr bool _Graphics_math_float_impl::not_equal(const typename _Graphics_math_float_impl::display_point_data_type& lhs, const typename _Graphics_math_float_impl::display_point_data_type& rhs) noexcept {
 			return !(equal(lhs, rhs));
 		}
 
-		inline typename _Graphics_math_float_impl::bounding_box_data_type _Graphics_math_float_impl::create_bounding_box() noexcept {
+		inline constexpr typename _Graphics_math_float_impl::bounding_box_data_type _Graphics_math_float_impl::create_bounding_box() noexcept {
 			return bounding_box_data_type{ 0.0f, 0.0f, 0.0f, 0.0f };
 		}
-		inline typename _Graphics_math_float_impl::bounding_box_data_type _Graphics_math_float_impl::create_bounding_box(float x, float y, float width, float height) noexcept {
+		inline constexpr typename _Graphics_math_float_impl::bounding_box_data_type _Graphics_math_float_impl::create_bounding_box(float x, float y, float width, float height) noexcept {
 			return bounding_box_data_type{ x, y, width, height };
 		}
-		inline void _Graphics_math_float_impl::x(typename _Graphics_math_float_impl::bounding_box_data_type& bbox, float val) noexcept {
+		inline constexpr void _Graphics_math_float_impl::x(typename _Graphics_math_float_impl::bounding_box_data_type& bbox, float val) noexcept {
 			bbox.x = val;
 		}
-		inline void _Graphics_math_float_impl::y(typename _Graphics_math_float_impl::bounding_box_data_type& bbox, float val) noexcept {
+		inline constexpr void _Graphics_math_float_impl::y(typename _Graphics_math_float_impl::bounding_box_data_type& bbox, float val) noexcept {
 			bbox.y = val;
 		}
-		inline void _Graphics_math_float_impl::width(typename _Graphics_math_float_impl::bounding_box_data_type& bbox, float val) noexcept {
+		inline constexpr void _Graphics_math_float_impl::width(typename _Graphics_math_float_impl::bounding_box_data_type& bbox, float val) noexcept {
 			bbox.width = val;
 		}
-		inline void _Graphics_math_float_impl::height(typename _Graphics_math_float_impl::bounding_box_data_type& bbox, float val) noexcept {
+		inline constexpr void _Graphics_math_float_impl::height(typename _Graphics_math_float_impl::bounding_box_data_type& bbox, float val) noexcept {
 			bbox.height = val;
 		}
-		inline void _Graphics_math_float_impl::top_left(typename _Graphics_math_float_impl::bounding_box_data_type& bbox, const typename _Graphics_math_float_impl::point_2d_data_type& val) noexcept {
+		inline constexpr void _Graphics_math_float_impl::top_left(typename _Graphics_math_float_impl::bounding_box_data_type& bbox, const typename _Graphics_math_float_impl::point_2d_data_type& val) noexcept {
 			bbox.x = val._X;
 			bbox.y = val._Y;
 		}
-		inline void _Graphics_math_float_impl::bottom_right(typename _Graphics_math_float_impl::bounding_box_data_type& bbox, const typename _Graphics_math_float_impl::point_2d_data_type& val) noexcept {
+		inline constexpr void _Graphics_math_float_impl::bottom_right(typename _Graphics_math_float_impl::bounding_box_data_type& bbox, const typename _Graphics_math_float_impl::point_2d_data_type& val) noexcept {
 			bbox.width = ::std::max(val._X - bbox.x, 0.0f);
 			bbox.height = ::std::max(val._Y - bbox.y, 0.0f);
 		}
-		inline float _Graphics_math_float_impl::x(const typename _Graphics_math_float_impl::bounding_box_data_type& bbox) noexcept {
+		inline constexpr float _Graphics_math_float_impl::x(const typename _Graphics_math_float_impl::bounding_box_data_type& bbox) noexcept {
 			return bbox.x;
 		}
-		inline float _Graphics_math_float_impl::y(const typename _Graphics_math_float_impl::bounding_box_data_type& bbox) noexcept {
+		inline constexpr float _Graphics_math_float_impl::y(const typename _Graphics_math_float_impl::bounding_box_data_type& bbox) noexcept {
 			return bbox.y;
 		}
-		inline float _Graphics_math_float_impl::width(const typename _Graphics_math_float_impl::bounding_box_data_type& bbox) noexcept {
+		inline constexpr float _Graphics_math_float_impl::width(const typename _Graphics_math_float_impl::bounding_box_data_type& bbox) noexcept {
 			return bbox.width;
 		}
-		inline float _Graphics_math_float_impl::height(const typename _Graphics_math_float_impl::bounding_box_data_type& bbox) noexcept {
+		inline constexpr float _Graphics_math_float_impl::height(const typename _Graphics_math_float_impl::bounding_box_data_type& bbox) noexcept {
 			return bbox.height;
 		}
-		inline typename _Graphics_math_float_impl::point_2d_data_type _Graphics_math_float_impl::top_left(const typename _Graphics_math_float_impl::bounding_box_data_type& bbox) noexcept {
+		inline constexpr typename _Graphics_math_float_impl::point_2d_data_type _Graphics_math_float_impl::top_left(const typename _Graphics_math_float_impl::bounding_box_data_type& bbox) noexcept {
 			return create_point_2d(bbox.x, bbox.y);
 		}
-		inline typename _Graphics_math_float_impl::point_2d_data_type _Graphics_math_float_impl::bottom_right(const typename _Graphics_math_float_impl::bounding_box_data_type& bbox) noexcept {
+		inline constexpr typename _Graphics_math_float_impl::point_2d_data_type _Graphics_math_float_impl::bottom_right(const typename _Graphics_math_float_impl::bounding_box_data_type& bbox) noexcept {
 			return create_point_2d(bbox.x + bbox.width, bbox.y + bbox.height);
 		}
+		inline constexpr typename _Graphics_math_float_impl::bounding_box_data_type _Graphics_math_float_impl::unite(const typename _Graphics_math_float_impl::bounding_box_data_type& lhs, const typename _Graphics_math_float_impl::bounding_box_data_type& rhs) noexcept {
+			const auto x = ::std::min(lhs.x, rhs.x);
+			const auto y = ::std::min(lhs.y, rhs.y);
+			return bounding_box_data_type{ x, y, ::std::max(lhs.x + lhs.width, rhs.x + rhs.width) - x, ::std::max(lhs.y + lhs.height, rhs.y + rhs.height) - y };
+		}
+		// If the boxes do not overlap, the result has a width and/or height of zero.
+		inline constexpr typename _Graphics_math_float_impl::bounding_box_data_type _Graphics_math_float_impl::intersect(const typename _Graphics_math_float_impl::bounding_box_data_type& lhs, const typename _Graphics_math_float_impl::bounding_box_data_type& rhs) noexcept {
+			const auto x = ::std::max(lhs.x, rhs.x);
+			const auto y = ::std::max(lhs.y, rhs.y);
+			return bounding_box_data_type{ x, y, ::std::max(::std::min(lhs.x + lhs.width, rhs.x + rhs.width) - x, 0.0f), ::std::max(::std::min(lhs.y + lhs.height, rhs.y + rhs.height) - y, 0.0f) };
+		}
 
-		inline bool _Graphics_math_float_impl::equal(const typename _Graphics_math_float_impl::bounding_box_data_type& lhs, const typename _Graphics_math_float_impl::bounding_box_data_type& rhs) noexcept {
+		inline constexpr bool _Graphics_math_float_impl::equal(const typename _Graphics_math_float_impl::bounding_box_data_type& lhs, const typename _Graphics_math_float_impl::bounding_box_data_type& rhs) noexcept {
 			return lhs.x == rhs.x && lhs.y == rhs.y && lhs.width == rhs.width && lhs.height == rhs.height;
 		}
-		inline bool _Graphics_math_float_impl::not_equal(const typename _Graphics_math_float_impl::bounding_box_data_type& lhs, const typename _Graphics_math_float_impl::bounding_box_data_type& rhs) noexcept {
+		inline constexpr bool _Graphics_math_float_impl::not_equal(const typename _Graphics_math_float_impl::bounding_box_data_type& lhs, const typename _Graphics_math_float_impl::bounding_box_data_type& rhs) noexcept {
 			return !(equal(lhs, rhs));
 		}
 
-		inline typename _Graphics_math_float_impl::circle_data_type _Graphics_math_float_impl::create_circle() noexcept {
+		inline constexpr typename _Graphics_math_float_impl::circle_data_type _Graphics_math_float_impl::create_circle() noexcept {
 			return circle_data_type{ 0.0f, 0.0f, 0.0f };
 		}
-		inline typename _Graphics_math_float_impl::circle_data_type _Graphics_math_float_impl::create_circle(const typename _Graphics_math_float_impl::point_2d_data_type& ctr, float rad) noexcept {
+		inline constexpr typename _Graphics_math_float_impl::circle_data_type _Graphics_math_float_impl::create_circle(const typename _Graphics_math_float_impl::point_2d_data_type& ctr, float rad) noexcept {
 			return circle_data_type{ ctr._X, ctr._Y, rad };
 		}
-		inline void _Graphics_math_float_impl::center(typename _Graphics_math_float_impl::circle_data_type& data, const point_2d_data_type& ctr) noexcept {
+		inline constexpr void _Graphics_math_float_impl::center(typename _Graphics_math_float_impl::circle_data_type& data, const point_2d_data_type& ctr) noexcept {
 			data.x = ctr._X;
 			data.y = ctr._Y;
 		}
-		inline void _Graphics_math_float_impl::radius(typename _Graphics_math_float_impl::circle_data_type& data, float r) noexcept {
+		inline constexpr void _Graphics_math_float_impl::radius(typename _Graphics_math_float_impl::circle_data_type& data, float r) noexcept {
 			data.radius = r;
 		}
-		inline typename _Graphics_math_float_impl::point_2d_data_type _Graphics_math_float_impl::center(const typename _Graphics_math_float_impl::circle_data_type& data) noexcept {
+		inline constexpr typename _Graphics_math_float_impl::point_2d_data_type _Graphics_math_float_impl::center(const typename _Graphics_math_float_impl::circle_data_type& data) noexcept {
 			return point_2d_data_type{ data.x, data.y };
 		}
-		inline float _Graphics_math_float_impl::radius(const typename _Graphics_math_float_impl::circle_data_type& data) noexcept {
+		inline constexpr float _Graphics_math_float_impl::radius(const typename _Graphics_math_float_impl::circle_data_type& data) noexcept {
 			return data.radius;
 		}
-		inline bool _Graphics_math_float_impl::equal(const typename _Graphics_math_float_impl::circle_data_type& lhs, const typename _Graphics_math_float_impl::circle_data_type& rhs) noexcept {
+		inline constexpr bool _Graphics_math_float_impl::equal(const typename _Graphics_math_float_impl::circle_data_type& lhs, const typename _Graphics_math_float_impl::circle_data_type& rhs) noexcept {
 			return lhs.radius == rhs.radius && lhs.x == rhs.x && lhs.y == rhs.y;
 		}
-		inline bool _Graphics_math_float_impl::not_equal(const typename _Graphics_math_float_impl::circle_data_type& lhs, const typename _Graphics_math_float_impl::circle_data_type& rhs) noexcept {
+		inline constexpr bool _Graphics_math_float_impl::not_equal(const typename _Graphics_math_float_impl::circle_data_type& lhs, const typename _Graphics_math_float_impl::circle_data_type& rhs) noexcept {
 			return !(equal(lhs, rhs));
 		}
 		inline typename _Graphics_math_float_impl::point_2d_data_type _Graphics_math_float_impl::point_for_angle(float ang, float mgn) noexcept {
 			auto v = create_point_2d(mgn, 0.0f);
 			auto m = create_rotate(ang);
 			auto result = transform_pt(m, v);
-			result._X = _Round_floating_point_to_zero(result._Y);
+			result._X = _Round_floating_point_to_zero(result._X);
 			result._Y = _Round_floating_point_to_zero(result._Y);
 			return result;
 		}
@@ -449,7 +520,7 @@ namespace std::experimental::io2d {
 			auto result = transform_pt(m, v);
 			result = multiply(result, rad);
 			result._X = _Round_floating_point_to_zero(result._X);
-			result._X = _Round_floating_point_to_zero(result._Y);
+			result._Y = _Round_floating_point_to_zero(result._Y);
 			return result;
 		}
 		inline float _Graphics_math_float_impl::angle_for_point(const point_2d_data_type& ctr, const point_2d_data_type& pt) noexcept {
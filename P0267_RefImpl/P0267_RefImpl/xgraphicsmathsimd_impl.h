@@ -0,0 +1,541 @@
+#pragma once
+#include "xio2d.h"
+#include "xgraphicsmathsimd.h"
+#include <limits>
+#if defined(_IO2D_Has_SSE2)
+#include <emmintrin.h>
+#endif
+#if defined(_IO2D_Has_AVX)
+#include <immintrin.h>
+#endif
+
+#if defined(_IO2D_Has_SSE2)
+namespace std::experimental::io2d {
+	inline namespace v1 {
+		inline typename _Graphics_math_simd_impl::point_2d_data_type _Graphics_math_simd_impl::create_point_2d() noexcept {
+			return create_point_2d(0.0f, 0.0f);
+		}
+
+		inline typename _Graphics_math_simd_impl::point_2d_data_type _Graphics_math_simd_impl::create_point_2d(float x, float y) noexcept {
+			auto result = _Graphics_math_simd_impl::point_2d_data_type();
+			result._X = x;
+			result._Y = y;
+			return result;
+		}
+
+		inline void _Graphics_math_simd_impl::x(typename _Graphics_math_simd_impl::point_2d_data_type& val, float x) noexcept {
+			val._X = x;
+		}
+
+		inline void _Graphics_math_simd_impl::y(typename _Graphics_math_simd_impl::point_2d_data_type& val, float y) noexcept {
+			val._Y = y;
+		}
+
+		inline float _Graphics_math_simd_impl::x(const typename _Graphics_math_simd_impl::point_2d_data_type& val) noexcept {
+			return val._X;
+		}
+
+		inline float _Graphics_math_simd_impl::y(const typename _Graphics_math_simd_impl::point_2d_data_type& val) noexcept {
+			return val._Y;
+		}
+
+		inline float _Graphics_math_simd_impl::dot(const typename _Graphics_math_simd_impl::point_2d_data_type& a, const typename _Graphics_math_simd_impl::point_2d_data_type& b) noexcept {
+			return a._X * b._X + a._Y * b._Y;
+		}
+
+		inline float _Graphics_math_simd_impl::magnitude(const typename _Graphics_math_simd_impl::point_2d_data_type& val) noexcept {
+			return ::std::sqrt(val._X * val._X + val._Y * val._Y);
+		}
+
+		inline float _Graphics_math_simd_impl::magnitude_squared(const typename _Graphics_math_simd_impl::point_2d_data_type& val) noexcept {
+			return val._X * val._X + val._Y * val._Y;
+		}
+
+		inline float _Graphics_math_simd_impl::angular_direction(const typename _Graphics_math_simd_impl::point_2d_data_type& val) noexcept {
+			auto v = ::std::atan2(val._Y, val._X);
+			if (v < 0.0F) {
+				v += two_pi<float>;
+			}
+			return v;
+		}
+
+		inline typename _Graphics_math_simd_impl::point_2d_data_type _Graphics_math_simd_impl::to_unit(const typename _Graphics_math_simd_impl::point_2d_data_type& val) noexcept {
+			const __m128 v = _mm_castpd_ps(_mm_load_sd(reinterpret_cast<const double*>(&val)));
+			const __m128 sq = _mm_mul_ps(v, v);
+			const __m128 leng = _mm_sqrt_ss(_mm_add_ss(sq, _mm_shuffle_ps(sq, sq, _MM_SHUFFLE(1, 1, 1, 1))));
+			point_2d_data_type result;
+			_mm_store_sd(reinterpret_cast<double*>(&result), _mm_castps_pd(_mm_div_ps(v, _mm_shuffle_ps(leng, leng, _MM_SHUFFLE(0, 0, 0, 0)))));
+			return result;
+		}
+
+		inline typename _Graphics_math_simd_impl::point_2d_data_type _Graphics_math_simd_impl::add(const typename _Graphics_math_simd_impl::point_2d_data_type& lhs, const typename _Graphics_math_simd_impl::point_2d_data_type& rhs) noexcept {
+			_Graphics_math_simd_impl::point_2d_data_type result;
+			result._X = lhs._X + rhs._X;
+			result._Y = lhs._Y + rhs._Y;
+			return result;
+		}
+
+		inline typename _Graphics_math_simd_impl::point_2d_data_type _Graphics_math_simd_impl::add(const typename _Graphics_math_simd_impl::point_2d_data_type& lhs, float rhs) noexcept {
+			_Graphics_math_simd_impl::point_2d_data_type result;
+			result._X = lhs._X + rhs;
+			result._Y = lhs._Y + rhs;
+			return result;
+		}
+
+		inline typename _Graphics_math_simd_impl::point_2d_data_type _Graphics_math_simd_impl::add(float lhs, const typename _Graphics_math_simd_impl::point_2d_data_type& rhs) noexcept {
+			_Graphics_math_simd_impl::point_2d_data_type result;
+			result._X = lhs + rhs._X;
+			result._Y = lhs + rhs._Y;
+			return result;
+		}
+
+		inline typename _Graphics_math_simd_impl::point_2d_data_type _Graphics_math_simd_impl::subtract(const typename _Graphics_math_simd_impl::point_2d_data_type& lhs, const typename _Graphics_math_simd_impl::point_2d_data_type& rhs) noexcept {
+			_Graphics_math_simd_impl::point_2d_data_type result;
+			result._X = lhs._X - rhs._X;
+			result._Y = lhs._Y - rhs._Y;
+			return result;
+		}
+
+		inline typename _Graphics_math_simd_impl::point_2d_data_type _Graphics_math_simd_impl::subtract(const typename _Graphics_math_simd_impl::point_2d_data_type& lhs, float rhs) noexcept {
+			_Graphics_math_simd_impl::point_2d_data_type result;
+			result._X = lhs._X - rhs;
+			result._Y = lhs._Y - rhs;
+			return result;
+		}
+
+		inline typename _Graphics_math_simd_impl::point_2d_data_type _Graphics_math_simd_impl::subtract(float lhs, const typename _Graphics_math_simd_impl::point_2d_data_type& rhs) noexcept {
+			_Graphics_math_simd_impl::point_2d_data_type result;
+			result._X = lhs - rhs._X;
+			result._Y = lhs - rhs._Y;
+			return result;
+		}
+
+		inline typename _Graphics_math_simd_impl::point_2d_data_type _Graphics_math_simd_impl::multiply(const typename _Graphics_math_simd_impl::point_2d_data_type& lhs, const typename _Graphics_math_simd_impl::point_2d_data_type& rhs) noexcept {
+			_Graphics_math_simd_impl::point_2d_data_type result;
+			result._X = lhs._X * rhs._X;
+			result._Y = lhs._Y * rhs._Y;
+			return result;
+		}
+
+		inline typename _Graphics_math_simd_impl::point_2d_data_type _Graphics_math_simd_impl::multiply(const typename _Graphics_math_simd_impl::point_2d_data_type& lhs, float rhs) noexcept {
+			_Graphics_math_simd_impl::point_2d_data_type result;
+			result._X = lhs._X * rhs;
+			result._Y = lhs._Y * rhs;
+			return result;
+		}
+
+		inline typename _Graphics_math_simd_impl::point_2d_data_type _Graphics_math_simd_impl::multiply(float lhs, const typename _Graphics_math_simd_impl::point_2d_data_type& rhs) noexcept {
+			_Graphics_math_simd_impl::point_2d_data_type result;
+			result._X = lhs * rhs._X;
+			result._Y = lhs * rhs._Y;
+			return result;
+		}
+
+		inline typename _Graphics_math_simd_impl::point_2d_data_type _Graphics_math_simd_impl::divide(const typename _Graphics_math_simd_impl::point_2d_data_type& lhs, const typename _Graphics_math_simd_impl::point_2d_data_type& rhs) noexcept {
+			_Graphics_math_simd_impl::point_2d_data_type result;
+			result._X = lhs._X / rhs._X;
+			result._Y = lhs._Y / rhs._Y;
+			return result;
+		}
+
+		inline typename _Graphics_math_simd_impl::point_2d_data_type _Graphics_math_simd_impl::divide(const typename _Graphics_math_simd_impl::point_2d_data_type& lhs, float rhs) noexcept {
+			_Graphics_math_simd_impl::point_2d_data_type result;
+			result._X = lhs._X / rhs;
+			result._Y = lhs._Y / rhs;
+			return result;
+		}
+
+		inline typename _Graphics_math_simd_impl::point_2d_data_type _Graphics_math_simd_impl::divide(float lhs, const typename _Graphics_math_simd_impl::point_2d_data_type& rhs) noexcept {
+			_Graphics_math_simd_impl::point_2d_data_type result;
+			result._X = lhs / rhs._X;
+			result._Y = lhs / rhs._Y;
+			return result;
+		}
+
+		inline bool _Graphics_math_simd_impl::equal(const typename _Graphics_math_simd_impl::point_2d_data_type& lhs, const typename _Graphics_math_simd_impl::point_2d_data_type& rhs) noexcept {
+			return lhs._X == rhs._X&& lhs._Y == rhs._Y;
+		}
+
+		inline bool _Graphics_math_simd_impl::not_equal(const typename _Graphics_math_simd_impl::point_2d_data_type& lhs, const typename _Graphics_math_simd_impl::point_2d_data_type& rhs) noexcept {
+			return !equal(lhs, rhs);
+		}
+
+		inline typename _Graphics_math_simd_impl::point_2d_data_type _Graphics_math_simd_impl::negate(const typename _Graphics_math_simd_impl::point_2d_data_type& val) noexcept {
+			return create_point_2d(-val._X, -val._Y);
+		}
+
+		inline typename _Graphics_math_simd_impl::matrix_2d_data_type _Graphics_math_simd_impl::create_matrix_2d() noexcept {
+			return create_matrix_2d(1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f);
+		}
+		inline typename _Graphics_math_simd_impl::matrix_2d_data_type _Graphics_math_simd_impl::create_matrix_2d(float v00, float v01, float v10, float v11, float v20, float v21) noexcept {
+			auto result = matrix_2d_data_type();
+			_mm_store_ps(&result.m00, _mm_setr_ps(v00, v01, v10, v11));
+			_mm_store_ps(&result.m20, _mm_setr_ps(v20, v21, 0.0f, 0.0f));
+			return result;
+		}
+		inline void _Graphics_math_simd_impl::m00(matrix_2d_data_type& mtx, float val) noexcept {
+			mtx.m00 = val;
+		}
+		inline void _Graphics_math_simd_impl::m01(matrix_2d_data_type& mtx, float val) noexcept {
+			mtx.m01 = val;
+		}
+		inline void _Graphics_math_simd_impl::m10(matrix_2d_data_type& mtx, float val) noexcept {
+			mtx.m10 = val;
+		}
+		inline void _Graphics_math_simd_impl::m11(matrix_2d_data_type& mtx, float val) noexcept {
+			mtx.m11 = val;
+		}
+		inline void _Graphics_math_simd_impl::m20(matrix_2d_data_type& mtx, float val) noexcept {
+			mtx.m20 = val;
+		}
+		inline void _Graphics_math_simd_impl::m21(matrix_2d_data_type& mtx, float val) noexcept {
+			mtx.m21 = val;
+		}
+		inline float _Graphics_math_simd_impl::m00(const matrix_2d_data_type& mtx) noexcept {
+			return mtx.m00;
+		}
+		inline float _Graphics_math_simd_impl::m01(const matrix_2d_data_type& mtx) noexcept {
+			return mtx.m01;
+		}
+		inline float _Graphics_math_simd_impl::m10(const matrix_2d_data_type& mtx) noexcept {
+			return mtx.m10;
+		}
+		inline float _Graphics_math_simd_impl::m11(const matrix_2d_data_type& mtx) noexcept {
+			return mtx.m11;
+		}
+		inline float _Graphics_math_simd_impl::m20(const matrix_2d_data_type& mtx) noexcept {
+			return mtx.m20;
+		}
+		inline float _Graphics_math_simd_impl::m21(const matrix_2d_data_type& mtx) noexcept {
+			return mtx.m21;
+		}
+		inline typename _Graphics_math_simd_impl::matrix_2d_data_type _Graphics_math_simd_impl::create_translate(const typename _Graphics_math_simd_impl::point_2d_data_type& val) noexcept {
+			return create_matrix_2d(1.0f, 0.0f, 0.0f, 1.0f, val._X, val._Y);
+		}
+		inline typename _Graphics_math_simd_impl::matrix_2d_data_type _Graphics_math_simd_impl::create_scale(const typename _Graphics_math_simd_impl::point_2d_data_type& val) noexcept {
+			return create_matrix_2d(val._X, 0.0f, 0.0f, val._Y, 0.0f, 0.0f);
+		}
+		inline typename _Graphics_math_simd_impl::matrix_2d_data_type _Graphics_math_simd_impl::create_rotate(float radians) noexcept {
+			float sine = sin(radians);
+			float cosine = cos(radians);
+			sine = _Round_floating_point_to_zero(sine);
+			cosine = _Round_floating_point_to_zero(cosine);
+			return create_matrix_2d(cosine, -sine, sine, cosine, 0.0f, 0.0f);
+		}
+		inline typename _Graphics_math_simd_impl::matrix_2d_data_type _Graphics_math_simd_impl::create_rotate(float radians, const typename _Graphics_math_simd_impl::point_2d_data_type& origin) noexcept {
+            return multiply(multiply(create_translate(negate(origin)), create_rotate(radians)), create_translate(origin));
+		}
+		inline typename _Graphics_math_simd_impl::matrix_2d_data_type _Graphics_math_simd_impl::create_reflect(float radians) noexcept {
+			auto sine = sin(radians * 2.0f);
+			auto cosine = cos(radians * 2.0f);
+			sine = _Round_floating_point_to_zero(sine);
+			cosine = _Round_floating_point_to_zero(cosine);
+			return create_matrix_2d(cosine, sine, sine, -cosine, 0.0f, 0.0f);
+		}
+		inline typename _Graphics_math_simd_impl::matrix_2d_data_type _Graphics_math_simd_impl::create_shear_x(float factor) noexcept {
+			return create_matrix_2d(1.0f, 0.0f, factor, 1.0f, 0.0f, 0.0f);
+		}
+		inline typename _Graphics_math_simd_impl::matrix_2d_data_type _Graphics_math_simd_impl::create_shear_y(float factor) noexcept {
+			return create_matrix_2d(1.0f, factor, 0.0f, 1.0f, 0.0f, 0.0f);
+		}
+		inline void _Graphics_math_simd_impl::translate(matrix_2d_data_type& mtx, const _Graphics_math_simd_impl::point_2d_data_type& v) noexcept {
+			mtx = multiply(mtx, create_translate(v));
+		}
+		inline void _Graphics_math_simd_impl::scale(matrix_2d_data_type& mtx, const point_2d_data_type& scl) noexcept {
+			mtx = multiply(mtx, create_scale(scl));
+		}
+		inline void _Graphics_math_simd_impl::rotate(matrix_2d_data_type& mtx, float radians) noexcept {
+			mtx = multiply(mtx, create_rotate(radians));
+		}
+		inline void _Graphics_math_simd_impl::rotate(matrix_2d_data_type& mtx, float radians, const point_2d_data_type& origin) noexcept {
+			mtx = multiply(mtx, create_rotate(radians, origin));
+		}
+		inline void _Graphics_math_simd_impl::reflect(matrix_2d_data_type& mtx, float radians) noexcept {
+			mtx = multiply(mtx, create_reflect(radians));
+		}
+		inline void _Graphics_math_simd_impl::shear_x(matrix_2d_data_type& mtx, float factor) noexcept {
+			mtx = multiply(mtx, create_shear_x(factor));
+		}
+		inline void _Graphics_math_simd_impl::shear_y(matrix_2d_data_type& mtx, float factor) noexcept {
+			mtx = multiply(mtx, create_shear_y(factor));
+		}
+		inline bool _Graphics_math_simd_impl::is_finite(const matrix_2d_data_type& mtx) noexcept {
+			static_assert(::std::numeric_limits<float>::is_iec559 == true, "This implementation relies on IEEE 754 floating point behavior.");
+			return ::std::numeric_limits<float>::is_iec559 &&
+				_Is_finite_check(mtx.m00) &&
+				_Is_finite_check(mtx.m01) &&
+				_Is_finite_check(mtx.m10) &&
+				_Is_finite_check(mtx.m11) &&
+				_Is_finite_check(mtx.m20) &&
+				_Is_finite_check(mtx.m21);
+		}
+
+		inline bool _Graphics_math_simd_impl::is_invertible(const matrix_2d_data_type& mtx) noexcept {
+			return (mtx.m00 * mtx.m11 - mtx.m01 * mtx.m10) != 0.0f;
+		}
+
+		inline float _Graphics_math_simd_impl::determinant(const matrix_2d_data_type& mtx) noexcept {
+			return mtx.m00 * mtx.m11 - mtx.m01 * mtx.m10;
+		}
+
+		inline _Graphics_math_simd_impl::matrix_2d_data_type _Graphics_math_simd_impl::inverse(const matrix_2d_data_type& mtx) noexcept {
+			auto inverseDeterminant = 1.0F / determinant(mtx);
+			return create_matrix_2d(
+				(mtx.m11 * 1.0F - 0.0F * mtx.m21) * inverseDeterminant,
+				-(mtx.m01 * 1.0F - 0.0F * mtx.m21) * inverseDeterminant,
+				-(mtx.m10 * 1.0F - 0.0F * mtx.m20) * inverseDeterminant,
+				(mtx.m00 * 1.0F - 0.0F * mtx.m20) * inverseDeterminant,
+				(mtx.m10 * mtx.m21 - mtx.m11 * mtx.m20) * inverseDeterminant,
+				-(mtx.m00 * mtx.m21 - mtx.m01 * mtx.m20) * inverseDeterminant
+			);
+		}
+
+		inline _Graphics_math_simd_impl::point_2d_data_type _Graphics_math_simd_impl::transform_pt(const matrix_2d_data_type& mtx, const _Graphics_math_simd_impl::point_2d_data_type& pt) noexcept {
+			// [ m00 * x, m01 * x, m10 * y, m11 * y ], then the two halves are summed and the translation added.
+			const __m128 p = _mm_castpd_ps(_mm_load_sd(reinterpret_cast<const double*>(&pt)));
+			const __m128 prod = _mm_mul_ps(_mm_load_ps(&mtx.m00), _mm_shuffle_ps(p, p, _MM_SHUFFLE(1, 1, 0, 0)));
+			const __m128 r = _mm_add_ps(_mm_add_ps(prod, _mm_movehl_ps(prod, prod)), _mm_load_ps(&mtx.m20));
+			point_2d_data_type result;
+			_mm_store_sd(reinterpret_cast<double*>(&result), _mm_castps_pd(_Round_floating_point_to_zero_m128(r)));
+			return result;
+		}
+
+		inline void _Graphics_math_simd_impl::transform_pts(const matrix_2d_data_type& mtx, const point_2d_data_type* first, const point_2d_data_type* last, point_2d_data_type* result) noexcept {
+			static_assert(sizeof(point_2d_data_type) == 2 * sizeof(float), "transform_pts relies on points being packed pairs of floats.");
+			const auto count = static_cast<size_t>(last - first);
+			size_t i = 0;
+			const __m128 lin = _mm_load_ps(&mtx.m00);
+			const __m128 col0 = _mm_movelh_ps(lin, lin);
+			const __m128 col1 = _mm_movehl_ps(lin, lin);
+			const __m128 trns = _mm_movelh_ps(_mm_load_ps(&mtx.m20), _mm_load_ps(&mtx.m20));
+#if defined(_IO2D_Has_AVX)
+			{
+				const __m256 col0x2 = _mm256_set_m128(col0, col0);
+				const __m256 col1x2 = _mm256_set_m128(col1, col1);
+				const __m256 trnsx2 = _mm256_set_m128(trns, trns);
+				for (; i + 4 <= count; i += 4) {
+					const __m256 pts = _mm256_loadu_ps(reinterpret_cast<const float*>(first + i));
+					const __m256 r = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(col0x2, _mm256_moveldup_ps(pts)), _mm256_mul_ps(col1x2, _mm256_movehdup_ps(pts))), trnsx2);
+					_mm256_storeu_ps(reinterpret_cast<float*>(result + i), _Round_floating_point_to_zero_m256(r));
+				}
+			}
+#endif
+			for (; i + 2 <= count; i += 2) {
+				const __m128 pts = _mm_loadu_ps(reinterpret_cast<const float*>(first + i));
+				const __m128 xs = _mm_shuffle_ps(pts, pts, _MM_SHUFFLE(2, 2, 0, 0));
+				const __m128 ys = _mm_shuffle_ps(pts, pts, _MM_SHUFFLE(3, 3, 1, 1));
+				const __m128 r = _mm_add_ps(_mm_add_ps(_mm_mul_ps(col0, xs), _mm_mul_ps(col1, ys)), trns);
+				_mm_storeu_ps(reinterpret_cast<float*>(result + i), _Round_floating_point_to_zero_m128(r));
+			}
+			for (; i < count; i++) {
+				result[i] = transform_pt(mtx, first[i]);
+			}
+		}
+
+		inline _Graphics_math_simd_impl::matrix_2d_data_type _Graphics_math_simd_impl::multiply(const matrix_2d_data_type& lhs, const matrix_2d_data_type& rhs) noexcept {
+			// Each row of lhs is [ a, b ]; the matching row of the result is a * [ rhs.m00, rhs.m01 ] + b * [ rhs.m10, rhs.m11 ], plus the rhs translation for the last row.
+			const __m128 lLin = _mm_load_ps(&lhs.m00);
+			const __m128 lTrns = _mm_load_ps(&lhs.m20);
+			const __m128 rLin = _mm_load_ps(&rhs.m00);
+			const __m128 rRow0 = _mm_movelh_ps(rLin, rLin);
+			const __m128 rRow1 = _mm_movehl_ps(rLin, rLin);
+			const __m128 lin = _mm_add_ps(_mm_mul_ps(_mm_shuffle_ps(lLin, lLin, _MM_SHUFFLE(2, 2, 0, 0)), rRow0), _mm_mul_ps(_mm_shuffle_ps(lLin, lLin, _MM_SHUFFLE(3, 3, 1, 1)), rRow1));
+			const __m128 trns = _mm_add_ps(_mm_add_ps(_mm_mul_ps(_mm_shuffle_ps(lTrns, lTrns, _MM_SHUFFLE(0, 0, 0, 0)), rRow0), _mm_mul_ps(_mm_shuffle_ps(lTrns, lTrns, _MM_SHUFFLE(1, 1, 1, 1)), rRow1)), _mm_load_ps(&rhs.m20));
+			auto result = matrix_2d_data_type();
+			_mm_store_ps(&result.m00, lin);
+			_mm_store_ps(&result.m20, _mm_movelh_ps(trns, _mm_setzero_ps()));
+			return result;
+		}
+
+		inline bool _Graphics_math_simd_impl::equal(const matrix_2d_data_type& lhs, const matrix_2d_data_type& rhs) noexcept {
+			const __m128 eq = _mm_and_ps(_mm_cmpeq_ps(_mm_load_ps(&lhs.m00), _mm_load_ps(&rhs.m00)), _mm_cmpeq_ps(_mm_load_ps(&lhs.m20), _mm_load_ps(&rhs.m20)));
+			return _mm_movemask_ps(eq) == 0xF;
+		}
+
+		inline bool _Graphics_math_simd_impl::not_equal(const matrix_2d_data_type& lhs, const matrix_2d_data_type& rhs) noexcept {
+			return !equal(lhs, rhs);
+		}
+
+		inline typename _Graphics_math_simd_impl::display_point_data_type _Graphics_math_simd_impl::create_display_point() noexcept {
+			return display_point_data_type{ 0, 0 };
+		}
+		inline typename _Graphics_math_simd_impl::display_point_data_type _Graphics_math_simd_impl::create_display_point(int x, int y) noexcept {
+			return display_point_data_type{ x, y };
+		}
+		inline void _Graphics_math_simd_impl::x(typename _Graphics_math_simd_impl::display_point_data_type& data, int x) noexcept {
+			data.x = x;
+		}
+		inline void _Graphics_math_simd_impl::y(typename _Graphics_math_simd_impl::display_point_data_type& data, int y) noexcept {
+			data.y = y;
+		}
+		inline int _Graphics_math_simd_impl::x(const typename _Graphics_math_simd_impl::display_point_data_type& data) noexcept {
+			return data.x;
+		}
+		inline int _Graphics_math_simd_impl::y(const typename _Graphics_math_simd_impl::display_point_data_type& data) noexcept {
+			return data.y;
+		}
+		inline bool _Graphics_math_simd_impl::equal(const typename _Graphics_math_simd_impl::display_point_data_type& lhs, const typename _Graphics_math_simd_impl::display_point_data_type& rhs) noexcept {
+			return lhs.x == rhs.x && lhs.y == rhs.y;
+		}
+		inline bool _Graphics_math_simd_impl::not_equal(const typename _Graphics_math_simd_impl::display_point_data_type& lhs, const typename _Graphics_math_simd_impl::display_point_data_type& rhs) noexcept {
+			return !(equal(lhs, rhs));
+		}
+
+		inline typename _Graphics_math_simd_impl::bounding_box_data_type _Graphics_math_simd_impl::create_bounding_box() noexcept {
+			return bounding_box_data_type{ 0.0f, 0.0f, 0.0f, 0.0f };
+		}
+		inline typename _Graphics_math_simd_impl::bounding_box_data_type _Graphics_math_simd_impl::create_bounding_box(float x, float y, float width, float height) noexcept {
+			return bounding_box_data_type{ x, y, width, height };
+		}
+		inline void _Graphics_math_simd_impl::x(typename _Graphics_math_simd_impl::bounding_box_data_type& bbox, float val) noexcept {
+			bbox.x = val;
+		}
+		inline void _Graphics_math_simd_impl::y(typename _Graphics_math_simd_impl::bounding_box_data_type& bbox, float val) noexcept {
+			bbox.y = val;
+		}
+		inline void _Graphics_math_simd_impl::width(typename _Graphics_math_simd_impl::bounding_box_data_type& bbox, float val) noexcept {
+			bbox.width = val;
+		}
+		inline void _Graphics_math_simd_impl::height(typename _Graphics_math_simd_impl::bounding_box_data_type& bbox, float val) noexcept {
+			bbox.height = val;
+		}
+		inline void _Graphics_math_simd_impl::top_left(typename _Graphics_math_simd_impl::bounding_box_data_type& bbox, const typename _Graphics_math_simd_impl::point_2d_data_type& val) noexcept {
+			bbox.x = val._X;
+			bbox.y = val._Y;
+		}
+		inline void _Graphics_math_simd_impl::bottom_right(typename _Graphics_math_simd_impl::bounding_box_data_type& bbox, const typename _Graphics_math_simd_impl::point_2d_data_type& val) noexcept {
+			bbox.width = ::std::max(val._X - bbox.x, 0.0f);
+			bbox.height = ::std::max(val._Y - bbox.y, 0.0f);
+		}
+		inline float _Graphics_math_simd_impl::x(const typename _Graphics_math_simd_impl::bounding_box_data_type& bbox) noexcept {
+			return bbox.x;
+		}
+		inline float _Graphics_math_simd_impl::y(const typename _Graphics_math_simd_impl::bounding_box_data_type& bbox) noexcept {
+			return bbox.y;
+		}
+		inline float _Graphics_math_simd_impl::width(const typename _Graphics_math_simd_impl::bounding_box_data_type& bbox) noexcept {
+			return bbox.width;
+		}
+		inline float _Graphics_math_simd_impl::height(const typename _Graphics_math_simd_impl::bounding_box_data_type& bbox) noexcept {
+			return bbox.height;
+		}
+		inline typename _Graphics_math_simd_impl::point_2d_data_type _Graphics_math_simd_impl::top_left(const typename _Graphics_math_simd_impl::bounding_box_data_type& bbox) noexcept {
+			return create_point_2d(bbox.x, bbox.y);
+		}
+		inline typename _Graphics_math_simd_impl::point_2d_data_type _Graphics_math_simd_impl::bottom_right(const typename _Graphics_math_simd_impl::bounding_box_data_type& bbox) noexcept {
+			return create_point_2d(bbox.x + bbox.width, bbox.y + bbox.height);
+		}
+		// Converts [ x, y, width, height ] to [ left, top, right, bottom ].
+		inline __m128 _Bounding_box_to_edges_m128(__m128 bbox) noexcept {
+			return _mm_add_ps(bbox, _mm_movelh_ps(_mm_setzero_ps(), bbox));
+		}
+		// Converts [ left, top, right, bottom ] to [ x, y, width, height ], clamping negative extents to zero.
+		inline __m128 _Edges_to_bounding_box_m128(__m128 edges) noexcept {
+			const __m128 extents = _mm_max_ps(_mm_sub_ps(edges, _mm_movelh_ps(edges, edges)), _mm_setzero_ps());
+			return _mm_shuffle_ps(edges, extents, _MM_SHUFFLE(3, 2, 1, 0));
+		}
+		inline typename _Graphics_math_simd_impl::bounding_box_data_type _Graphics_math_simd_impl::unite(const typename _Graphics_math_simd_impl::bounding_box_data_type& lhs, const typename _Graphics_math_simd_impl::bounding_box_data_type& rhs) noexcept {
+			const __m128 l = _Bounding_box_to_edges_m128(_mm_load_ps(&lhs.x));
+			const __m128 r = _Bounding_box_to_edges_m128(_mm_load_ps(&rhs.x));
+			const __m128 edges = _mm_shuffle_ps(_mm_min_ps(l, r), _mm_max_ps(l, r), _MM_SHUFFLE(3, 2, 1, 0));
+			bounding_box_data_type result;
+			_mm_store_ps(&result.x, _Edges_to_bounding_box_m128(edges));
+			return result;
+		}
+		// If the boxes do not overlap, the result has a width and/or height of zero.
+		inline typename _Graphics_math_simd_impl::bounding_box_data_type _Graphics_math_simd_impl::intersect(const typename _Graphics_math_simd_impl::bounding_box_data_type& lhs, const typename _Graphics_math_simd_impl::bounding_box_data_type& rhs) noexcept {
+			const __m128 l = _Bounding_box_to_edges_m128(_mm_load_ps(&lhs.x));
+			const __m128 r = _Bounding_box_to_edges_m128(_mm_load_ps(&rhs.x));
+			const __m128 edges = _mm_shuffle_ps(_mm_max_ps(l, r), _mm_min_ps(l, r), _MM_SHUFFLE(3, 2, 1, 0));
+			bounding_box_data_type result;
+			_mm_store_ps(&result.x, _Edges_to_bounding_box_m128(edges));
+			return result;
+		}
+
+		inline bool _Graphics_math_simd_impl::equal(const typename _Graphics_math_simd_impl::bounding_box_data_type& lhs, const typename _Graphics_math_simd_impl::bounding_box_data_type& rhs) noexcept {
+			return _mm_movemask_ps(_mm_cmpeq_ps(_mm_load_ps(&lhs.x), _mm_load_ps(&rhs.x))) == 0xF;
+		}
+		inline bool _Graphics_math_simd_impl::not_equal(const typename _Graphics_math_simd_impl::bounding_box_data_type& lhs, const typename _Graphics_math_simd_impl::bounding_box_data_type& rhs) noexcept {
+			return !(equal(lhs, rhs));
+		}
+
+		inline typename _Graphics_math_simd_impl::circle_data_type _Graphics_math_simd_impl::create_circle() noexcept {
+			return circle_data_type{ 0.0f, 0.0f, 0.0f, 0.0f };
+		}
+		inline typename _Graphics_math_simd_impl::circle_data_type _Graphics_math_simd_impl::create_circle(const typename _Graphics_math_simd_impl::point_2d_data_type& ctr, float rad) noexcept {
+			return circle_data_type{ ctr._X, ctr._Y, rad, 0.0f };
+		}
+		inline void _Graphics_math_simd_impl::center(typename _Graphics_math_simd_impl::circle_data_type& data, const point_2d_data_type& ctr) noexcept {
+			data.x = ctr._X;
+			data.y = ctr._Y;
+		}
+		inline void _Graphics_math_simd_impl::radius(typename _Graphics_math_simd_impl::circle_data_type& data, float r) noexcept {
+			data.radius = r;
+		}
+		inline typename _Graphics_math_simd_impl::point_2d_data_type _Graphics_math_simd_impl::center(const typename _Graphics_math_simd_impl::circle_data_type& data) noexcept {
+			return point_2d_data_type{ data.x, data.y };
+		}
+		inline float _Graphics_math_simd_impl::radius(const typename _Graphics_math_simd_impl::circle_data_type& data) noexcept {
+			return data.radius;
+		}
+		inline bool _Graphics_math_simd_impl::equal(const typename _Graphics_math_simd_impl::circle_data_type& lhs, const typename _Graphics_math_simd_impl::circle_data_type& rhs) noexcept {
+			return lhs.radius == rhs.radius && lhs.x == rhs.x && lhs.y == rhs.y;
+		}
+		inline bool _Graphics_math_simd_impl::not_equal(const typename _Graphics_math_simd_impl::circle_data_type& lhs, const typename _Graphics_math_simd_impl::circle_data_type& rhs) noexcept {
+			return !(equal(lhs, rhs));
+		}
+		inline typename _Graphics_math_simd_impl::point_2d_data_type _Graphics_math_simd_impl::point_for_angle(float ang, float mgn) noexcept {
+			auto v = create_point_2d(mgn, 0.0f);
+			auto m = create_rotate(ang);
+			auto result = transform_pt(m, v);
+			result._X = _Round_floating_point_to_zero(result._X);
+			result._Y = _Round_floating_point_to_zero(result._Y);
+			return result;
+		}
+		inline typename _Graphics_math_simd_impl::point_2d_data_type _Graphics_math_simd_impl::point_for_angle(float ang, const point_2d_data_type& rad) noexcept {
+			auto v = create_point_2d(1.0f, 0.0f);
+			auto m = create_rotate(ang);
+			auto result = transform_pt(m, v);
+			result = multiply(result, rad);
+			result._X = _Round_floating_point_to_zero(result._X);
+			result._Y = _Round_floating_point_to_zero(result._Y);
+			return result;
+		}
+		inline float _Graphics_math_simd_impl::angle_for_point(const point_2d_data_type& ctr, const point_2d_data_type& pt) noexcept {
+			auto xDiff = pt._X - ctr._X;
+			auto yDiff = -(pt._Y - ctr._Y);
+			auto angle = atan2(yDiff, xDiff);
+			const float oneThousandthOfADegreeInRads = pi<float> / 180'000.0F;
+			if ((abs(angle) < oneThousandthOfADegreeInRads) || abs(angle - two_pi<float>) < oneThousandthOfADegreeInRads) {
+				return 0.0F;
+			}
+			if (angle < 0.0F) {
+				return angle + two_pi<float>;
+			}
+			return angle;
+		}
+		inline typename _Graphics_math_simd_impl::point_2d_data_type _Graphics_math_simd_impl::arc_start(const point_2d_data_type& ctr, float sang, const point_2d_data_type& rad, const matrix_2d_data_type& m) noexcept {
+			auto lmtx = m;
+			lmtx.m20 = 0.0f; lmtx.m21 = 0.0f; // Eliminate translation.
+			auto pt = point_for_angle(sang, rad);
+			//return ctr + pt * lmtx;
+			return add(ctr, transform_pt(lmtx, pt));
+		}
+		inline typename _Graphics_math_simd_impl::point_2d_data_type _Graphics_math_simd_impl::arc_center(const point_2d_data_type& cpt, float sang, const point_2d_data_type& rad, const matrix_2d_data_type& m) noexcept {
+			auto lmtx = m;
+			lmtx.m20 = 0.0f; lmtx.m21 = 0.0f; // Eliminate translation.
+			auto centerOffset = point_for_angle(two_pi<float> -sang, rad);
+			centerOffset._Y = -centerOffset._Y;
+			return subtract(cpt, transform_pt(lmtx, centerOffset));
+		}
+		inline typename _Graphics_math_simd_impl::point_2d_data_type _Graphics_math_simd_impl::arc_end(const point_2d_data_type& cpt, float eang, const point_2d_data_type& rad, const matrix_2d_data_type& m) noexcept {
+			auto lmtx = m;
+			auto tfrm = create_rotate(eang);
+			lmtx.m20 = 0.0f; lmtx.m21 = 0.0f; // Eliminate translation.
+			auto pt = transform_pt(tfrm, rad);
+			pt._Y = -pt._Y;
+			return add(cpt, transform_pt(lmtx, pt));
+		}
+	}
+}
+#endif
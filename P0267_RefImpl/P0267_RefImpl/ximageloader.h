@@ -0,0 +1,82 @@
+#pragma once
+#include "xio2d.h"
+#include "xsurfaces.h"
+#include <condition_variable>
+#include <deque>
+#include <future>
+#include <thread>
+
+namespace std::experimental::io2d {
+	inline namespace v1 {
+		// One thread that runs read tasks in order and a number of threads that run decode tasks. Read tasks hand their results to decode tasks
+		// through decode(), which waits while the decode queue is full so that files are not read far ahead of the decoders. The destructor runs
+		// every queued task before joining the threads.
+		class _Image_load_queue {
+			::std::mutex _Mutex;
+			::std::condition_variable _Read_ready;
+			::std::condition_variable _Decode_ready;
+			::std::condition_variable _Decode_space;
+			::std::deque<::std::function<void()>> _Reads;
+			::std::deque<::std::function<void()>> _Decodes;
+			size_t _Decode_limit;
+			unsigned int _Decode_threads;
+			bool _Stopping = false;
+			bool _Reads_finished = false;
+			::std::vector<::std::thread> _Threads;
+
+			void _Read_loop();
+			void _Decode_loop();
+			void _Stop() noexcept;
+		public:
+			explicit _Image_load_queue(unsigned int decodeThreads);
+			_Image_load_queue(const _Image_load_queue&) = delete;
+			_Image_load_queue& operator=(const _Image_load_queue&) = delete;
+			~_Image_load_queue() noexcept;
+
+			unsigned int decode_threads() const noexcept;
+			void read(::std::function<void()> task);
+			// wait is true for read tasks, which wait for room in the decode queue. Images that are already in memory are queued at once.
+			void decode(::std::function<void()> task, bool wait);
+		};
+
+		// Loads images on a pool of threads instead of the calling thread. Files are read one at a time by a reading thread while
+		// decode_threads() threads decode the images that have already been read, so reading overlaps decoding and disks are not asked for many
+		// files at once. At most twice as many images as there are decoding threads wait in memory to be decoded.
+		//
+		// Every load returns a future for the image, or instead calls done with that future, already ready, on one of the loader's threads; done
+		// must not throw. Errors are reported through the future as the exceptions the basic_image_surface constructors throw. The destructor waits
+		// for every load that was already requested.
+		//
+		// A loader that has been moved from has no threads: decode_threads() returns 0 and load throws a system_error with
+		// errc::operation_not_permitted until another loader is move-assigned to it.
+		template <class GraphicsSurfaces>
+		class basic_image_loader {
+			::std::unique_ptr<_Image_load_queue> _Queue;
+
+			_Image_load_queue& _Load_queue();
+		public:
+			using image_type = basic_image_surface<GraphicsSurfaces>;
+			using done_function = ::std::function<void(::std::future<image_type>)>;
+
+			// Zero decoding threads means one for each hardware thread.
+			explicit basic_image_loader(unsigned int decodeThreads = 0);
+			basic_image_loader(basic_image_loader&&) noexcept = default;
+			basic_image_loader& operator=(basic_image_loader&&) noexcept = default;
+
+			unsigned int decode_threads() const noexcept;
+
+#ifdef _Filesystem_support_test
+			::std::future<image_type> load(filesystem::path p, image_file_format iff, io2d::format fmt);
+			void load(filesystem::path p, image_file_format iff, io2d::format fmt, done_function done);
+			::std::vector<::std::future<image_type>> load(const ::std::vector<filesystem::path>& paths, image_file_format iff, io2d::format fmt);
+#else
+			::std::future<image_type> load(::std::string f, image_file_format iff, io2d::format fmt);
+			void load(::std::string f, image_file_format iff, io2d::format fmt, done_function done);
+			::std::vector<::std::future<image_type>> load(const ::std::vector<::std::string>& files, image_file_format iff, io2d::format fmt);
+#endif
+			// Decodes an image file that is already in memory.
+			::std::future<image_type> load(::std::vector<::std::byte> bytes, image_file_format iff, io2d::format fmt);
+			void load(::std::vector<::std::byte> bytes, image_file_format iff, io2d::format fmt, done_function done);
+		};
+	}
+}
@@ -0,0 +1,248 @@
+#pragma once
+#include "ximageloader.h"
+#include <fstream>
+
+namespace std::experimental::io2d {
+	inline namespace v1 {
+		inline _Image_load_queue::_Image_load_queue(unsigned int decodeThreads)
+			: _Decode_limit(0)
+			, _Decode_threads(decodeThreads != 0 ? decodeThreads : ::std::max(::std::thread::hardware_concurrency(), 1u)) {
+			_Decode_limit = static_cast<size_t>(_Decode_threads) * 2;
+			try {
+				_Threads.emplace_back([this] { _Read_loop(); });
+				for (unsigned int i = 0; i < _Decode_threads; ++i) {
+					_Threads.emplace_back([this] { _Decode_loop(); });
+				}
+			}
+			catch (...) {
+				_Stop();
+				throw;
+			}
+		}
+
+		inline _Image_load_queue::~_Image_load_queue() noexcept {
+			_Stop();
+		}
+
+		inline void _Image_load_queue::_Stop() noexcept {
+			{
+				lock_guard<mutex> lock(_Mutex);
+				_Stopping = true;
+			}
+			_Read_ready.notify_all();
+			_Decode_ready.notify_all();
+			for (auto& thread : _Threads) {
+				if (thread.joinable()) {
+					thread.join();
+				}
+			}
+		}
+
+		inline void _Image_load_queue::_Read_loop() {
+			for (;;) {
+				::std::function<void()> task;
+				{
+					unique_lock<mutex> lock(_Mutex);
+					_Read_ready.wait(lock, [this] { return _Stopping || !_Reads.empty(); });
+					if (_Reads.empty()) {
+						_Reads_finished = true;
+						_Decode_ready.notify_all();
+						return;
+					}
+					task = move(_Reads.front());
+					_Reads.pop_front();
+				}
+				task();
+			}
+		}
+
+		// Decoding threads keep going after the loader starts stopping until the reading thread has queued its last decode.
+		inline void _Image_load_queue::_Decode_loop() {
+			for (;;) {
+				::std::function<void()> task;
+				{
+					unique_lock<mutex> lock(_Mutex);
+					_Decode_ready.wait(lock, [this] { return !_Decodes.empty() || (_Stopping && _Reads_finished); });
+					if (_Decodes.empty()) {
+						return;
+					}
+					task = move(_Decodes.front());
+					_Decodes.pop_front();
+				}
+				_Decode_space.notify_one();
+				task();
+			}
+		}
+
+		inline unsigned int _Image_load_queue::decode_threads() const noexcept {
+			return _Decode_threads;
+		}
+
+		inline void _Image_load_queue::read(::std::function<void()> task) {
+			{
+				lock_guard<mutex> lock(_Mutex);
+				_Reads.push_back(move(task));
+			}
+			_Read_ready.notify_one();
+		}
+
+		inline void _Image_load_queue::decode(::std::function<void()> task, bool wait) {
+			{
+				unique_lock<mutex> lock(_Mutex);
+				if (wait) {
+					_Decode_space.wait(lock, [this] { return _Decodes.size() < _Decode_limit; });
+				}
+				_Decodes.push_back(move(task));
+			}
+			_Decode_ready.notify_one();
+		}
+
+		inline ::std::vector<::std::byte> _Read_image_file(const ::std::string& f) {
+			::std::ifstream ifs(f, ::std::ios::binary | ::std::ios::ate);
+			if (!ifs) {
+				throw ::std::system_error(::std::make_error_code(::std::errc::no_such_file_or_directory), "Could not open the image file.");
+			}
+			const auto size = ifs.tellg();
+			if (size < 0) {
+				throw ::std::system_error(::std::make_error_code(::std::errc::io_error), "Could not read the image file.");
+			}
+			::std::vector<::std::byte> bytes(static_cast<size_t>(size));
+			ifs.seekg(0);
+			ifs.read(reinterpret_cast<char*>(bytes.data()), static_cast<::std::streamsize>(size));
+			if (!ifs) {
+				throw ::std::system_error(::std::make_error_code(::std::errc::io_error), "Could not read the image file.");
+			}
+			return bytes;
+		}
+
+		// The state of one load, shared by the tasks that carry it out.
+		template <class GraphicsSurfaces>
+		struct _Image_load {
+			::std::promise<basic_image_surface<GraphicsSurfaces>> result;
+			// Set for loads that report to a function instead of returning the future, which is then kept here until the image is ready.
+			typename basic_image_loader<GraphicsSurfaces>::done_function done;
+			::std::future<basic_image_surface<GraphicsSurfaces>> future;
+
+			void finish() noexcept {
+				if (done) {
+					done(move(future));
+				}
+			}
+			void decode(const ::std::vector<::std::byte>& bytes, image_file_format iff, io2d::format fmt) noexcept {
+				try {
+					result.set_value(basic_image_surface<GraphicsSurfaces>(bytes.data(), bytes.size(), iff, fmt));
+				}
+				catch (...) {
+					result.set_exception(::std::current_exception());
+				}
+				finish();
+			}
+			void fail(::std::exception_ptr e) noexcept {
+				result.set_exception(e);
+				finish();
+			}
+		};
+
+		template <class GraphicsSurfaces>
+		void _Queue_image_read(_Image_load_queue& queue, ::std::string f, image_file_format iff, io2d::format fmt, const ::std::shared_ptr<_Image_load<GraphicsSurfaces>>& load) {
+			queue.read([&queue, f = move(f), iff, fmt, load]() {
+				try {
+					auto bytes = make_shared<::std::vector<::std::byte>>(_Read_image_file(f));
+					queue.decode([bytes, iff, fmt, load]() { load->decode(*bytes, iff, fmt); }, true);
+				}
+				catch (...) {
+					load->fail(::std::current_exception());
+				}
+			});
+		}
+
+		template <class GraphicsSurfaces>
+		void _Queue_image_decode(_Image_load_queue& queue, ::std::vector<::std::byte>&& bytes, image_file_format iff, io2d::format fmt, const ::std::shared_ptr<_Image_load<GraphicsSurfaces>>& load) {
+			auto shared = make_shared<::std::vector<::std::byte>>(move(bytes));
+			queue.decode([shared, iff, fmt, load]() { load->decode(*shared, iff, fmt); }, false);
+		}
+
+		template <class GraphicsSurfaces>
+		basic_image_loader<GraphicsSurfaces>::basic_image_loader(unsigned int decodeThreads)
+			: _Queue(make_unique<_Image_load_queue>(decodeThreads)) {
+		}
+
+		template <class GraphicsSurfaces>
+		_Image_load_queue& basic_image_loader<GraphicsSurfaces>::_Load_queue() {
+			if (_Queue == nullptr) {
+				throw ::std::system_error(::std::make_error_code(::std::errc::operation_not_permitted));
+			}
+			return *_Queue;
+		}
+
+		template <class GraphicsSurfaces>
+		unsigned int basic_image_loader<GraphicsSurfaces>::decode_threads() const noexcept {
+			return _Queue == nullptr ? 0 : _Queue->decode_threads();
+		}
+
+#ifdef _Filesystem_support_test
+		template <class GraphicsSurfaces>
+		::std::future<basic_image_surface<GraphicsSurfaces>> basic_image_loader<GraphicsSurfaces>::load(filesystem::path p, image_file_format iff, io2d::format fmt) {
+			auto state = make_shared<_Image_load<GraphicsSurfaces>>();
+			auto result = state->result.get_future();
+			_Queue_image_read(_Load_queue(), p.string(), iff, fmt, state);
+			return result;
+		}
+		template <class GraphicsSurfaces>
+		void basic_image_loader<GraphicsSurfaces>::load(filesystem::path p, image_file_format iff, io2d::format fmt, done_function done) {
+			auto state = make_shared<_Image_load<GraphicsSurfaces>>();
+			state->future = state->result.get_future();
+			state->done = move(done);
+			_Queue_image_read(_Load_queue(), p.string(), iff, fmt, state);
+		}
+		template <class GraphicsSurfaces>
+		::std::vector<::std::future<basic_image_surface<GraphicsSurfaces>>> basic_image_loader<GraphicsSurfaces>::load(const ::std::vector<filesystem::path>& paths, image_file_format iff, io2d::format fmt) {
+			::std::vector<::std::future<image_type>> result;
+			result.reserve(paths.size());
+			for (const auto& p : paths) {
+				result.push_back(load(p, iff, fmt));
+			}
+			return result;
+		}
+#else
+		template <class GraphicsSurfaces>
+		::std::future<basic_image_surface<GraphicsSurfaces>> basic_image_loader<GraphicsSurfaces>::load(::std::string f, image_file_format iff, io2d::format fmt) {
+			auto state = make_shared<_Image_load<GraphicsSurfaces>>();
+			auto result = state->result.get_future();
+			_Queue_image_read(_Load_queue(), move(f), iff, fmt, state);
+			return result;
+		}
+		template <class GraphicsSurfaces>
+		void basic_image_loader<GraphicsSurfaces>::load(::std::string f, image_file_format iff, io2d::format fmt, done_function done) {
+			auto state = make_shared<_Image_load<GraphicsSurfaces>>();
+			state->future = state->result.get_future();
+			state->done = move(done);
+			_Queue_image_read(_Load_queue(), move(f), iff, fmt, state);
+		}
+		template <class GraphicsSurfaces>
+		::std::vector<::std::future<basic_image_surface<GraphicsSurfaces>>> basic_image_loader<GraphicsSurfaces>::load(const ::std::vector<::std::string>& files, image_file_format iff, io2d::format fmt) {
+			::std::vector<::std::future<image_type>> result;
+			result.reserve(files.size());
+			for (const auto& f : files) {
+				result.push_back(load(f, iff, fmt));
+			}
+			return result;
+		}
+#endif
+
+		template <class GraphicsSurfaces>
+		::std::future<basic_image_surface<GraphicsSurfaces>> basic_image_loader<GraphicsSurfaces>::load(::std::vector<::std::byte> bytes, image_file_format iff, io2d::format fmt) {
+			auto state = make_shared<_Image_load<GraphicsSurfaces>>();
+			auto result = state->result.get_future();
+			_Queue_image_decode(_Load_queue(), move(bytes), iff, fmt, state);
+			return result;
+		}
+		template <class GraphicsSurfaces>
+		void basic_image_loader<GraphicsSurfaces>::load(::std::vector<::std::byte> bytes, image_file_format iff, io2d::format fmt, done_function done) {
+			auto state = make_shared<_Image_load<GraphicsSurfaces>>();
+			state->future = state->result.get_future();
+			state->done = move(done);
+			_Queue_image_decode(_Load_queue(), move(bytes), iff, fmt, state);
+		}
+	}
+}
@@ -0,0 +1,40 @@
+#pragma once
+#include "xio2d.h"
+#include "xsurfaces.h"
+#include <condition_variable>
+#include <deque>
+#include <future>
+#include <thread>
+
+namespace std::experimental::io2d {
+	inline namespace v1 {
+		// Runs the encodes that save_async hands it, one at a time and in order, on a thread that lives as long as the program. Each task holds a
+		// copy of a surface, so save_async reserves a slot before making the copy and the slot is released once the task has run and the copy is
+		// gone. reserve waits while _Limit slots are taken, whether their tasks are queued or being encoded.
+		class _Image_save_worker {
+			static constexpr size_t _Limit = 4;
+
+			::std::mutex _Mutex;
+			::std::condition_variable _Ready;
+			::std::condition_variable _Space;
+			::std::deque<::std::function<void()>> _Tasks;
+			size_t _Reserved = 0;
+			bool _Stopping = false;
+			::std::thread _Thread;
+
+			_Image_save_worker();
+			void _Run();
+		public:
+			_Image_save_worker(const _Image_save_worker&) = delete;
+			_Image_save_worker& operator=(const _Image_save_worker&) = delete;
+			~_Image_save_worker() noexcept;
+
+			static _Image_save_worker& instance();
+			void reserve();
+			// Gives back a slot whose task was never pushed.
+			void release() noexcept;
+			// Queues the task for a slot taken with reserve.
+			void push(::std::function<void()> task);
+		};
+	}
+}
@@ -0,0 +1,104 @@
+#pragma once
+#include "ximagesaveworker.h"
+
+namespace std::experimental::io2d {
+	inline namespace v1 {
+		inline _Image_save_worker::_Image_save_worker()
+			: _Thread([this] { _Run(); }) {
+		}
+
+		// Saves that are still queued when the program exits are finished first.
+		inline _Image_save_worker::~_Image_save_worker() noexcept {
+			{
+				lock_guard<mutex> lock(_Mutex);
+				_Stopping = true;
+			}
+			_Ready.notify_all();
+			_Thread.join();
+		}
+
+		inline _Image_save_worker& _Image_save_worker::instance() {
+			static _Image_save_worker worker;
+			return worker;
+		}
+
+		inline void _Image_save_worker::_Run() {
+			for (;;) {
+				::std::function<void()> task;
+				{
+					unique_lock<mutex> lock(_Mutex);
+					_Ready.wait(lock, [this] { return _Stopping || !_Tasks.empty(); });
+					if (_Tasks.empty()) {
+						return;
+					}
+					task = move(_Tasks.front());
+					_Tasks.pop_front();
+				}
+				task();
+				// Destroying the task frees its copy of the pixels before the slot is given back.
+				task = nullptr;
+				release();
+			}
+		}
+
+		inline void _Image_save_worker::reserve() {
+			unique_lock<mutex> lock(_Mutex);
+			_Space.wait(lock, [this] { return _Reserved < _Limit; });
+			++_Reserved;
+		}
+
+		inline void _Image_save_worker::release() noexcept {
+			{
+				lock_guard<mutex> lock(_Mutex);
+				--_Reserved;
+			}
+			_Space.notify_one();
+		}
+
+		inline void _Image_save_worker::push(::std::function<void()> task) {
+			{
+				lock_guard<mutex> lock(_Mutex);
+				_Tasks.push_back(move(task));
+			}
+			_Ready.notify_one();
+		}
+
+		// The snapshot is made with copy_surface, so it shares the pixels with image until image is next drawn to.
+		template <class GraphicsSurfaces>
+		::std::future<void> _Save_image_surface_async(basic_image_surface<GraphicsSurfaces>& image, ::std::string f, image_file_format iff) {
+			auto& worker = _Image_save_worker::instance();
+			worker.reserve();
+			try {
+				auto snapshot = make_shared<basic_image_surface<GraphicsSurfaces>>(copy_surface(image));
+				auto done = make_shared<::std::promise<void>>();
+				auto result = done->get_future();
+				worker.push([snapshot = move(snapshot), f = move(f), iff, done]() {
+					try {
+						snapshot->save(f, iff);
+						done->set_value();
+					}
+					catch (...) {
+						done->set_exception(::std::current_exception());
+					}
+				});
+				return result;
+			}
+			catch (...) {
+				worker.release();
+				throw;
+			}
+		}
+
+#ifdef _Filesystem_support_test
+		template <class GraphicsSurfaces>
+		::std::future<void> basic_image_surface<GraphicsSurfaces>::save_async(filesystem::path p, image_file_format i) {
+			return _Save_image_surface_async(*this, p.string(), i);
+		}
+#else
+		template <class GraphicsSurfaces>
+		::std::future<void> basic_image_surface<GraphicsSurfaces>::save_async(::std::string f, image_file_format i) {
+			return _Save_image_surface_async(*this, move(f), i);
+		}
+#endif
+	}
+}
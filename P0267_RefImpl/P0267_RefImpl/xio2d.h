@@ -13,13 +13,16 @@
 #include <string>
 #include <algorithm>
 #include <system_error>
+#include <stdexcept>
 #include <cstdint>
 #include <atomic>
+#include <mutex>
 #include <variant>
 #include <optional>
 #include <initializer_list>
 #include <cmath>
 #include <chrono>
+#include <future>
 
 #define __cpp_lib_experimental_io2d 201710
 
@@ -38,6 +41,14 @@
     #define _IO2D_Has_Magick
 #endif
 
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    #define _IO2D_Has_SSE2
+#endif
+
+#if defined(__AVX__)
+    #define _IO2D_Has_AVX
+#endif
+
 #if defined BUILD_IO2D_API_DLL 
 #define _IO2D_API __declspec(dllexport)
 #elif defined USE_IO2D_API_DLL
@@ -132,20 +143,37 @@ namespace std {
 #include "xdiagnostics.h"
 #include "xgraphicsmath.h"
 #include "xgraphicsmathfloat.h"
+#include "xgraphicsmathsimd.h"
 #include "xinput.h"
 #include "xio2d.h"
 #include "xpath.h"
 #include "xsurfaces_enums.h"
 #include "xsurfaces.h"
+#include "xatlas.h"
+#include "xsurfacepool.h"
+#include "xtiledsurface.h"
+#include "xbandedexport.h"
+#include "ximageloader.h"
+#include "ximagesaveworker.h"
+#include "xmappedpixels.h"
 #include "xtext.h"
 #include "xbrushes_impl.h"
 #include "xgraphicsmath_impl.h"
 #include "xgraphicsmathfloat_impl.h"
+#include "xgraphicsmathsimd_impl.h"
 #include "xio2d_impl.h"
 #include "xpath_impl.h"
 #include "xpathbuilder_impl.h"
 #include "xsurfaces_impl.h"
 #include "xsurfacesprops_impl.h"
+#include "xatlas_impl.h"
+#include "xsurfacepool_impl.h"
+#include "xmappedsurface_impl.h"
+#include "xtiledsurface_impl.h"
+#include "xbandedexport_impl.h"
+#include "ximageloader_impl.h"
+#include "ximagesaveworker_impl.h"
+#include "xmappedpixels_impl.h"
 #include "xinterchangebuffer.h"
 
 #endif // _XIO2D_H_
@@ -0,0 +1,48 @@
+#pragma once
+#include "xio2d.h"
+#include "xsurfaces.h"
+
+namespace std::experimental::io2d {
+	inline namespace v1 {
+		// Direct access to an image surface's own pixel memory, for code that computes pixels itself instead of drawing them. Nothing is copied:
+		// rows are stride() bytes apart, top row first. argb32 pixels are premultiplied ::std::uint32_t values with alpha in the high byte followed
+		// by red, green and blue; xrgb32 pixels have the same layout with the high byte unused; a8 pixels are a single byte of alpha.
+		//
+		// The surface is flushed when basic_image_surface::map_pixels makes the view, and the extents it was given are marked dirty by commit() and
+		// by the destructor. Only pixels inside those extents may be changed. Call commit() before using the surface in any other way while the view
+		// exists, and do not let the view outlive the surface.
+		template <class GraphicsSurfaces>
+		class basic_mapped_pixels {
+		public:
+			using graphics_math_type = typename GraphicsSurfaces::graphics_math_type;
+		private:
+			friend basic_image_surface<GraphicsSurfaces>;
+
+			basic_image_surface<GraphicsSurfaces>* _Surface;
+			::std::byte* _Pixels;
+			int _Stride;
+			basic_bounding_box<graphics_math_type> _Extents;
+
+			basic_mapped_pixels(basic_image_surface<GraphicsSurfaces>& sfc, const basic_bounding_box<graphics_math_type>& extents);
+		public:
+			basic_mapped_pixels(const basic_mapped_pixels&) = delete;
+			basic_mapped_pixels& operator=(const basic_mapped_pixels&) = delete;
+			basic_mapped_pixels(basic_mapped_pixels&& other) noexcept;
+			basic_mapped_pixels& operator=(basic_mapped_pixels&& other) noexcept;
+			~basic_mapped_pixels() noexcept;
+
+			io2d::format format() const noexcept;
+			basic_display_point<graphics_math_type> dimensions() const noexcept;
+			int stride() const noexcept;
+			::std::byte* data() noexcept;
+			const ::std::byte* data() const noexcept;
+			// Row y as Pixel values, normally ::std::uint32_t for argb32 and xrgb32 and ::std::uint8_t for a8.
+			template <class Pixel = ::std::uint32_t>
+			Pixel* row(int y) noexcept;
+			template <class Pixel = ::std::uint32_t>
+			const Pixel* row(int y) const noexcept;
+			// Marks the extents dirty so that drawing, brushes and save see the changes so far. The view stays usable.
+			void commit();
+		};
+	}
+}
@@ -0,0 +1,96 @@
+#pragma once
+#include "xmappedpixels.h"
+
+namespace std::experimental::io2d {
+	inline namespace v1 {
+		template <class GraphicsSurfaces>
+		basic_mapped_pixels<GraphicsSurfaces>::basic_mapped_pixels(basic_image_surface<GraphicsSurfaces>& sfc, const basic_bounding_box<graphics_math_type>& extents)
+			: _Surface(&sfc)
+			, _Pixels(nullptr)
+			, _Stride(0)
+			, _Extents(extents) {
+			// The caller is about to write, so a surface that copy_surface left sharing its pixels needs its own first.
+			sfc._Own_pixels();
+			sfc.flush();
+			_Pixels = GraphicsSurfaces::surfaces::pixels(sfc._Data);
+			_Stride = GraphicsSurfaces::surfaces::stride(sfc._Data);
+		}
+		template <class GraphicsSurfaces>
+		basic_mapped_pixels<GraphicsSurfaces>::basic_mapped_pixels(basic_mapped_pixels&& other) noexcept
+			: _Surface(other._Surface)
+			, _Pixels(other._Pixels)
+			, _Stride(other._Stride)
+			, _Extents(other._Extents) {
+			other._Surface = nullptr;
+			other._Pixels = nullptr;
+		}
+		template <class GraphicsSurfaces>
+		basic_mapped_pixels<GraphicsSurfaces>& basic_mapped_pixels<GraphicsSurfaces>::operator=(basic_mapped_pixels&& other) noexcept {
+			if (this != &other) {
+				if (_Surface != nullptr) {
+					error_code ec;
+					_Surface->mark_dirty(_Extents, ec);
+				}
+				_Surface = other._Surface;
+				_Pixels = other._Pixels;
+				_Stride = other._Stride;
+				_Extents = other._Extents;
+				other._Surface = nullptr;
+				other._Pixels = nullptr;
+			}
+			return *this;
+		}
+		// Errors cannot be reported from here; call commit() first to see them.
+		template <class GraphicsSurfaces>
+		basic_mapped_pixels<GraphicsSurfaces>::~basic_mapped_pixels() noexcept {
+			if (_Surface != nullptr) {
+				error_code ec;
+				_Surface->mark_dirty(_Extents, ec);
+			}
+		}
+		template <class GraphicsSurfaces>
+		io2d::format basic_mapped_pixels<GraphicsSurfaces>::format() const noexcept {
+			return _Surface->format();
+		}
+		template <class GraphicsSurfaces>
+		basic_display_point<typename basic_mapped_pixels<GraphicsSurfaces>::graphics_math_type> basic_mapped_pixels<GraphicsSurfaces>::dimensions() const noexcept {
+			return _Surface->dimensions();
+		}
+		template <class GraphicsSurfaces>
+		int basic_mapped_pixels<GraphicsSurfaces>::stride() const noexcept {
+			return _Stride;
+		}
+		template <class GraphicsSurfaces>
+		::std::byte* basic_mapped_pixels<GraphicsSurfaces>::data() noexcept {
+			return _Pixels;
+		}
+		template <class GraphicsSurfaces>
+		const ::std::byte* basic_mapped_pixels<GraphicsSurfaces>::data() const noexcept {
+			return _Pixels;
+		}
+		template <class GraphicsSurfaces>
+		template <class Pixel>
+		Pixel* basic_mapped_pixels<GraphicsSurfaces>::row(int y) noexcept {
+			return reinterpret_cast<Pixel*>(_Pixels + static_cast<ptrdiff_t>(y) * _Stride);
+		}
+		template <class GraphicsSurfaces>
+		template <class Pixel>
+		const Pixel* basic_mapped_pixels<GraphicsSurfaces>::row(int y) const noexcept {
+			return reinterpret_cast<const Pixel*>(_Pixels + static_cast<ptrdiff_t>(y) * _Stride);
+		}
+		template <class GraphicsSurfaces>
+		void basic_mapped_pixels<GraphicsSurfaces>::commit() {
+			_Surface->mark_dirty(_Extents);
+		}
+
+		template <class GraphicsSurfaces>
+		basic_mapped_pixels<GraphicsSurfaces> basic_image_surface<GraphicsSurfaces>::map_pixels() {
+			const auto dims = dimensions();
+			return map_pixels(basic_bounding_box<graphics_math_type>(0.0F, 0.0F, static_cast<float>(dims.x()), static_cast<float>(dims.y())));
+		}
+		template <class GraphicsSurfaces>
+		basic_mapped_pixels<GraphicsSurfaces> basic_image_surface<GraphicsSurfaces>::map_pixels(const basic_bounding_box<graphics_math_type>& extents) {
+			return basic_mapped_pixels<GraphicsSurfaces>(*this, extents);
+		}
+	}
+}
@@ -0,0 +1,226 @@
+#pragma once
+#include "xsurfaces.h"
+#include <cerrno>
+#include <cstring>
+
+#if defined(_WIN32) || defined(_WIN64)
+#include "xsystemheaders.h"
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace std::experimental::io2d {
+	inline namespace v1 {
+		// A file mapped into memory for as long as the object lives. Mapped pages are shared with the file, except in read_only mode where writes go
+		// to private copies of the pages.
+		class _Mapped_file {
+			::std::byte* _Data = nullptr;
+			size_t _Size = 0;
+
+			[[noreturn]] static void _Throw_system_error(int code, const char* what) {
+				throw ::std::system_error(code, ::std::system_category(), what);
+			}
+		public:
+			// Creates the file, replacing any existing one, with size zero bytes.
+			_Mapped_file(const ::std::string& p, size_t size);
+			_Mapped_file(const ::std::string& p, mapped_file_mode m);
+			_Mapped_file(const _Mapped_file&) = delete;
+			_Mapped_file& operator=(const _Mapped_file&) = delete;
+			~_Mapped_file() noexcept;
+
+			::std::byte* data() const noexcept {
+				return _Data;
+			}
+			size_t size() const noexcept {
+				return _Size;
+			}
+		};
+
+#if defined(_WIN32) || defined(_WIN64)
+		inline _Mapped_file::_Mapped_file(const ::std::string& p, size_t size) {
+			const auto file = CreateFileA(p.c_str(), GENERIC_READ | GENERIC_WRITE, FILE_SHARE_READ, nullptr, CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr);
+			if (file == INVALID_HANDLE_VALUE) {
+				_Throw_system_error(static_cast<int>(GetLastError()), "Could not create the file for a mapped image surface.");
+			}
+			// The mapping keeps the file open, and the view keeps the mapping alive.
+			const auto mapping = CreateFileMappingA(file, nullptr, PAGE_READWRITE, static_cast<DWORD>(static_cast<uint64_t>(size) >> 32), static_cast<DWORD>(size & 0xFFFFFFFFu), nullptr);
+			const auto mappingError = GetLastError();
+			CloseHandle(file);
+			if (mapping == nullptr) {
+				_Throw_system_error(static_cast<int>(mappingError), "Could not map the file for a mapped image surface.");
+			}
+			const auto view = MapViewOfFile(mapping, FILE_MAP_WRITE, 0, 0, size);
+			const auto viewError = GetLastError();
+			CloseHandle(mapping);
+			if (view == nullptr) {
+				_Throw_system_error(static_cast<int>(viewError), "Could not map the file for a mapped image surface.");
+			}
+			_Data = static_cast<::std::byte*>(view);
+			_Size = size;
+		}
+		inline _Mapped_file::_Mapped_file(const ::std::string& p, mapped_file_mode m) {
+			const bool readOnly = m == mapped_file_mode::read_only;
+			const auto file = CreateFileA(p.c_str(), readOnly ? GENERIC_READ : GENERIC_READ | GENERIC_WRITE, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+			if (file == INVALID_HANDLE_VALUE) {
+				_Throw_system_error(static_cast<int>(GetLastError()), "Could not open the file for a mapped image surface.");
+			}
+			LARGE_INTEGER fileSize;
+			if (!GetFileSizeEx(file, &fileSize) || fileSize.QuadPart == 0) {
+				CloseHandle(file);
+				throw ::std::system_error(::std::make_error_code(::std::errc::illegal_byte_sequence));
+			}
+			const auto mapping = CreateFileMappingA(file, nullptr, readOnly ? PAGE_WRITECOPY : PAGE_READWRITE, 0, 0, nullptr);
+			const auto mappingError = GetLastError();
+			CloseHandle(file);
+			if (mapping == nullptr) {
+				_Throw_system_error(static_cast<int>(mappingError), "Could not map the file for a mapped image surface.");
+			}
+			const auto view = MapViewOfFile(mapping, readOnly ? FILE_MAP_COPY : FILE_MAP_WRITE, 0, 0, 0);
+			const auto viewError = GetLastError();
+			CloseHandle(mapping);
+			if (view == nullptr) {
+				_Throw_system_error(static_cast<int>(viewError), "Could not map the file for a mapped image surface.");
+			}
+			_Data = static_cast<::std::byte*>(view);
+			_Size = static_cast<size_t>(fileSize.QuadPart);
+		}
+		inline _Mapped_file::~_Mapped_file() noexcept {
+			UnmapViewOfFile(_Data);
+		}
+#else
+		inline _Mapped_file::_Mapped_file(const ::std::string& p, size_t size) {
+			const int fd = ::open(p.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+			if (fd < 0) {
+				_Throw_system_error(errno, "Could not create the file for a mapped image surface.");
+			}
+			// Extending the file leaves a sparse, zero filled file, so untouched pages take no disk space and read as transparent black.
+			if (::ftruncate(fd, static_cast<off_t>(size)) != 0) {
+				const int error = errno;
+				::close(fd);
+				_Throw_system_error(error, "Could not size the file for a mapped image surface.");
+			}
+			void* view = ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+			const int error = errno;
+			::close(fd);
+			if (view == MAP_FAILED) {
+				_Throw_system_error(error, "Could not map the file for a mapped image surface.");
+			}
+			_Data = static_cast<::std::byte*>(view);
+			_Size = size;
+		}
+		inline _Mapped_file::_Mapped_file(const ::std::string& p, mapped_file_mode m) {
+			const bool readOnly = m == mapped_file_mode::read_only;
+			const int fd = ::open(p.c_str(), readOnly ? O_RDONLY : O_RDWR);
+			if (fd < 0) {
+				_Throw_system_error(errno, "Could not open the file for a mapped image surface.");
+			}
+			struct stat status;
+			if (::fstat(fd, &status) != 0 || status.st_size <= 0) {
+				::close(fd);
+				throw ::std::system_error(::std::make_error_code(::std::errc::illegal_byte_sequence));
+			}
+			const auto size = static_cast<size_t>(status.st_size);
+			void* view = ::mmap(nullptr, size, PROT_READ | PROT_WRITE, readOnly ? MAP_PRIVATE : MAP_SHARED, fd, 0);
+			const int error = errno;
+			::close(fd);
+			if (view == MAP_FAILED) {
+				_Throw_system_error(error, "Could not map the file for a mapped image surface.");
+			}
+			_Data = static_cast<::std::byte*>(view);
+			_Size = size;
+		}
+		inline _Mapped_file::~_Mapped_file() noexcept {
+			::munmap(_Data, _Size);
+		}
+#endif
+
+		// The pixel rows start headerSize bytes into the file and are stored in the byte order of the machine that wrote them, which byteOrder records.
+		struct _Mapped_surface_header {
+			char magic[8];
+			uint32_t byteOrder;
+			uint32_t version;
+			uint32_t headerSize;
+			uint32_t format;
+			int32_t width;
+			int32_t height;
+			int32_t stride;
+			uint8_t reserved[28];
+		};
+		static_assert(sizeof(_Mapped_surface_header) == 64, "The mapped surface header must stay 64 bytes.");
+
+		constexpr char _Mapped_surface_magic[8] = { 'I', 'O', '2', 'D', 'R', 'A', 'W', '\0' };
+		constexpr uint32_t _Mapped_surface_byte_order = 0x01020304u;
+		constexpr uint32_t _Mapped_surface_version = 1;
+
+		template <class GraphicsSurfaces>
+		typename GraphicsSurfaces::surfaces::image_surface_data_type _Create_mapped_image_surface(const ::std::string& p, io2d::format fmt, int width, int height) {
+			const auto maxDimensions = GraphicsSurfaces::surfaces::max_dimensions();
+			const int stride = GraphicsSurfaces::surfaces::stride_for_width(fmt, width);
+			if (width <= 0 || height <= 0 || width > maxDimensions.x() || height > maxDimensions.y() || stride <= 0) {
+				throw ::std::system_error(::std::make_error_code(::std::errc::invalid_argument));
+			}
+			auto file = make_shared<_Mapped_file>(p, sizeof(_Mapped_surface_header) + static_cast<size_t>(stride) * static_cast<size_t>(height));
+			_Mapped_surface_header header{};
+			::std::memcpy(header.magic, _Mapped_surface_magic, sizeof(header.magic));
+			header.byteOrder = _Mapped_surface_byte_order;
+			header.version = _Mapped_surface_version;
+			header.headerSize = sizeof(_Mapped_surface_header);
+			header.format = static_cast<uint32_t>(fmt);
+			header.width = width;
+			header.height = height;
+			header.stride = stride;
+			::std::memcpy(file->data(), &header, sizeof(header));
+			auto pixels = file->data() + sizeof(header);
+			return GraphicsSurfaces::surfaces::create_image_surface(fmt, width, height, pixels, stride, move(file));
+		}
+
+		template <class GraphicsSurfaces>
+		typename GraphicsSurfaces::surfaces::image_surface_data_type _Open_mapped_image_surface(const ::std::string& p, mapped_file_mode m) {
+			auto file = make_shared<_Mapped_file>(p, m);
+			_Mapped_surface_header header;
+			if (file->size() < sizeof(header)) {
+				throw ::std::system_error(::std::make_error_code(::std::errc::illegal_byte_sequence));
+			}
+			::std::memcpy(&header, file->data(), sizeof(header));
+			if (::std::memcmp(header.magic, _Mapped_surface_magic, sizeof(header.magic)) != 0 || header.version != _Mapped_surface_version || header.headerSize < sizeof(header) || header.headerSize % 4 != 0) {
+				throw ::std::system_error(::std::make_error_code(::std::errc::illegal_byte_sequence));
+			}
+			if (header.byteOrder != _Mapped_surface_byte_order) {
+				throw ::std::system_error(::std::make_error_code(::std::errc::not_supported));
+			}
+			const auto fmt = static_cast<io2d::format>(header.format);
+			if (fmt != io2d::format::argb32 && fmt != io2d::format::xrgb32 && fmt != io2d::format::a8) {
+				throw ::std::system_error(::std::make_error_code(::std::errc::not_supported));
+			}
+			if (header.width <= 0 || header.height <= 0 || header.stride < GraphicsSurfaces::surfaces::stride_for_width(fmt, header.width) ||
+				header.headerSize + static_cast<size_t>(header.stride) * static_cast<size_t>(header.height) > file->size()) {
+				throw ::std::system_error(::std::make_error_code(::std::errc::illegal_byte_sequence));
+			}
+			auto pixels = file->data() + header.headerSize;
+			return GraphicsSurfaces::surfaces::create_image_surface(fmt, header.width, header.height, pixels, header.stride, move(file));
+		}
+
+#ifdef _Filesystem_support_test
+		template <class GraphicsSurfaces>
+		basic_image_surface<GraphicsSurfaces> basic_image_surface<GraphicsSurfaces>::create_mapped(filesystem::path p, io2d::format fmt, int width, int height) {
+			return basic_image_surface(nullptr, _Create_mapped_image_surface<GraphicsSurfaces>(p.string(), fmt, width, height));
+		}
+		template <class GraphicsSurfaces>
+		basic_image_surface<GraphicsSurfaces> basic_image_surface<GraphicsSurfaces>::open_mapped(filesystem::path p, mapped_file_mode m) {
+			return basic_image_surface(nullptr, _Open_mapped_image_surface<GraphicsSurfaces>(p.string(), m));
+		}
+#else
+		template <class GraphicsSurfaces>
+		basic_image_surface<GraphicsSurfaces> basic_image_surface<GraphicsSurfaces>::create_mapped(::std::string f, io2d::format fmt, int width, int height) {
+			return basic_image_surface(nullptr, _Create_mapped_image_surface<GraphicsSurfaces>(f, fmt, width, height));
+		}
+		template <class GraphicsSurfaces>
+		basic_image_surface<GraphicsSurfaces> basic_image_surface<GraphicsSurfaces>::open_mapped(::std::string f, mapped_file_mode m) {
+			return basic_image_surface(nullptr, _Open_mapped_image_surface<GraphicsSurfaces>(f, m));
+		}
+#endif
+	}
+}
@@ -460,6 +460,116 @@ namespace std {
 				lhs.swap(rhs);
 				}*/ // compiler error prevents forward declaration
 
+				// A fixed capacity path whose items are resolved as they are added: matrices are applied, relative items are made absolute, and quadratic curves are converted to cubic curves,
+				// exactly as when a path_builder is interpreted. Since every member is constexpr, static geometry such as icons can be built at compile time and turned into an
+				// interpreted_path without any further interpretation. Arcs are not supported because they require trigonometric functions, which are not constexpr.
+				template <class GraphicsMath, size_t Capacity>
+				class basic_static_path {
+				public:
+					static_assert(Capacity > 0, "A basic_static_path must be able to hold at least one segment.");
+
+					enum class segment_type {
+						new_figure,
+						line,
+						cubic_curve,
+						close_figure
+					};
+
+					// new_figure and line use pts[0]; cubic_curve uses pts[0] and pts[1] as control points and pts[2] as the end point; close_figure uses none.
+					struct segment {
+						segment_type type = segment_type::new_figure;
+						basic_point_2d<GraphicsMath> pts[3];
+					};
+
+					using value_type = segment;
+					using size_type = size_t;
+					using const_reference = const value_type&;
+					using const_iterator = const value_type*;
+
+					// The number of matrix items that can be outstanding (i.e. not yet reverted) at any one time.
+					static constexpr size_type max_matrix_depth = 16;
+				private:
+					segment _Segments[Capacity];
+					size_type _Size;
+					basic_matrix_2d<GraphicsMath> _Matrix;
+					basic_matrix_2d<GraphicsMath> _Matrices[max_matrix_depth];
+					size_type _Matrix_depth;
+					basic_point_2d<GraphicsMath> _Current_point;
+					basic_point_2d<GraphicsMath> _Close_point;
+
+					constexpr void _Push(segment_type type, const basic_point_2d<GraphicsMath>& pt0 = {}, const basic_point_2d<GraphicsMath>& pt1 = {}, const basic_point_2d<GraphicsMath>& pt2 = {});
+					constexpr basic_matrix_2d<GraphicsMath> _Relative_matrix() const noexcept;
+					constexpr void _Cubic_curve(const basic_point_2d<GraphicsMath>& pt0, const basic_point_2d<GraphicsMath>& pt1, const basic_point_2d<GraphicsMath>& pt2);
+					constexpr void _Quadratic_curve(const basic_point_2d<GraphicsMath>& cpt, const basic_point_2d<GraphicsMath>& ept);
+				public:
+					constexpr basic_static_path() noexcept;
+
+					// These throw length_error if the path would exceed its capacity (or max_matrix_depth), which makes a constant expression that does so ill-formed.
+					constexpr void new_figure(const basic_point_2d<GraphicsMath>& pt);
+					constexpr void rel_new_figure(const basic_point_2d<GraphicsMath>& pt);
+					constexpr void close_figure();
+					constexpr void matrix(const basic_matrix_2d<GraphicsMath>& m);
+					constexpr void rel_matrix(const basic_matrix_2d<GraphicsMath>& m);
+					constexpr void revert_matrix() noexcept;
+					constexpr void line(const basic_point_2d<GraphicsMath>& pt);
+					constexpr void rel_line(const basic_point_2d<GraphicsMath>& dpt);
+					constexpr void quadratic_curve(const basic_point_2d<GraphicsMath>& pt0, const basic_point_2d<GraphicsMath>& pt2);
+					constexpr void rel_quadratic_curve(const basic_point_2d<GraphicsMath>& pt0, const basic_point_2d<GraphicsMath>& pt2);
+					constexpr void cubic_curve(const basic_point_2d<GraphicsMath>& pt0, const basic_point_2d<GraphicsMath>& pt1, const basic_point_2d<GraphicsMath>& pt2);
+					constexpr void rel_cubic_curve(const basic_point_2d<GraphicsMath>& dpt0, const basic_point_2d<GraphicsMath>& dpt1, const basic_point_2d<GraphicsMath>& dpt2);
+
+					constexpr const_iterator begin() const noexcept;
+					constexpr const_iterator end() const noexcept;
+					constexpr const_reference operator[](size_type n) const noexcept;
+					constexpr size_type size() const noexcept;
+					constexpr bool empty() const noexcept;
+					static constexpr size_type capacity() noexcept;
+				};
+
+				// Holds flattened copies of an interpreted path, keyed by the flattening tolerance and the scale factor of the transform they were flattened for.
+				// Backends store one (through a _Flattened_path_cache_ptr) in their interpreted path data so that copies of a path share the results. Access is
+				// synchronized; flattenFn runs without the lock held, so a slow flatten does not hold up lookups for other tolerances.
+				template <class T>
+				class _Flattened_path_cache {
+					struct _Entry {
+						float tolerance;
+						float scale;
+						T path;
+					};
+					mutex _Mutex;
+					_Entry _Entries[4];
+					size_t _Size = 0;
+					size_t _Next = 0;
+
+					bool _Find(float tolerance, float scale, T& path) const noexcept;
+				public:
+					template <class Fn>
+					T get(float tolerance, float scale, Fn&& flattenFn);
+				};
+
+				// A shared_ptr to a _Flattened_path_cache that is created by the first call to get(). Interpreted paths are drawn from several threads at
+				// once, so the pointer is only read or written with _Mutex held. Copies share the cache that exists when they are made.
+				template <class T>
+				class _Flattened_path_cache_ptr {
+					mutable mutex _Mutex;
+					mutable ::std::shared_ptr<_Flattened_path_cache<T>> _Cache;
+
+					::std::shared_ptr<_Flattened_path_cache<T>> _Load() const;
+				public:
+					_Flattened_path_cache_ptr() noexcept = default;
+					_Flattened_path_cache_ptr(const _Flattened_path_cache_ptr& other);
+					_Flattened_path_cache_ptr& operator=(const _Flattened_path_cache_ptr& other);
+					::std::shared_ptr<_Flattened_path_cache<T>> get() const;
+				};
+
+				template <class GraphicsMath>
+				float _Flattening_scale(const basic_matrix_2d<GraphicsMath>& m) noexcept;
+
+				template <class GraphicsSurfaces>
+				class basic_stroke_props;
+				template <class GraphicsSurfaces>
+				class basic_dashes;
+
 				template <class GraphicsSurfaces>
 				class basic_interpreted_path {
 				public:
@@ -486,12 +596,28 @@ namespace std {
 
 					explicit basic_interpreted_path(initializer_list<typename basic_figure_items<GraphicsSurfaces>::figure_item> il);
 
+					template <size_t Capacity>
+					explicit basic_interpreted_path(const basic_static_path<graphics_math_type, Capacity>& sp);
+
 					basic_interpreted_path(const basic_interpreted_path&);
 					basic_interpreted_path& operator=(const basic_interpreted_path&);
 					basic_interpreted_path(basic_interpreted_path&&) noexcept;
 					basic_interpreted_path& operator=(basic_interpreted_path&&) noexcept;
 
 					~basic_interpreted_path() noexcept;
+
+					// Returns a copy of this path with every curve replaced by line segments that stay within tolerance device pixels of it when drawn with the transform m
+					// (normally the surface matrix of the render props it will be drawn with). Results are cached per tolerance and transform scale, so flattening the same
+					// path again at the same zoom does not redo the subdivision.
+					basic_interpreted_path flatten(float tolerance, const basic_matrix_2d<graphics_math_type>& m = basic_matrix_2d<graphics_math_type>{}) const;
+
+					// The smallest box, in the coordinate space of the path, that encloses every point of its filled area.
+					basic_bounding_box<graphics_math_type> bounds() const noexcept;
+
+					// Returns a path whose filled area is the area that stroking this path with sp and d covers, so that the outline can be computed once and drawn with fill.
+					// It must be filled using fill_rule::winding (the default). Curves are flattened and round joins and caps approximated to within tolerance device pixels
+					// when drawn with the transform m. Throws an invalid_argument system_error if tolerance is not positive or d has a negative length or only zero lengths.
+					basic_interpreted_path stroke_outline(const basic_stroke_props<GraphicsSurfaces>& sp, const basic_dashes<GraphicsSurfaces>& d = basic_dashes<GraphicsSurfaces>{}, const basic_matrix_2d<graphics_math_type>& m = basic_matrix_2d<graphics_math_type>{}, float tolerance = 0.1F) const;
 				};
 			}
 		}
@@ -6,32 +6,32 @@
 namespace std::experimental::io2d {
 	inline namespace v1 {
 		template<class GraphicsSurfaces>
-		inline const typename basic_figure_items<GraphicsSurfaces>::abs_new_figure::data_type& basic_figure_items<GraphicsSurfaces>::abs_new_figure::data() const noexcept {
+		const typename basic_figure_items<GraphicsSurfaces>::abs_new_figure::data_type& basic_figure_items<GraphicsSurfaces>::abs_new_figure::data() const noexcept {
 			return _Data;
 		}
 
 		template<class GraphicsSurfaces>
-		inline typename basic_figure_items<GraphicsSurfaces>::abs_new_figure::data_type& basic_figure_items<GraphicsSurfaces>::abs_new_figure::data() noexcept {
+		typename basic_figure_items<GraphicsSurfaces>::abs_new_figure::data_type& basic_figure_items<GraphicsSurfaces>::abs_new_figure::data() noexcept {
 			return _Data;
 		}
 
 		template<class GraphicsSurfaces>
-		inline basic_figure_items<GraphicsSurfaces>::abs_new_figure::abs_new_figure()
+		basic_figure_items<GraphicsSurfaces>::abs_new_figure::abs_new_figure()
 			: _Data(GraphicsSurfaces::paths::create_abs_new_figure()) {
 		}
 
 		template<class GraphicsSurfaces>
-		inline basic_figure_items<GraphicsSurfaces>::abs_new_figure::abs_new_figure(const basic_point_2d<typename GraphicsSurfaces::graphics_math_type>& pt)
+		basic_figure_items<GraphicsSurfaces>::abs_new_figure::abs_new_figure(const basic_point_2d<typename GraphicsSurfaces::graphics_math_type>& pt)
 			: _Data(GraphicsSurfaces::paths::create_abs_new_figure(pt)) {
 		}
 
 		template<class GraphicsSurfaces>
-		inline basic_figure_items<GraphicsSurfaces>::abs_new_figure::abs_new_figure(const abs_new_figure& other)
+		basic_figure_items<GraphicsSurfaces>::abs_new_figure::abs_new_figure(const abs_new_figure& other)
 			: _Data(GraphicsSurfaces::paths::copy_abs_new_figure(other._Data)) {
 		}
 
 		template<class GraphicsSurfaces>
-		inline typename basic_figure_items<GraphicsSurfaces>::abs_new_figure& basic_figure_items<GraphicsSurfaces>::abs_new_figure::operator=(const abs_new_figure& other) {
+		typename basic_figure_items<GraphicsSurfaces>::abs_new_figure& basic_figure_items<GraphicsSurfaces>::abs_new_figure::operator=(const abs_new_figure& other) {
 			if (this != &other) {
 				_Data = GraphicsSurfaces::paths::copy_abs_new_figure(other._Data);
 			}
@@ -39,12 +39,12 @@ namespace std::experimental::io2d {
 		}
 
 		template<class GraphicsSurfaces>
-		inline basic_figure_items<GraphicsSurfaces>::abs_new_figure::abs_new_figure(abs_new_figure&& other) noexcept
+		basic_figure_items<GraphicsSurfaces>::abs_new_figure::abs_new_figure(abs_new_figure&& other) noexcept
 			: _Data(GraphicsSurfaces::paths::move_abs_new_figure(move(other._Data))) {
 		}
 
 		template<class GraphicsSurfaces>
-		inline typename basic_figure_items<GraphicsSurfaces>::abs_new_figure& basic_figure_items<GraphicsSurfaces>::abs_new_figure::operator=(abs_new_figure&& other) noexcept {
+		typename basic_figure_items<GraphicsSurfaces>::abs_new_figure& basic_figure_items<GraphicsSurfaces>::abs_new_figure::operator=(abs_new_figure&& other) noexcept {
 			if (this != &other) {
 				_Data = move(GraphicsSurfaces::paths::move_abs_new_figure(move(other._Data)));
 			}
@@ -52,113 +52,113 @@ namespace std::experimental::io2d {
 		}
 
 		template<class GraphicsSurfaces>
-		inline basic_figure_items<GraphicsSurfaces>::abs_new_figure::~abs_new_figure() noexcept {
+		basic_figure_items<GraphicsSurfaces>::abs_new_figure::~abs_new_figure() noexcept {
 			GraphicsSurfaces::paths::destroy(_Data);
 		}
 
 		template<class GraphicsSurfaces>
-		inline void basic_figure_items<GraphicsSurfaces>::abs_new_figure::at(const basic_point_2d<typename GraphicsSurfaces::graphics_math_type>& pt) noexcept {
+		void basic_figure_items<GraphicsSurfaces>::abs_new_figure::at(const basic_point_2d<typename GraphicsSurfaces::graphics_math_type>& pt) noexcept {
 			GraphicsSurfaces::paths::at(_Data, pt);
 		}
 
 		template<class GraphicsSurfaces>
-		inline basic_point_2d<typename GraphicsSurfaces::graphics_math_type> basic_figure_items<GraphicsSurfaces>::abs_new_figure::at() const noexcept {
+		basic_point_2d<typename GraphicsSurfaces::graphics_math_type> basic_figure_items<GraphicsSurfaces>::abs_new_figure::at() const noexcept {
 			return GraphicsSurfaces::paths::at(_Data);
 		}
 
         template<class GraphicsSurfaces>
-        inline bool basic_figure_items<GraphicsSurfaces>::abs_new_figure::operator==(const abs_new_figure& rhs) const noexcept {
+        bool basic_figure_items<GraphicsSurfaces>::abs_new_figure::operator==(const abs_new_figure& rhs) const noexcept {
             return at() == rhs.at();
         }
 
         template<class GraphicsSurfaces>
-        inline bool basic_figure_items<GraphicsSurfaces>::abs_new_figure::operator!=(const abs_new_figure& rhs) const noexcept {
+        bool basic_figure_items<GraphicsSurfaces>::abs_new_figure::operator!=(const abs_new_figure& rhs) const noexcept {
             return !(*this == rhs);
         }
                 
 		template<class GraphicsSurfaces>
-		inline const typename basic_figure_items<GraphicsSurfaces>::rel_new_figure::data_type& basic_figure_items<GraphicsSurfaces>::rel_new_figure::data() const noexcept {
+		const typename basic_figure_items<GraphicsSurfaces>::rel_new_figure::data_type& basic_figure_items<GraphicsSurfaces>::rel_new_figure::data() const noexcept {
 			return _Data;
 		}
 		template<class GraphicsSurfaces>
-		inline typename basic_figure_items<GraphicsSurfaces>::rel_new_figure::data_type& basic_figure_items<GraphicsSurfaces>::rel_new_figure::data() noexcept {
+		typename basic_figure_items<GraphicsSurfaces>::rel_new_figure::data_type& basic_figure_items<GraphicsSurfaces>::rel_new_figure::data() noexcept {
 			return _Data;
 		}
 		template<class GraphicsSurfaces>
-		inline basic_figure_items<GraphicsSurfaces>::rel_new_figure::rel_new_figure() noexcept
+		basic_figure_items<GraphicsSurfaces>::rel_new_figure::rel_new_figure() noexcept
 			: _Data(GraphicsSurfaces::paths::create_rel_new_figure()) {
 		}
 		template<class GraphicsSurfaces>
-		inline basic_figure_items<GraphicsSurfaces>::rel_new_figure::rel_new_figure(const basic_point_2d<typename GraphicsSurfaces::graphics_math_type>& pt) noexcept
+		basic_figure_items<GraphicsSurfaces>::rel_new_figure::rel_new_figure(const basic_point_2d<typename GraphicsSurfaces::graphics_math_type>& pt) noexcept
 			: _Data(GraphicsSurfaces::paths::create_rel_new_figure(pt)) {
 		}
 		template<class GraphicsSurfaces>
-		inline basic_figure_items<GraphicsSurfaces>::rel_new_figure::rel_new_figure(const rel_new_figure& other)
+		basic_figure_items<GraphicsSurfaces>::rel_new_figure::rel_new_figure(const rel_new_figure& other)
 			: _Data(GraphicsSurfaces::paths::copy_rel_new_figure(other._Data)) {
 		}
 		template<class GraphicsSurfaces>
-		inline typename basic_figure_items<GraphicsSurfaces>::rel_new_figure& basic_figure_items<GraphicsSurfaces>::rel_new_figure::operator=(const rel_new_figure& other) {
+		typename basic_figure_items<GraphicsSurfaces>::rel_new_figure& basic_figure_items<GraphicsSurfaces>::rel_new_figure::operator=(const rel_new_figure& other) {
 			if (this != &other) {
 				GraphicsSurfaces::paths::copy_rel_new_figure(other._Data);
 			}
 			return *this;
 		}
 		template<class GraphicsSurfaces>
-		inline basic_figure_items<GraphicsSurfaces>::rel_new_figure::rel_new_figure(rel_new_figure&& other) noexcept
+		basic_figure_items<GraphicsSurfaces>::rel_new_figure::rel_new_figure(rel_new_figure&& other) noexcept
 			: _Data(move(GraphicsSurfaces::paths::move_rel_new_figure(move(other._Data)))) {
 		}
 		template<class GraphicsSurfaces>
-		inline typename basic_figure_items<GraphicsSurfaces>::rel_new_figure& basic_figure_items<GraphicsSurfaces>::rel_new_figure::operator=(rel_new_figure&& other) noexcept {
+		typename basic_figure_items<GraphicsSurfaces>::rel_new_figure& basic_figure_items<GraphicsSurfaces>::rel_new_figure::operator=(rel_new_figure&& other) noexcept {
 			if (this != &other) {
 				_Data = move(GraphicsSurfaces::paths::move_rel_new_figure(move(other._Data)));
 			}
 			return *this;
 		}
 		template<class GraphicsSurfaces>
-		inline basic_figure_items<GraphicsSurfaces>::rel_new_figure::~rel_new_figure() noexcept {
+		basic_figure_items<GraphicsSurfaces>::rel_new_figure::~rel_new_figure() noexcept {
 			GraphicsSurfaces::paths::destroy(_Data);
 		}
 		template<class GraphicsSurfaces>
-		inline void basic_figure_items<GraphicsSurfaces>::rel_new_figure::at(const basic_point_2d<typename GraphicsSurfaces::graphics_math_type>& pt) noexcept {
+		void basic_figure_items<GraphicsSurfaces>::rel_new_figure::at(const basic_point_2d<typename GraphicsSurfaces::graphics_math_type>& pt) noexcept {
 			GraphicsSurfaces::paths::at(_Data, pt);
 		}
 		template<class GraphicsSurfaces>
-		inline basic_point_2d<typename GraphicsSurfaces::graphics_math_type> basic_figure_items<GraphicsSurfaces>::rel_new_figure::at() const noexcept {
+		basic_point_2d<typename GraphicsSurfaces::graphics_math_type> basic_figure_items<GraphicsSurfaces>::rel_new_figure::at() const noexcept {
 			return GraphicsSurfaces::paths::at(_Data);
 		}
         
         template<class GraphicsSurfaces>
-        inline bool basic_figure_items<GraphicsSurfaces>::rel_new_figure::operator==(const rel_new_figure& rhs) const noexcept {
+        bool basic_figure_items<GraphicsSurfaces>::rel_new_figure::operator==(const rel_new_figure& rhs) const noexcept {
             return at() == rhs.at();
         }
         
         template<class GraphicsSurfaces>
-        inline bool basic_figure_items<GraphicsSurfaces>::rel_new_figure::operator!=(const rel_new_figure& rhs) const noexcept {
+        bool basic_figure_items<GraphicsSurfaces>::rel_new_figure::operator!=(const rel_new_figure& rhs) const noexcept {
             return !(*this == rhs);
         }        
         
 		template<class GraphicsSurfaces>
-		inline const typename basic_figure_items<GraphicsSurfaces>::close_figure::data_type& basic_figure_items<GraphicsSurfaces>::close_figure::data() const noexcept {
+		const typename basic_figure_items<GraphicsSurfaces>::close_figure::data_type& basic_figure_items<GraphicsSurfaces>::close_figure::data() const noexcept {
 			return _Data;
 		}
 
 		template<class GraphicsSurfaces>
-		inline typename basic_figure_items<GraphicsSurfaces>::close_figure::data_type& basic_figure_items<GraphicsSurfaces>::close_figure::data() noexcept {
+		typename basic_figure_items<GraphicsSurfaces>::close_figure::data_type& basic_figure_items<GraphicsSurfaces>::close_figure::data() noexcept {
 			return _Data;
 		}
 
 		template<class GraphicsSurfaces>
-		inline basic_figure_items<GraphicsSurfaces>::close_figure::close_figure() noexcept
+		basic_figure_items<GraphicsSurfaces>::close_figure::close_figure() noexcept
 			: _Data(GraphicsSurfaces::paths::create_close_figure()) {
 		}
 
 		template<class GraphicsSurfaces>
-		inline basic_figure_items<GraphicsSurfaces>::close_figure::close_figure(const close_figure& other)
+		basic_figure_items<GraphicsSurfaces>::close_figure::close_figure(const close_figure& other)
 			: _Data(GraphicsSurfaces::paths::copy_close_figure(other._Data)) {
 		}
 
 		template<class GraphicsSurfaces>
-		inline typename basic_figure_items<GraphicsSurfaces>::close_figure& basic_figure_items<GraphicsSurfaces>::close_figure::operator=(const close_figure& other) {
+		typename basic_figure_items<GraphicsSurfaces>::close_figure& basic_figure_items<GraphicsSurfaces>::close_figure::operator=(const close_figure& other) {
 			if (this != &other) {
 				_Data = GraphicsSurfaces::paths::copy_close_figure(other._Data);
 			}
@@ -166,12 +166,12 @@ namespace std::experimental::io2d {
 		}
 
 		template<class GraphicsSurfaces>
-		inline basic_figure_items<GraphicsSurfaces>::close_figure::close_figure(close_figure&& other) noexcept
+		basic_figure_items<GraphicsSurfaces>::close_figure::close_figure(close_figure&& other) noexcept
 			: _Data(move(GraphicsSurfaces::paths::move_close_figure(move(other._Data)))) {
 		}
 
 		template<class GraphicsSurfaces>
-		inline typename basic_figure_items<GraphicsSurfaces>::close_figure& basic_figure_items<GraphicsSurfaces>::close_figure::operator=(close_figure&& other) noexcept {
+		typename basic_figure_items<GraphicsSurfaces>::close_figure& basic_figure_items<GraphicsSurfaces>::close_figure::operator=(close_figure&& other) noexcept {
 			if (this != &other) {
 				_Data = move(GraphicsSurfaces::paths::move_close_figure(move(other._Data)));
 			}
@@ -179,47 +179,47 @@ namespace std::experimental::io2d {
 		}
 
 		template<class GraphicsSurfaces>
-		inline basic_figure_items<GraphicsSurfaces>::close_figure::~close_figure() noexcept {
+		basic_figure_items<GraphicsSurfaces>::close_figure::~close_figure() noexcept {
 			GraphicsSurfaces::paths::destroy(_Data);
 		}
         
         template<class GraphicsSurfaces>
-        inline bool basic_figure_items<GraphicsSurfaces>::close_figure::operator==(const close_figure& rhs) const noexcept {
+        bool basic_figure_items<GraphicsSurfaces>::close_figure::operator==(const close_figure& rhs) const noexcept {
             return true;
         }
         
         template<class GraphicsSurfaces>
-        inline bool basic_figure_items<GraphicsSurfaces>::close_figure::operator!=(const close_figure& rhs) const noexcept {
+        bool basic_figure_items<GraphicsSurfaces>::close_figure::operator!=(const close_figure& rhs) const noexcept {
             return !(*this == rhs);
         }                
                 
 		template<class GraphicsSurfaces>
-		inline const typename basic_figure_items<GraphicsSurfaces>::abs_matrix::data_type& basic_figure_items<GraphicsSurfaces>::abs_matrix::data() const noexcept {
+		const typename basic_figure_items<GraphicsSurfaces>::abs_matrix::data_type& basic_figure_items<GraphicsSurfaces>::abs_matrix::data() const noexcept {
 			return _Data;
 		}
 
 		template<class GraphicsSurfaces>
-		inline typename basic_figure_items<GraphicsSurfaces>::abs_matrix::data_type& basic_figure_items<GraphicsSurfaces>::abs_matrix::data() noexcept {
+		typename basic_figure_items<GraphicsSurfaces>::abs_matrix::data_type& basic_figure_items<GraphicsSurfaces>::abs_matrix::data() noexcept {
 			return _Data;
 		}
 
 		template<class GraphicsSurfaces>
-		inline basic_figure_items<GraphicsSurfaces>::abs_matrix::abs_matrix() noexcept
+		basic_figure_items<GraphicsSurfaces>::abs_matrix::abs_matrix() noexcept
 			: _Data(GraphicsSurfaces::paths::create_abs_matrix()) {
 		}
 
 		template<class GraphicsSurfaces>
-		inline basic_figure_items<GraphicsSurfaces>::abs_matrix::abs_matrix(const basic_matrix_2d<typename GraphicsSurfaces::graphics_math_type>& m) noexcept
+		basic_figure_items<GraphicsSurfaces>::abs_matrix::abs_matrix(const basic_matrix_2d<typename GraphicsSurfaces::graphics_math_type>& m) noexcept
 			: _Data(GraphicsSurfaces::paths::create_abs_matrix(m)) {
 		}
 
 		template<class GraphicsSurfaces>
-		inline basic_figure_items<GraphicsSurfaces>::abs_matrix::abs_matrix(const abs_matrix& other)
+		basic_figure_items<GraphicsSurfaces>::abs_matrix::abs_matrix(const abs_matrix& other)
 			: _Data(GraphicsSurfaces::paths::copy_abs_matrix(other._Data)) {
 		}
 
 		template<class GraphicsSurfaces>
-		inline typename basic_figure_items<GraphicsSurfaces>::abs_matrix& basic_figure_items<GraphicsSurfaces>::abs_matrix::operator=(const abs_matrix& other) {
+		typename basic_figure_items<GraphicsSurfaces>::abs_matrix& basic_figure_items<GraphicsSurfaces>::abs_matrix::operator=(const abs_matrix& other) {
 			if (this != &other) {
 				_Data = GraphicsSurfaces::paths::copy_abs_matrix(other._Data);
 			}
@@ -227,12 +227,12 @@ namespace std::experimental::io2d {
 		}
 
 		template<class GraphicsSurfaces>
-		inline basic_figure_items<GraphicsSurfaces>::abs_matrix::abs_matrix(abs_matrix&& other) noexcept
+		basic_figure_items<GraphicsSurfaces>::abs_matrix::abs_matrix(abs_matrix&& other) noexcept
 			: _Data(move(GraphicsSurfaces::paths::move_abs_matrix(move(other._Data)))) {
 		}
 
 		template<class GraphicsSurfaces>
-		inline typename basic_figure_items<GraphicsSurfaces>::abs_matrix& basic_figure_items<GraphicsSurfaces>::abs_matrix::operator=(abs_matrix&& other) noexcept {
+		typename basic_figure_items<GraphicsSurfaces>::abs_matrix& basic_figure_items<GraphicsSurfaces>::abs_matrix::operator=(abs_matrix&& other) noexcept {
 			if (this != &other) {
 				_Data = move(GraphicsSurfaces::paths::move_abs_matrix(move(other._Data)));
 			}
@@ -240,57 +240,57 @@ namespace std::experimental::io2d {
 		}
 
 		template<class GraphicsSurfaces>
-		inline basic_figure_items<GraphicsSurfaces>::abs_matrix::~abs_matrix() noexcept {
+		basic_figure_items<GraphicsSurfaces>::abs_matrix::~abs_matrix() noexcept {
 			GraphicsSurfaces::paths::destroy(_Data);
 		}
 
 		template<class GraphicsSurfaces>
-		inline void basic_figure_items<GraphicsSurfaces>::abs_matrix::matrix(const basic_matrix_2d<typename GraphicsSurfaces::graphics_math_type>& m) noexcept {
+		void basic_figure_items<GraphicsSurfaces>::abs_matrix::matrix(const basic_matrix_2d<typename GraphicsSurfaces::graphics_math_type>& m) noexcept {
 			GraphicsSurfaces::paths::matrix(_Data, m);
 		}
 
 		template<class GraphicsSurfaces>
-		inline basic_matrix_2d<typename GraphicsSurfaces::graphics_math_type> basic_figure_items<GraphicsSurfaces>::abs_matrix::matrix() const noexcept {
+		basic_matrix_2d<typename GraphicsSurfaces::graphics_math_type> basic_figure_items<GraphicsSurfaces>::abs_matrix::matrix() const noexcept {
 			return GraphicsSurfaces::paths::matrix(_Data);
 		}
 
         template<class GraphicsSurfaces>
-        inline bool basic_figure_items<GraphicsSurfaces>::abs_matrix::operator==(const abs_matrix& rhs) const noexcept {
+        bool basic_figure_items<GraphicsSurfaces>::abs_matrix::operator==(const abs_matrix& rhs) const noexcept {
             return matrix() == rhs.matrix();
         }
         
         template<class GraphicsSurfaces>
-        inline bool basic_figure_items<GraphicsSurfaces>::abs_matrix::operator!=(const abs_matrix& rhs) const noexcept {
+        bool basic_figure_items<GraphicsSurfaces>::abs_matrix::operator!=(const abs_matrix& rhs) const noexcept {
             return !(*this == rhs);
         }             
                 
 		template<class GraphicsSurfaces>
-		inline const typename basic_figure_items<GraphicsSurfaces>::rel_matrix::data_type& basic_figure_items<GraphicsSurfaces>::rel_matrix::data() const noexcept {
+		const typename basic_figure_items<GraphicsSurfaces>::rel_matrix::data_type& basic_figure_items<GraphicsSurfaces>::rel_matrix::data() const noexcept {
 			return _Data;
 		}
 
 		template<class GraphicsSurfaces>
-		inline typename basic_figure_items<GraphicsSurfaces>::rel_matrix::data_type& basic_figure_items<GraphicsSurfaces>::rel_matrix::data() noexcept {
+		typename basic_figure_items<GraphicsSurfaces>::rel_matrix::data_type& basic_figure_items<GraphicsSurfaces>::rel_matrix::data() noexcept {
 			return _Data;
 		}
 
 		template<class GraphicsSurfaces>
-		inline basic_figure_items<GraphicsSurfaces>::rel_matrix::rel_matrix() noexcept
+		basic_figure_items<GraphicsSurfaces>::rel_matrix::rel_matrix() noexcept
 			: _Data(GraphicsSurfaces::paths::create_rel_matrix()) {
 		}
 
 		template<class GraphicsSurfaces>
-		inline basic_figure_items<GraphicsSurfaces>::rel_matrix::rel_matrix(const basic_matrix_2d<typename GraphicsSurfaces::graphics_math_type>& m) noexcept
+		basic_figure_items<GraphicsSurfaces>::rel_matrix::rel_matrix(const basic_matrix_2d<typename GraphicsSurfaces::graphics_math_type>& m) noexcept
 			: _Data(GraphicsSurfaces::paths::create_rel_matrix(m)) {
 		}
 
 		template<class GraphicsSurfaces>
-		inline basic_figure_items<GraphicsSurfaces>::rel_matrix::rel_matrix(const rel_matrix& other)
+		basic_figure_items<GraphicsSurfaces>::rel_matrix::rel_matrix(const rel_matrix& other)
 			: _Data(GraphicsSurfaces::paths::copy_rel_matrix(other._Data)) {
 		}
 
 		template<class GraphicsSurfaces>
-		inline typename basic_figure_items<GraphicsSurfaces>::rel_matrix& basic_figure_items<GraphicsSurfaces>::rel_matrix::operator=(const rel_matrix& other) {
+		typename basic_figure_items<GraphicsSurfaces>::rel_matrix& basic_figure_items<GraphicsSurfaces>::rel_matrix::operator=(const rel_matrix& other) {
 			if (this != &other) {
 				_Data = GraphicsSurfaces::paths::copy_rel_matrix(other._Data);
 			}
@@ -298,12 +298,12 @@ namespace std::experimental::io2d {
 		}
 
 		template<class GraphicsSurfaces>
-		inline basic_figure_items<GraphicsSurfaces>::rel_matrix::rel_matrix(rel_matrix&& other) noexcept
+		basic_figure_items<GraphicsSurfaces>::rel_matrix::rel_matrix(rel_matrix&& other) noexcept
 			: _Data(move(GraphicsSurfaces::paths::move_rel_matrix(move(other._Data)))) {
 		}
 
 		template<class GraphicsSurfaces>
-		inline typename basic_figure_items<GraphicsSurfaces>::rel_matrix& basic_figure_items<GraphicsSurfaces>::rel_matrix::operator=(rel_matrix&& other) noexcept {
+		typename basic_figure_items<GraphicsSurfaces>::rel_matrix& basic_figure_items<GraphicsSurfaces>::rel_matrix::operator=(rel_matrix&& other) noexcept {
 			if (this != &other) {
 				_Data = move(GraphicsSurfaces::paths::move_rel_matrix(move(other._Data)));
 			}
@@ -311,634 +311,1150 @@ namespace std::experimental::io2d {
 		}
 
 		template<class GraphicsSurfaces>
-		inline basic_figure_items<GraphicsSurfaces>::rel_matrix::~rel_matrix() noexcept {
+		basic_figure_items<GraphicsSurfaces>::rel_matrix::~rel_matrix() noexcept {
 			GraphicsSurfaces::paths::destroy(_Data);
 		}
 
 		template<class GraphicsSurfaces>
-		inline void basic_figure_items<GraphicsSurfaces>::rel_matrix::matrix(const basic_matrix_2d<typename GraphicsSurfaces::graphics_math_type>& m) noexcept {
+		void basic_figure_items<GraphicsSurfaces>::rel_matrix::matrix(const basic_matrix_2d<typename GraphicsSurfaces::graphics_math_type>& m) noexcept {
 			GraphicsSurfaces::paths::matrix(_Data, m);
 		}
 
 		template<class GraphicsSurfaces>
-		inline basic_matrix_2d<typename GraphicsSurfaces::graphics_math_type> basic_figure_items<GraphicsSurfaces>::rel_matrix::matrix() const noexcept {
+		basic_matrix_2d<typename GraphicsSurfaces::graphics_math_type> basic_figure_items<GraphicsSurfaces>::rel_matrix::matrix() const noexcept {
 			return GraphicsSurfaces::paths::matrix(_Data);
 		}
 
         template<class GraphicsSurfaces>
-        inline bool basic_figure_items<GraphicsSurfaces>::rel_matrix::operator==(const rel_matrix& rhs) const noexcept {
+        bool basic_figure_items<GraphicsSurfaces>::rel_matrix::operator==(const rel_matrix& rhs) const noexcept {
             return matrix() == rhs.matrix();
         }
         
         template<class GraphicsSurfaces>
-        inline bool basic_figure_items<GraphicsSurfaces>::rel_matrix::operator!=(const rel_matrix& rhs) const noexcept {
+        bool basic_figure_items<GraphicsSurfaces>::rel_matrix::operator!=(const rel_matrix& rhs) const noexcept {
             return !(*this == rhs);
         }               
 
 		template<class GraphicsSurfaces>
-		inline const typename basic_figure_items<GraphicsSurfaces>::revert_matrix::data_type& basic_figure_items<GraphicsSurfaces>::revert_matrix::data() const noexcept {
+		const typename basic_figure_items<GraphicsSurfaces>::revert_matrix::data_type& basic_figure_items<GraphicsSurfaces>::revert_matrix::data() const noexcept {
 			return _Data;
 		}
 		template<class GraphicsSurfaces>
-		inline typename basic_figure_items<GraphicsSurfaces>::revert_matrix::data_type& basic_figure_items<GraphicsSurfaces>::revert_matrix::data() noexcept {
+		typename basic_figure_items<GraphicsSurfaces>::revert_matrix::data_type& basic_figure_items<GraphicsSurfaces>::revert_matrix::data() noexcept {
 			return _Data;
 		}
 		template<class GraphicsSurfaces>
-		inline basic_figure_items<GraphicsSurfaces>::revert_matrix::revert_matrix() noexcept
+		basic_figure_items<GraphicsSurfaces>::revert_matrix::revert_matrix() noexcept
 			: _Data(GraphicsSurfaces::paths::create_revert_matrix()) {
 		}
 		template<class GraphicsSurfaces>
-		inline basic_figure_items<GraphicsSurfaces>::revert_matrix::revert_matrix(const revert_matrix& other)
+		basic_figure_items<GraphicsSurfaces>::revert_matrix::revert_matrix(const revert_matrix& other)
 			: _Data(GraphicsSurfaces::paths::copy_revert_matrix(other._Data)) {
 		}
 		template<class GraphicsSurfaces>
-		inline typename basic_figure_items<GraphicsSurfaces>::revert_matrix& basic_figure_items<GraphicsSurfaces>::revert_matrix::operator=(const revert_matrix& other) {
+		typename basic_figure_items<GraphicsSurfaces>::revert_matrix& basic_figure_items<GraphicsSurfaces>::revert_matrix::operator=(const revert_matrix& other) {
 			if (this != &other) {
 				_Data = GraphicsSurfaces::paths::copy_revert_matrix(other._Data);
 			}
 			return *this;
 		}
 		template<class GraphicsSurfaces>
-		inline basic_figure_items<GraphicsSurfaces>::revert_matrix::revert_matrix(revert_matrix&& other) noexcept
+		basic_figure_items<GraphicsSurfaces>::revert_matrix::revert_matrix(revert_matrix&& other) noexcept
 			: _Data(move(GraphicsSurfaces::paths::move_revert_matrix(move(other._Data)))) {
 		}
 		template<class GraphicsSurfaces>
-		inline typename basic_figure_items<GraphicsSurfaces>::revert_matrix& basic_figure_items<GraphicsSurfaces>::revert_matrix::operator=(revert_matrix&& other) noexcept {
+		typename basic_figure_items<GraphicsSurfaces>::revert_matrix& basic_figure_items<GraphicsSurfaces>::revert_matrix::operator=(revert_matrix&& other) noexcept {
 			if (this != &other) {
 				_Data = move(GraphicsSurfaces::paths::move_revert_matrix(move(other._Data)));
 			}
 			return *this;
 		}
 		template<class GraphicsSurfaces>
-		inline basic_figure_items<GraphicsSurfaces>::revert_matrix::~revert_matrix() noexcept {
+		basic_figure_items<GraphicsSurfaces>::revert_matrix::~revert_matrix() noexcept {
 			GraphicsSurfaces::paths::destroy(_Data);
 		}
         
         template<class GraphicsSurfaces>
-        inline bool basic_figure_items<GraphicsSurfaces>::revert_matrix::operator==(const revert_matrix& rhs) const noexcept {
+        bool basic_figure_items<GraphicsSurfaces>::revert_matrix::operator==(const revert_matrix& rhs) const noexcept {
             return true;
         }
         
         template<class GraphicsSurfaces>
-        inline bool basic_figure_items<GraphicsSurfaces>::revert_matrix::operator!=(const revert_matrix& rhs) const noexcept {
+        bool basic_figure_items<GraphicsSurfaces>::revert_matrix::operator!=(const revert_matrix& rhs) const noexcept {
             return !(*this == rhs);
         }
 
 		template<class GraphicsSurfaces>
-		inline const typename basic_figure_items<GraphicsSurfaces>::abs_line::data_type& basic_figure_items<GraphicsSurfaces>::abs_line::data() const noexcept {
+		const typename basic_figure_items<GraphicsSurfaces>::abs_line::data_type& basic_figure_items<GraphicsSurfaces>::abs_line::data() const noexcept {
 			return _Data;
 		}
 		template<class GraphicsSurfaces>
-		inline typename basic_figure_items<GraphicsSurfaces>::abs_line::data_type& basic_figure_items<GraphicsSurfaces>::abs_line::data() noexcept {
+		typename basic_figure_items<GraphicsSurfaces>::abs_line::data_type& basic_figure_items<GraphicsSurfaces>::abs_line::data() noexcept {
 			return _Data;
 		}
 		template<class GraphicsSurfaces>
-		inline basic_figure_items<GraphicsSurfaces>::abs_line::abs_line() noexcept
+		basic_figure_items<GraphicsSurfaces>::abs_line::abs_line() noexcept
 			: _Data(GraphicsSurfaces::paths::create_abs_line()) {
 		}
 		template<class GraphicsSurfaces>
-		inline basic_figure_items<GraphicsSurfaces>::abs_line::abs_line(const basic_point_2d<typename GraphicsSurfaces::graphics_math_type>& pt) noexcept
+		basic_figure_items<GraphicsSurfaces>::abs_line::abs_line(const basic_point_2d<typename GraphicsSurfaces::graphics_math_type>& pt) noexcept
 			: _Data(GraphicsSurfaces::paths::create_abs_line(pt)) {
 		}
 		template<class GraphicsSurfaces>
-		inline basic_figure_items<GraphicsSurfaces>::abs_line::abs_line(const abs_line& other)
+		basic_figure_items<GraphicsSurfaces>::abs_line::abs_line(const abs_line& other)
 			: _Data(GraphicsSurfaces::paths::copy_abs_line(other._Data)) {
 		}
 		template<class GraphicsSurfaces>
-		inline typename basic_figure_items<GraphicsSurfaces>::abs_line& basic_figure_items<GraphicsSurfaces>::abs_line::operator=(const abs_line& other) {
+		typename basic_figure_items<GraphicsSurfaces>::abs_line& basic_figure_items<GraphicsSurfaces>::abs_line::operator=(const abs_line& other) {
 			if (this != &other) {
 				_Data = GraphicsSurfaces::paths::copy_abs_line(other._Data);
 			}
 			return *this;
 		}
 		template<class GraphicsSurfaces>
-		inline basic_figure_items<GraphicsSurfaces>::abs_line::abs_line(abs_line&& other) noexcept
+		basic_figure_items<GraphicsSurfaces>::abs_line::abs_line(abs_line&& other) noexcept
 			: _Data(move(GraphicsSurfaces::paths::move_abs_line(move(other._Data)))) {
 		}
 		template<class GraphicsSurfaces>
-		inline typename basic_figure_items<GraphicsSurfaces>::abs_line& basic_figure_items<GraphicsSurfaces>::abs_line::operator=(abs_line&& other) noexcept {
+		typename basic_figure_items<GraphicsSurfaces>::abs_line& basic_figure_items<GraphicsSurfaces>::abs_line::operator=(abs_line&& other) noexcept {
 			if (this != &other) {
 				_Data = move(GraphicsSurfaces::paths::move_abs_line(move(other._Data)));
 			}
 			return *this;
 		}
 		template<class GraphicsSurfaces>
-		inline basic_figure_items<GraphicsSurfaces>::abs_line::~abs_line() noexcept {
+		basic_figure_items<GraphicsSurfaces>::abs_line::~abs_line() noexcept {
 			GraphicsSurfaces::paths::destroy(_Data);
 		}
 		template<class GraphicsSurfaces>
-		inline void basic_figure_items<GraphicsSurfaces>::abs_line::to(const basic_point_2d<typename GraphicsSurfaces::graphics_math_type>& pt) noexcept {
+		void basic_figure_items<GraphicsSurfaces>::abs_line::to(const basic_point_2d<typename GraphicsSurfaces::graphics_math_type>& pt) noexcept {
 			GraphicsSurfaces::paths::to(_Data, pt);
 		}
 		template<class GraphicsSurfaces>
-		inline basic_point_2d<typename GraphicsSurfaces::graphics_math_type> basic_figure_items<GraphicsSurfaces>::abs_line::to() const noexcept {
+		basic_point_2d<typename GraphicsSurfaces::graphics_math_type> basic_figure_items<GraphicsSurfaces>::abs_line::to() const noexcept {
 			return GraphicsSurfaces::paths::to(_Data);
 		}
 
         template<class GraphicsSurfaces>
-        inline bool basic_figure_items<GraphicsSurfaces>::abs_line::operator==(const abs_line& rhs) const noexcept {
+        bool basic_figure_items<GraphicsSurfaces>::abs_line::operator==(const abs_line& rhs) const noexcept {
             return to() == rhs.to();
         }
         
         template<class GraphicsSurfaces>
-        inline bool basic_figure_items<GraphicsSurfaces>::abs_line::operator!=(const abs_line& rhs) const noexcept {
+        bool basic_figure_items<GraphicsSurfaces>::abs_line::operator!=(const abs_line& rhs) const noexcept {
             return !(*this == rhs);
         }        
 
 		template<class GraphicsSurfaces>
-		inline const typename basic_figure_items<GraphicsSurfaces>::rel_line::data_type& std::experimental::io2d::v1::basic_figure_items<GraphicsSurfaces>::rel_line::data() const noexcept {
+		const typename basic_figure_items<GraphicsSurfaces>::rel_line::data_type& std::experimental::io2d::v1::basic_figure_items<GraphicsSurfaces>::rel_line::data() const noexcept {
 			return _Data;
 		}
 		template<class GraphicsSurfaces>
-		inline typename basic_figure_items<GraphicsSurfaces>::rel_line::data_type& basic_figure_items<GraphicsSurfaces>::rel_line::data() noexcept {
+		typename basic_figure_items<GraphicsSurfaces>::rel_line::data_type& basic_figure_items<GraphicsSurfaces>::rel_line::data() noexcept {
 			return _Data;
 		}
 		template<class GraphicsSurfaces>
-		inline basic_figure_items<GraphicsSurfaces>::rel_line::rel_line() noexcept
+		basic_figure_items<GraphicsSurfaces>::rel_line::rel_line() noexcept
 			: _Data(GraphicsSurfaces::paths::create_rel_line()) {
 		}
 		template<class GraphicsSurfaces>
-		inline basic_figure_items<GraphicsSurfaces>::rel_line::rel_line(const basic_point_2d<typename GraphicsSurfaces::graphics_math_type>& pt) noexcept
+		basic_figure_items<GraphicsSurfaces>::rel_line::rel_line(const basic_point_2d<typename GraphicsSurfaces::graphics_math_type>& pt) noexcept
 			: _Data(GraphicsSurfaces::paths::create_rel_line(pt)) {
 		}
 		template<class GraphicsSurfaces>
-		inline basic_figure_items<GraphicsSurfaces>::rel_line::rel_line(const rel_line& other)
+		basic_figure_items<GraphicsSurfaces>::rel_line::rel_line(const rel_line& other)
 			: _Data(GraphicsSurfaces::paths::copy_rel_line(other._Data)) {
 		}
 		template<class GraphicsSurfaces>
-		inline typename basic_figure_items<GraphicsSurfaces>::rel_line& basic_figure_items<GraphicsSurfaces>::rel_line::operator=(const rel_line& other) {
+		typename basic_figure_items<GraphicsSurfaces>::rel_line& basic_figure_items<GraphicsSurfaces>::rel_line::operator=(const rel_line& other) {
 			if (this != &other) {
 				_Data = GraphicsSurfaces::paths::copy_rel_line(other._Data);
 			}
 			return *this;
 		}
 		template<class GraphicsSurfaces>
-		inline basic_figure_items<GraphicsSurfaces>::rel_line::rel_line(rel_line&& other) noexcept
+		basic_figure_items<GraphicsSurfaces>::rel_line::rel_line(rel_line&& other) noexcept
 			: _Data(move(GraphicsSurfaces::paths::move_rel_line(move(other._Data)))) {
 		}
 		template<class GraphicsSurfaces>
-		inline typename basic_figure_items<GraphicsSurfaces>::rel_line& basic_figure_items<GraphicsSurfaces>::rel_line::operator=(rel_line&& other) noexcept {
+		typename basic_figure_items<GraphicsSurfaces>::rel_line& basic_figure_items<GraphicsSurfaces>::rel_line::operator=(rel_line&& other) noexcept {
 			if (this != &other) {
 				_Data = move(GraphicsSurfaces::paths::move_rel_line(move(other._Data)));
 			}
 			return *this;
 		}
 		template<class GraphicsSurfaces>
-		inline basic_figure_items<GraphicsSurfaces>::rel_line::~rel_line() noexcept {
+		basic_figure_items<GraphicsSurfaces>::rel_line::~rel_line() noexcept {
 			GraphicsSurfaces::paths::destroy(_Data);
 		}
 		template<class GraphicsSurfaces>
-		inline void basic_figure_items<GraphicsSurfaces>::rel_line::to(const basic_point_2d<typename GraphicsSurfaces::graphics_math_type>& pt) noexcept {
+		void basic_figure_items<GraphicsSurfaces>::rel_line::to(const basic_point_2d<typename GraphicsSurfaces::graphics_math_type>& pt) noexcept {
 			GraphicsSurfaces::paths::to(_Data, pt);
 		}
 		template<class GraphicsSurfaces>
-		inline basic_point_2d<typename GraphicsSurfaces::graphics_math_type> basic_figure_items<GraphicsSurfaces>::rel_line::to() const noexcept {
+		basic_point_2d<typename GraphicsSurfaces::graphics_math_type> basic_figure_items<GraphicsSurfaces>::rel_line::to() const noexcept {
 			return GraphicsSurfaces::paths::to(_Data);
 		}
 
         template<class GraphicsSurfaces>
-        inline bool basic_figure_items<GraphicsSurfaces>::rel_line::operator==(const rel_line& rhs) const noexcept {
+        bool basic_figure_items<GraphicsSurfaces>::rel_line::operator==(const rel_line& rhs) const noexcept {
             return to() == rhs.to();
         }
         
         template<class GraphicsSurfaces>
-        inline bool basic_figure_items<GraphicsSurfaces>::rel_line::operator!=(const rel_line& rhs) const noexcept {
+        bool basic_figure_items<GraphicsSurfaces>::rel_line::operator!=(const rel_line& rhs) const noexcept {
             return !(*this == rhs);
         }
         
 		template<class GraphicsSurfaces>
-		inline const typename basic_figure_items<GraphicsSurfaces>::abs_quadratic_curve::data_type& basic_figure_items<GraphicsSurfaces>::abs_quadratic_curve::data() const noexcept {
+		const typename basic_figure_items<GraphicsSurfaces>::abs_quadratic_curve::data_type& basic_figure_items<GraphicsSurfaces>::abs_quadratic_curve::data() const noexcept {
 			return _Data;
 		}
 		template<class GraphicsSurfaces>
-		inline typename basic_figure_items<GraphicsSurfaces>::abs_quadratic_curve::data_type& basic_figure_items<GraphicsSurfaces>::abs_quadratic_curve::data() noexcept {
+		typename basic_figure_items<GraphicsSurfaces>::abs_quadratic_curve::data_type& basic_figure_items<GraphicsSurfaces>::abs_quadratic_curve::data() noexcept {
 			return _Data;
 		}
 		template<class GraphicsSurfaces>
-		inline basic_figure_items<GraphicsSurfaces>::abs_quadratic_curve::abs_quadratic_curve() noexcept
+		basic_figure_items<GraphicsSurfaces>::abs_quadratic_curve::abs_quadratic_curve() noexcept
 			: _Data(GraphicsSurfaces::paths::create_abs_quadratic_curve()) {
 		}
 		template<class GraphicsSurfaces>
-		inline basic_figure_items<GraphicsSurfaces>::abs_quadratic_curve::abs_quadratic_curve(const basic_point_2d<typename GraphicsSurfaces::graphics_math_type>& cpt, const basic_point_2d<typename GraphicsSurfaces::graphics_math_type>& ept) noexcept
+		basic_figure_items<GraphicsSurfaces>::abs_quadratic_curve::abs_quadratic_curve(const basic_point_2d<typename GraphicsSurfaces::graphics_math_type>& cpt, const basic_point_2d<typename GraphicsSurfaces::graphics_math_type>& ept) noexcept
 			: _Data(GraphicsSurfaces::paths::create_abs_quadratic_curve(cpt, ept)) {
 		}
 		template<class GraphicsSurfaces>
-		inline basic_figure_items<GraphicsSurfaces>::abs_quadratic_curve::abs_quadratic_curve(const abs_quadratic_curve& other)
+		basic_figure_items<GraphicsSurfaces>::abs_quadratic_curve::abs_quadratic_curve(const abs_quadratic_curve& other)
 			: _Data(GraphicsSurfaces::paths::copy_abs_quadratic_curve(other._Data)) {
 		}
 		template<class GraphicsSurfaces>
-		inline typename basic_figure_items<GraphicsSurfaces>::abs_quadratic_curve& basic_figure_items<GraphicsSurfaces>::abs_quadratic_curve::operator=(const abs_quadratic_curve& other) {
+		typename basic_figure_items<GraphicsSurfaces>::abs_quadratic_curve& basic_figure_items<GraphicsSurfaces>::abs_quadratic_curve::operator=(const abs_quadratic_curve& other) {
 			if (this != &other) {
 				_Data = GraphicsSurfaces::paths::copy_abs_quadratic_curve(other._Data);
 			}
 			return *this;
 		}
 		template<class GraphicsSurfaces>
-		inline basic_figure_items<GraphicsSurfaces>::abs_quadratic_curve::abs_quadratic_curve(abs_quadratic_curve&& other) noexcept
+		basic_figure_items<GraphicsSurfaces>::abs_quadratic_curve::abs_quadratic_curve(abs_quadratic_curve&& other) noexcept
 			: _Data(move(GraphicsSurfaces::paths::move_abs_quadratic_curve(move(other._Data)))) {
 		}
 		template<class GraphicsSurfaces>
-		inline typename basic_figure_items<GraphicsSurfaces>::abs_quadratic_curve& basic_figure_items<GraphicsSurfaces>::abs_quadratic_curve::operator=(abs_quadratic_curve&& other) noexcept {
+		typename basic_figure_items<GraphicsSurfaces>::abs_quadratic_curve& basic_figure_items<GraphicsSurfaces>::abs_quadratic_curve::operator=(abs_quadratic_curve&& other) noexcept {
 			if (this != &other) {
 				_Data = move(GraphicsSurfaces::paths::move_abs_quadratic_curve(move(other._Data)));
 			}
 			return *this;
 		}
 		template<class GraphicsSurfaces>
-		inline basic_figure_items<GraphicsSurfaces>::abs_quadratic_curve::~abs_quadratic_curve() noexcept {
+		basic_figure_items<GraphicsSurfaces>::abs_quadratic_curve::~abs_quadratic_curve() noexcept {
 			GraphicsSurfaces::paths::destroy(_Data);
 		}
 		template<class GraphicsSurfaces>
-		inline void basic_figure_items<GraphicsSurfaces>::abs_quadratic_curve::control_pt(const basic_point_2d<typename GraphicsSurfaces::graphics_math_type>& cpt) noexcept {
+		void basic_figure_items<GraphicsSurfaces>::abs_quadratic_curve::control_pt(const basic_point_2d<typename GraphicsSurfaces::graphics_math_type>& cpt) noexcept {
 			GraphicsSurfaces::paths::control_pt(_Data, cpt);
 		}
 		template<class GraphicsSurfaces>
-		inline void basic_figure_items<GraphicsSurfaces>::abs_quadratic_curve::end_pt(const basic_point_2d<typename GraphicsSurfaces::graphics_math_type>& ept) noexcept {
+		void basic_figure_items<GraphicsSurfaces>::abs_quadratic_curve::end_pt(const basic_point_2d<typename GraphicsSurfaces::graphics_math_type>& ept) noexcept {
 			GraphicsSurfaces::paths::end_pt(_Data, ept);
 		}
 		template<class GraphicsSurfaces>
-		inline basic_point_2d<typename GraphicsSurfaces::graphics_math_type> basic_figure_items<GraphicsSurfaces>::abs_quadratic_curve::control_pt() const noexcept {
+		basic_point_2d<typename GraphicsSurfaces::graphics_math_type> basic_figure_items<GraphicsSurfaces>::abs_quadratic_curve::control_pt() const noexcept {
 			return GraphicsSurfaces::paths::control_pt(_Data);
 		}
 		template<class GraphicsSurfaces>
-		inline basic_point_2d<typename GraphicsSurfaces::graphics_math_type> basic_figure_items<GraphicsSurfaces>::abs_quadratic_curve::end_pt() const noexcept {
+		basic_point_2d<typename GraphicsSurfaces::graphics_math_type> basic_figure_items<GraphicsSurfaces>::abs_quadratic_curve::end_pt() const noexcept {
 			return GraphicsSurfaces::paths::end_pt(_Data);
 		}
 
         template<class GraphicsSurfaces>
-        inline bool basic_figure_items<GraphicsSurfaces>::abs_quadratic_curve::operator==(const abs_quadratic_curve& rhs) const noexcept {
+        bool basic_figure_items<GraphicsSurfaces>::abs_quadratic_curve::operator==(const abs_quadratic_curve& rhs) const noexcept {
             return control_pt() == rhs.control_pt() && end_pt() == rhs.end_pt();
         }
         
         template<class GraphicsSurfaces>
-        inline bool basic_figure_items<GraphicsSurfaces>::abs_quadratic_curve::operator!=(const abs_quadratic_curve& rhs) const noexcept {
+        bool basic_figure_items<GraphicsSurfaces>::abs_quadratic_curve::operator!=(const abs_quadratic_curve& rhs) const noexcept {
             return !(*this == rhs);
         }        
         
 		template<class GraphicsSurfaces>
-		inline const typename basic_figure_items<GraphicsSurfaces>::rel_quadratic_curve::data_type& basic_figure_items<GraphicsSurfaces>::rel_quadratic_curve::data() const noexcept {
+		const typename basic_figure_items<GraphicsSurfaces>::rel_quadratic_curve::data_type& basic_figure_items<GraphicsSurfaces>::rel_quadratic_curve::data() const noexcept {
 			return _Data;
 		}
 		template<class GraphicsSurfaces>
-		inline typename basic_figure_items<GraphicsSurfaces>::rel_quadratic_curve::data_type& basic_figure_items<GraphicsSurfaces>::rel_quadratic_curve::data() noexcept {
+		typename basic_figure_items<GraphicsSurfaces>::rel_quadratic_curve::data_type& basic_figure_items<GraphicsSurfaces>::rel_quadratic_curve::data() noexcept {
 			return _Data;
 		}
 		template<class GraphicsSurfaces>
-		inline basic_figure_items<GraphicsSurfaces>::rel_quadratic_curve::rel_quadratic_curve() noexcept
+		basic_figure_items<GraphicsSurfaces>::rel_quadratic_curve::rel_quadratic_curve() noexcept
 			: _Data(GraphicsSurfaces::paths::create_rel_quadratic_curve()) {
 		}
 		template<class GraphicsSurfaces>
-		inline basic_figure_items<GraphicsSurfaces>::rel_quadratic_curve::rel_quadratic_curve(const basic_point_2d<typename GraphicsSurfaces::graphics_math_type>& cpt, const basic_point_2d<typename GraphicsSurfaces::graphics_math_type>& ept) noexcept
+		basic_figure_items<GraphicsSurfaces>::rel_quadratic_curve::rel_quadratic_curve(const basic_point_2d<typename GraphicsSurfaces::graphics_math_type>& cpt, const basic_point_2d<typename GraphicsSurfaces::graphics_math_type>& ept) noexcept
 			: _Data(GraphicsSurfaces::paths::create_rel_quadratic_curve(cpt, ept)) {
 		}
 		template<class GraphicsSurfaces>
-		inline basic_figure_items<GraphicsSurfaces>::rel_quadratic_curve::rel_quadratic_curve(const rel_quadratic_curve& other)
+		basic_figure_items<GraphicsSurfaces>::rel_quadratic_curve::rel_quadratic_curve(const rel_quadratic_curve& other)
 			: _Data(GraphicsSurfaces::paths::copy_rel_quadratic_curve(other._Data)) {
 		}
 		template<class GraphicsSurfaces>
-		inline typename basic_figure_items<GraphicsSurfaces>::rel_quadratic_curve& basic_figure_items<GraphicsSurfaces>::rel_quadratic_curve::operator=(const rel_quadratic_curve& other) {
+		typename basic_figure_items<GraphicsSurfaces>::rel_quadratic_curve& basic_figure_items<GraphicsSurfaces>::rel_quadratic_curve::operator=(const rel_quadratic_curve& other) {
 			if (this != &other) {
 				_Data = GraphicsSurfaces::paths::copy_rel_quadratic_curve(other._Data);
 			}
 			return *this;
 		}
 		template<class GraphicsSurfaces>
-		inline basic_figure_items<GraphicsSurfaces>::rel_quadratic_curve::rel_quadratic_curve(rel_quadratic_curve&& other) noexcept
+		basic_figure_items<GraphicsSurfaces>::rel_quadratic_curve::rel_quadratic_curve(rel_quadratic_curve&& other) noexcept
 			: _Data(move(GraphicsSurfaces::paths::move_rel_quadratic_curve(move(other._Data)))) {
 		}
 		template<class GraphicsSurfaces>
-		inline typename basic_figure_items<GraphicsSurfaces>::rel_quadratic_curve& basic_figure_items<GraphicsSurfaces>::rel_quadratic_curve::operator=(rel_quadratic_curve&& other) noexcept {
+		typename basic_figure_items<GraphicsSurfaces>::rel_quadratic_curve& basic_figure_items<GraphicsSurfaces>::rel_quadratic_curve::operator=(rel_quadratic_curve&& other) noexcept {
 			if (this != &other) {
 				_Data = move(GraphicsSurfaces::paths::move_rel_quadratic_curve(move(other._Data)));
 			}
 			return *this;
 		}
 		template<class GraphicsSurfaces>
-		inline basic_figure_items<GraphicsSurfaces>::rel_quadratic_curve::~rel_quadratic_curve() noexcept {
+		basic_figure_items<GraphicsSurfaces>::rel_quadratic_curve::~rel_quadratic_curve() noexcept {
 			GraphicsSurfaces::paths::destroy(_Data);
 		}
 		template<class GraphicsSurfaces>
-		inline void basic_figure_items<GraphicsSurfaces>::rel_quadratic_curve::control_pt(const basic_point_2d<typename GraphicsSurfaces::graphics_math_type>& cpt) noexcept {
+		void basic_figure_items<GraphicsSurfaces>::rel_quadratic_curve::control_pt(const basic_point_2d<typename GraphicsSurfaces::graphics_math_type>& cpt) noexcept {
 			GraphicsSurfaces::paths::control_pt(_Data, cpt);
 		}
 		template<class GraphicsSurfaces>
-		inline void basic_figure_items<GraphicsSurfaces>::rel_quadratic_curve::end_pt(const basic_point_2d<typename GraphicsSurfaces::graphics_math_type>& ept) noexcept {
+		void basic_figure_items<GraphicsSurfaces>::rel_quadratic_curve::end_pt(const basic_point_2d<typename GraphicsSurfaces::graphics_math_type>& ept) noexcept {
 			GraphicsSurfaces::paths::end_pt(_Data, ept);
 		}
 		template<class GraphicsSurfaces>
-		inline basic_point_2d<typename GraphicsSurfaces::graphics_math_type> basic_figure_items<GraphicsSurfaces>::rel_quadratic_curve::control_pt() const noexcept {
+		basic_point_2d<typename GraphicsSurfaces::graphics_math_type> basic_figure_items<GraphicsSurfaces>::rel_quadratic_curve::control_pt() const noexcept {
 			return GraphicsSurfaces::paths::control_pt(_Data);
 		}
 		template<class GraphicsSurfaces>
-		inline basic_point_2d<typename GraphicsSurfaces::graphics_math_type> basic_figure_items<GraphicsSurfaces>::rel_quadratic_curve::end_pt() const noexcept {
+		basic_point_2d<typename GraphicsSurfaces::graphics_math_type> basic_figure_items<GraphicsSurfaces>::rel_quadratic_curve::end_pt() const noexcept {
 			return GraphicsSurfaces::paths::end_pt(_Data);
 		}
 
         template<class GraphicsSurfaces>
-        inline bool basic_figure_items<GraphicsSurfaces>::rel_quadratic_curve::operator==(const rel_quadratic_curve& rhs) const noexcept {
+        bool basic_figure_items<GraphicsSurfaces>::rel_quadratic_curve::operator==(const rel_quadratic_curve& rhs) const noexcept {
             return control_pt() == rhs.control_pt() && end_pt() == rhs.end_pt();
         }
         
         template<class GraphicsSurfaces>
-        inline bool basic_figure_items<GraphicsSurfaces>::rel_quadratic_curve::operator!=(const rel_quadratic_curve& rhs) const noexcept {
+        bool basic_figure_items<GraphicsSurfaces>::rel_quadratic_curve::operator!=(const rel_quadratic_curve& rhs) const noexcept {
             return !(*this == rhs);
         }             
         
 		template<class GraphicsSurfaces>
-		inline const typename basic_figure_items<GraphicsSurfaces>::abs_cubic_curve::data_type& basic_figure_items<GraphicsSurfaces>::abs_cubic_curve::data() const noexcept {
+		const typename basic_figure_items<GraphicsSurfaces>::abs_cubic_curve::data_type& basic_figure_items<GraphicsSurfaces>::abs_cubic_curve::data() const noexcept {
 			return _Data;
 		}
 		template<class GraphicsSurfaces>
-		inline typename basic_figure_items<GraphicsSurfaces>::abs_cubic_curve::data_type& basic_figure_items<GraphicsSurfaces>::abs_cubic_curve::data() noexcept {
+		typename basic_figure_items<GraphicsSurfaces>::abs_cubic_curve::data_type& basic_figure_items<GraphicsSurfaces>::abs_cubic_curve::data() noexcept {
 			return _Data;
 		}
 		template<class GraphicsSurfaces>
-		inline basic_figure_items<GraphicsSurfaces>::abs_cubic_curve::abs_cubic_curve() noexcept
+		basic_figure_items<GraphicsSurfaces>::abs_cubic_curve::abs_cubic_curve() noexcept
 			: _Data(GraphicsSurfaces::paths::create_abs_cubic_curve()) {
 		}
 		template<class GraphicsSurfaces>
-		inline basic_figure_items<GraphicsSurfaces>::abs_cubic_curve::abs_cubic_curve(const basic_point_2d<typename GraphicsSurfaces::graphics_math_type>& cpt1, const basic_point_2d<typename GraphicsSurfaces::graphics_math_type>& cpt2, const basic_point_2d<typename GraphicsSurfaces::graphics_math_type>& ept) noexcept
+		basic_figure_items<GraphicsSurfaces>::abs_cubic_curve::abs_cubic_curve(const basic_point_2d<typename GraphicsSurfaces::graphics_math_type>& cpt1, const basic_point_2d<typename GraphicsSurfaces::graphics_math_type>& cpt2, const basic_point_2d<typename GraphicsSurfaces::graphics_math_type>& ept) noexcept
 			: _Data(GraphicsSurfaces::paths::create_abs_cubic_curve(cpt1, cpt2, ept)) {
 		}
 		template<class GraphicsSurfaces>
-		inline basic_figure_items<GraphicsSurfaces>::abs_cubic_curve::abs_cubic_curve(const abs_cubic_curve& other)
+		basic_figure_items<GraphicsSurfaces>::abs_cubic_curve::abs_cubic_curve(const abs_cubic_curve& other)
 			: _Data(GraphicsSurfaces::paths::copy_abs_cubic_curve(other._Data)) {
 		}
 		template<class GraphicsSurfaces>
-		inline typename basic_figure_items<GraphicsSurfaces>::abs_cubic_curve& basic_figure_items<GraphicsSurfaces>::abs_cubic_curve::operator=(const abs_cubic_curve& other) {
+		typename basic_figure_items<GraphicsSurfaces>::abs_cubic_curve& basic_figure_items<GraphicsSurfaces>::abs_cubic_curve::operator=(const abs_cubic_curve& other) {
 			if (this != &other) {
 				_Data = GraphicsSurfaces::paths::copy_abs_cubic_curve(other._Data);
 			}
 			return *this;
 		}
 		template<class GraphicsSurfaces>
-		inline basic_figure_items<GraphicsSurfaces>::abs_cubic_curve::abs_cubic_curve(abs_cubic_curve&& other) noexcept
+		basic_figure_items<GraphicsSurfaces>::abs_cubic_curve::abs_cubic_curve(abs_cubic_curve&& other) noexcept
 			: _Data(move(GraphicsSurfaces::paths::move_abs_cubic_curve(move(other._Data)))) {
 		}
 		template<class GraphicsSurfaces>
-		inline typename basic_figure_items<GraphicsSurfaces>::abs_cubic_curve& basic_figure_items<GraphicsSurfaces>::abs_cubic_curve::operator=(abs_cubic_curve&& other) noexcept {
+		typename basic_figure_items<GraphicsSurfaces>::abs_cubic_curve& basic_figure_items<GraphicsSurfaces>::abs_cubic_curve::operator=(abs_cubic_curve&& other) noexcept {
 			if (this != &other) {
 				_Data = move(GraphicsSurfaces::paths::move_abs_cubic_curve(move(other._Data)));
 			}
 			return *this;
 		}
 		template<class GraphicsSurfaces>
-		inline basic_figure_items<GraphicsSurfaces>::abs_cubic_curve::~abs_cubic_curve() noexcept {
+		basic_figure_items<GraphicsSurfaces>::abs_cubic_curve::~abs_cubic_curve() noexcept {
 			GraphicsSurfaces::paths::destroy(_Data);
 		}
 		template<class GraphicsSurfaces>
-		inline void basic_figure_items<GraphicsSurfaces>::abs_cubic_curve::control_pt1(const basic_point_2d<typename GraphicsSurfaces::graphics_math_type>& cpt) noexcept {
+		void basic_figure_items<GraphicsSurfaces>::abs_cubic_curve::control_pt1(const basic_point_2d<typename GraphicsSurfaces::graphics_math_type>& cpt) noexcept {
 			GraphicsSurfaces::paths::control_pt1(_Data, cpt);
 		}
 		template<class GraphicsSurfaces>
-		inline void basic_figure_items<GraphicsSurfaces>::abs_cubic_curve::control_pt2(const basic_point_2d<typename GraphicsSurfaces::graphics_math_type>& cpt) noexcept {
+		void basic_figure_items<GraphicsSurfaces>::abs_cubic_curve::control_pt2(const basic_point_2d<typename GraphicsSurfaces::graphics_math_type>& cpt) noexcept {
 			GraphicsSurfaces::paths::control_pt2(_Data, cpt);
 		}
 		template<class GraphicsSurfaces>
-		inline void basic_figure_items<GraphicsSurfaces>::abs_cubic_curve::end_pt(const basic_point_2d<typename GraphicsSurfaces::graphics_math_type>& ept) noexcept {
+		void basic_figure_items<GraphicsSurfaces>::abs_cubic_curve::end_pt(const basic_point_2d<typename GraphicsSurfaces::graphics_math_type>& ept) noexcept {
 			GraphicsSurfaces::paths::end_pt(_Data, ept);
 		}
 		template<class GraphicsSurfaces>
-		inline basic_point_2d<typename GraphicsSurfaces::graphics_math_type> basic_figure_items<GraphicsSurfaces>::abs_cubic_curve::control_pt1() const noexcept {
+		basic_point_2d<typename GraphicsSurfaces::graphics_math_type> basic_figure_items<GraphicsSurfaces>::abs_cubic_curve::control_pt1() const noexcept {
 			return GraphicsSurfaces::paths::control_pt1(_Data);
 		}
 		template<class GraphicsSurfaces>
-		inline basic_point_2d<typename GraphicsSurfaces::graphics_math_type> basic_figure_items<GraphicsSurfaces>::abs_cubic_curve::control_pt2() const noexcept {
+		basic_point_2d<typename GraphicsSurfaces::graphics_math_type> basic_figure_items<GraphicsSurfaces>::abs_cubic_curve::control_pt2() const noexcept {
 			return GraphicsSurfaces::paths::control_pt2(_Data);
 		}
 		template<class GraphicsSurfaces>
-		inline basic_point_2d<typename GraphicsSurfaces::graphics_math_type> basic_figure_items<GraphicsSurfaces>::abs_cubic_curve::end_pt() const noexcept {
+		basic_point_2d<typename GraphicsSurfaces::graphics_math_type> basic_figure_items<GraphicsSurfaces>::abs_cubic_curve::end_pt() const noexcept {
 			return GraphicsSurfaces::paths::end_pt(_Data);
 		}
 
         template<class GraphicsSurfaces>
-        inline bool basic_figure_items<GraphicsSurfaces>::abs_cubic_curve::operator==(const abs_cubic_curve& rhs) const noexcept {
+        bool basic_figure_items<GraphicsSurfaces>::abs_cubic_curve::operator==(const abs_cubic_curve& rhs) const noexcept {
             return control_pt1() == rhs.control_pt1() && control_pt2() == rhs.control_pt2() && end_pt() == rhs.end_pt();
         }
         
         template<class GraphicsSurfaces>
-        inline bool basic_figure_items<GraphicsSurfaces>::abs_cubic_curve::operator!=(const abs_cubic_curve& rhs) const noexcept {
+        bool basic_figure_items<GraphicsSurfaces>::abs_cubic_curve::operator!=(const abs_cubic_curve& rhs) const noexcept {
             return !(*this == rhs);
         }
 
 		template<class GraphicsSurfaces>
-		inline const typename basic_figure_items<GraphicsSurfaces>::rel_cubic_curve::data_type& std::experimental::io2d::v1::basic_figure_items<GraphicsSurfaces>::rel_cubic_curve::data() const noexcept {
+		const typename basic_figure_items<GraphicsSurfaces>::rel_cubic_curve::data_type& std::experimental::io2d::v1::basic_figure_items<GraphicsSurfaces>::rel_cubic_curve::data() const noexcept {
 			return _Data;
 		}
 		template<class GraphicsSurfaces>
-		inline typename basic_figure_items<GraphicsSurfaces>::rel_cubic_curve::data_type& basic_figure_items<GraphicsSurfaces>::rel_cubic_curve::data() noexcept {
+		typename basic_figure_items<GraphicsSurfaces>::rel_cubic_curve::data_type& basic_figure_items<GraphicsSurfaces>::rel_cubic_curve::data() noexcept {
 			return _Data;
 		}
 		template<class GraphicsSurfaces>
-		inline basic_figure_items<GraphicsSurfaces>::rel_cubic_curve::rel_cubic_curve() noexcept
+		basic_figure_items<GraphicsSurfaces>::rel_cubic_curve::rel_cubic_curve() noexcept
 			: _Data(GraphicsSurfaces::paths::create_rel_cubic_curve()) {
 		}
 		template<class GraphicsSurfaces>
-		inline basic_figure_items<GraphicsSurfaces>::rel_cubic_curve::rel_cubic_curve(const basic_point_2d<typename GraphicsSurfaces::graphics_math_type>& cpt1, const basic_point_2d<typename GraphicsSurfaces::graphics_math_type>& cpt2, const basic_point_2d<typename GraphicsSurfaces::graphics_math_type>& ept) noexcept
+		basic_figure_items<GraphicsSurfaces>::rel_cubic_curve::rel_cubic_curve(const basic_point_2d<typename GraphicsSurfaces::graphics_math_type>& cpt1, const basic_point_2d<typename GraphicsSurfaces::graphics_math_type>& cpt2, const basic_point_2d<typename GraphicsSurfaces::graphics_math_type>& ept) noexcept
 			: _Data(GraphicsSurfaces::paths::create_rel_cubic_curve(cpt1, cpt2, ept)) {
 		}
 		template<class GraphicsSurfaces>
-		inline basic_figure_items<GraphicsSurfaces>::rel_cubic_curve::rel_cubic_curve(const rel_cubic_curve& other)
+		basic_figure_items<GraphicsSurfaces>::rel_cubic_curve::rel_cubic_curve(const rel_cubic_curve& other)
 			: _Data(GraphicsSurfaces::paths::copy_rel_cubic_curve(other._Data)) {
 		}
 		template<class GraphicsSurfaces>
-		inline typename basic_figure_items<GraphicsSurfaces>::rel_cubic_curve& basic_figure_items<GraphicsSurfaces>::rel_cubic_curve::operator=(const rel_cubic_curve& other) {
+		typename basic_figure_items<GraphicsSurfaces>::rel_cubic_curve& basic_figure_items<GraphicsSurfaces>::rel_cubic_curve::operator=(const rel_cubic_curve& other) {
 			if (this != &other) {
 				_Data = GraphicsSurfaces::paths::copy_rel_cubic_curve(other._Data);
 			}
 			return *this;
 		}
 		template<class GraphicsSurfaces>
-		inline basic_figure_items<GraphicsSurfaces>::rel_cubic_curve::rel_cubic_curve(rel_cubic_curve&& other) noexcept
+		basic_figure_items<GraphicsSurfaces>::rel_cubic_curve::rel_cubic_curve(rel_cubic_curve&& other) noexcept
 			: _Data(move(GraphicsSurfaces::paths::move_rel_cubic_curve(move(other._Data)))) {
 		}
 		template<class GraphicsSurfaces>
-		inline typename basic_figure_items<GraphicsSurfaces>::rel_cubic_curve& basic_figure_items<GraphicsSurfaces>::rel_cubic_curve::operator=(rel_cubic_curve&& other) noexcept {
+		typename basic_figure_items<GraphicsSurfaces>::rel_cubic_curve& basic_figure_items<GraphicsSurfaces>::rel_cubic_curve::operator=(rel_cubic_curve&& other) noexcept {
 			if (this != &other) {
 				_Data = move(GraphicsSurfaces::paths::move_rel_cubic_curve(move(other._Data)));
 			}
 			return *this;
 		}
 		template<class GraphicsSurfaces>
-		inline basic_figure_items<GraphicsSurfaces>::rel_cubic_curve::~rel_cubic_curve() noexcept {
+		basic_figure_items<GraphicsSurfaces>::rel_cubic_curve::~rel_cubic_curve() noexcept {
 			GraphicsSurfaces::paths::destroy(_Data);
 		}
 		template<class GraphicsSurfaces>
-		inline void basic_figure_items<GraphicsSurfaces>::rel_cubic_curve::control_pt1(const basic_point_2d<typename GraphicsSurfaces::graphics_math_type>& cpt) noexcept {
+		void basic_figure_items<GraphicsSurfaces>::rel_cubic_curve::control_pt1(const basic_point_2d<typename GraphicsSurfaces::graphics_math_type>& cpt) noexcept {
 			GraphicsSurfaces::paths::control_pt1(_Data, cpt);
 		}
 		template<class GraphicsSurfaces>
-		inline void basic_figure_items<GraphicsSurfaces>::rel_cubic_curve::control_pt2(const basic_point_2d<typename GraphicsSurfaces::graphics_math_type>& cpt) noexcept {
+		void basic_figure_items<GraphicsSurfaces>::rel_cubic_curve::control_pt2(const basic_point_2d<typename GraphicsSurfaces::graphics_math_type>& cpt) noexcept {
 			GraphicsSurfaces::paths::control_pt2(_Data, cpt);
 		}
 		template<class GraphicsSurfaces>
-		inline void basic_figure_items<GraphicsSurfaces>::rel_cubic_curve::end_pt(const basic_point_2d<typename GraphicsSurfaces::graphics_math_type>& ept) noexcept {
+		void basic_figure_items<GraphicsSurfaces>::rel_cubic_curve::end_pt(const basic_point_2d<typename GraphicsSurfaces::graphics_math_type>& ept) noexcept {
 			GraphicsSurfaces::paths::end_pt(_Data, ept);
 		}
 		template<class GraphicsSurfaces>
-		inline basic_point_2d<typename GraphicsSurfaces::graphics_math_type> basic_figure_items<GraphicsSurfaces>::rel_cubic_curve::control_pt1() const noexcept {
+		basic_point_2d<typename GraphicsSurfaces::graphics_math_type> basic_figure_items<GraphicsSurfaces>::rel_cubic_curve::control_pt1() const noexcept {
 			return GraphicsSurfaces::paths::control_pt1(_Data);
 		}
 		template<class GraphicsSurfaces>
-		inline basic_point_2d<typename GraphicsSurfaces::graphics_math_type> basic_figure_items<GraphicsSurfaces>::rel_cubic_curve::control_pt2() const noexcept {
+		basic_point_2d<typename GraphicsSurfaces::graphics_math_type> basic_figure_items<GraphicsSurfaces>::rel_cubic_curve::control_pt2() const noexcept {
 			return GraphicsSurfaces::paths::control_pt2(_Data);
 		}
 		template<class GraphicsSurfaces>
-		inline basic_point_2d<typename GraphicsSurfaces::graphics_math_type> basic_figure_items<GraphicsSurfaces>::rel_cubic_curve::end_pt() const noexcept {
+		basic_point_2d<typename GraphicsSurfaces::graphics_math_type> basic_figure_items<GraphicsSurfaces>::rel_cubic_curve::end_pt() const noexcept {
 			return GraphicsSurfaces::paths::end_pt(_Data);
 		}
 
         template<class GraphicsSurfaces>
-        inline bool basic_figure_items<GraphicsSurfaces>::rel_cubic_curve::operator==(const rel_cubic_curve& rhs) const noexcept {
+        bool basic_figure_items<GraphicsSurfaces>::rel_cubic_curve::operator==(const rel_cubic_curve& rhs) const noexcept {
             return control_pt1() == rhs.control_pt1() && control_pt2() == rhs.control_pt2() && end_pt() == rhs.end_pt();
         }
         
         template<class GraphicsSurfaces>
-        inline bool basic_figure_items<GraphicsSurfaces>::rel_cubic_curve::operator!=(const rel_cubic_curve& rhs) const noexcept {
+        bool basic_figure_items<GraphicsSurfaces>::rel_cubic_curve::operator!=(const rel_cubic_curve& rhs) const noexcept {
             return !(*this == rhs);
         }        
         
 		template<class GraphicsSurfaces>
-		inline const typename basic_figure_items<GraphicsSurfaces>::arc::data_type& std::experimental::io2d::v1::basic_figure_items<GraphicsSurfaces>::arc::data() const noexcept {
+		const typename basic_figure_items<GraphicsSurfaces>::arc::data_type& std::experimental::io2d::v1::basic_figure_items<GraphicsSurfaces>::arc::data() const noexcept {
 			return _Data;
 		}
 		template<class GraphicsSurfaces>
-		inline typename basic_figure_items<GraphicsSurfaces>::arc::data_type& basic_figure_items<GraphicsSurfaces>::arc::data() noexcept {
+		typename basic_figure_items<GraphicsSurfaces>::arc::data_type& basic_figure_items<GraphicsSurfaces>::arc::data() noexcept {
 			return _Data;
 		}
 		template<class GraphicsSurfaces>
-		inline basic_figure_items<GraphicsSurfaces>::arc::arc() noexcept
+		basic_figure_items<GraphicsSurfaces>::arc::arc() noexcept
 			: _Data(GraphicsSurfaces::paths::create_arc()) {
 		}
 		template<class GraphicsSurfaces>
-		inline basic_figure_items<GraphicsSurfaces>::arc::arc(const basic_point_2d<typename GraphicsSurfaces::graphics_math_type>& rad, float rot, float sang) noexcept
+		basic_figure_items<GraphicsSurfaces>::arc::arc(const basic_point_2d<typename GraphicsSurfaces::graphics_math_type>& rad, float rot, float sang) noexcept
 			: _Data(GraphicsSurfaces::paths::create_arc(rad, rot, sang)) {
 		}
 		template<class GraphicsSurfaces>
-		inline basic_figure_items<GraphicsSurfaces>::arc::arc(const arc& other)
+		basic_figure_items<GraphicsSurfaces>::arc::arc(const arc& other)
 			: _Data(GraphicsSurfaces::paths::copy_arc(other._Data)) {
 		}
 		template<class GraphicsSurfaces>
-		inline typename basic_figure_items<GraphicsSurfaces>::arc& basic_figure_items<GraphicsSurfaces>::arc::operator=(const arc& other) {
+		typename basic_figure_items<GraphicsSurfaces>::arc& basic_figure_items<GraphicsSurfaces>::arc::operator=(const arc& other) {
 			if (this != &other) {
 				_Data = GraphicsSurfaces::paths::copy_arc(other._Data);
 			}
 			return *this;
 		}
 		template<class GraphicsSurfaces>
-		inline basic_figure_items<GraphicsSurfaces>::arc::arc(arc&& other) noexcept
+		basic_figure_items<GraphicsSurfaces>::arc::arc(arc&& other) noexcept
 			: _Data(move(GraphicsSurfaces::paths::move_arc(move(other._Data)))) {
 		}
 		template<class GraphicsSurfaces>
-		inline typename basic_figure_items<GraphicsSurfaces>::arc& basic_figure_items<GraphicsSurfaces>::arc::operator=(arc&& other) noexcept {
+		typename basic_figure_items<GraphicsSurfaces>::arc& basic_figure_items<GraphicsSurfaces>::arc::operator=(arc&& other) noexcept {
 			if (this != &other) {
 				_Data = move(GraphicsSurfaces::paths::move_arc(move(other._Data)));
 			}
 			return *this;
 		}
 		template<class GraphicsSurfaces>
-		inline basic_figure_items<GraphicsSurfaces>::arc::~arc() noexcept {
+		basic_figure_items<GraphicsSurfaces>::arc::~arc() noexcept {
 			GraphicsSurfaces::paths::destroy(_Data);
 		}
 		template<class GraphicsSurfaces>
-		inline void basic_figure_items<GraphicsSurfaces>::arc::radius(const basic_point_2d<typename GraphicsSurfaces::graphics_math_type>& rad) noexcept {
+		void basic_figure_items<GraphicsSurfaces>::arc::radius(const basic_point_2d<typename GraphicsSurfaces::graphics_math_type>& rad) noexcept {
 			GraphicsSurfaces::paths::radius(_Data, rad);
 		}
 		template<class GraphicsSurfaces>
-		inline void basic_figure_items<GraphicsSurfaces>::arc::rotation(float rot) noexcept {
+		void basic_figure_items<GraphicsSurfaces>::arc::rotation(float rot) noexcept {
 			GraphicsSurfaces::paths::rotation(_Data, rot);
 		}
 		template<class GraphicsSurfaces>
-		inline void basic_figure_items<GraphicsSurfaces>::arc::start_angle(float radians) noexcept {
+		void basic_figure_items<GraphicsSurfaces>::arc::start_angle(float radians) noexcept {
 			GraphicsSurfaces::paths::start_angle(_Data, radians);
 		}
 		template<class GraphicsSurfaces>
-		inline basic_point_2d<typename GraphicsSurfaces::graphics_math_type> basic_figure_items<GraphicsSurfaces>::arc::radius() const noexcept {
+		basic_point_2d<typename GraphicsSurfaces::graphics_math_type> basic_figure_items<GraphicsSurfaces>::arc::radius() const noexcept {
 			return GraphicsSurfaces::paths::radius(_Data);
 		}
 		template<class GraphicsSurfaces>
-		inline float basic_figure_items<GraphicsSurfaces>::arc::rotation() const noexcept {
+		float basic_figure_items<GraphicsSurfaces>::arc::rotation() const noexcept {
 			return GraphicsSurfaces::paths::rotation(_Data);
 		}
 		template<class GraphicsSurfaces>
-		inline float basic_figure_items<GraphicsSurfaces>::arc::start_angle() const noexcept {
+		float basic_figure_items<GraphicsSurfaces>::arc::start_angle() const noexcept {
 			return GraphicsSurfaces::paths::start_angle(_Data);
 		}
 		template<class GraphicsSurfaces>
-		inline basic_point_2d<typename GraphicsSurfaces::graphics_math_type> basic_figure_items<GraphicsSurfaces>::arc::center(const basic_point_2d<typename GraphicsSurfaces::graphics_math_type>& cpt, const basic_matrix_2d<typename GraphicsSurfaces::graphics_math_type>& m) const noexcept {
+		basic_point_2d<typename GraphicsSurfaces::graphics_math_type> basic_figure_items<GraphicsSurfaces>::arc::center(const basic_point_2d<typename GraphicsSurfaces::graphics_math_type>& cpt, const basic_matrix_2d<typename GraphicsSurfaces::graphics_math_type>& m) const noexcept {
 			return GraphicsSurfaces::paths::center(_Data, cpt, m);
 		}
 		template<class GraphicsSurfaces>
-		inline basic_point_2d<typename GraphicsSurfaces::graphics_math_type> basic_figure_items<GraphicsSurfaces>::arc::end_pt(const basic_point_2d<typename GraphicsSurfaces::graphics_math_type>& cpt, const basic_matrix_2d<typename GraphicsSurfaces::graphics_math_type>& m) const noexcept {
+		basic_point_2d<typename GraphicsSurfaces::graphics_math_type> basic_figure_items<GraphicsSurfaces>::arc::end_pt(const basic_point_2d<typename GraphicsSurfaces::graphics_math_type>& cpt, const basic_matrix_2d<typename GraphicsSurfaces::graphics_math_type>& m) const noexcept {
 			return GraphicsSurfaces::paths::end_pt(_Data, cpt, m);
 		}
 
         template<class GraphicsSurfaces>
-        inline bool basic_figure_items<GraphicsSurfaces>::arc::operator==(const arc& rhs) const noexcept {
+        bool basic_figure_items<GraphicsSurfaces>::arc::operator==(const arc& rhs) const noexcept {
             return radius() == rhs.radius() && rotation() == rhs.rotation() && start_angle() == rhs.start_angle();
         }
         
         template<class GraphicsSurfaces>
-        inline bool basic_figure_items<GraphicsSurfaces>::arc::operator!=(const arc& rhs) const noexcept {
+        bool basic_figure_items<GraphicsSurfaces>::arc::operator!=(const arc& rhs) const noexcept {
             return !(*this == rhs);
         }
 
+		template <class GraphicsMath, size_t Capacity>
+		constexpr basic_static_path<GraphicsMath, Capacity>::basic_static_path() noexcept
+			: _Segments{}
+			, _Size(0)
+			, _Matrix()
+			, _Matrices{}
+			, _Matrix_depth(0)
+			, _Current_point()
+			, _Close_point() {
+		}
+
+		template <class GraphicsMath, size_t Capacity>
+		constexpr void basic_static_path<GraphicsMath, Capacity>::_Push(segment_type type, const basic_point_2d<GraphicsMath>& pt0, const basic_point_2d<GraphicsMath>& pt1, const basic_point_2d<GraphicsMath>& pt2) {
+			if (_Size == Capacity) {
+				throw ::std::length_error("basic_static_path capacity exceeded.");
+			}
+			auto& seg = _Segments[_Size++];
+			seg.type = type;
+			seg.pts[0] = pt0;
+			seg.pts[1] = pt1;
+			seg.pts[2] = pt2;
+		}
+
+		template <class GraphicsMath, size_t Capacity>
+		constexpr basic_matrix_2d<GraphicsMath> basic_static_path<GraphicsMath, Capacity>::_Relative_matrix() const noexcept {
+			auto amtx = _Matrix;
+			amtx.m20(0.0F); amtx.m21(0.0F); // obliterate translation since this is relative.
+			return amtx;
+		}
+
+		// Takes transformed, absolute points.
+		template <class GraphicsMath, size_t Capacity>
+		constexpr void basic_static_path<GraphicsMath, Capacity>::_Cubic_curve(const basic_point_2d<GraphicsMath>& pt0, const basic_point_2d<GraphicsMath>& pt1, const basic_point_2d<GraphicsMath>& pt2) {
+			if (_Current_point == pt0 && pt0 == pt1 && pt1 == pt2) {
+				return; // degenerate path segment
+			}
+			_Push(segment_type::cubic_curve, pt0, pt1, pt2);
+			_Current_point = pt2;
+		}
+
+		// Takes transformed, absolute points.
+		template <class GraphicsMath, size_t Capacity>
+		constexpr void basic_static_path<GraphicsMath, Capacity>::_Quadratic_curve(const basic_point_2d<GraphicsMath>& cpt, const basic_point_2d<GraphicsMath>& ept) {
+			constexpr float twoThirds = 2.0F / 3.0F;
+			if (_Current_point == cpt && cpt == ept) {
+				return; // degenerate path segment
+			}
+			const auto beginPt = _Current_point;
+			const basic_point_2d<GraphicsMath> cpt1 = { ((cpt.x() - beginPt.x()) * twoThirds) + beginPt.x(), ((cpt.y() - beginPt.y()) * twoThirds) + beginPt.y() };
+			const basic_point_2d<GraphicsMath> cpt2 = { ((cpt.x() - ept.x()) * twoThirds) + ept.x(), ((cpt.y() - ept.y()) * twoThirds) + ept.y() };
+			_Push(segment_type::cubic_curve, cpt1, cpt2, ept);
+			_Current_point = ept;
+		}
+
+		template <class GraphicsMath, size_t Capacity>
+		constexpr void basic_static_path<GraphicsMath, Capacity>::new_figure(const basic_point_2d<GraphicsMath>& pt) {
+			const auto tpt = pt * _Matrix;
+			_Push(segment_type::new_figure, tpt);
+			_Current_point = tpt;
+			_Close_point = tpt;
+		}
+
+		template <class GraphicsMath, size_t Capacity>
+		constexpr void basic_static_path<GraphicsMath, Capacity>::rel_new_figure(const basic_point_2d<GraphicsMath>& pt) {
+			const auto tpt = _Current_point + pt * _Relative_matrix();
+			_Push(segment_type::new_figure, tpt);
+			_Current_point = tpt;
+			_Close_point = tpt;
+		}
+
+		template <class GraphicsMath, size_t Capacity>
+		constexpr void basic_static_path<GraphicsMath, Capacity>::close_figure() {
+			if (_Size == 0 || _Segments[_Size - 1].type == segment_type::new_figure) {
+				return; // degenerate path
+			}
+			_Push(segment_type::close_figure);
+			_Push(segment_type::new_figure, _Close_point);
+			_Current_point = _Close_point;
+		}
+
+		template <class GraphicsMath, size_t Capacity>
+		constexpr void basic_static_path<GraphicsMath, Capacity>::matrix(const basic_matrix_2d<GraphicsMath>& m) {
+			if (_Matrix_depth == max_matrix_depth) {
+				throw ::std::length_error("basic_static_path max_matrix_depth exceeded.");
+			}
+			_Matrices[_Matrix_depth++] = _Matrix;
+			_Matrix = m;
+		}
+
+		template <class GraphicsMath, size_t Capacity>
+		constexpr void basic_static_path<GraphicsMath, Capacity>::rel_matrix(const basic_matrix_2d<GraphicsMath>& m) {
+			matrix(m * _Matrix);
+		}
+
+		template <class GraphicsMath, size_t Capacity>
+		constexpr void basic_static_path<GraphicsMath, Capacity>::revert_matrix() noexcept {
+			if (_Matrix_depth == 0) {
+				_Matrix = basic_matrix_2d<GraphicsMath>{};
+			}
+			else {
+				_Matrix = _Matrices[--_Matrix_depth];
+			}
+		}
+
+		template <class GraphicsMath, size_t Capacity>
+		constexpr void basic_static_path<GraphicsMath, Capacity>::line(const basic_point_2d<GraphicsMath>& pt) {
+			const auto tpt = pt * _Matrix;
+			if (_Current_point == tpt) {
+				return; // degenerate path segment
+			}
+			_Push(segment_type::line, tpt);
+			_Current_point = tpt;
+		}
+
+		template <class GraphicsMath, size_t Capacity>
+		constexpr void basic_static_path<GraphicsMath, Capacity>::rel_line(const basic_point_2d<GraphicsMath>& dpt) {
+			const auto tpt = _Current_point + dpt * _Relative_matrix();
+			if (_Current_point == tpt) {
+				return; // degenerate path segment
+			}
+			_Push(segment_type::line, tpt);
+			_Current_point = tpt;
+		}
+
+		template <class GraphicsMath, size_t Capacity>
+		constexpr void basic_static_path<GraphicsMath, Capacity>::quadratic_curve(const basic_point_2d<GraphicsMath>& pt0, const basic_point_2d<GraphicsMath>& pt2) {
+			_Quadratic_curve(pt0 * _Matrix, pt2 * _Matrix);
+		}
+
+		template <class GraphicsMath, size_t Capacity>
+		constexpr void basic_static_path<GraphicsMath, Capacity>::rel_quadratic_curve(const basic_point_2d<GraphicsMath>& pt0, const basic_point_2d<GraphicsMath>& pt2) {
+			const auto amtx = _Relative_matrix();
+			const auto cpt = _Current_point + pt0 * amtx;
+			_Quadratic_curve(cpt, cpt + pt2 * amtx);
+		}
+
+		template <class GraphicsMath, size_t Capacity>
+		constexpr void basic_static_path<GraphicsMath, Capacity>::cubic_curve(const basic_point_2d<GraphicsMath>& pt0, const basic_point_2d<GraphicsMath>& pt1, const basic_point_2d<GraphicsMath>& pt2) {
+			_Cubic_curve(pt0 * _Matrix, pt1 * _Matrix, pt2 * _Matrix);
+		}
+
+		template <class GraphicsMath, size_t Capacity>
+		constexpr void basic_static_path<GraphicsMath, Capacity>::rel_cubic_curve(const basic_point_2d<GraphicsMath>& dpt0, const basic_point_2d<GraphicsMath>& dpt1, const basic_point_2d<GraphicsMath>& dpt2) {
+			const auto amtx = _Relative_matrix();
+			const auto pt0 = dpt0 * amtx;
+			const auto pt1 = dpt1 * amtx;
+			const auto pt2 = dpt2 * amtx;
+			if (_Current_point == pt0 && pt0 == pt1 && pt1 == pt2) {
+				return; // degenerate path segment
+			}
+			_Push(segment_type::cubic_curve, _Current_point + pt0, _Current_point + pt0 + pt1, _Current_point + pt0 + pt1 + pt2);
+			_Current_point = _Current_point + pt0 + pt1 + pt2;
+		}
+
+		template <class GraphicsMath, size_t Capacity>
+		constexpr typename basic_static_path<GraphicsMath, Capacity>::const_iterator basic_static_path<GraphicsMath, Capacity>::begin() const noexcept {
+			return _Segments;
+		}
+
+		template <class GraphicsMath, size_t Capacity>
+		constexpr typename basic_static_path<GraphicsMath, Capacity>::const_iterator basic_static_path<GraphicsMath, Capacity>::end() const noexcept {
+			return _Segments + _Size;
+		}
+
+		template <class GraphicsMath, size_t Capacity>
+		constexpr typename basic_static_path<GraphicsMath, Capacity>::const_reference basic_static_path<GraphicsMath, Capacity>::operator[](size_type n) const noexcept {
+			return _Segments[n];
+		}
+
+		template <class GraphicsMath, size_t Capacity>
+		constexpr typename basic_static_path<GraphicsMath, Capacity>::size_type basic_static_path<GraphicsMath, Capacity>::size() const noexcept {
+			return _Size;
+		}
+
+		template <class GraphicsMath, size_t Capacity>
+		constexpr bool basic_static_path<GraphicsMath, Capacity>::empty() const noexcept {
+			return _Size == 0;
+		}
+
+		template <class GraphicsMath, size_t Capacity>
+		constexpr typename basic_static_path<GraphicsMath, Capacity>::size_type basic_static_path<GraphicsMath, Capacity>::capacity() noexcept {
+			return Capacity;
+		}
+
 		template <class GraphicsSurfaces, class Allocator>
 		::std::vector<typename basic_figure_items<GraphicsSurfaces>::figure_item> _Interpret_path_items(const basic_path_builder<GraphicsSurfaces, Allocator>&);
 
+		template <class T>
+		bool _Flattened_path_cache<T>::_Find(float tolerance, float scale, T& path) const noexcept {
+			for (size_t i = 0; i < _Size; ++i) {
+				if (_Entries[i].tolerance == tolerance && _Entries[i].scale == scale) {
+					path = _Entries[i].path;
+					return true;
+				}
+			}
+			return false;
+		}
+
+		// Two threads that miss at once both flatten; the second to finish takes the first one's result, so every caller gets the same path.
+		template <class T>
+		template <class Fn>
+		T _Flattened_path_cache<T>::get(float tolerance, float scale, Fn&& flattenFn) {
+			T path;
+			{
+				lock_guard<mutex> lock(_Mutex);
+				if (_Find(tolerance, scale, path)) {
+					return path;
+				}
+			}
+			T flattened = flattenFn();
+			lock_guard<mutex> lock(_Mutex);
+			if (_Find(tolerance, scale, path)) {
+				return path;
+			}
+			const size_t capacity = extent_v<decltype(_Entries)>;
+			_Entry& entry = _Entries[_Next];
+			entry = { tolerance, scale, move(flattened) };
+			_Next = (_Next + 1) % capacity;
+			_Size = ::std::min(_Size + 1, capacity);
+			return entry.path;
+		}
+
+		template <class T>
+		::std::shared_ptr<_Flattened_path_cache<T>> _Flattened_path_cache_ptr<T>::_Load() const {
+			lock_guard<mutex> lock(_Mutex);
+			return _Cache;
+		}
+
+		template <class T>
+		_Flattened_path_cache_ptr<T>::_Flattened_path_cache_ptr(const _Flattened_path_cache_ptr& other)
+			: _Cache(other._Load()) {
+		}
+
+		template <class T>
+		_Flattened_path_cache_ptr<T>& _Flattened_path_cache_ptr<T>::operator=(const _Flattened_path_cache_ptr& other) {
+			auto cache = other._Load();
+			lock_guard<mutex> lock(_Mutex);
+			_Cache = move(cache);
+			return *this;
+		}
+
+		template <class T>
+		::std::shared_ptr<_Flattened_path_cache<T>> _Flattened_path_cache_ptr<T>::get() const {
+			lock_guard<mutex> lock(_Mutex);
+			if (_Cache == nullptr) {
+				_Cache = make_shared<_Flattened_path_cache<T>>();
+			}
+			return _Cache;
+		}
+
+		// The largest factor by which m stretches any vector (its largest singular value). Flattening for this scale keeps the error within tolerance in every direction.
+		template <class GraphicsMath>
+		float _Flattening_scale(const basic_matrix_2d<GraphicsMath>& m) noexcept {
+			const float sumSq = m.m00() * m.m00() + m.m01() * m.m01() + m.m10() * m.m10() + m.m11() * m.m11();
+			const float det = m.determinant();
+			const float disc = ::std::sqrt(::std::max(sumSq * sumSq - 4.0F * det * det, 0.0F));
+			return ::std::sqrt((sumSq + disc) / 2.0F);
+		}
+
+		// A flattened figure to be outlined by _Stroke_outliner.
+		template <class GraphicsMath>
+		struct _Stroke_polyline {
+			::std::vector<basic_point_2d<GraphicsMath>> pts;
+			bool closed = false;
+		};
+
+		// Converts flattened figures into polygons that, when filled using fill_rule::winding, cover the same area that stroking the figures with the given
+		// stroke properties and dash pattern covers. Every polygon is given the same orientation so that overlapping pieces add up rather than cancel out.
+		// tolerance is the greatest distance, in the coordinate space of the figures, that round joins and caps may stray from the arcs they approximate.
+		template <class GraphicsMath>
+		class _Stroke_outliner {
+			using _Point = basic_point_2d<GraphicsMath>;
+
+			float _Half_width;
+			io2d::line_cap _Cap;
+			io2d::line_join _Join;
+			float _Miter_limit;
+			float _Arc_step;
+			::std::vector<::std::vector<_Point>> _Polygons;
+
+			static _Point _Normal(const _Point& dir) noexcept {
+				return _Point(-dir.y(), dir.x());
+			}
+			static float _Cross(const _Point& a, const _Point& b) noexcept {
+				return a.x() * b.y() - a.y() * b.x();
+			}
+
+			void _Add_polygon(::std::vector<_Point>&& poly) {
+				float area = 0.0F;
+				for (size_t i = 0, j = poly.size() - 1; i < poly.size(); j = i++) {
+					area += _Cross(poly[j], poly[i]);
+				}
+				if (area == 0.0F) {
+					return;
+				}
+				if (area < 0.0F) {
+					::std::reverse(poly.begin(), poly.end());
+				}
+				_Polygons.push_back(move(poly));
+			}
+
+			void _Add_arc(::std::vector<_Point>& poly, const _Point& ctr, float startAngle, float sweep) const {
+				const int steps = ::std::max(1, static_cast<int>(::std::ceil(::std::abs(sweep) / _Arc_step)));
+				for (int i = 0; i <= steps; ++i) {
+					const float angle = startAngle + sweep * i / steps;
+					poly.push_back(ctr + _Point(::std::cos(angle), ::std::sin(angle)) * _Half_width);
+				}
+			}
+
+			// Fills the wedge on the outside of the turn at pt between the segments with unit directions inDir and outDir.
+			void _Add_join(const _Point& pt, const _Point& inDir, const _Point& outDir) {
+				const float cross = _Cross(inDir, outDir);
+				const float cosTurn = inDir.dot(outDir);
+				if (cross == 0.0F && cosTurn > 0.0F) {
+					return;
+				}
+				const float side = (cross > 0.0F) ? -1.0F : 1.0F;
+				const _Point inOffset = _Normal(inDir) * (side * _Half_width);
+				const _Point outOffset = _Normal(outDir) * (side * _Half_width);
+				::std::vector<_Point> poly{ pt, pt + inOffset };
+				switch (_Join) {
+				case io2d::line_join::round:
+				{
+					_Add_arc(poly, pt, inOffset.angular_direction(), ::std::atan2(_Cross(inOffset, outOffset), inOffset.dot(outOffset)));
+				} break;
+				case io2d::line_join::miter:
+				{
+					// The miter length divided by the line width is 1 / cos(turn / 2).
+					const float cosHalfTurn = ::std::sqrt(::std::max((1.0F + cosTurn) / 2.0F, 0.0F));
+					if (cosHalfTurn > 0.0F && cosHalfTurn * _Miter_limit >= 1.0F) {
+						poly.push_back(pt + (inOffset + outOffset).to_unit() * (_Half_width / cosHalfTurn));
+					}
+					poly.push_back(pt + outOffset);
+				} break;
+				case io2d::line_join::bevel:
+				{
+					poly.push_back(pt + outOffset);
+				} break;
+				default:
+				{
+					assert("Unexpected line_join value." && false);
+				} break;
+				}
+				_Add_polygon(move(poly));
+			}
+
+			// Caps the end of a figure at pt; dir is the unit direction pointing away from the figure.
+			void _Add_cap(const _Point& pt, const _Point& dir) {
+				const _Point offset = _Normal(dir) * _Half_width;
+				switch (_Cap) {
+				case io2d::line_cap::none:
+				{
+				} break;
+				case io2d::line_cap::square:
+				{
+					const _Point ext = dir * _Half_width;
+					_Add_polygon({ pt + offset, pt + offset + ext, pt - offset + ext, pt - offset });
+				} break;
+				case io2d::line_cap::round:
+				{
+					::std::vector<_Point> poly;
+					_Add_arc(poly, pt, offset.angular_direction(), -pi<float>);
+					_Add_polygon(move(poly));
+				} break;
+				default:
+				{
+					assert("Unexpected line_cap value." && false);
+				} break;
+				}
+			}
+
+			void _Outline(::std::vector<_Point> pts, bool closed) {
+				pts.erase(unique(pts.begin(), pts.end()), pts.end());
+				if (closed && pts.size() > 1 && pts.front() == pts.back()) {
+					pts.pop_back();
+				}
+				if (pts.empty()) {
+					return;
+				}
+				if (pts.size() == 1) {
+					// A zero length figure has no direction, so like cairo its caps are drawn as if it ran along the x axis.
+					_Add_cap(pts[0], _Point(-1.0F, 0.0F));
+					_Add_cap(pts[0], _Point(1.0F, 0.0F));
+					return;
+				}
+				const size_t segCount = closed ? pts.size() : pts.size() - 1;
+				::std::vector<_Point> dirs;
+				dirs.reserve(segCount);
+				for (size_t i = 0; i < segCount; ++i) {
+					const _Point& from = pts[i];
+					const _Point& to = pts[(i + 1) % pts.size()];
+					const _Point dir = (to - from).to_unit();
+					const _Point offset = _Normal(dir) * _Half_width;
+					dirs.push_back(dir);
+					_Add_polygon({ from + offset, to + offset, to - offset, from - offset });
+				}
+				if (closed) {
+					for (size_t i = 0; i < segCount; ++i) {
+						_Add_join(pts[i], dirs[(i + segCount - 1) % segCount], dirs[i]);
+					}
+				}
+				else {
+					for (size_t i = 1; i < segCount; ++i) {
+						_Add_join(pts[i], dirs[i - 1], dirs[i]);
+					}
+					_Add_cap(pts.front(), -dirs.front());
+					_Add_cap(pts.back(), dirs.back());
+				}
+			}
+
+		public:
+			_Stroke_outliner(float lineWidth, io2d::line_cap lc, io2d::line_join lj, float miterLimit, float tolerance) noexcept
+				: _Half_width(lineWidth / 2.0F)
+				, _Cap(lc)
+				, _Join(lj)
+				, _Miter_limit(miterLimit)
+				, _Arc_step((tolerance < _Half_width) ? 2.0F * ::std::acos(1.0F - tolerance / _Half_width) : half_pi<float>)
+				, _Polygons() {
+			}
+
+			// Outlines pl, split into dashes when pattern is not empty. The pattern and offset follow the rules of basic_dashes: an odd number of lengths is used
+			// twice over and the offset is how far into the pattern each figure starts.
+			void add(const _Stroke_polyline<GraphicsMath>& pl, const ::std::vector<float>& pattern, float offset) {
+				if (_Half_width <= 0.0F || pl.pts.empty()) {
+					return;
+				}
+				if (pattern.empty()) {
+					_Outline(pl.pts, pl.closed);
+					return;
+				}
+				::std::vector<float> lengths(pattern);
+				if (lengths.size() % 2 == 1) {
+					lengths.insert(lengths.end(), pattern.begin(), pattern.end());
+				}
+				float total = 0.0F;
+				for (auto len : lengths) {
+					if (len < 0.0F) {
+						throw system_error(make_error_code(errc::invalid_argument));
+					}
+					total += len;
+				}
+				if (total <= 0.0F) {
+					throw system_error(make_error_code(errc::invalid_argument));
+				}
+				size_t index = 0;
+				float start = ::std::fmod(offset, total);
+				if (start < 0.0F) {
+					start += total;
+				}
+				while (start >= lengths[index]) {
+					start -= lengths[index];
+					index = (index + 1) % lengths.size();
+				}
+				float remaining = lengths[index] - start;
+				const bool startsOn = (index % 2 == 0);
+				bool on = startsOn;
+
+				::std::vector<::std::vector<_Point>> dashes;
+				::std::vector<_Point> dash;
+				if (on) {
+					dash.push_back(pl.pts.front());
+				}
+				const size_t segCount = pl.closed ? pl.pts.size() : pl.pts.size() - 1;
+				for (size_t i = 0; i < segCount; ++i) {
+					const _Point& from = pl.pts[i];
+					const _Point& to = pl.pts[(i + 1) % pl.pts.size()];
+					const float segLength = (to - from).magnitude();
+					const _Point dir = (segLength > 0.0F) ? (to - from) / segLength : _Point();
+					float pos = 0.0F;
+					while (segLength - pos > remaining) {
+						pos += remaining;
+						const _Point pt = from + dir * pos;
+						if (on) {
+							dash.push_back(pt);
+							dashes.push_back(move(dash));
+							dash.clear();
+						}
+						else {
+							dash.push_back(pt);
+						}
+						on = !on;
+						index = (index + 1) % lengths.size();
+						remaining = lengths[index];
+					}
+					remaining -= segLength - pos;
+					if (on) {
+						dash.push_back(to);
+					}
+				}
+				if (on) {
+					if (pl.closed && startsOn && dashes.empty()) {
+						// The pattern never turned off, so the figure is drawn whole.
+						_Outline(move(dash), true);
+						return;
+					}
+					if (pl.closed && startsOn) {
+						// The dash running through the start of a closed figure is drawn as one piece, so that it gets a join there instead of two caps.
+						dash.insert(dash.end(), dashes.front().begin() + 1, dashes.front().end());
+						dashes.front() = move(dash);
+					}
+					else {
+						dashes.push_back(move(dash));
+					}
+				}
+				for (auto& d : dashes) {
+					_Outline(move(d), false);
+				}
+			}
+
+			::std::vector<::std::vector<_Point>>& polygons() noexcept {
+				return _Polygons;
+			}
+		};
+
 		template<class GraphicsSurfaces>
-		inline const typename basic_interpreted_path<GraphicsSurfaces>::data_type& basic_interpreted_path<GraphicsSurfaces>::data() const noexcept {
+		const typename basic_interpreted_path<GraphicsSurfaces>::data_type& basic_interpreted_path<GraphicsSurfaces>::data() const noexcept {
 			return _Data;
 		}
 
 		template<class GraphicsSurfaces>
-		inline typename basic_interpreted_path<GraphicsSurfaces>::data_type& basic_interpreted_path<GraphicsSurfaces>::data() noexcept {
+		typename basic_interpreted_path<GraphicsSurfaces>::data_type& basic_interpreted_path<GraphicsSurfaces>::data() noexcept {
 			return _Data;
 		}
 
 		template <class GraphicsSurfaces>
-		inline basic_interpreted_path<GraphicsSurfaces>::basic_interpreted_path() noexcept
+		basic_interpreted_path<GraphicsSurfaces>::basic_interpreted_path() noexcept
 			: _Data(GraphicsSurfaces::paths::create_interpreted_path()) { }
 
 		template <class GraphicsSurfaces>
-		inline basic_interpreted_path<GraphicsSurfaces>::basic_interpreted_path(const basic_bounding_box<graphics_math_type>& bb)
+		basic_interpreted_path<GraphicsSurfaces>::basic_interpreted_path(const basic_bounding_box<graphics_math_type>& bb)
 			: _Data (GraphicsSurfaces::paths::create_interpreted_path(bb)) { }
 
 		template <class GraphicsSurfaces>
 		template <class Allocator>
-		inline basic_interpreted_path<GraphicsSurfaces>::basic_interpreted_path(const basic_path_builder<GraphicsSurfaces, Allocator>& pb)
+		basic_interpreted_path<GraphicsSurfaces>::basic_interpreted_path(const basic_path_builder<GraphicsSurfaces, Allocator>& pb)
 			: _Data(GraphicsSurfaces::paths::create_interpreted_path(begin(pb), end(pb))) { }
 
 		template <class GraphicsSurfaces>
 		template <class ForwardIterator>
-		inline basic_interpreted_path<GraphicsSurfaces>::basic_interpreted_path(ForwardIterator first, ForwardIterator last)
+		basic_interpreted_path<GraphicsSurfaces>::basic_interpreted_path(ForwardIterator first, ForwardIterator last)
 			: _Data(GraphicsSurfaces::paths::create_interpreted_path(first, last)) { }
 
 		template<class GraphicsSurfaces>
-		inline basic_interpreted_path<GraphicsSurfaces>::basic_interpreted_path(initializer_list<typename basic_figure_items<GraphicsSurfaces>::figure_item> il)
+		basic_interpreted_path<GraphicsSurfaces>::basic_interpreted_path(initializer_list<typename basic_figure_items<GraphicsSurfaces>::figure_item> il)
 			: _Data(GraphicsSurfaces::paths::create_interpreted_path(begin(il), end(il))) {
 		}
 
+		template <class GraphicsSurfaces>
+		template <size_t Capacity>
+		inline basic_interpreted_path<GraphicsSurfaces>::basic_interpreted_path(const basic_static_path<graphics_math_type, Capacity>& sp)
+			: _Data(GraphicsSurfaces::paths::create_interpreted_path(sp)) { }
+
 		template<class GraphicsSurfaces>
-		inline basic_interpreted_path<GraphicsSurfaces>::basic_interpreted_path(const basic_interpreted_path& val) {
+		basic_interpreted_path<GraphicsSurfaces>::basic_interpreted_path(const basic_interpreted_path& val) {
 			_Data = GraphicsSurfaces::paths::copy_interpreted_path(val._Data);
 		}
 
 		template<class GraphicsSurfaces>
-		inline basic_interpreted_path<GraphicsSurfaces>& basic_interpreted_path<GraphicsSurfaces>::operator=(const basic_interpreted_path& val) {
+		basic_interpreted_path<GraphicsSurfaces>& basic_interpreted_path<GraphicsSurfaces>::operator=(const basic_interpreted_path& val) {
 			_Data = GraphicsSurfaces::paths::copy_interpreted_path(val._Data);
 			return *this;
 		}
 
 		template<class GraphicsSurfaces>
-		inline basic_interpreted_path<GraphicsSurfaces>::basic_interpreted_path(basic_interpreted_path&& val) noexcept {
+		basic_interpreted_path<GraphicsSurfaces>::basic_interpreted_path(basic_interpreted_path&& val) noexcept {
 			if (this != &val) {
 				_Data = move(GraphicsSurfaces::paths::move_interpreted_path(move(val._Data)));
 			}
 		}
 
 		template<class GraphicsSurfaces>
-		inline basic_interpreted_path<GraphicsSurfaces>& basic_interpreted_path<GraphicsSurfaces>::operator=(basic_interpreted_path&& val) noexcept {
+		basic_interpreted_path<GraphicsSurfaces>& basic_interpreted_path<GraphicsSurfaces>::operator=(basic_interpreted_path&& val) noexcept {
 			if (this != &val) {
 				_Data = move(GraphicsSurfaces::paths::move_interpreted_path(move(val._Data)));
 			}
@@ -946,8 +1462,35 @@ namespace std::experimental::io2d {
 		}
 
 		template<class GraphicsSurfaces>
-		inline basic_interpreted_path<GraphicsSurfaces>::~basic_interpreted_path() noexcept {
+		basic_interpreted_path<GraphicsSurfaces>::~basic_interpreted_path() noexcept {
 			GraphicsSurfaces::paths::destroy(_Data);
 		}
+
+		template <class GraphicsSurfaces>
+		basic_interpreted_path<GraphicsSurfaces> basic_interpreted_path<GraphicsSurfaces>::flatten(float tolerance, const basic_matrix_2d<graphics_math_type>& m) const {
+			if (!(tolerance > 0.0F)) {
+				throw system_error(make_error_code(errc::invalid_argument));
+			}
+			basic_interpreted_path result;
+			GraphicsSurfaces::paths::destroy(result._Data);
+			result._Data = GraphicsSurfaces::paths::flatten(_Data, tolerance, _Flattening_scale(m));
+			return result;
+		}
+
+		template <class GraphicsSurfaces>
+		basic_bounding_box<typename GraphicsSurfaces::graphics_math_type> basic_interpreted_path<GraphicsSurfaces>::bounds() const noexcept {
+			return GraphicsSurfaces::paths::bounds(_Data);
+		}
+
+		template <class GraphicsSurfaces>
+		basic_interpreted_path<GraphicsSurfaces> basic_interpreted_path<GraphicsSurfaces>::stroke_outline(const basic_stroke_props<GraphicsSurfaces>& sp, const basic_dashes<GraphicsSurfaces>& d, const basic_matrix_2d<graphics_math_type>& m, float tolerance) const {
+			if (!(tolerance > 0.0F)) {
+				throw system_error(make_error_code(errc::invalid_argument));
+			}
+			basic_interpreted_path result;
+			GraphicsSurfaces::paths::destroy(result._Data);
+			result._Data = GraphicsSurfaces::paths::stroke_outline(_Data, sp, d, tolerance, _Flattening_scale(m));
+			return result;
+		}
 	}
 }
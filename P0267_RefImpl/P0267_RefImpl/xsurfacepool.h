@@ -0,0 +1,96 @@
+#pragma once
+#include "xio2d.h"
+#include "xsurfaces.h"
+#include <list>
+
+namespace std::experimental::io2d {
+	inline namespace v1 {
+		class image_surface_pool_stats {
+			size_t _Surfaces = 0;
+			size_t _Bytes = 0;
+			size_t _Hits = 0;
+			size_t _Misses = 0;
+			size_t _Evictions = 0;
+		public:
+			image_surface_pool_stats() noexcept = default;
+			image_surface_pool_stats(size_t surfaces, size_t bytes, size_t hits, size_t misses, size_t evictions) noexcept;
+
+			size_t surfaces() const noexcept;
+			size_t bytes() const noexcept;
+			size_t hits() const noexcept;
+			size_t misses() const noexcept;
+			size_t evictions() const noexcept;
+		};
+
+		// Shared by a pool, its scopes and every surface it hands out, so surfaces may outlive the pool. Retained surfaces are kept most recently
+		// released first and the least recently released are freed when the budget is exceeded.
+		template <class GraphicsSurfaces>
+		class _Image_surface_pool_state {
+		public:
+			using data_type = typename GraphicsSurfaces::surfaces::image_surface_data_type;
+		private:
+			struct _Entry {
+				io2d::format format;
+				int width;
+				int height;
+				size_t bytes;
+				data_type data;
+
+				_Entry(io2d::format fmt, int w, int h, size_t b, data_type&& d) noexcept;
+				~_Entry() noexcept;
+			};
+			mutable ::std::mutex _Mutex;
+			::std::list<_Entry> _Entries;
+			size_t _Budget;
+			size_t _Bytes = 0;
+			size_t _Hits = 0;
+			size_t _Misses = 0;
+			size_t _Evictions = 0;
+
+			void _Trim(::std::list<_Entry>& evicted) noexcept;
+		public:
+			explicit _Image_surface_pool_state(size_t budget) noexcept;
+
+			data_type acquire(io2d::format fmt, int width, int height);
+			void release(data_type& data) noexcept;
+			void budget(size_t bytes) noexcept;
+			size_t budget() const noexcept;
+			void clear() noexcept;
+			image_surface_pool_stats statistics() const noexcept;
+		};
+
+		template <class GraphicsSurfaces>
+		class basic_image_surface_pool_scope;
+
+		// Recycles image surfaces by format and size. A surface from acquire() goes back to the pool when it is destroyed, as long as nothing else still
+		// refers to its pixels and the retained surfaces stay within budget() bytes. Recycled surfaces are cleared to transparent black before reuse.
+		template <class GraphicsSurfaces>
+		class basic_image_surface_pool {
+			friend basic_image_surface_pool_scope<GraphicsSurfaces>;
+
+			::std::shared_ptr<_Image_surface_pool_state<GraphicsSurfaces>> _State;
+		public:
+			explicit basic_image_surface_pool(size_t budget);
+			basic_image_surface_pool(const basic_image_surface_pool&) = delete;
+			basic_image_surface_pool& operator=(const basic_image_surface_pool&) = delete;
+			~basic_image_surface_pool() noexcept;
+
+			basic_image_surface<GraphicsSurfaces> acquire(io2d::format fmt, int width, int height);
+			void budget(size_t bytes) noexcept;
+			size_t budget() const noexcept;
+			void clear() noexcept;
+			image_surface_pool_stats statistics() const noexcept;
+		};
+
+		// While a scope is alive, image surfaces constructed on its thread from a format and dimensions come from its pool. Scopes nest.
+		template <class GraphicsSurfaces>
+		class basic_image_surface_pool_scope {
+			::std::shared_ptr<_Image_surface_pool_state<GraphicsSurfaces>> _Previous;
+		public:
+			explicit basic_image_surface_pool_scope(basic_image_surface_pool<GraphicsSurfaces>& pool) noexcept;
+			basic_image_surface_pool_scope(const basic_image_surface_pool_scope&) = delete;
+			basic_image_surface_pool_scope& operator=(const basic_image_surface_pool_scope&) = delete;
+			~basic_image_surface_pool_scope() noexcept;
+		};
+	}
+}
@@ -0,0 +1,196 @@
+#pragma once
+#include "xsurfacepool.h"
+
+namespace std::experimental::io2d {
+	inline namespace v1 {
+		inline image_surface_pool_stats::image_surface_pool_stats(size_t surfaces, size_t bytes, size_t hits, size_t misses, size_t evictions) noexcept
+			: _Surfaces(surfaces)
+			, _Bytes(bytes)
+			, _Hits(hits)
+			, _Misses(misses)
+			, _Evictions(evictions) {
+		}
+		inline size_t image_surface_pool_stats::surfaces() const noexcept {
+			return _Surfaces;
+		}
+		inline size_t image_surface_pool_stats::bytes() const noexcept {
+			return _Bytes;
+		}
+		inline size_t image_surface_pool_stats::hits() const noexcept {
+			return _Hits;
+		}
+		inline size_t image_surface_pool_stats::misses() const noexcept {
+			return _Misses;
+		}
+		inline size_t image_surface_pool_stats::evictions() const noexcept {
+			return _Evictions;
+		}
+
+		// The pixel storage of a surface, with rows padded to four bytes. Only used to weigh surfaces against a pool's budget.
+		inline size_t _Image_surface_pool_bytes(io2d::format fmt, int width, int height) noexcept {
+			const size_t rowBytes = (fmt == io2d::format::a8) ? (static_cast<size_t>(width) + 3) & ~size_t{ 3 } : static_cast<size_t>(width) * 4;
+			return rowBytes * static_cast<size_t>(height);
+		}
+
+		template <class GraphicsSurfaces>
+		::std::shared_ptr<_Image_surface_pool_state<GraphicsSurfaces>>& _Current_image_surface_pool() noexcept {
+			static thread_local ::std::shared_ptr<_Image_surface_pool_state<GraphicsSurfaces>> current;
+			return current;
+		}
+
+		template <class GraphicsSurfaces>
+		_Image_surface_pool_state<GraphicsSurfaces>::_Entry::_Entry(io2d::format fmt, int w, int h, size_t b, data_type&& d) noexcept
+			: format(fmt)
+			, width(w)
+			, height(h)
+			, bytes(b)
+			, data(GraphicsSurfaces::surfaces::move_image_surface(move(d))) {
+		}
+		template <class GraphicsSurfaces>
+		_Image_surface_pool_state<GraphicsSurfaces>::_Entry::~_Entry() noexcept {
+			GraphicsSurfaces::surfaces::destroy(data);
+		}
+
+		template <class GraphicsSurfaces>
+		_Image_surface_pool_state<GraphicsSurfaces>::_Image_surface_pool_state(size_t budget) noexcept
+			: _Budget(budget) {
+		}
+
+		// Moves the least recently released surfaces into evicted until the rest fit the budget, so the caller can free them once the lock is released.
+		template <class GraphicsSurfaces>
+		void _Image_surface_pool_state<GraphicsSurfaces>::_Trim(::std::list<_Entry>& evicted) noexcept {
+			while (_Bytes > _Budget && !_Entries.empty()) {
+				_Bytes -= _Entries.back().bytes;
+				++_Evictions;
+				evicted.splice(evicted.begin(), _Entries, prev(_Entries.end()));
+			}
+		}
+
+		template <class GraphicsSurfaces>
+		typename _Image_surface_pool_state<GraphicsSurfaces>::data_type _Image_surface_pool_state<GraphicsSurfaces>::acquire(io2d::format fmt, int width, int height) {
+			::std::list<_Entry> found;
+			{
+				lock_guard<mutex> lg(_Mutex);
+				auto it = find_if(_Entries.begin(), _Entries.end(), [fmt, width, height](const _Entry& e) {
+					return e.format == fmt && e.width == width && e.height == height;
+				});
+				if (it == _Entries.end()) {
+					++_Misses;
+				}
+				else {
+					++_Hits;
+					_Bytes -= it->bytes;
+					found.splice(found.begin(), _Entries, it);
+				}
+			}
+			if (found.empty()) {
+				return GraphicsSurfaces::surfaces::create_image_surface(fmt, width, height);
+			}
+			auto data = GraphicsSurfaces::surfaces::move_image_surface(move(found.front().data));
+			GraphicsSurfaces::surfaces::coverage_cache_limit(data, 0);
+			GraphicsSurfaces::surfaces::paint(data, basic_brush<GraphicsSurfaces>(rgba_color::transparent_black), basic_brush_props<GraphicsSurfaces>(),
+				basic_render_props<GraphicsSurfaces>(antialias::none, basic_matrix_2d<typename GraphicsSurfaces::graphics_math_type>{}, compositing_op::source), basic_clip_props<GraphicsSurfaces>());
+			return data;
+		}
+
+		// Keeps data by moving it out if the backend says nothing else refers to its pixels and it fits the budget. Otherwise data is left for the caller
+		// to destroy as usual.
+		template <class GraphicsSurfaces>
+		void _Image_surface_pool_state<GraphicsSurfaces>::release(data_type& data) noexcept {
+			if (!GraphicsSurfaces::surfaces::is_recyclable(data)) {
+				return;
+			}
+			const auto fmt = GraphicsSurfaces::surfaces::format(data);
+			const auto dimensions = GraphicsSurfaces::surfaces::dimensions(data);
+			const auto bytes = _Image_surface_pool_bytes(fmt, dimensions.x(), dimensions.y());
+			::std::list<_Entry> evicted;
+			lock_guard<mutex> lg(_Mutex);
+			if (bytes > _Budget) {
+				return;
+			}
+			try {
+				_Entries.emplace_front(fmt, dimensions.x(), dimensions.y(), bytes, move(data));
+			}
+			catch (...) {
+				return;
+			}
+			_Bytes += bytes;
+			_Trim(evicted);
+		}
+
+		template <class GraphicsSurfaces>
+		void _Image_surface_pool_state<GraphicsSurfaces>::budget(size_t bytes) noexcept {
+			::std::list<_Entry> evicted;
+			lock_guard<mutex> lg(_Mutex);
+			_Budget = bytes;
+			_Trim(evicted);
+		}
+
+		template <class GraphicsSurfaces>
+		size_t _Image_surface_pool_state<GraphicsSurfaces>::budget() const noexcept {
+			lock_guard<mutex> lg(_Mutex);
+			return _Budget;
+		}
+
+		template <class GraphicsSurfaces>
+		void _Image_surface_pool_state<GraphicsSurfaces>::clear() noexcept {
+			::std::list<_Entry> evicted;
+			lock_guard<mutex> lg(_Mutex);
+			evicted.splice(evicted.begin(), _Entries);
+			_Bytes = 0;
+		}
+
+		template <class GraphicsSurfaces>
+		image_surface_pool_stats _Image_surface_pool_state<GraphicsSurfaces>::statistics() const noexcept {
+			lock_guard<mutex> lg(_Mutex);
+			return image_surface_pool_stats(_Entries.size(), _Bytes, _Hits, _Misses, _Evictions);
+		}
+
+		template <class GraphicsSurfaces>
+		basic_image_surface_pool<GraphicsSurfaces>::basic_image_surface_pool(size_t budget)
+			: _State(make_shared<_Image_surface_pool_state<GraphicsSurfaces>>(budget)) {
+		}
+
+		// Surfaces still in use hold on to the shared state. With a budget of 0 they are freed as usual when they are destroyed.
+		template <class GraphicsSurfaces>
+		basic_image_surface_pool<GraphicsSurfaces>::~basic_image_surface_pool() noexcept {
+			_State->budget(0);
+		}
+
+		template <class GraphicsSurfaces>
+		basic_image_surface<GraphicsSurfaces> basic_image_surface_pool<GraphicsSurfaces>::acquire(io2d::format fmt, int width, int height) {
+			return basic_image_surface<GraphicsSurfaces>(_State, _State->acquire(fmt, width, height));
+		}
+
+		template <class GraphicsSurfaces>
+		void basic_image_surface_pool<GraphicsSurfaces>::budget(size_t bytes) noexcept {
+			_State->budget(bytes);
+		}
+
+		template <class GraphicsSurfaces>
+		size_t basic_image_surface_pool<GraphicsSurfaces>::budget() const noexcept {
+			return _State->budget();
+		}
+
+		template <class GraphicsSurfaces>
+		void basic_image_surface_pool<GraphicsSurfaces>::clear() noexcept {
+			_State->clear();
+		}
+
+		template <class GraphicsSurfaces>
+		image_surface_pool_stats basic_image_surface_pool<GraphicsSurfaces>::statistics() const noexcept {
+			return _State->statistics();
+		}
+
+		template <class GraphicsSurfaces>
+		basic_image_surface_pool_scope<GraphicsSurfaces>::basic_image_surface_pool_scope(basic_image_surface_pool<GraphicsSurfaces>& pool) noexcept
+			: _Previous(move(_Current_image_surface_pool<GraphicsSurfaces>())) {
+			_Current_image_surface_pool<GraphicsSurfaces>() = pool._State;
+		}
+
+		template <class GraphicsSurfaces>
+		basic_image_surface_pool_scope<GraphicsSurfaces>::~basic_image_surface_pool_scope() noexcept {
+			_Current_image_surface_pool<GraphicsSurfaces>() = move(_Previous);
+		}
+	}
+}
@@ -164,6 +164,71 @@ namespace std::experimental::io2d {
 			~basic_dashes() noexcept;
 		};
 
+		// One of the copies of a path drawn by fill_instances. The path is transformed by matrix() before the surface matrix of the render props is applied.
+		// When color() has a value it is used in place of the brush. The result is drawn with its opacity multiplied by alpha().
+		template <class GraphicsMath>
+		class basic_fill_instance {
+			basic_matrix_2d<GraphicsMath> _Matrix;
+			optional<rgba_color> _Color;
+			float _Alpha;
+		public:
+			basic_fill_instance() noexcept;
+			basic_fill_instance(const basic_matrix_2d<GraphicsMath>& m, float alpha = 1.0F) noexcept;
+			basic_fill_instance(const basic_matrix_2d<GraphicsMath>& m, const rgba_color& c, float alpha = 1.0F) noexcept;
+			void matrix(const basic_matrix_2d<GraphicsMath>& m) noexcept;
+			void color(const optional<rgba_color>& c) noexcept;
+			void alpha(float a) noexcept;
+			const basic_matrix_2d<GraphicsMath>& matrix() const noexcept;
+			const optional<rgba_color>& color() const noexcept;
+			float alpha() const noexcept;
+		};
+
+		// The instances fill_instances hands to the backends: count instances stored contiguously from first. Ranges the caller already keeps
+		// contiguously are passed as they are; others are copied into a vector first.
+		template <class GraphicsMath>
+		class _Fill_instance_range {
+			const basic_fill_instance<GraphicsMath>* _First;
+			size_t _Count;
+		public:
+			_Fill_instance_range(const basic_fill_instance<GraphicsMath>* first, size_t count) noexcept;
+			const basic_fill_instance<GraphicsMath>* begin() const noexcept;
+			const basic_fill_instance<GraphicsMath>* end() const noexcept;
+			size_t size() const noexcept;
+			bool empty() const noexcept;
+			const basic_fill_instance<GraphicsMath>& operator[](size_t i) const noexcept;
+		};
+
+		// Calls f with the instances in [first, last) as a _Fill_instance_range.
+		template <class GraphicsMath, class InputIterator, class Function>
+		void _Call_with_fill_instances(InputIterator first, InputIterator last, Function&& f);
+
+		// A snapshot of a surface's coverage mask cache. bytes() is the memory held by the entries() cached masks; evictions() counts masks dropped to stay
+		// within the surface's coverage_cache_limit().
+		class coverage_cache_stats {
+			size_t _Entries = 0;
+			size_t _Bytes = 0;
+			size_t _Hits = 0;
+			size_t _Misses = 0;
+			size_t _Evictions = 0;
+		public:
+			coverage_cache_stats() noexcept = default;
+			coverage_cache_stats(size_t entries, size_t bytes, size_t hits, size_t misses, size_t evictions) noexcept;
+			size_t entries() const noexcept;
+			size_t bytes() const noexcept;
+			size_t hits() const noexcept;
+			size_t misses() const noexcept;
+			size_t evictions() const noexcept;
+		};
+
+		template <class GraphicsSurfaces>
+		class _Image_surface_pool_state;
+		template <class GraphicsSurfaces>
+		::std::shared_ptr<_Image_surface_pool_state<GraphicsSurfaces>>& _Current_image_surface_pool() noexcept;
+		template <class GraphicsSurfaces>
+		class basic_image_surface_pool;
+		template <class GraphicsSurfaces>
+		class basic_mapped_pixels;
+
 		template <class GraphicsSurfaces>
 		class basic_image_surface {
 		public:
@@ -171,11 +236,33 @@ namespace std::experimental::io2d {
 			using data_type = typename GraphicsSurfaces::surfaces::image_surface_data_type;
 
 		private:
+			friend basic_image_surface_pool<GraphicsSurfaces>;
+			friend basic_mapped_pixels<GraphicsSurfaces>;
+			template <class GS>
+			friend basic_image_surface<GS> copy_surface(basic_image_surface<GS>& sfc);
+			template <class GS>
+			friend void copy_region(const basic_image_surface<GS>& src, const basic_bounding_box<typename GS::graphics_math_type>& srcRect, basic_image_surface<GS>& dst, const basic_display_point<typename GS::graphics_math_type>& dstPoint);
+
+			// Set when the surface came from a basic_image_surface_pool, which gets _Data back when the surface is destroyed or assigned to.
+			::std::shared_ptr<_Image_surface_pool_state<GraphicsSurfaces>> _Pool;
 			data_type _Data;
+			// Set on both surfaces by copy_surface. Their pixels stay shared until one of them is changed while something else still references them.
+			bool _Shares_pixels = false;
 
+			basic_image_surface(const ::std::shared_ptr<_Image_surface_pool_state<GraphicsSurfaces>>& pool, data_type&& data) noexcept;
+			void _Own_pixels();
+			basic_image_surface _Copy_pixels() const;
 		public:
+			const data_type& data() const noexcept;
 			data_type& data() noexcept;
 			basic_image_surface(io2d::format fmt, int width, int height);
+			// Draws directly into memory owned by the caller, which must stay valid and must not be freed until the surface and every brush made from it
+			// are destroyed. The pixels use the backend's own layout for fmt, rows are stride bytes apart and stride must be at least
+			// stride_for_width(fmt, width). Call flush() before reading the memory and mark_dirty() after writing to it other than through the surface.
+			basic_image_surface(io2d::format fmt, int width, int height, ::std::byte* data, int stride);
+			// Decodes an image file that has already been read into memory. The memory is not needed once the constructor returns.
+			basic_image_surface(const ::std::byte* data, size_t size, image_file_format iff, io2d::format fmt);
+			basic_image_surface(const ::std::byte* data, size_t size, image_file_format iff, io2d::format fmt, error_code& ec) noexcept;
 #ifdef _Filesystem_support_test
 			basic_image_surface(filesystem::path f, image_file_format iff, io2d::format fmt);
 			basic_image_surface(filesystem::path f, image_file_format iff, io2d::format fmt, error_code& ec) noexcept;
@@ -192,8 +279,27 @@ namespace std::experimental::io2d {
 #else
 			void save(::std::string f, image_file_format i);
 			void save(::std::string f, image_file_format i, error_code& ec) noexcept;
+#endif
+			// Copies the surface with copy_surface and returns at once; the copy is encoded and saved on a background thread and the future reports
+			// when it is done, or the exception save() would have thrown. The copy shares the pixels until this surface is next changed. At most four
+			// such copies exist at once; save_async waits for one of them to be saved first.
+#ifdef _Filesystem_support_test
+			::std::future<void> save_async(filesystem::path p, image_file_format i);
+#else
+			::std::future<void> save_async(::std::string f, image_file_format i);
+#endif
+			// Surfaces whose pixels live in a memory-mapped file: a small header followed by the raw rows in the layout stride_for_width() describes,
+			// so the operating system pages them in and out and the file can be opened again, or used as a brush, without decoding. create_mapped
+			// replaces the file with a transparent black surface. Call flush() before another process reads the file.
+#ifdef _Filesystem_support_test
+			static basic_image_surface create_mapped(filesystem::path p, io2d::format fmt, int width, int height);
+			static basic_image_surface open_mapped(filesystem::path p, mapped_file_mode m = mapped_file_mode::read_write);
+#else
+			static basic_image_surface create_mapped(::std::string f, io2d::format fmt, int width, int height);
+			static basic_image_surface open_mapped(::std::string f, mapped_file_mode m = mapped_file_mode::read_write);
 #endif
 			static basic_display_point<graphics_math_type> max_dimensions() noexcept;
+			static int stride_for_width(io2d::format fmt, int width) noexcept;
 			io2d::format format() const noexcept;
 			basic_display_point<graphics_math_type> dimensions() const noexcept;
 
@@ -211,7 +317,32 @@ namespace std::experimental::io2d {
 			template <class Allocator>
 			void fill(const basic_brush<GraphicsSurfaces>& b, const basic_path_builder<GraphicsSurfaces, Allocator>& pb, const optional<basic_brush_props<GraphicsSurfaces>>& bp = nullopt, const optional<basic_render_props<GraphicsSurfaces>>& rp = nullopt, const optional<basic_clip_props<GraphicsSurfaces>>& cl = nullopt);
 			void fill(const basic_brush<GraphicsSurfaces>& b, const basic_interpreted_path<GraphicsSurfaces>& ip, const optional<basic_brush_props<GraphicsSurfaces>>& bp = nullopt, const optional<basic_render_props<GraphicsSurfaces>>& rp = nullopt, const optional<basic_clip_props<GraphicsSurfaces>>& cl = nullopt);
+			// Same result as fill(fb, ...) followed by stroke(sb, ...) with the same path and props, but the path and state are only sent to the backend once.
+			template <class Allocator>
+			void fill_stroke(const basic_brush<GraphicsSurfaces>& fb, const basic_brush<GraphicsSurfaces>& sb, const basic_path_builder<GraphicsSurfaces, Allocator>& pb, const optional<basic_brush_props<GraphicsSurfaces>>& bp = nullopt, const optional<basic_stroke_props<GraphicsSurfaces>>& sp = nullopt, const optional<basic_dashes<GraphicsSurfaces>>& d = nullopt, const optional<basic_render_props<GraphicsSurfaces>>& rp = nullopt, const optional<basic_clip_props<GraphicsSurfaces>>& cl = nullopt);
+			void fill_stroke(const basic_brush<GraphicsSurfaces>& fb, const basic_brush<GraphicsSurfaces>& sb, const basic_interpreted_path<GraphicsSurfaces>& ip, const optional<basic_brush_props<GraphicsSurfaces>>& bp = nullopt, const optional<basic_stroke_props<GraphicsSurfaces>>& sp = nullopt, const optional<basic_dashes<GraphicsSurfaces>>& d = nullopt, const optional<basic_render_props<GraphicsSurfaces>>& rp = nullopt, const optional<basic_clip_props<GraphicsSurfaces>>& cl = nullopt);
+			// Same result as fill or stroke with an interpreted_path made from bb or c, without building one. Rectangles whose edges land on whole pixels
+			// may be filled by writing the surface's pixels directly.
+			void fill_rect(const basic_brush<GraphicsSurfaces>& b, const basic_bounding_box<graphics_math_type>& bb, const optional<basic_brush_props<GraphicsSurfaces>>& bp = nullopt, const optional<basic_render_props<GraphicsSurfaces>>& rp = nullopt, const optional<basic_clip_props<GraphicsSurfaces>>& cl = nullopt);
+			void stroke_rect(const basic_brush<GraphicsSurfaces>& b, const basic_bounding_box<graphics_math_type>& bb, const optional<basic_brush_props<GraphicsSurfaces>>& bp = nullopt, const optional<basic_stroke_props<GraphicsSurfaces>>& sp = nullopt, const optional<basic_dashes<GraphicsSurfaces>>& d = nullopt, const optional<basic_render_props<GraphicsSurfaces>>& rp = nullopt, const optional<basic_clip_props<GraphicsSurfaces>>& cl = nullopt);
+			void fill_circle(const basic_brush<GraphicsSurfaces>& b, const basic_circle<graphics_math_type>& c, const optional<basic_brush_props<GraphicsSurfaces>>& bp = nullopt, const optional<basic_render_props<GraphicsSurfaces>>& rp = nullopt, const optional<basic_clip_props<GraphicsSurfaces>>& cl = nullopt);
+			// Fills ip once for each basic_fill_instance (or basic_matrix_2d) in [first, last), as if by fill with the instance's matrix prepended to the surface matrix.
+			template <class InputIterator>
+			void fill_instances(const basic_brush<GraphicsSurfaces>& b, const basic_interpreted_path<GraphicsSurfaces>& ip, InputIterator first, InputIterator last, const optional<basic_brush_props<GraphicsSurfaces>>& bp = nullopt, const optional<basic_render_props<GraphicsSurfaces>>& rp = nullopt, const optional<basic_clip_props<GraphicsSurfaces>>& cl = nullopt);
 			void mask(const basic_brush<GraphicsSurfaces>& b, const basic_brush<GraphicsSurfaces>& mb, const optional<basic_brush_props<GraphicsSurfaces>>& bp = nullopt, const optional<basic_mask_props<GraphicsSurfaces>>& mp = nullopt, const optional<basic_render_props<GraphicsSurfaces>>& rp = nullopt, const optional<basic_clip_props<GraphicsSurfaces>>& cl = nullopt);
+			// Moves the pixels inside region, or the whole surface, by offset, copying rows directly instead of drawing. Pixels that move out of
+			// the region are dropped and the part of the region that nothing moves into keeps its old pixels, ready to be drawn over. The edges of
+			// region are rounded to whole pixels.
+			void scroll(const basic_display_point<graphics_math_type>& offset);
+			void scroll(const basic_display_point<graphics_math_type>& offset, const basic_bounding_box<graphics_math_type>& region);
+			// Gives direct access to the pixels, or to those inside extents, without copying them; see basic_mapped_pixels.
+			basic_mapped_pixels<GraphicsSurfaces> map_pixels();
+			basic_mapped_pixels<GraphicsSurfaces> map_pixels(const basic_bounding_box<graphics_math_type>& extents);
+			// Fills of one interpreted path that differ only by translation can reuse a coverage mask rasterized by an earlier fill. The cache holds at most
+			// bytes of masks, dropping the least recently used; a limit of 0, the default, turns it off and frees it.
+			void coverage_cache_limit(size_t bytes);
+			size_t coverage_cache_limit() const noexcept;
+			coverage_cache_stats coverage_cache_statistics() const noexcept;
 		};
 
 		template <class GraphicsSurfaces>
@@ -269,7 +400,18 @@ namespace std::experimental::io2d {
 			template <class Allocator>
 			void fill(const basic_brush<GraphicsSurfaces>& b, const basic_path_builder<GraphicsSurfaces, Allocator>& pb, const optional<basic_brush_props<GraphicsSurfaces>>& bp = nullopt, const optional<basic_render_props<GraphicsSurfaces>>& rp = nullopt, const optional<basic_clip_props<GraphicsSurfaces>>& cl = nullopt);
 			void fill(const basic_brush<GraphicsSurfaces>& b, const basic_interpreted_path<GraphicsSurfaces>& ip, const optional<basic_brush_props<GraphicsSurfaces>>& bp = nullopt, const optional<basic_render_props<GraphicsSurfaces>>& rp = nullopt, const optional<basic_clip_props<GraphicsSurfaces>>& cl = nullopt);
+			template <class Allocator>
+			void fill_stroke(const basic_brush<GraphicsSurfaces>& fb, const basic_brush<GraphicsSurfaces>& sb, const basic_path_builder<GraphicsSurfaces, Allocator>& pb, const optional<basic_brush_props<GraphicsSurfaces>>& bp = nullopt, const optional<basic_stroke_props<GraphicsSurfaces>>& sp = nullopt, const optional<basic_dashes<GraphicsSurfaces>>& d = nullopt, const optional<basic_render_props<GraphicsSurfaces>>& rp = nullopt, const optional<basic_clip_props<GraphicsSurfaces>>& cl = nullopt);
+			void fill_stroke(const basic_brush<GraphicsSurfaces>& fb, const basic_brush<GraphicsSurfaces>& sb, const basic_interpreted_path<GraphicsSurfaces>& ip, const optional<basic_brush_props<GraphicsSurfaces>>& bp = nullopt, const optional<basic_stroke_props<GraphicsSurfaces>>& sp = nullopt, const optional<basic_dashes<GraphicsSurfaces>>& d = nullopt, const optional<basic_render_props<GraphicsSurfaces>>& rp = nullopt, const optional<basic_clip_props<GraphicsSurfaces>>& cl = nullopt);
+			void fill_rect(const basic_brush<GraphicsSurfaces>& b, const basic_bounding_box<graphics_math_type>& bb, const optional<basic_brush_props<GraphicsSurfaces>>& bp = nullopt, const optional<basic_render_props<GraphicsSurfaces>>& rp = nullopt, const optional<basic_clip_props<GraphicsSurfaces>>& cl = nullopt);
+			void stroke_rect(const basic_brush<GraphicsSurfaces>& b, const basic_bounding_box<graphics_math_type>& bb, const optional<basic_brush_props<GraphicsSurfaces>>& bp = nullopt, const optional<basic_stroke_props<GraphicsSurfaces>>& sp = nullopt, const optional<basic_dashes<GraphicsSurfaces>>& d = nullopt, const optional<basic_render_props<GraphicsSurfaces>>& rp = nullopt, const optional<basic_clip_props<GraphicsSurfaces>>& cl = nullopt);
+			void fill_circle(const basic_brush<GraphicsSurfaces>& b, const basic_circle<graphics_math_type>& c, const optional<basic_brush_props<GraphicsSurfaces>>& bp = nullopt, const optional<basic_render_props<GraphicsSurfaces>>& rp = nullopt, const optional<basic_clip_props<GraphicsSurfaces>>& cl = nullopt);
+			template <class InputIterator>
+			void fill_instances(const basic_brush<GraphicsSurfaces>& b, const basic_interpreted_path<GraphicsSurfaces>& ip, InputIterator first, InputIterator last, const optional<basic_brush_props<GraphicsSurfaces>>& bp = nullopt, const optional<basic_render_props<GraphicsSurfaces>>& rp = nullopt, const optional<basic_clip_props<GraphicsSurfaces>>& cl = nullopt);
 			void mask(const basic_brush<GraphicsSurfaces>& b, const basic_brush<GraphicsSurfaces>& mb, const optional<basic_brush_props<GraphicsSurfaces>>& bp = nullopt, const optional<basic_mask_props<GraphicsSurfaces>>& mp = nullopt, const optional<basic_render_props<GraphicsSurfaces>>& rp = nullopt, const optional<basic_clip_props<GraphicsSurfaces>>& cl = nullopt);
+			void coverage_cache_limit(size_t bytes);
+			size_t coverage_cache_limit() const noexcept;
+			coverage_cache_stats coverage_cache_statistics() const noexcept;
 
 			// display functions
 			void draw_callback(const function<void(basic_output_surface& sfc)>& fn);
@@ -337,7 +479,18 @@ namespace std::experimental::io2d {
 			template <class Allocator>
 			void fill(const basic_brush<GraphicsSurfaces>& b, const basic_path_builder<GraphicsSurfaces, Allocator>& pb, const optional<basic_brush_props<GraphicsSurfaces>>& bp = nullopt, const optional<basic_render_props<GraphicsSurfaces>>& rp = nullopt, const optional<basic_clip_props<GraphicsSurfaces>>& cl = nullopt);
 			void fill(const basic_brush<GraphicsSurfaces>& b, const basic_interpreted_path<GraphicsSurfaces>& ip, const optional<basic_brush_props<GraphicsSurfaces>>& bp = nullopt, const optional<basic_render_props<GraphicsSurfaces>>& rp = nullopt, const optional<basic_clip_props<GraphicsSurfaces>>& cl = nullopt);
+			template <class Allocator>
+			void fill_stroke(const basic_brush<GraphicsSurfaces>& fb, const basic_brush<GraphicsSurfaces>& sb, const basic_path_builder<GraphicsSurfaces, Allocator>& pb, const optional<basic_brush_props<GraphicsSurfaces>>& bp = nullopt, const optional<basic_stroke_props<GraphicsSurfaces>>& sp = nullopt, const optional<basic_dashes<GraphicsSurfaces>>& d = nullopt, const optional<basic_render_props<GraphicsSurfaces>>& rp = nullopt, const optional<basic_clip_props<GraphicsSurfaces>>& cl = nullopt);
+			void fill_stroke(const basic_brush<GraphicsSurfaces>& fb, const basic_brush<GraphicsSurfaces>& sb, const basic_interpreted_path<GraphicsSurfaces>& ip, const optional<basic_brush_props<GraphicsSurfaces>>& bp = nullopt, const optional<basic_stroke_props<GraphicsSurfaces>>& sp = nullopt, const optional<basic_dashes<GraphicsSurfaces>>& d = nullopt, const optional<basic_render_props<GraphicsSurfaces>>& rp = nullopt, const optional<basic_clip_props<GraphicsSurfaces>>& cl = nullopt);
+			void fill_rect(const basic_brush<GraphicsSurfaces>& b, const basic_bounding_box<graphics_math_type>& bb, const optional<basic_brush_props<GraphicsSurfaces>>& bp = nullopt, const optional<basic_render_props<GraphicsSurfaces>>& rp = nullopt, const optional<basic_clip_props<GraphicsSurfaces>>& cl = nullopt);
+			void stroke_rect(const basic_brush<GraphicsSurfaces>& b, const basic_bounding_box<graphics_math_type>& bb, const optional<basic_brush_props<GraphicsSurfaces>>& bp = nullopt, const optional<basic_stroke_props<GraphicsSurfaces>>& sp = nullopt, const optional<basic_dashes<GraphicsSurfaces>>& d = nullopt, const optional<basic_render_props<GraphicsSurfaces>>& rp = nullopt, const optional<basic_clip_props<GraphicsSurfaces>>& cl = nullopt);
+			void fill_circle(const basic_brush<GraphicsSurfaces>& b, const basic_circle<graphics_math_type>& c, const optional<basic_brush_props<GraphicsSurfaces>>& bp = nullopt, const optional<basic_render_props<GraphicsSurfaces>>& rp = nullopt, const optional<basic_clip_props<GraphicsSurfaces>>& cl = nullopt);
+			template <class InputIterator>
+			void fill_instances(const basic_brush<GraphicsSurfaces>& b, const basic_interpreted_path<GraphicsSurfaces>& ip, InputIterator first, InputIterator last, const optional<basic_brush_props<GraphicsSurfaces>>& bp = nullopt, const optional<basic_render_props<GraphicsSurfaces>>& rp = nullopt, const optional<basic_clip_props<GraphicsSurfaces>>& cl = nullopt);
 			void mask(const basic_brush<GraphicsSurfaces>& b, const basic_brush<GraphicsSurfaces>& mb, const optional<basic_brush_props<GraphicsSurfaces>>& bp = nullopt, const optional<basic_mask_props<GraphicsSurfaces>>& mp = nullopt, const optional<basic_render_props<GraphicsSurfaces>>& rp = nullopt, const optional<basic_clip_props<GraphicsSurfaces>>& cl = nullopt);
+			void coverage_cache_limit(size_t bytes);
+			size_t coverage_cache_limit() const noexcept;
+			coverage_cache_stats coverage_cache_statistics() const noexcept;
 
 			// display functions
 			void draw_callback(const function<void(basic_unmanaged_output_surface& sfc)>& fn);
@@ -364,14 +517,23 @@ namespace std::experimental::io2d {
 			bool auto_clear() const noexcept;
 		};
 
+		// The copy shares sfc's pixels, so copying costs nothing until one of the two surfaces is drawn to; that surface then copies the pixels
+		// before it changes them. Surfaces over caller memory or a mapped file are copied at once, so that drawing to them still reaches that
+		// memory. Writes made through data() are not seen and reach both surfaces.
+		template <class GraphicsSurfaces>
+		basic_image_surface<GraphicsSurfaces> copy_surface(basic_image_surface<GraphicsSurfaces>& sfc);
+
+		// Replaces the pixels of dst at dstPoint with the pixels under srcRect in src, as a fill_rect with compositing_op::source would. Parts of
+		// srcRect outside src, and parts of the copy that would land outside dst, are left out. When the surfaces have the same format and the
+		// edges of srcRect are on whole pixels, the rows are copied directly instead of drawn. src and dst may be the same surface.
 		template <class GraphicsSurfaces>
-		basic_image_surface<GraphicsSurfaces> copy_surface(basic_image_surface<GraphicsSurfaces>& sfc) noexcept;
+		void copy_region(const basic_image_surface<GraphicsSurfaces>& src, const basic_bounding_box<typename GraphicsSurfaces::graphics_math_type>& srcRect, basic_image_surface<GraphicsSurfaces>& dst, const basic_display_point<typename GraphicsSurfaces::graphics_math_type>& dstPoint);
 
 		template <class GraphicsSurfaces>
-		basic_image_surface<GraphicsSurfaces> copy_surface(basic_output_surface<GraphicsSurfaces>& sfc) noexcept;
+		basic_image_surface<GraphicsSurfaces> copy_surface(basic_output_surface<GraphicsSurfaces>& sfc);
 
 		template <class GraphicsSurfaces>
-		basic_image_surface<GraphicsSurfaces> copy_surface(basic_unmanaged_output_surface<GraphicsSurfaces>& sfc) noexcept;
+		basic_image_surface<GraphicsSurfaces> copy_surface(basic_unmanaged_output_surface<GraphicsSurfaces>& sfc);
 
 	}
 }
@@ -87,6 +87,11 @@ namespace std {
 					jpeg,
 					tiff
 				};
+
+				enum class mapped_file_mode {
+					read_write,     // Drawing writes through to the file
+					read_only       // The file is never changed; drawing only changes private copies of the pages it touches
+				};
 			}
 		}
 	}
@@ -9,190 +9,387 @@ namespace std {
 				// image_surface
 
 				template <class GraphicsSurfaces>
-				inline typename basic_image_surface<GraphicsSurfaces>::data_type& basic_image_surface<GraphicsSurfaces>::data() noexcept {
+				const typename basic_image_surface<GraphicsSurfaces>::data_type& basic_image_surface<GraphicsSurfaces>::data() const noexcept {
 					return _Data;
 				}
 				template <class GraphicsSurfaces>
-				inline basic_image_surface<GraphicsSurfaces>::basic_image_surface(io2d::format fmt, int width, int height)
-					: _Data(GraphicsSurfaces::surfaces::create_image_surface(fmt, width, height)) {
+				typename basic_image_surface<GraphicsSurfaces>::data_type& basic_image_surface<GraphicsSurfaces>::data() noexcept {
+					return _Data;
+				}
+				template <class GraphicsSurfaces>
+				basic_image_surface<GraphicsSurfaces>::basic_image_surface(io2d::format fmt, int width, int height)
+					: _Pool(_Current_image_surface_pool<GraphicsSurfaces>())
+					, _Data(_Pool == nullptr ? GraphicsSurfaces::surfaces::create_image_surface(fmt, width, height) : _Pool->acquire(fmt, width, height)) {
+				}
+				template <class GraphicsSurfaces>
+				basic_image_surface<GraphicsSurfaces>::basic_image_surface(io2d::format fmt, int width, int height, ::std::byte* data, int stride)
+					: _Data(GraphicsSurfaces::surfaces::create_image_surface(fmt, width, height, data, stride, nullptr)) {
+				}
+				template <class GraphicsSurfaces>
+				basic_image_surface<GraphicsSurfaces>::basic_image_surface(const ::std::byte* data, size_t size, image_file_format iff, io2d::format fmt)
+					: _Data(GraphicsSurfaces::surfaces::create_image_surface(data, size, iff, fmt)) {
+				}
+				template <class GraphicsSurfaces>
+				basic_image_surface<GraphicsSurfaces>::basic_image_surface(const ::std::byte* data, size_t size, image_file_format iff, io2d::format fmt, error_code& ec) noexcept
+					: _Data(GraphicsSurfaces::surfaces::create_image_surface(data, size, iff, fmt, ec)) {
+				}
+				template <class GraphicsSurfaces>
+				basic_image_surface<GraphicsSurfaces>::basic_image_surface(const ::std::shared_ptr<_Image_surface_pool_state<GraphicsSurfaces>>& pool, data_type&& data) noexcept
+					: _Pool(pool)
+					, _Data(GraphicsSurfaces::surfaces::move_image_surface(move(data))) {
 				}
 
 #ifdef _Filesystem_support_test
 				template <class GraphicsSurfaces>
-				inline basic_image_surface<GraphicsSurfaces>::basic_image_surface(filesystem::path f, image_file_format iff, io2d::format fmt)
+				basic_image_surface<GraphicsSurfaces>::basic_image_surface(filesystem::path f, image_file_format iff, io2d::format fmt)
 					: _Data(GraphicsSurfaces::surfaces::create_image_surface(f, iff, fmt)) {
 				}
 				template <class GraphicsSurfaces>
-				inline basic_image_surface<GraphicsSurfaces>::basic_image_surface(filesystem::path f, image_file_format iff, io2d::format fmt, error_code& ec) noexcept
+				basic_image_surface<GraphicsSurfaces>::basic_image_surface(filesystem::path f, image_file_format iff, io2d::format fmt, error_code& ec) noexcept
 					: _Data(GraphicsSurfaces::surfaces::create_image_surface(f, iff, fmt, ec)) {
 				}
 #else
 				template <class GraphicsSurfaces>
-				inline basic_image_surface<GraphicsSurfaces>::basic_image_surface(::std::string f, image_file_format iff, io2d::format fmt)
+				basic_image_surface<GraphicsSurfaces>::basic_image_surface(::std::string f, image_file_format iff, io2d::format fmt)
 					: _Data(GraphicsSurfaces::surfaces::create_image_surface(f, iff, fmt)) {
 				}
 				template <class GraphicsSurfaces>
-				inline basic_image_surface<GraphicsSurfaces>::basic_image_surface(::std::string f, image_file_format iff, io2d::format fmt, error_code& ec) noexcept
+				basic_image_surface<GraphicsSurfaces>::basic_image_surface(::std::string f, image_file_format iff, io2d::format fmt, error_code& ec) noexcept
 					: _Data(GraphicsSurfaces::surfaces::create_image_surface(f, iff, fmt, ec)) {
 				}
 #endif
 				template<class GraphicsSurfaces>
-				inline basic_image_surface<GraphicsSurfaces>::basic_image_surface(basic_image_surface&& val) noexcept 
-					: _Data(move(GraphicsSurfaces::surfaces::move_image_surface(move(val._Data)))) {
+				basic_image_surface<GraphicsSurfaces>::basic_image_surface(basic_image_surface&& val) noexcept 
+					: _Pool(move(val._Pool))
+					, _Data(move(GraphicsSurfaces::surfaces::move_image_surface(move(val._Data))))
+					, _Shares_pixels(val._Shares_pixels) {
 				}
 
 				template<class GraphicsSurfaces>
-				inline basic_image_surface<GraphicsSurfaces>& basic_image_surface<GraphicsSurfaces>::operator=(basic_image_surface&& val) noexcept {
+				basic_image_surface<GraphicsSurfaces>& basic_image_surface<GraphicsSurfaces>::operator=(basic_image_surface&& val) noexcept {
 					if (this != &val) {
+						if (_Pool != nullptr) {
+							_Pool->release(_Data);
+						}
+						_Pool = move(val._Pool);
 						_Data = move(GraphicsSurfaces::surfaces::move_image_surface(move(val._Data)));
+						_Shares_pixels = val._Shares_pixels;
 					}
 					return *this;
 				}
 
 				template<class GraphicsSurfaces>
-				inline basic_image_surface<GraphicsSurfaces>::~basic_image_surface() noexcept {
+				basic_image_surface<GraphicsSurfaces>::~basic_image_surface() noexcept {
+					if (_Pool != nullptr) {
+						_Pool->release(_Data);
+					}
 					GraphicsSurfaces::surfaces::destroy(_Data);
 				}
 
 #ifdef _Filesystem_support_test
 				template <class GraphicsSurfaces>
-				inline void basic_image_surface<GraphicsSurfaces>::save(filesystem::path p, image_file_format iff) {
+				void basic_image_surface<GraphicsSurfaces>::save(filesystem::path p, image_file_format iff) {
 					GraphicsSurfaces::surfaces::save(_Data, p, iff);
 				}
 				template <class GraphicsSurfaces>
-				inline void basic_image_surface<GraphicsSurfaces>::save(filesystem::path p, image_file_format iff, error_code& ec) noexcept {
+				void basic_image_surface<GraphicsSurfaces>::save(filesystem::path p, image_file_format iff, error_code& ec) noexcept {
 					GraphicsSurfaces::surfaces::save(_Data, p, iff, ec);
 				}
 #else
 				template <class GraphicsSurfaces>
-				inline void basic_image_surface<GraphicsSurfaces>::save(::std::string p, image_file_format iff) {
+				void basic_image_surface<GraphicsSurfaces>::save(::std::string p, image_file_format iff) {
 					GraphicsSurfaces::surfaces::save(_Data, p, iff);
 				}
 				template <class GraphicsSurfaces>
-				inline void basic_image_surface<GraphicsSurfaces>::save(::std::string p, image_file_format iff, error_code& ec) noexcept {
+				void basic_image_surface<GraphicsSurfaces>::save(::std::string p, image_file_format iff, error_code& ec) noexcept {
 					GraphicsSurfaces::surfaces::save(_Data, p, iff, ec);
 				}
 #endif
 
 				template<class GraphicsSurfaces>
-				inline basic_display_point<typename basic_image_surface<GraphicsSurfaces>::graphics_math_type> basic_image_surface<GraphicsSurfaces>::max_dimensions() noexcept {
+				basic_display_point<typename basic_image_surface<GraphicsSurfaces>::graphics_math_type> basic_image_surface<GraphicsSurfaces>::max_dimensions() noexcept {
 					return GraphicsSurfaces::surfaces::max_dimensions();
 				}
 				template <class GraphicsSurfaces>
-				inline io2d::format basic_image_surface<GraphicsSurfaces>::format() const noexcept {
+				int basic_image_surface<GraphicsSurfaces>::stride_for_width(io2d::format fmt, int width) noexcept {
+					return GraphicsSurfaces::surfaces::stride_for_width(fmt, width);
+				}
+				template <class GraphicsSurfaces>
+				io2d::format basic_image_surface<GraphicsSurfaces>::format() const noexcept {
 					return GraphicsSurfaces::surfaces::format(_Data);
 				}
 				template<class GraphicsSurfaces>
-				inline basic_display_point<typename basic_image_surface<GraphicsSurfaces>::graphics_math_type> basic_image_surface<GraphicsSurfaces>::dimensions() const noexcept {
+				basic_display_point<typename basic_image_surface<GraphicsSurfaces>::graphics_math_type> basic_image_surface<GraphicsSurfaces>::dimensions() const noexcept {
 					return GraphicsSurfaces::surfaces::dimensions(_Data);
 				}
 
+				// Called before anything that changes the pixels. The pixels are copied only while another surface or a brush still references them; the
+				// pool uses the same test to decide whether data can be reused.
 				template <class GraphicsSurfaces>
-				inline void basic_image_surface<GraphicsSurfaces>::clear() {
+				void basic_image_surface<GraphicsSurfaces>::_Own_pixels() {
+					if (!_Shares_pixels) {
+						return;
+					}
+					if (!GraphicsSurfaces::surfaces::is_recyclable(_Data)) {
+						*this = _Copy_pixels();
+					}
+					_Shares_pixels = false;
+				}
+				template <class GraphicsSurfaces>
+				basic_image_surface<GraphicsSurfaces> basic_image_surface<GraphicsSurfaces>::_Copy_pixels() const {
+					const auto dims = dimensions();
+					basic_image_surface copy(format(), dims.x(), dims.y());
+					copy.paint(basic_brush<GraphicsSurfaces>(*this), nullopt, basic_render_props<GraphicsSurfaces>(antialias::none, basic_matrix_2d<graphics_math_type>{}, compositing_op::source));
+					copy.coverage_cache_limit(coverage_cache_limit());
+					return copy;
+				}
+
+				template <class GraphicsSurfaces>
+				void basic_image_surface<GraphicsSurfaces>::clear() {
+					_Own_pixels();
 					GraphicsSurfaces::surfaces::clear(_Data);
 				}
 				template <class GraphicsSurfaces>
-				inline void basic_image_surface<GraphicsSurfaces>::flush() {
+				void basic_image_surface<GraphicsSurfaces>::flush() {
 					GraphicsSurfaces::surfaces::flush(_Data);
 				}
 				template <class GraphicsSurfaces>
-				inline void basic_image_surface<GraphicsSurfaces>::flush(error_code& ec) noexcept {
+				void basic_image_surface<GraphicsSurfaces>::flush(error_code& ec) noexcept {
 					GraphicsSurfaces::surfaces::flush(_Data, ec);
 				}
 				template <class GraphicsSurfaces>
-				inline void basic_image_surface<GraphicsSurfaces>::mark_dirty() {
+				void basic_image_surface<GraphicsSurfaces>::mark_dirty() {
 					GraphicsSurfaces::surfaces::mark_dirty(_Data);
 				}
 				template <class GraphicsSurfaces>
-				inline void basic_image_surface<GraphicsSurfaces>::mark_dirty(error_code& ec) noexcept {
+				void basic_image_surface<GraphicsSurfaces>::mark_dirty(error_code& ec) noexcept {
 					GraphicsSurfaces::surfaces::mark_dirty(_Data, ec);
 				}
 				template <class GraphicsSurfaces>
-				inline void basic_image_surface<GraphicsSurfaces>::mark_dirty(const basic_bounding_box<graphics_math_type>& extents) {
+				void basic_image_surface<GraphicsSurfaces>::mark_dirty(const basic_bounding_box<graphics_math_type>& extents) {
 					GraphicsSurfaces::surfaces::mark_dirty(_Data, extents);
 				}
 				template <class GraphicsSurfaces>
-				inline void basic_image_surface<GraphicsSurfaces>::mark_dirty(const basic_bounding_box<graphics_math_type>& extents, error_code& ec) noexcept {
+				void basic_image_surface<GraphicsSurfaces>::mark_dirty(const basic_bounding_box<graphics_math_type>& extents, error_code& ec) noexcept {
 					GraphicsSurfaces::surfaces::mark_dirty(_Data, extents, ec);
 				}
 				template <class GraphicsSurfaces>
-				inline void basic_image_surface<GraphicsSurfaces>::paint(const basic_brush<GraphicsSurfaces>& b, const optional<basic_brush_props<GraphicsSurfaces>>& bp, const optional<basic_render_props<GraphicsSurfaces>>& rp, const optional<basic_clip_props<GraphicsSurfaces>>& cl) {
+				void basic_image_surface<GraphicsSurfaces>::paint(const basic_brush<GraphicsSurfaces>& b, const optional<basic_brush_props<GraphicsSurfaces>>& bp, const optional<basic_render_props<GraphicsSurfaces>>& rp, const optional<basic_clip_props<GraphicsSurfaces>>& cl) {
+					_Own_pixels();
 					GraphicsSurfaces::surfaces::paint(_Data, b, (bp == nullopt ? basic_brush_props<GraphicsSurfaces>() : bp.value()), (rp == nullopt ? basic_render_props<GraphicsSurfaces>() : rp.value()), (cl == nullopt ? basic_clip_props<GraphicsSurfaces>() : cl.value()));
 				}
 				template <class GraphicsSurfaces>
 				template <class Allocator>
-				inline void basic_image_surface<GraphicsSurfaces>::stroke(const basic_brush<GraphicsSurfaces>& b, const basic_path_builder<GraphicsSurfaces, Allocator>& pb, const optional<basic_brush_props<GraphicsSurfaces>>& bp, const optional<basic_stroke_props<GraphicsSurfaces>>& sp, const optional<basic_dashes<GraphicsSurfaces>>& d, const optional<basic_render_props<GraphicsSurfaces>>& rp, const optional<basic_clip_props<GraphicsSurfaces>>& cl) {
+				void basic_image_surface<GraphicsSurfaces>::stroke(const basic_brush<GraphicsSurfaces>& b, const basic_path_builder<GraphicsSurfaces, Allocator>& pb, const optional<basic_brush_props<GraphicsSurfaces>>& bp, const optional<basic_stroke_props<GraphicsSurfaces>>& sp, const optional<basic_dashes<GraphicsSurfaces>>& d, const optional<basic_render_props<GraphicsSurfaces>>& rp, const optional<basic_clip_props<GraphicsSurfaces>>& cl) {
+					_Own_pixels();
 					GraphicsSurfaces::surfaces::stroke(_Data, b, basic_interpreted_path<GraphicsSurfaces>(pb), (bp == nullopt ? basic_brush_props<GraphicsSurfaces>() : bp.value()), (sp == nullopt ? basic_stroke_props<GraphicsSurfaces>() : sp.value()), (d == nullopt ? basic_dashes<GraphicsSurfaces>() : d.value()), (rp == nullopt ? basic_render_props<GraphicsSurfaces>() : rp.value()), (cl == nullopt ? basic_clip_props<GraphicsSurfaces>() : cl.value()));
 				}
 				template <class GraphicsSurfaces>
-				inline void basic_image_surface<GraphicsSurfaces>::stroke(const basic_brush<GraphicsSurfaces>& b, const basic_interpreted_path<GraphicsSurfaces>& ip, const optional<basic_brush_props<GraphicsSurfaces>>& bp, const optional<basic_stroke_props<GraphicsSurfaces>>& sp, const optional<basic_dashes<GraphicsSurfaces>>& d, const optional<basic_render_props<GraphicsSurfaces>>& rp, const optional<basic_clip_props<GraphicsSurfaces>>& cl) {
+				void basic_image_surface<GraphicsSurfaces>::stroke(const basic_brush<GraphicsSurfaces>& b, const basic_interpreted_path<GraphicsSurfaces>& ip, const optional<basic_brush_props<GraphicsSurfaces>>& bp, const optional<basic_stroke_props<GraphicsSurfaces>>& sp, const optional<basic_dashes<GraphicsSurfaces>>& d, const optional<basic_render_props<GraphicsSurfaces>>& rp, const optional<basic_clip_props<GraphicsSurfaces>>& cl) {
+					_Own_pixels();
 					GraphicsSurfaces::surfaces::stroke(_Data, b, ip, (bp == nullopt ? basic_brush_props<GraphicsSurfaces>() : bp.value()), (sp == nullopt ? basic_stroke_props<GraphicsSurfaces>() : sp.value()), (d == nullopt ? basic_dashes<GraphicsSurfaces>() : d.value()), (rp == nullopt ? basic_render_props<GraphicsSurfaces>() : rp.value()), (cl == nullopt ? basic_clip_props<GraphicsSurfaces>() : cl.value()));
 				}
 				template <class GraphicsSurfaces>
 				template <class Allocator>
-				inline void basic_image_surface<GraphicsSurfaces>::fill(const basic_brush<GraphicsSurfaces>& b, const basic_path_builder<GraphicsSurfaces, Allocator>& pb, const optional<basic_brush_props<GraphicsSurfaces>>& bp, const optional<basic_render_props<GraphicsSurfaces>>& rp, const optional<basic_clip_props<GraphicsSurfaces>>& cl) {
+				void basic_image_surface<GraphicsSurfaces>::fill(const basic_brush<GraphicsSurfaces>& b, const basic_path_builder<GraphicsSurfaces, Allocator>& pb, const optional<basic_brush_props<GraphicsSurfaces>>& bp, const optional<basic_render_props<GraphicsSurfaces>>& rp, const optional<basic_clip_props<GraphicsSurfaces>>& cl) {
+					_Own_pixels();
 					GraphicsSurfaces::surfaces::fill(_Data, b, basic_interpreted_path<GraphicsSurfaces>(pb), (bp == nullopt ? basic_brush_props<GraphicsSurfaces>() : bp.value()), (rp == nullopt ? basic_render_props<GraphicsSurfaces>() : rp.value()), (cl == nullopt ? basic_clip_props<GraphicsSurfaces>() : cl.value()));
 				}
 				template <class GraphicsSurfaces>
-				inline void basic_image_surface<GraphicsSurfaces>::fill(const basic_brush<GraphicsSurfaces>& b, const basic_interpreted_path<GraphicsSurfaces>& ip, const optional<basic_brush_props<GraphicsSurfaces>>& bp, const optional<basic_render_props<GraphicsSurfaces>>& rp, const optional<basic_clip_props<GraphicsSurfaces>>& cl) {
+				void basic_image_surface<GraphicsSurfaces>::fill(const basic_brush<GraphicsSurfaces>& b, const basic_interpreted_path<GraphicsSurfaces>& ip, const optional<basic_brush_props<GraphicsSurfaces>>& bp, const optional<basic_render_props<GraphicsSurfaces>>& rp, const optional<basic_clip_props<GraphicsSurfaces>>& cl) {
+					_Own_pixels();
 					GraphicsSurfaces::surfaces::fill(_Data, b, ip, (bp == nullopt ? basic_brush_props<GraphicsSurfaces>() : bp.value()), (rp == nullopt ? basic_render_props<GraphicsSurfaces>() : rp.value()), (cl == nullopt ? basic_clip_props<GraphicsSurfaces>() : cl.value()));
 				}
 				template <class GraphicsSurfaces>
-				inline void basic_image_surface<GraphicsSurfaces>::mask(const basic_brush<GraphicsSurfaces>& b, const basic_brush<GraphicsSurfaces>& mb, const optional<basic_brush_props<GraphicsSurfaces>>& bp, const optional<basic_mask_props<GraphicsSurfaces>>& mp, const optional<basic_render_props<GraphicsSurfaces>>& rp, const optional<basic_clip_props<GraphicsSurfaces>>& cl) {
+				template <class Allocator>
+				void basic_image_surface<GraphicsSurfaces>::fill_stroke(const basic_brush<GraphicsSurfaces>& fb, const basic_brush<GraphicsSurfaces>& sb, const basic_path_builder<GraphicsSurfaces, Allocator>& pb, const optional<basic_brush_props<GraphicsSurfaces>>& bp, const optional<basic_stroke_props<GraphicsSurfaces>>& sp, const optional<basic_dashes<GraphicsSurfaces>>& d, const optional<basic_render_props<GraphicsSurfaces>>& rp, const optional<basic_clip_props<GraphicsSurfaces>>& cl) {
+					_Own_pixels();
+					GraphicsSurfaces::surfaces::fill_stroke(_Data, fb, sb, basic_interpreted_path<GraphicsSurfaces>(pb), (bp == nullopt ? basic_brush_props<GraphicsSurfaces>() : bp.value()), (sp == nullopt ? basic_stroke_props<GraphicsSurfaces>() : sp.value()), (d == nullopt ? basic_dashes<GraphicsSurfaces>() : d.value()), (rp == nullopt ? basic_render_props<GraphicsSurfaces>() : rp.value()), (cl == nullopt ? basic_clip_props<GraphicsSurfaces>() : cl.value()));
+				}
+				template <class GraphicsSurfaces>
+				void basic_image_surface<GraphicsSurfaces>::fill_stroke(const basic_brush<GraphicsSurfaces>& fb, const basic_brush<GraphicsSurfaces>& sb, const basic_interpreted_path<GraphicsSurfaces>& ip, const optional<basic_brush_props<GraphicsSurfaces>>& bp, const optional<basic_stroke_props<GraphicsSurfaces>>& sp, const optional<basic_dashes<GraphicsSurfaces>>& d, const optional<basic_render_props<GraphicsSurfaces>>& rp, const optional<basic_clip_props<GraphicsSurfaces>>& cl) {
+					_Own_pixels();
+					GraphicsSurfaces::surfaces::fill_stroke(_Data, fb, sb, ip, (bp == nullopt ? basic_brush_props<GraphicsSurfaces>() : bp.value()), (sp == nullopt ? basic_stroke_props<GraphicsSurfaces>() : sp.value()), (d == nullopt ? basic_dashes<GraphicsSurfaces>() : d.value()), (rp == nullopt ? basic_render_props<GraphicsSurfaces>() : rp.value()), (cl == nullopt ? basic_clip_props<GraphicsSurfaces>() : cl.value()));
+				}
+				template <class GraphicsSurfaces>
+				void basic_image_surface<GraphicsSurfaces>::fill_rect(const basic_brush<GraphicsSurfaces>& b, const basic_bounding_box<graphics_math_type>& bb, const optional<basic_brush_props<GraphicsSurfaces>>& bp, const optional<basic_render_props<GraphicsSurfaces>>& rp, const optional<basic_clip_props<GraphicsSurfaces>>& cl) {
+					_Own_pixels();
+					GraphicsSurfaces::surfaces::fill_rect(_Data, b, bb, (bp == nullopt ? basic_brush_props<GraphicsSurfaces>() : bp.value()), (rp == nullopt ? basic_render_props<GraphicsSurfaces>() : rp.value()), (cl == nullopt ? basic_clip_props<GraphicsSurfaces>() : cl.value()));
+				}
+				template <class GraphicsSurfaces>
+				void basic_image_surface<GraphicsSurfaces>::stroke_rect(const basic_brush<GraphicsSurfaces>& b, const basic_bounding_box<graphics_math_type>& bb, const optional<basic_brush_props<GraphicsSurfaces>>& bp, const optional<basic_stroke_props<GraphicsSurfaces>>& sp, const optional<basic_dashes<GraphicsSurfaces>>& d, const optional<basic_render_props<GraphicsSurfaces>>& rp, const optional<basic_clip_props<GraphicsSurfaces>>& cl) {
+					_Own_pixels();
+					GraphicsSurfaces::surfaces::stroke_rect(_Data, b, bb, (bp == nullopt ? basic_brush_props<GraphicsSurfaces>() : bp.value()), (sp == nullopt ? basic_stroke_props<GraphicsSurfaces>() : sp.value()), (d == nullopt ? basic_dashes<GraphicsSurfaces>() : d.value()), (rp == nullopt ? basic_render_props<GraphicsSurfaces>() : rp.value()), (cl == nullopt ? basic_clip_props<GraphicsSurfaces>() : cl.value()));
+				}
+				template <class GraphicsSurfaces>
+				void basic_image_surface<GraphicsSurfaces>::fill_circle(const basic_brush<GraphicsSurfaces>& b, const basic_circle<graphics_math_type>& c, const optional<basic_brush_props<GraphicsSurfaces>>& bp, const optional<basic_render_props<GraphicsSurfaces>>& rp, const optional<basic_clip_props<GraphicsSurfaces>>& cl) {
+					_Own_pixels();
+					GraphicsSurfaces::surfaces::fill_circle(_Data, b, c, (bp == nullopt ? basic_brush_props<GraphicsSurfaces>() : bp.value()), (rp == nullopt ? basic_render_props<GraphicsSurfaces>() : rp.value()), (cl == nullopt ? basic_clip_props<GraphicsSurfaces>() : cl.value()));
+				}
+				template <class GraphicsSurfaces>
+				template <class InputIterator>
+				void basic_image_surface<GraphicsSurfaces>::fill_instances(const basic_brush<GraphicsSurfaces>& b, const basic_interpreted_path<GraphicsSurfaces>& ip, InputIterator first, InputIterator last, const optional<basic_brush_props<GraphicsSurfaces>>& bp, const optional<basic_render_props<GraphicsSurfaces>>& rp, const optional<basic_clip_props<GraphicsSurfaces>>& cl) {
+					_Own_pixels();
+					_Call_with_fill_instances<graphics_math_type>(first, last, [&](const _Fill_instance_range<graphics_math_type>& instances) {
+						GraphicsSurfaces::surfaces::fill_instances(_Data, b, ip, instances, (bp == nullopt ? basic_brush_props<GraphicsSurfaces>() : bp.value()), (rp == nullopt ? basic_render_props<GraphicsSurfaces>() : rp.value()), (cl == nullopt ? basic_clip_props<GraphicsSurfaces>() : cl.value()));
+					});
+				}
+				template <class GraphicsSurfaces>
+				void basic_image_surface<GraphicsSurfaces>::mask(const basic_brush<GraphicsSurfaces>& b, const basic_brush<GraphicsSurfaces>& mb, const optional<basic_brush_props<GraphicsSurfaces>>& bp, const optional<basic_mask_props<GraphicsSurfaces>>& mp, const optional<basic_render_props<GraphicsSurfaces>>& rp, const optional<basic_clip_props<GraphicsSurfaces>>& cl) {
+					_Own_pixels();
 					GraphicsSurfaces::surfaces::mask(_Data, b, mb, (bp == nullopt ? basic_brush_props<GraphicsSurfaces>() : bp.value()), (mp == nullopt ? basic_mask_props<GraphicsSurfaces>() : mp.value()), (rp == nullopt ? basic_render_props<GraphicsSurfaces>() : rp.value()), (cl == nullopt ? basic_clip_props<GraphicsSurfaces>() : cl.value()));
 				}
+				template <class GraphicsSurfaces>
+				void basic_image_surface<GraphicsSurfaces>::scroll(const basic_display_point<graphics_math_type>& offset) {
+					const auto dims = dimensions();
+					scroll(offset, basic_bounding_box<graphics_math_type>(0.0F, 0.0F, static_cast<float>(dims.x()), static_cast<float>(dims.y())));
+				}
+				template <class GraphicsSurfaces>
+				void basic_image_surface<GraphicsSurfaces>::scroll(const basic_display_point<graphics_math_type>& offset, const basic_bounding_box<graphics_math_type>& region) {
+					const auto dims = dimensions();
+					const basic_display_point<graphics_math_type> regionMin(::std::max(_Float_to_int(region.x()), 0), ::std::max(_Float_to_int(region.y()), 0));
+					const basic_display_point<graphics_math_type> regionMax(::std::min(_Float_to_int(region.x() + region.width()), dims.x()), ::std::min(_Float_to_int(region.y() + region.height()), dims.y()));
+					int x = regionMin.x();
+					int y = regionMin.y();
+					int width = regionMax.x() - x;
+					int height = regionMax.y() - y;
+					int dstX = x + offset.x();
+					int dstY = y + offset.y();
+					if ((offset.x() == 0 && offset.y() == 0) || !_Clip_pixel_block(x, y, width, height, dstX, dstY, regionMin, regionMax, regionMin, regionMax)) {
+						return;
+					}
+					_Own_pixels();
+					GraphicsSurfaces::surfaces::copy_region(_Data, x, y, width, height, _Data, dstX, dstY);
+				}
+				template <class GraphicsSurfaces>
+				void basic_image_surface<GraphicsSurfaces>::coverage_cache_limit(size_t bytes) {
+					GraphicsSurfaces::surfaces::coverage_cache_limit(_Data, bytes);
+				}
+				template <class GraphicsSurfaces>
+				size_t basic_image_surface<GraphicsSurfaces>::coverage_cache_limit() const noexcept {
+					return GraphicsSurfaces::surfaces::coverage_cache_limit(_Data);
+				}
+				template <class GraphicsSurfaces>
+				coverage_cache_stats basic_image_surface<GraphicsSurfaces>::coverage_cache_statistics() const noexcept {
+					return GraphicsSurfaces::surfaces::coverage_cache_statistics(_Data);
+				}
 
 				template<class GraphicsSurfaces>
-				inline basic_image_surface<GraphicsSurfaces> copy_surface(basic_image_surface<GraphicsSurfaces>& sfc) noexcept {
-					return GraphicsSurfaces::surfaces::copy_surface(sfc);
+				basic_image_surface<GraphicsSurfaces> copy_surface(basic_image_surface<GraphicsSurfaces>& sfc) {
+					if (GraphicsSurfaces::surfaces::uses_external_memory(sfc._Data)) {
+						return sfc._Copy_pixels();
+					}
+					basic_image_surface<GraphicsSurfaces> result(nullptr, GraphicsSurfaces::surfaces::share_image_surface(sfc._Data));
+					result._Shares_pixels = true;
+					sfc._Shares_pixels = true;
+					return result;
+				}
+
+				// Shrinks the width by height block at (x, y) and its destination at (dstX, dstY) until the block lies within [srcMin, srcMax) and the
+				// destination within [dstMin, dstMax). Returns false when nothing is left to copy.
+				template <class GraphicsMath>
+				bool _Clip_pixel_block(int& x, int& y, int& width, int& height, int& dstX, int& dstY, const basic_display_point<GraphicsMath>& srcMin, const basic_display_point<GraphicsMath>& srcMax, const basic_display_point<GraphicsMath>& dstMin, const basic_display_point<GraphicsMath>& dstMax) noexcept {
+					const auto clipAxis = [](int& from, int& to, int& size, int fromMin, int fromMax, int toMin, int toMax) {
+						const int skip = ::std::max(fromMin - from, toMin - to);
+						if (skip > 0) {
+							from += skip;
+							to += skip;
+							size -= skip;
+						}
+						size = ::std::min(size, ::std::min(fromMax - from, toMax - to));
+						return size > 0;
+					};
+					return clipAxis(x, dstX, width, srcMin.x(), srcMax.x(), dstMin.x(), dstMax.x()) && clipAxis(y, dstY, height, srcMin.y(), srcMax.y(), dstMin.y(), dstMax.y());
 				}
 
 				template<class GraphicsSurfaces>
-				inline basic_image_surface<GraphicsSurfaces> copy_surface(basic_output_surface<GraphicsSurfaces>& sfc) noexcept {
+				void copy_region(const basic_image_surface<GraphicsSurfaces>& src, const basic_bounding_box<typename GraphicsSurfaces::graphics_math_type>& srcRect, basic_image_surface<GraphicsSurfaces>& dst, const basic_display_point<typename GraphicsSurfaces::graphics_math_type>& dstPoint) {
+					using graphics_math_type = typename GraphicsSurfaces::graphics_math_type;
+					const auto srcDims = src.dimensions();
+					const auto wholePixel = [](float v) { return ::std::floor(v) == v; };
+					if (src.format() == dst.format() && wholePixel(srcRect.x()) && wholePixel(srcRect.y()) && wholePixel(srcRect.width()) && wholePixel(srcRect.height())) {
+						int x = static_cast<int>(srcRect.x());
+						int y = static_cast<int>(srcRect.y());
+						int width = static_cast<int>(srcRect.width());
+						int height = static_cast<int>(srcRect.height());
+						int dstX = dstPoint.x();
+						int dstY = dstPoint.y();
+						const basic_display_point<graphics_math_type> origin(0, 0);
+						if (!_Clip_pixel_block(x, y, width, height, dstX, dstY, origin, srcDims, origin, dst.dimensions())) {
+							return;
+						}
+						dst._Own_pixels();
+						GraphicsSurfaces::surfaces::copy_region(src._Data, x, y, width, height, dst._Data, dstX, dstY);
+						return;
+					}
+
+					// Anything else is drawn, leaving out the part of srcRect outside src so that it does not clear dst.
+					const float left = ::std::max(srcRect.x(), 0.0F);
+					const float top = ::std::max(srcRect.y(), 0.0F);
+					const float right = ::std::min(srcRect.x() + srcRect.width(), static_cast<float>(srcDims.x()));
+					const float bottom = ::std::min(srcRect.y() + srcRect.height(), static_cast<float>(srcDims.y()));
+					if (left >= right || top >= bottom) {
+						return;
+					}
+					const basic_point_2d<graphics_math_type> dstTopLeft(static_cast<float>(dstPoint.x()) + left - srcRect.x(), static_cast<float>(dstPoint.y()) + top - srcRect.y());
+					const basic_render_props<GraphicsSurfaces> copyProps(antialias::none, basic_matrix_2d<graphics_math_type>{}, compositing_op::source);
+					const basic_brush_props<GraphicsSurfaces> copyBrushProps(io2d::wrap_mode::none, io2d::filter::nearest, io2d::fill_rule::winding, basic_matrix_2d<graphics_math_type>::create_translate(basic_point_2d<graphics_math_type>(left - dstTopLeft.x(), top - dstTopLeft.y())));
+					const basic_bounding_box<graphics_math_type> dstRect(dstTopLeft.x(), dstTopLeft.y(), right - left, bottom - top);
+					if (&src == &dst) {
+						// Drawing a surface onto itself is undefined, so draw from a copy that shares its pixels until fill_rect copies them.
+						dst.fill_rect(basic_brush<GraphicsSurfaces>(copy_surface(dst)), dstRect, copyBrushProps, copyProps);
+					}
+					else {
+						dst.fill_rect(basic_brush<GraphicsSurfaces>(src), dstRect, copyBrushProps, copyProps);
+					}
+				}
+
+				template<class GraphicsSurfaces>
+				basic_image_surface<GraphicsSurfaces> copy_surface(basic_output_surface<GraphicsSurfaces>& sfc) {
 					return GraphicsSurfaces::surfaces::copy_surface(sfc);
 				}
 
 				template<class GraphicsSurfaces>
-				inline basic_image_surface<GraphicsSurfaces> copy_surface(basic_unmanaged_output_surface<GraphicsSurfaces>& sfc) noexcept {
+				basic_image_surface<GraphicsSurfaces> copy_surface(basic_unmanaged_output_surface<GraphicsSurfaces>& sfc) {
 					return GraphicsSurfaces::surfaces::copy_surface(sfc);
 				}
 
 				// output surface
 
 				template <class GraphicsSurfaces>
-				inline basic_output_surface<GraphicsSurfaces>::basic_output_surface(int preferredWidth,
+				basic_output_surface<GraphicsSurfaces>::basic_output_surface(int preferredWidth,
 					int preferredHeight, io2d::format preferredFormat, io2d::scaling scl,
 					io2d::refresh_style rr, float fps)
 					: _Data(move(GraphicsSurfaces::surfaces::create_output_surface(preferredWidth, preferredHeight, preferredFormat, scl, rr, fps))) {}
 				template <class GraphicsSurfaces>
-				inline basic_output_surface<GraphicsSurfaces>::basic_output_surface(int preferredWidth,
+				basic_output_surface<GraphicsSurfaces>::basic_output_surface(int preferredWidth,
 					int preferredHeight, io2d::format preferredFormat, error_code& ec, io2d::scaling scl,
 					io2d::refresh_style rr, float fps) noexcept
 					: _Data(move(GraphicsSurfaces::surfaces::create_output_surface(preferredWidth, preferredHeight, preferredFormat, ec, scl, rr, fps))) {}
 				template <class GraphicsSurfaces>
-				inline basic_output_surface<GraphicsSurfaces>::basic_output_surface(int preferredWidth,
+				basic_output_surface<GraphicsSurfaces>::basic_output_surface(int preferredWidth,
 					int preferredHeight, io2d::format preferredFormat, int preferredDisplayWidth,
 					int preferredDisplayHeight, io2d::scaling scl, io2d::refresh_style rr, float fps)
 					: _Data(move(GraphicsSurfaces::surfaces::create_output_surface(preferredWidth, preferredHeight, preferredFormat, preferredDisplayWidth, preferredDisplayHeight, scl, rr, fps))) {}
 				template <class GraphicsSurfaces>
-				inline basic_output_surface<GraphicsSurfaces>::basic_output_surface(int preferredWidth,
+				basic_output_surface<GraphicsSurfaces>::basic_output_surface(int preferredWidth,
 					int preferredHeight, io2d::format preferredFormat, int preferredDisplayWidth,
 					int preferredDisplayHeight, error_code& ec, io2d::scaling scl, io2d::refresh_style rr,
 					float fps) noexcept
 					: _Data(move(GraphicsSurfaces::surfaces::create_output_surface(preferredWidth, preferredHeight, preferredFormat, preferredDisplayWidth, preferredDisplayHeight, ec, scl, rr, fps))) {}
 
 				template <class GraphicsSurfaces>
-				inline basic_output_surface<GraphicsSurfaces>::~basic_output_surface() noexcept {
+				basic_output_surface<GraphicsSurfaces>::~basic_output_surface() noexcept {
 					GraphicsSurfaces::surfaces::destroy(_Data);
 				}
 
 				template<class GraphicsSurfaces>
-				inline basic_output_surface<GraphicsSurfaces>::basic_output_surface(basic_output_surface&& other) noexcept
+				basic_output_surface<GraphicsSurfaces>::basic_output_surface(basic_output_surface&& other) noexcept
 					: _Data(move(GraphicsSurfaces::surfaces::move_output_surface(move(other._Data)))) {
 				}
 
 				template<class GraphicsSurfaces>
-				inline basic_output_surface<GraphicsSurfaces>& basic_output_surface<GraphicsSurfaces>::operator=(basic_output_surface&& other) noexcept {
+				basic_output_surface<GraphicsSurfaces>& basic_output_surface<GraphicsSurfaces>::operator=(basic_output_surface&& other) noexcept {
 					if (this != &other) {
 						_Data = move(GraphicsSurfaces::surfaces::move_output_surface(move(other._Data)));
 					}
@@ -200,160 +397,218 @@ namespace std {
 				}
 
 				template <class GraphicsSurfaces>
-				inline void basic_output_surface<GraphicsSurfaces>::redraw_required() noexcept {
+				void basic_output_surface<GraphicsSurfaces>::redraw_required() noexcept {
 					GraphicsSurfaces::surfaces::redraw_required(_Data);
 				}
 				template <class GraphicsSurfaces>
-				inline int basic_output_surface<GraphicsSurfaces>::begin_show() {
+				int basic_output_surface<GraphicsSurfaces>::begin_show() {
 					return GraphicsSurfaces::surfaces::begin_show(_Data, this, *this);
 				}
 				template <class GraphicsSurfaces>
-				inline void basic_output_surface<GraphicsSurfaces>::end_show() {
+				void basic_output_surface<GraphicsSurfaces>::end_show() {
 					GraphicsSurfaces::surfaces::end_show(_Data);
 				}
 
 				template <class GraphicsSurfaces>
-				inline typename basic_output_surface<GraphicsSurfaces>::data_type& basic_output_surface<GraphicsSurfaces>::data() noexcept {
+				typename basic_output_surface<GraphicsSurfaces>::data_type& basic_output_surface<GraphicsSurfaces>::data() noexcept {
 					return _Data;
 				}
 
 				template <class GraphicsSurfaces>
-				inline void basic_output_surface<GraphicsSurfaces>::clear() {
+				void basic_output_surface<GraphicsSurfaces>::clear() {
 					GraphicsSurfaces::surfaces::clear(_Data);
 				}
 				template <class GraphicsSurfaces>
-				inline void basic_output_surface<GraphicsSurfaces>::flush() {
+				void basic_output_surface<GraphicsSurfaces>::flush() {
 					GraphicsSurfaces::surfaces::flush(_Data);
 				}
 				template <class GraphicsSurfaces>
-				inline void basic_output_surface<GraphicsSurfaces>::flush(error_code& ec) noexcept {
+				void basic_output_surface<GraphicsSurfaces>::flush(error_code& ec) noexcept {
 					GraphicsSurfaces::surfaces::flush(_Data, ec);
 				}
 				template <class GraphicsSurfaces>
-				inline void basic_output_surface<GraphicsSurfaces>::mark_dirty() {
+				void basic_output_surface<GraphicsSurfaces>::mark_dirty() {
 					GraphicsSurfaces::surfaces::mark_dirty(_Data);
 				}
 				template <class GraphicsSurfaces>
-				inline void basic_output_surface<GraphicsSurfaces>::mark_dirty(error_code& ec) noexcept {
+				void basic_output_surface<GraphicsSurfaces>::mark_dirty(error_code& ec) noexcept {
 					GraphicsSurfaces::surfaces::mark_dirty(_Data, ec);
 				}
 				template <class GraphicsSurfaces>
-				inline void basic_output_surface<GraphicsSurfaces>::mark_dirty(const basic_bounding_box<graphics_math_type>& extents) {
+				void basic_output_surface<GraphicsSurfaces>::mark_dirty(const basic_bounding_box<graphics_math_type>& extents) {
 					GraphicsSurfaces::surfaces::mark_dirty(_Data, extents);
 				}
 				template <class GraphicsSurfaces>
-				inline void basic_output_surface<GraphicsSurfaces>::mark_dirty(const basic_bounding_box<graphics_math_type>& extents, error_code& ec) noexcept {
+				void basic_output_surface<GraphicsSurfaces>::mark_dirty(const basic_bounding_box<graphics_math_type>& extents, error_code& ec) noexcept {
 					GraphicsSurfaces::surfaces::mark_dirty(_Data, extents, ec);
 				}
 				template <class GraphicsSurfaces>
-				inline void basic_output_surface<GraphicsSurfaces>::paint(const basic_brush<GraphicsSurfaces>& b, const optional<basic_brush_props<GraphicsSurfaces>>& bp, const optional<basic_render_props<GraphicsSurfaces>>& rp, const optional<basic_clip_props<GraphicsSurfaces>>& cl) {
+				void basic_output_surface<GraphicsSurfaces>::paint(const basic_brush<GraphicsSurfaces>& b, const optional<basic_brush_props<GraphicsSurfaces>>& bp, const optional<basic_render_props<GraphicsSurfaces>>& rp, const optional<basic_clip_props<GraphicsSurfaces>>& cl) {
 					GraphicsSurfaces::surfaces::paint(_Data, b, (bp == nullopt ? basic_brush_props<GraphicsSurfaces>() : bp.value()), (rp == nullopt ? basic_render_props<GraphicsSurfaces>() : rp.value()), (cl == nullopt ? basic_clip_props<GraphicsSurfaces>() : cl.value()));
 				}
 				template <class GraphicsSurfaces>
 				template <class Allocator>
-				inline void basic_output_surface<GraphicsSurfaces>::stroke(const basic_brush<GraphicsSurfaces>& b, const basic_path_builder<GraphicsSurfaces, Allocator>& pb, const optional<basic_brush_props<GraphicsSurfaces>>& bp, const optional<basic_stroke_props<GraphicsSurfaces>>& sp, const optional<basic_dashes<GraphicsSurfaces>>& d, const optional<basic_render_props<GraphicsSurfaces>>& rp, const optional<basic_clip_props<GraphicsSurfaces>>& cl) {
+				void basic_output_surface<GraphicsSurfaces>::stroke(const basic_brush<GraphicsSurfaces>& b, const basic_path_builder<GraphicsSurfaces, Allocator>& pb, const optional<basic_brush_props<GraphicsSurfaces>>& bp, const optional<basic_stroke_props<GraphicsSurfaces>>& sp, const optional<basic_dashes<GraphicsSurfaces>>& d, const optional<basic_render_props<GraphicsSurfaces>>& rp, const optional<basic_clip_props<GraphicsSurfaces>>& cl) {
 					GraphicsSurfaces::surfaces::stroke(_Data, b, basic_interpreted_path<GraphicsSurfaces>(pb), (bp == nullopt ? basic_brush_props<GraphicsSurfaces>() : bp.value()), (sp == nullopt ? basic_stroke_props<GraphicsSurfaces>() : sp.value()), (d == nullopt ? basic_dashes<GraphicsSurfaces>() : d.value()), (rp == nullopt ? basic_render_props<GraphicsSurfaces>() : rp.value()), (cl == nullopt ? basic_clip_props<GraphicsSurfaces>() : cl.value()));
 				}
 				template <class GraphicsSurfaces>
-				inline void basic_output_surface<GraphicsSurfaces>::stroke(const basic_brush<GraphicsSurfaces>& b, const basic_interpreted_path<GraphicsSurfaces>& ip, const optional<basic_brush_props<GraphicsSurfaces>>& bp, const optional<basic_stroke_props<GraphicsSurfaces>>& sp, const optional<basic_dashes<GraphicsSurfaces>>& d, const optional<basic_render_props<GraphicsSurfaces>>& rp, const optional<basic_clip_props<GraphicsSurfaces>>& cl) {
+				void basic_output_surface<GraphicsSurfaces>::stroke(const basic_brush<GraphicsSurfaces>& b, const basic_interpreted_path<GraphicsSurfaces>& ip, const optional<basic_brush_props<GraphicsSurfaces>>& bp, const optional<basic_stroke_props<GraphicsSurfaces>>& sp, const optional<basic_dashes<GraphicsSurfaces>>& d, const optional<basic_render_props<GraphicsSurfaces>>& rp, const optional<basic_clip_props<GraphicsSurfaces>>& cl) {
 					GraphicsSurfaces::surfaces::stroke(_Data, b, ip, (bp == nullopt ? basic_brush_props<GraphicsSurfaces>() : bp.value()), (sp == nullopt ? basic_stroke_props<GraphicsSurfaces>() : sp.value()), (d == nullopt ? basic_dashes<GraphicsSurfaces>() : d.value()), (rp == nullopt ? basic_render_props<GraphicsSurfaces>() : rp.value()), (cl == nullopt ? basic_clip_props<GraphicsSurfaces>() : cl.value()));
 				}
 				template <class GraphicsSurfaces>
 				template <class Allocator>
-				inline void basic_output_surface<GraphicsSurfaces>::fill(const basic_brush<GraphicsSurfaces>& b, const basic_path_builder<GraphicsSurfaces, Allocator>& pb, const optional<basic_brush_props<GraphicsSurfaces>>& bp, const optional<basic_render_props<GraphicsSurfaces>>& rp, const optional<basic_clip_props<GraphicsSurfaces>>& cl) {
+				void basic_output_surface<GraphicsSurfaces>::fill(const basic_brush<GraphicsSurfaces>& b, const basic_path_builder<GraphicsSurfaces, Allocator>& pb, const optional<basic_brush_props<GraphicsSurfaces>>& bp, const optional<basic_render_props<GraphicsSurfaces>>& rp, const optional<basic_clip_props<GraphicsSurfaces>>& cl) {
 					GraphicsSurfaces::surfaces::fill(_Data, b, basic_interpreted_path<GraphicsSurfaces>(pb), (bp == nullopt ? basic_brush_props<GraphicsSurfaces>() : bp.value()), (rp == nullopt ? basic_render_props<GraphicsSurfaces>() : rp.value()), (cl == nullopt ? basic_clip_props<GraphicsSurfaces>() : cl.value()));
 				}
 				template <class GraphicsSurfaces>
-				inline void basic_output_surface<GraphicsSurfaces>::fill(const basic_brush<GraphicsSurfaces>& b, const basic_interpreted_path<GraphicsSurfaces>& ip, const optional<basic_brush_props<GraphicsSurfaces>>& bp, const optional<basic_render_props<GraphicsSurfaces>>& rp, const optional<basic_clip_props<GraphicsSurfaces>>& cl) {
+				void basic_output_surface<GraphicsSurfaces>::fill(const basic_brush<GraphicsSurfaces>& b, const basic_interpreted_path<GraphicsSurfaces>& ip, const optional<basic_brush_props<GraphicsSurfaces>>& bp, const optional<basic_render_props<GraphicsSurfaces>>& rp, const optional<basic_clip_props<GraphicsSurfaces>>& cl) {
 					GraphicsSurfaces::surfaces::fill(_Data, b, ip, (bp == nullopt ? basic_brush_props<GraphicsSurfaces>() : bp.value()), (rp == nullopt ? basic_render_props<GraphicsSurfaces>() : rp.value()), (cl == nullopt ? basic_clip_props<GraphicsSurfaces>() : cl.value()));
 				}
 				template <class GraphicsSurfaces>
-				inline void basic_output_surface<GraphicsSurfaces>::mask(const basic_brush<GraphicsSurfaces>& b, const basic_brush<GraphicsSurfaces>& mb, const optional<basic_brush_props<GraphicsSurfaces>>& bp, const optional<basic_mask_props<GraphicsSurfaces>>& mp, const optional<basic_render_props<GraphicsSurfaces>>& rp, const optional<basic_clip_props<GraphicsSurfaces>>& cl) {
+				template <class Allocator>
+				void basic_output_surface<GraphicsSurfaces>::fill_stroke(const basic_brush<GraphicsSurfaces>& fb, const basic_brush<GraphicsSurfaces>& sb, const basic_path_builder<GraphicsSurfaces, Allocator>& pb, const optional<basic_brush_props<GraphicsSurfaces>>& bp, const optional<basic_stroke_props<GraphicsSurfaces>>& sp, const optional<basic_dashes<GraphicsSurfaces>>& d, const optional<basic_render_props<GraphicsSurfaces>>& rp, const optional<basic_clip_props<GraphicsSurfaces>>& cl) {
+					GraphicsSurfaces::surfaces::fill_stroke(_Data, fb, sb, basic_interpreted_path<GraphicsSurfaces>(pb), (bp == nullopt ? basic_brush_props<GraphicsSurfaces>() : bp.value()), (sp == nullopt ? basic_stroke_props<GraphicsSurfaces>() : sp.value()), (d == nullopt ? basic_dashes<GraphicsSurfaces>() : d.value()), (rp == nullopt ? basic_render_props<GraphicsSurfaces>() : rp.value()), (cl == nullopt ? basic_clip_props<GraphicsSurfaces>() : cl.value()));
+				}
+				template <class GraphicsSurfaces>
+				void basic_output_surface<GraphicsSurfaces>::fill_stroke(const basic_brush<GraphicsSurfaces>& fb, const basic_brush<GraphicsSurfaces>& sb, const basic_interpreted_path<GraphicsSurfaces>& ip, const optional<basic_brush_props<GraphicsSurfaces>>& bp, const optional<basic_stroke_props<GraphicsSurfaces>>& sp, const optional<basic_dashes<GraphicsSurfaces>>& d, const optional<basic_render_props<GraphicsSurfaces>>& rp, const optional<basic_clip_props<GraphicsSurfaces>>& cl) {
+					GraphicsSurfaces::surfaces::fill_stroke(_Data, fb, sb, ip, (bp == nullopt ? basic_brush_props<GraphicsSurfaces>() : bp.value()), (sp == nullopt ? basic_stroke_props<GraphicsSurfaces>() : sp.value()), (d == nullopt ? basic_dashes<GraphicsSurfaces>() : d.value()), (rp == nullopt ? basic_render_props<GraphicsSurfaces>() : rp.value()), (cl == nullopt ? basic_clip_props<GraphicsSurfaces>() : cl.value()));
+				}
+				template <class GraphicsSurfaces>
+				void basic_output_surface<GraphicsSurfaces>::fill_rect(const basic_brush<GraphicsSurfaces>& b, const basic_bounding_box<graphics_math_type>& bb, const optional<basic_brush_props<GraphicsSurfaces>>& bp, const optional<basic_render_props<GraphicsSurfaces>>& rp, const optional<basic_clip_props<GraphicsSurfaces>>& cl) {
+					GraphicsSurfaces::surfaces::fill_rect(_Data, b, bb, (bp == nullopt ? basic_brush_props<GraphicsSurfaces>() : bp.value()), (rp == nullopt ? basic_render_props<GraphicsSurfaces>() : rp.value()), (cl == nullopt ? basic_clip_props<GraphicsSurfaces>() : cl.value()));
+				}
+				template <class GraphicsSurfaces>
+				void basic_output_surface<GraphicsSurfaces>::stroke_rect(const basic_brush<GraphicsSurfaces>& b, const basic_bounding_box<graphics_math_type>& bb, const optional<basic_brush_props<GraphicsSurfaces>>& bp, const optional<basic_stroke_props<GraphicsSurfaces>>& sp, const optional<basic_dashes<GraphicsSurfaces>>& d, const optional<basic_render_props<GraphicsSurfaces>>& rp, const optional<basic_clip_props<GraphicsSurfaces>>& cl) {
+					GraphicsSurfaces::surfaces::stroke_rect(_Data, b, bb, (bp == nullopt ? basic_brush_props<GraphicsSurfaces>() : bp.value()), (sp == nullopt ? basic_stroke_props<GraphicsSurfaces>() : sp.value()), (d == nullopt ? basic_dashes<GraphicsSurfaces>() : d.value()), (rp == nullopt ? basic_render_props<GraphicsSurfaces>() : rp.value()), (cl == nullopt ? basic_clip_props<GraphicsSurfaces>() : cl.value()));
+				}
+				template <class GraphicsSurfaces>
+				void basic_output_surface<GraphicsSurfaces>::fill_circle(const basic_brush<GraphicsSurfaces>& b, const basic_circle<graphics_math_type>& c, const optional<basic_brush_props<GraphicsSurfaces>>& bp, const optional<basic_render_props<GraphicsSurfaces>>& rp, const optional<basic_clip_props<GraphicsSurfaces>>& cl) {
+					GraphicsSurfaces::surfaces::fill_circle(_Data, b, c, (bp == nullopt ? basic_brush_props<GraphicsSurfaces>() : bp.value()), (rp == nullopt ? basic_render_props<GraphicsSurfaces>() : rp.value()), (cl == nullopt ? basic_clip_props<GraphicsSurfaces>() : cl.value()));
+				}
+				template <class GraphicsSurfaces>
+				template <class InputIterator>
+				void basic_output_surface<GraphicsSurfaces>::fill_instances(const basic_brush<GraphicsSurfaces>& b, const basic_interpreted_path<GraphicsSurfaces>& ip, InputIterator first, InputIterator last, const optional<basic_brush_props<GraphicsSurfaces>>& bp, const optional<basic_render_props<GraphicsSurfaces>>& rp, const optional<basic_clip_props<GraphicsSurfaces>>& cl) {
+					_Call_with_fill_instances<graphics_math_type>(first, last, [&](const _Fill_instance_range<graphics_math_type>& instances) {
+						GraphicsSurfaces::surfaces::fill_instances(_Data, b, ip, instances, (bp == nullopt ? basic_brush_props<GraphicsSurfaces>() : bp.value()), (rp == nullopt ? basic_render_props<GraphicsSurfaces>() : rp.value()), (cl == nullopt ? basic_clip_props<GraphicsSurfaces>() : cl.value()));
+					});
+				}
+				template <class GraphicsSurfaces>
+				void basic_output_surface<GraphicsSurfaces>::mask(const basic_brush<GraphicsSurfaces>& b, const basic_brush<GraphicsSurfaces>& mb, const optional<basic_brush_props<GraphicsSurfaces>>& bp, const optional<basic_mask_props<GraphicsSurfaces>>& mp, const optional<basic_render_props<GraphicsSurfaces>>& rp, const optional<basic_clip_props<GraphicsSurfaces>>& cl) {
 					GraphicsSurfaces::surfaces::mask(_Data, b, mb, (bp == nullopt ? basic_brush_props<GraphicsSurfaces>() : bp.value()), (mp == nullopt ? basic_mask_props<GraphicsSurfaces>() : mp.value()), (rp == nullopt ? basic_render_props<GraphicsSurfaces>() : rp.value()), (cl == nullopt ? basic_clip_props<GraphicsSurfaces>() : cl.value()));
 				}
+				template <class GraphicsSurfaces>
+				void basic_output_surface<GraphicsSurfaces>::coverage_cache_limit(size_t bytes) {
+					GraphicsSurfaces::surfaces::coverage_cache_limit(_Data, bytes);
+				}
+				template <class GraphicsSurfaces>
+				size_t basic_output_surface<GraphicsSurfaces>::coverage_cache_limit() const noexcept {
+					return GraphicsSurfaces::surfaces::coverage_cache_limit(_Data);
+				}
+				template <class GraphicsSurfaces>
+				coverage_cache_stats basic_output_surface<GraphicsSurfaces>::coverage_cache_statistics() const noexcept {
+					return GraphicsSurfaces::surfaces::coverage_cache_statistics(_Data);
+				}
 
 				template <class GraphicsSurfaces>
-				inline void basic_output_surface<GraphicsSurfaces>::draw_callback(const function<void(basic_output_surface& sfc)>& fn) {
+				void basic_output_surface<GraphicsSurfaces>::draw_callback(const function<void(basic_output_surface& sfc)>& fn) {
 					GraphicsSurfaces::surfaces::draw_callback(_Data, fn);
 				}
 				template <class GraphicsSurfaces>
-				inline void basic_output_surface<GraphicsSurfaces>::size_change_callback(const function<void(basic_output_surface& sfc)>& fn) {
+				void basic_output_surface<GraphicsSurfaces>::size_change_callback(const function<void(basic_output_surface& sfc)>& fn) {
 					GraphicsSurfaces::surfaces::size_change_callback(_Data, fn);
 				}
 				template <class GraphicsSurfaces>
-				inline void basic_output_surface<GraphicsSurfaces>::dimensions(basic_display_point<graphics_math_type> dp) {
+				void basic_output_surface<GraphicsSurfaces>::dimensions(basic_display_point<graphics_math_type> dp) {
 					GraphicsSurfaces::surfaces::dimensions(_Data, dp);
 				}
 				template <class GraphicsSurfaces>
-				inline void basic_output_surface<GraphicsSurfaces>::dimensions(basic_display_point<graphics_math_type> dp, error_code& ec) noexcept {
-					GraphicsSurfaces::surfaces::dimensions(_Data, dp, ec);
+				void basic_output_surface<GraphicsSurfaces>::dimensions(basic_display_point<graphics_math_type> dp, error_code& ec) noexcept {
+					try {
+						GraphicsSurfaces::surfaces::dimensions(_Data, dp);
+						ec.clear();
+					}
+					catch (const system_error& e) {
+						ec = e.code();
+					}
+					catch (const bad_alloc&) {
+						ec = make_error_code(errc::not_enough_memory);
+					}
 				}
 				template<class GraphicsSurfaces>
-				inline void basic_output_surface<GraphicsSurfaces>::display_dimensions(basic_display_point<graphics_math_type> dp) {
+				void basic_output_surface<GraphicsSurfaces>::display_dimensions(basic_display_point<graphics_math_type> dp) {
 					GraphicsSurfaces::surfaces::display_dimensions(_Data, dp);
 				}
 				template<class GraphicsSurfaces>
-				inline void basic_output_surface<GraphicsSurfaces>::display_dimensions(basic_display_point<graphics_math_type> dp, error_code & ec) noexcept {
-					GraphicsSurfaces::surfaces::display_dimensions(_Data, dp, ec);
+				void basic_output_surface<GraphicsSurfaces>::display_dimensions(basic_display_point<graphics_math_type> dp, error_code & ec) noexcept {
+					try {
+						GraphicsSurfaces::surfaces::display_dimensions(_Data, dp);
+						ec.clear();
+					}
+					catch (const system_error& e) {
+						ec = e.code();
+					}
+					catch (const bad_alloc&) {
+						ec = make_error_code(errc::not_enough_memory);
+					}
 				}
 				template <class GraphicsSurfaces>
-				inline void basic_output_surface<GraphicsSurfaces>::scaling(experimental::io2d::scaling scl) noexcept {
+				void basic_output_surface<GraphicsSurfaces>::scaling(experimental::io2d::scaling scl) noexcept {
 					GraphicsSurfaces::surfaces::scaling(_Data, scl);
 				}
 				template <class GraphicsSurfaces>
-				inline void basic_output_surface<GraphicsSurfaces>::user_scaling_callback(const function<basic_bounding_box<graphics_math_type>(const basic_output_surface&, bool&)>& fn) {
+				void basic_output_surface<GraphicsSurfaces>::user_scaling_callback(const function<basic_bounding_box<graphics_math_type>(const basic_output_surface&, bool&)>& fn) {
 					GraphicsSurfaces::surfaces::user_scaling_callback(_Data, fn);
 				}
 				template <class GraphicsSurfaces>
-				inline void basic_output_surface<GraphicsSurfaces>::letterbox_brush(const optional<basic_brush<GraphicsSurfaces>>& b, const optional<basic_brush_props<GraphicsSurfaces>>& bp) noexcept {
+				void basic_output_surface<GraphicsSurfaces>::letterbox_brush(const optional<basic_brush<GraphicsSurfaces>>& b, const optional<basic_brush_props<GraphicsSurfaces>>& bp) noexcept {
 					GraphicsSurfaces::surfaces::letterbox_brush(_Data, b, bp);
 				}
 				template<class GraphicsSurfaces>
-				inline void basic_output_surface<GraphicsSurfaces>::letterbox_brush_props(const optional<basic_brush_props<GraphicsSurfaces>>& bp) noexcept {
-					GraphicsSurfaces::surfaces::letterbox_brush_props(_Data, bp);
+				void basic_output_surface<GraphicsSurfaces>::letterbox_brush_props(const optional<basic_brush_props<GraphicsSurfaces>>& bp) noexcept {
+					GraphicsSurfaces::surfaces::letterbox_brush_props(_Data, bp.value_or(basic_brush_props<GraphicsSurfaces>()));
 				}
 				template <class GraphicsSurfaces>
-				inline void basic_output_surface<GraphicsSurfaces>::auto_clear(bool val) noexcept {
+				void basic_output_surface<GraphicsSurfaces>::auto_clear(bool val) noexcept {
 					GraphicsSurfaces::surfaces::auto_clear(_Data, val);
 				}
 				template <class GraphicsSurfaces>
-				inline void basic_output_surface<GraphicsSurfaces>::redraw_required(bool val) noexcept {
+				void basic_output_surface<GraphicsSurfaces>::redraw_required(bool val) noexcept {
 					GraphicsSurfaces::surfaces::redraw_required(_Data, val);
 				}
 				template <class GraphicsSurfaces>
-				inline io2d::format basic_output_surface<GraphicsSurfaces>::format() const noexcept {
+				io2d::format basic_output_surface<GraphicsSurfaces>::format() const noexcept {
 					return GraphicsSurfaces::surfaces::format(_Data);
 				}
 				template <class GraphicsSurfaces>
-				inline basic_display_point<typename GraphicsSurfaces::graphics_math_type> basic_output_surface<GraphicsSurfaces>::dimensions() const noexcept {
+				basic_display_point<typename GraphicsSurfaces::graphics_math_type> basic_output_surface<GraphicsSurfaces>::dimensions() const noexcept {
 					return GraphicsSurfaces::surfaces::dimensions(_Data);
 				}
 				template <class GraphicsSurfaces>
-				inline basic_display_point<typename GraphicsSurfaces::graphics_math_type> basic_output_surface<GraphicsSurfaces>::max_dimensions() const noexcept {
+				basic_display_point<typename GraphicsSurfaces::graphics_math_type> basic_output_surface<GraphicsSurfaces>::max_dimensions() const noexcept {
 					return GraphicsSurfaces::surfaces::max_dimensions();
 				}
 				template<class GraphicsSurfaces>
-				inline basic_display_point<typename GraphicsSurfaces::graphics_math_type> basic_output_surface<GraphicsSurfaces>::display_dimensions() const noexcept {
+				basic_display_point<typename GraphicsSurfaces::graphics_math_type> basic_output_surface<GraphicsSurfaces>::display_dimensions() const noexcept {
 					return GraphicsSurfaces::surfaces::display_dimensions(_Data);
 				}
 				template<class GraphicsSurfaces>
-				inline basic_display_point<typename GraphicsSurfaces::graphics_math_type> basic_output_surface<GraphicsSurfaces>::max_display_dimensions() const noexcept {
+				basic_display_point<typename GraphicsSurfaces::graphics_math_type> basic_output_surface<GraphicsSurfaces>::max_display_dimensions() const noexcept {
 					return GraphicsSurfaces::surfaces::max_display_dimensions();
 				}
 				template <class GraphicsSurfaces>
-				inline io2d::scaling basic_output_surface<GraphicsSurfaces>::scaling() const noexcept {
+				io2d::scaling basic_output_surface<GraphicsSurfaces>::scaling() const noexcept {
 					return GraphicsSurfaces::surfaces::scaling(_Data);
 				}
 				template <class GraphicsSurfaces>
-				inline optional<basic_brush<GraphicsSurfaces>> basic_output_surface<GraphicsSurfaces>::letterbox_brush() const noexcept {
+				optional<basic_brush<GraphicsSurfaces>> basic_output_surface<GraphicsSurfaces>::letterbox_brush() const noexcept {
 					return GraphicsSurfaces::surfaces::letterbox_brush(_Data);
 				}
 				template <class GraphicsSurfaces>
-				inline optional<basic_brush_props<GraphicsSurfaces>> basic_output_surface<GraphicsSurfaces>::letterbox_brush_props() const noexcept {
+				optional<basic_brush_props<GraphicsSurfaces>> basic_output_surface<GraphicsSurfaces>::letterbox_brush_props() const noexcept {
 					return GraphicsSurfaces::surfaces::letterbox_brush_props(_Data);
 				}
 				template <class GraphicsSurfaces>
-				inline bool basic_output_surface<GraphicsSurfaces>::auto_clear() const noexcept {
+				bool basic_output_surface<GraphicsSurfaces>::auto_clear() const noexcept {
 					return GraphicsSurfaces::surfaces::auto_clear(_Data);
 				}
 
@@ -361,199 +616,257 @@ namespace std {
 				// unmanaged output surface
 
 				template <class GraphicsSurfaces>
-				inline basic_unmanaged_output_surface<GraphicsSurfaces>::basic_unmanaged_output_surface(data_type&& data) noexcept
+				basic_unmanaged_output_surface<GraphicsSurfaces>::basic_unmanaged_output_surface(data_type&& data) noexcept
 					: _Data(move(data)) {
 				}
 
 				template <class GraphicsSurfaces>
-				inline basic_unmanaged_output_surface<GraphicsSurfaces>::basic_unmanaged_output_surface(basic_unmanaged_output_surface&& val) noexcept {
+				basic_unmanaged_output_surface<GraphicsSurfaces>::basic_unmanaged_output_surface(basic_unmanaged_output_surface&& val) noexcept {
 					_Data = move(GraphicsSurfaces::surfaces::move_unmanaged_output_surface(move(val._Data)));
 				}
 				template <class GraphicsSurfaces>
-				inline basic_unmanaged_output_surface<GraphicsSurfaces>& basic_unmanaged_output_surface<GraphicsSurfaces>::operator=(basic_unmanaged_output_surface&& val) noexcept {
+				basic_unmanaged_output_surface<GraphicsSurfaces>& basic_unmanaged_output_surface<GraphicsSurfaces>::operator=(basic_unmanaged_output_surface&& val) noexcept {
 					if (this != &val) {
 						_Data = move(GraphicsSurfaces::surfaces::move_unmanaged_output_surface(move(val._Data)));
 					}
 					return *this;
 				}
 				template <class GraphicsSurfaces>
-				inline basic_unmanaged_output_surface<GraphicsSurfaces>::~basic_unmanaged_output_surface() noexcept {
+				basic_unmanaged_output_surface<GraphicsSurfaces>::~basic_unmanaged_output_surface() noexcept {
 					GraphicsSurfaces::surfaces::destroy(_Data);
 				}
 
 				template<class GraphicsSurfaces>
-				inline bool basic_unmanaged_output_surface<GraphicsSurfaces>::has_draw_callback() const noexcept {
+				bool basic_unmanaged_output_surface<GraphicsSurfaces>::has_draw_callback() const noexcept {
 					return GraphicsSurfaces::surfaces::has_draw_callback(_Data);
 				}
 
 				template <class GraphicsSurfaces>
-				inline void basic_unmanaged_output_surface<GraphicsSurfaces>::invoke_draw_callback() {
+				void basic_unmanaged_output_surface<GraphicsSurfaces>::invoke_draw_callback() {
 					GraphicsSurfaces::surfaces::invoke_draw_callback(_Data, *this);
 				}
 				template<class GraphicsSurfaces>
-				inline bool basic_unmanaged_output_surface<GraphicsSurfaces>::has_size_change_callback() const noexcept {
+				bool basic_unmanaged_output_surface<GraphicsSurfaces>::has_size_change_callback() const noexcept {
 					return GraphicsSurfaces::surfaces::has_size_change_callback(_Data);
 				}
 				template <class GraphicsSurfaces>
-				inline void basic_unmanaged_output_surface<GraphicsSurfaces>::invoke_size_change_callback() {
+				void basic_unmanaged_output_surface<GraphicsSurfaces>::invoke_size_change_callback() {
 					GraphicsSurfaces::surfaces::invoke_size_change_callback(_Data, *this);
 				}
 				template<class GraphicsSurfaces>
-				inline bool basic_unmanaged_output_surface<GraphicsSurfaces>::has_user_scaling_callback() const noexcept {
+				bool basic_unmanaged_output_surface<GraphicsSurfaces>::has_user_scaling_callback() const noexcept {
 					return GraphicsSurfaces::surfaces::has_user_scaling_callback(_Data);
 				}
 				template <class GraphicsSurfaces>
-				inline basic_bounding_box<typename GraphicsSurfaces::graphics_math_type> basic_unmanaged_output_surface<GraphicsSurfaces>::invoke_user_scaling_callback(bool& useLetterboxBrush) {
-					GraphicsSurfaces::surfaces::invoke_user_scaling_callback(_Data, *this, useLetterboxBrush);
+				basic_bounding_box<typename GraphicsSurfaces::graphics_math_type> basic_unmanaged_output_surface<GraphicsSurfaces>::invoke_user_scaling_callback(bool& useLetterboxBrush) {
+					return GraphicsSurfaces::surfaces::invoke_user_scaling_callback(_Data, *this, useLetterboxBrush);
 				}
 
 				template<class GraphicsSurfaces>
-				inline void basic_unmanaged_output_surface<GraphicsSurfaces>::draw_to_output() {
+				void basic_unmanaged_output_surface<GraphicsSurfaces>::draw_to_output() {
 					GraphicsSurfaces::surfaces::draw_to_output(_Data, *this);
 				}
 
 				template <class GraphicsSurfaces>
-				inline typename basic_unmanaged_output_surface<GraphicsSurfaces>::data_type& basic_unmanaged_output_surface<GraphicsSurfaces>::data() noexcept {
+				typename basic_unmanaged_output_surface<GraphicsSurfaces>::data_type& basic_unmanaged_output_surface<GraphicsSurfaces>::data() noexcept {
 					return _Data;
 				}
 
 				template <class GraphicsSurfaces>
-				inline void basic_unmanaged_output_surface<GraphicsSurfaces>::clear() {
+				void basic_unmanaged_output_surface<GraphicsSurfaces>::clear() {
 					GraphicsSurfaces::surfaces::clear(_Data);
 				}
 				template <class GraphicsSurfaces>
-				inline void basic_unmanaged_output_surface<GraphicsSurfaces>::flush() {
+				void basic_unmanaged_output_surface<GraphicsSurfaces>::flush() {
 					GraphicsSurfaces::surfaces::flush(_Data);
 				}
 				template <class GraphicsSurfaces>
-				inline void basic_unmanaged_output_surface<GraphicsSurfaces>::flush(error_code& ec) noexcept {
+				void basic_unmanaged_output_surface<GraphicsSurfaces>::flush(error_code& ec) noexcept {
 					GraphicsSurfaces::surfaces::flush(_Data, ec);
 				}
 				template <class GraphicsSurfaces>
-				inline void basic_unmanaged_output_surface<GraphicsSurfaces>::mark_dirty() {
+				void basic_unmanaged_output_surface<GraphicsSurfaces>::mark_dirty() {
 					GraphicsSurfaces::surfaces::mark_dirty(_Data);
 				}
 				template <class GraphicsSurfaces>
-				inline void basic_unmanaged_output_surface<GraphicsSurfaces>::mark_dirty(error_code& ec) noexcept {
+				void basic_unmanaged_output_surface<GraphicsSurfaces>::mark_dirty(error_code& ec) noexcept {
 					GraphicsSurfaces::surfaces::mark_dirty(_Data, ec);
 				}
 				template <class GraphicsSurfaces>
-				inline void basic_unmanaged_output_surface<GraphicsSurfaces>::mark_dirty(const basic_bounding_box<graphics_math_type>& extents) {
+				void basic_unmanaged_output_surface<GraphicsSurfaces>::mark_dirty(const basic_bounding_box<graphics_math_type>& extents) {
 					GraphicsSurfaces::surfaces::mark_dirty(_Data, extents);
 				}
 				template <class GraphicsSurfaces>
-				inline void basic_unmanaged_output_surface<GraphicsSurfaces>::mark_dirty(const basic_bounding_box<graphics_math_type>& extents, error_code& ec) noexcept {
+				void basic_unmanaged_output_surface<GraphicsSurfaces>::mark_dirty(const basic_bounding_box<graphics_math_type>& extents, error_code& ec) noexcept {
 					GraphicsSurfaces::surfaces::mark_dirty(_Data, extents, ec);
 				}
 				template <class GraphicsSurfaces>
-				inline void basic_unmanaged_output_surface<GraphicsSurfaces>::paint(const basic_brush<GraphicsSurfaces>& b, const optional<basic_brush_props<GraphicsSurfaces>>& bp, const optional<basic_render_props<GraphicsSurfaces>>& rp, const optional<basic_clip_props<GraphicsSurfaces>>& cl) {
+				void basic_unmanaged_output_surface<GraphicsSurfaces>::paint(const basic_brush<GraphicsSurfaces>& b, const optional<basic_brush_props<GraphicsSurfaces>>& bp, const optional<basic_render_props<GraphicsSurfaces>>& rp, const optional<basic_clip_props<GraphicsSurfaces>>& cl) {
 					GraphicsSurfaces::surfaces::paint(_Data, b, (bp == nullopt ? basic_brush_props<GraphicsSurfaces>() : bp.value()), (rp == nullopt ? basic_render_props<GraphicsSurfaces>() : rp.value()), (cl == nullopt ? basic_clip_props<GraphicsSurfaces>() : cl.value()));
 				}
 				template <class GraphicsSurfaces>
 				template <class Allocator>
-				inline void basic_unmanaged_output_surface<GraphicsSurfaces>::stroke(const basic_brush<GraphicsSurfaces>& b, const basic_path_builder<GraphicsSurfaces, Allocator>& pb, const optional<basic_brush_props<GraphicsSurfaces>>& bp, const optional<basic_stroke_props<GraphicsSurfaces>>& sp, const optional<basic_dashes<GraphicsSurfaces>>& d, const optional<basic_render_props<GraphicsSurfaces>>& rp, const optional<basic_clip_props<GraphicsSurfaces>>& cl) {
+				void basic_unmanaged_output_surface<GraphicsSurfaces>::stroke(const basic_brush<GraphicsSurfaces>& b, const basic_path_builder<GraphicsSurfaces, Allocator>& pb, const optional<basic_brush_props<GraphicsSurfaces>>& bp, const optional<basic_stroke_props<GraphicsSurfaces>>& sp, const optional<basic_dashes<GraphicsSurfaces>>& d, const optional<basic_render_props<GraphicsSurfaces>>& rp, const optional<basic_clip_props<GraphicsSurfaces>>& cl) {
 					GraphicsSurfaces::surfaces::stroke(_Data, b, basic_interpreted_path<GraphicsSurfaces>(pb), (bp == nullopt ? basic_brush_props<GraphicsSurfaces>() : bp.value()), (sp == nullopt ? basic_stroke_props<GraphicsSurfaces>() : sp.value()), (d == nullopt ? basic_dashes<GraphicsSurfaces>() : d.value()), (rp == nullopt ? basic_render_props<GraphicsSurfaces>() : rp.value()), (cl == nullopt ? basic_clip_props<GraphicsSurfaces>() : cl.value()));
 				}
 				template <class GraphicsSurfaces>
-				inline void basic_unmanaged_output_surface<GraphicsSurfaces>::stroke(const basic_brush<GraphicsSurfaces>& b, const basic_interpreted_path<GraphicsSurfaces>& ip, const optional<basic_brush_props<GraphicsSurfaces>>& bp, const optional<basic_stroke_props<GraphicsSurfaces>>& sp, const optional<basic_dashes<GraphicsSurfaces>>& d, const optional<basic_render_props<GraphicsSurfaces>>& rp, const optional<basic_clip_props<GraphicsSurfaces>>& cl) {
+				void basic_unmanaged_output_surface<GraphicsSurfaces>::stroke(const basic_brush<GraphicsSurfaces>& b, const basic_interpreted_path<GraphicsSurfaces>& ip, const optional<basic_brush_props<GraphicsSurfaces>>& bp, const optional<basic_stroke_props<GraphicsSurfaces>>& sp, const optional<basic_dashes<GraphicsSurfaces>>& d, const optional<basic_render_props<GraphicsSurfaces>>& rp, const optional<basic_clip_props<GraphicsSurfaces>>& cl) {
 					GraphicsSurfaces::surfaces::stroke(_Data, b, ip, (bp == nullopt ? basic_brush_props<GraphicsSurfaces>() : bp.value()), (sp == nullopt ? basic_stroke_props<GraphicsSurfaces>() : sp.value()), (d == nullopt ? basic_dashes<GraphicsSurfaces>() : d.value()), (rp == nullopt ? basic_render_props<GraphicsSurfaces>() : rp.value()), (cl == nullopt ? basic_clip_props<GraphicsSurfaces>() : cl.value()));
 				}
 				template <class GraphicsSurfaces>
 				template <class Allocator>
-				inline void basic_unmanaged_output_surface<GraphicsSurfaces>::fill(const basic_brush<GraphicsSurfaces>& b, const basic_path_builder<GraphicsSurfaces, Allocator>& pb, const optional<basic_brush_props<GraphicsSurfaces>>& bp, const optional<basic_render_props<GraphicsSurfaces>>& rp, const optional<basic_clip_props<GraphicsSurfaces>>& cl) {
+				void basic_unmanaged_output_surface<GraphicsSurfaces>::fill(const basic_brush<GraphicsSurfaces>& b, const basic_path_builder<GraphicsSurfaces, Allocator>& pb, const optional<basic_brush_props<GraphicsSurfaces>>& bp, const optional<basic_render_props<GraphicsSurfaces>>& rp, const optional<basic_clip_props<GraphicsSurfaces>>& cl) {
 					GraphicsSurfaces::surfaces::fill(_Data, b, basic_interpreted_path<GraphicsSurfaces>(pb), (bp == nullopt ? basic_brush_props<GraphicsSurfaces>() : bp.value()), (rp == nullopt ? basic_render_props<GraphicsSurfaces>() : rp.value()), (cl == nullopt ? basic_clip_props<GraphicsSurfaces>() : cl.value()));
 				}
 				template <class GraphicsSurfaces>
-				inline void basic_unmanaged_output_surface<GraphicsSurfaces>::fill(const basic_brush<GraphicsSurfaces>& b, const basic_interpreted_path<GraphicsSurfaces>& ip, const optional<basic_brush_props<GraphicsSurfaces>>& bp, const optional<basic_render_props<GraphicsSurfaces>>& rp, const optional<basic_clip_props<GraphicsSurfaces>>& cl) {
+				void basic_unmanaged_output_surface<GraphicsSurfaces>::fill(const basic_brush<GraphicsSurfaces>& b, const basic_interpreted_path<GraphicsSurfaces>& ip, const optional<basic_brush_props<GraphicsSurfaces>>& bp, const optional<basic_render_props<GraphicsSurfaces>>& rp, const optional<basic_clip_props<GraphicsSurfaces>>& cl) {
 					GraphicsSurfaces::surfaces::fill(_Data, b, ip, (bp == nullopt ? basic_brush_props<GraphicsSurfaces>() : bp.value()), (rp == nullopt ? basic_render_props<GraphicsSurfaces>() : rp.value()), (cl == nullopt ? basic_clip_props<GraphicsSurfaces>() : cl.value()));
 				}
 				template <class GraphicsSurfaces>
-				inline void basic_unmanaged_output_surface<GraphicsSurfaces>::mask(const basic_brush<GraphicsSurfaces>& b, const basic_brush<GraphicsSurfaces>& mb, const optional<basic_brush_props<GraphicsSurfaces>>& bp, const optional<basic_mask_props<GraphicsSurfaces>>& mp, const optional<basic_render_props<GraphicsSurfaces>>& rp, const optional<basic_clip_props<GraphicsSurfaces>>& cl) {
+				template <class Allocator>
+				void basic_unmanaged_output_surface<GraphicsSurfaces>::fill_stroke(const basic_brush<GraphicsSurfaces>& fb, const basic_brush<GraphicsSurfaces>& sb, const basic_path_builder<GraphicsSurfaces, Allocator>& pb, const optional<basic_brush_props<GraphicsSurfaces>>& bp, const optional<basic_stroke_props<GraphicsSurfaces>>& sp, const optional<basic_dashes<GraphicsSurfaces>>& d, const optional<basic_render_props<GraphicsSurfaces>>& rp, const optional<basic_clip_props<GraphicsSurfaces>>& cl) {
+					GraphicsSurfaces::surfaces::fill_stroke(_Data, fb, sb, basic_interpreted_path<GraphicsSurfaces>(pb), (bp == nullopt ? basic_brush_props<GraphicsSurfaces>() : bp.value()), (sp == nullopt ? basic_stroke_props<GraphicsSurfaces>() : sp.value()), (d == nullopt ? basic_dashes<GraphicsSurfaces>() : d.value()), (rp == nullopt ? basic_render_props<GraphicsSurfaces>() : rp.value()), (cl == nullopt ? basic_clip_props<GraphicsSurfaces>() : cl.value()));
+				}
+				template <class GraphicsSurfaces>
+				void basic_unmanaged_output_surface<GraphicsSurfaces>::fill_stroke(const basic_brush<GraphicsSurfaces>& fb, const basic_brush<GraphicsSurfaces>& sb, const basic_interpreted_path<GraphicsSurfaces>& ip, const optional<basic_brush_props<GraphicsSurfaces>>& bp, const optional<basic_stroke_props<GraphicsSurfaces>>& sp, const optional<basic_dashes<GraphicsSurfaces>>& d, const optional<basic_render_props<GraphicsSurfaces>>& rp, const optional<basic_clip_props<GraphicsSurfaces>>& cl) {
+					GraphicsSurfaces::surfaces::fill_stroke(_Data, fb, sb, ip, (bp == nullopt ? basic_brush_props<GraphicsSurfaces>() : bp.value()), (sp == nullopt ? basic_stroke_props<GraphicsSurfaces>() : sp.value()), (d == nullopt ? basic_dashes<GraphicsSurfaces>() : d.value()), (rp == nullopt ? basic_render_props<GraphicsSurfaces>() : rp.value()), (cl == nullopt ? basic_clip_props<GraphicsSurfaces>() : cl.value()));
+				}
+				template <class GraphicsSurfaces>
+				void basic_unmanaged_output_surface<GraphicsSurfaces>::fill_rect(const basic_brush<GraphicsSurfaces>& b, const basic_bounding_box<graphics_math_type>& bb, const optional<basic_brush_props<GraphicsSurfaces>>& bp, const optional<basic_render_props<GraphicsSurfaces>>& rp, const optional<basic_clip_props<GraphicsSurfaces>>& cl) {
+					GraphicsSurfaces::surfaces::fill_rect(_Data, b, bb, (bp == nullopt ? basic_brush_props<GraphicsSurfaces>() : bp.value()), (rp == nullopt ? basic_render_props<GraphicsSurfaces>() : rp.value()), (cl == nullopt ? basic_clip_props<GraphicsSurfaces>() : cl.value()));
+				}
+				template <class GraphicsSurfaces>
+				void basic_unmanaged_output_surface<GraphicsSurfaces>::stroke_rect(const basic_brush<GraphicsSurfaces>& b, const basic_bounding_box<graphics_math_type>& bb, const optional<basic_brush_props<GraphicsSurfaces>>& bp, const optional<basic_stroke_props<GraphicsSurfaces>>& sp, const optional<basic_dashes<GraphicsSurfaces>>& d, const optional<basic_render_props<GraphicsSurfaces>>& rp, const optional<basic_clip_props<GraphicsSurfaces>>& cl) {
+					GraphicsSurfaces::surfaces::stroke_rect(_Data, b, bb, (bp == nullopt ? basic_brush_props<GraphicsSurfaces>() : bp.value()), (sp == nullopt ? basic_stroke_props<GraphicsSurfaces>() : sp.value()), (d == nullopt ? basic_dashes<GraphicsSurfaces>() : d.value()), (rp == nullopt ? basic_render_props<GraphicsSurfaces>() : rp.value()), (cl == nullopt ? basic_clip_props<GraphicsSurfaces>() : cl.value()));
+				}
+				template <class GraphicsSurfaces>
+				void basic_unmanaged_output_surface<GraphicsSurfaces>::fill_circle(const basic_brush<GraphicsSurfaces>& b, const basic_circle<graphics_math_type>& c, const optional<basic_brush_props<GraphicsSurfaces>>& bp, const optional<basic_render_props<GraphicsSurfaces>>& rp, const optional<basic_clip_props<GraphicsSurfaces>>& cl) {
+					GraphicsSurfaces::surfaces::fill_circle(_Data, b, c, (bp == nullopt ? basic_brush_props<GraphicsSurfaces>() : bp.value()), (rp == nullopt ? basic_render_props<GraphicsSurfaces>() : rp.value()), (cl == nullopt ? basic_clip_props<GraphicsSurfaces>() : cl.value()));
+				}
+				template <class GraphicsSurfaces>
+				template <class InputIterator>
+				void basic_unmanaged_output_surface<GraphicsSurfaces>::fill_instances(const basic_brush<GraphicsSurfaces>& b, const basic_interpreted_path<GraphicsSurfaces>& ip, InputIterator first, InputIterator last, const optional<basic_brush_props<GraphicsSurfaces>>& bp, const optional<basic_render_props<GraphicsSurfaces>>& rp, const optional<basic_clip_props<GraphicsSurfaces>>& cl) {
+					_Call_with_fill_instances<graphics_math_type>(first, last, [&](const _Fill_instance_range<graphics_math_type>& instances) {
+						GraphicsSurfaces::surfaces::fill_instances(_Data, b, ip, instances, (bp == nullopt ? basic_brush_props<GraphicsSurfaces>() : bp.value()), (rp == nullopt ? basic_render_props<GraphicsSurfaces>() : rp.value()), (cl == nullopt ? basic_clip_props<GraphicsSurfaces>() : cl.value()));
+					});
+				}
+				template <class GraphicsSurfaces>
+				void basic_unmanaged_output_surface<GraphicsSurfaces>::mask(const basic_brush<GraphicsSurfaces>& b, const basic_brush<GraphicsSurfaces>& mb, const optional<basic_brush_props<GraphicsSurfaces>>& bp, const optional<basic_mask_props<GraphicsSurfaces>>& mp, const optional<basic_render_props<GraphicsSurfaces>>& rp, const optional<basic_clip_props<GraphicsSurfaces>>& cl) {
 					GraphicsSurfaces::surfaces::mask(_Data, b, mb, (bp == nullopt ? basic_brush_props<GraphicsSurfaces>() : bp.value()), (mp == nullopt ? basic_mask_props<GraphicsSurfaces>() : mp.value()), (rp == nullopt ? basic_render_props<GraphicsSurfaces>() : rp.value()), (cl == nullopt ? basic_clip_props<GraphicsSurfaces>() : cl.value()));
 				}
+				template <class GraphicsSurfaces>
+				void basic_unmanaged_output_surface<GraphicsSurfaces>::coverage_cache_limit(size_t bytes) {
+					GraphicsSurfaces::surfaces::coverage_cache_limit(_Data, bytes);
+				}
+				template <class GraphicsSurfaces>
+				size_t basic_unmanaged_output_surface<GraphicsSurfaces>::coverage_cache_limit() const noexcept {
+					return GraphicsSurfaces::surfaces::coverage_cache_limit(_Data);
+				}
+				template <class GraphicsSurfaces>
+				coverage_cache_stats basic_unmanaged_output_surface<GraphicsSurfaces>::coverage_cache_statistics() const noexcept {
+					return GraphicsSurfaces::surfaces::coverage_cache_statistics(_Data);
+				}
 
 				template <class GraphicsSurfaces>
-				inline void basic_unmanaged_output_surface<GraphicsSurfaces>::draw_callback(const function<void(basic_unmanaged_output_surface& sfc)>& fn) {
+				void basic_unmanaged_output_surface<GraphicsSurfaces>::draw_callback(const function<void(basic_unmanaged_output_surface& sfc)>& fn) {
 					GraphicsSurfaces::surfaces::draw_callback(_Data, fn);
 				}
 				template <class GraphicsSurfaces>
-				inline void basic_unmanaged_output_surface<GraphicsSurfaces>::size_change_callback(const function<void(basic_unmanaged_output_surface& sfc)>& fn) {
+				void basic_unmanaged_output_surface<GraphicsSurfaces>::size_change_callback(const function<void(basic_unmanaged_output_surface& sfc)>& fn) {
 					GraphicsSurfaces::surfaces::size_change_callback(_Data, fn);
 				}
 				template <class GraphicsSurfaces>
-				inline void basic_unmanaged_output_surface<GraphicsSurfaces>::dimensions(basic_display_point<graphics_math_type> dp) {
+				void basic_unmanaged_output_surface<GraphicsSurfaces>::dimensions(basic_display_point<graphics_math_type> dp) {
 					GraphicsSurfaces::surfaces::dimensions(_Data, dp);
 				}
 				template <class GraphicsSurfaces>
-				inline void basic_unmanaged_output_surface<GraphicsSurfaces>::dimensions(basic_display_point<graphics_math_type> dp, error_code& ec) noexcept {
-					GraphicsSurfaces::surfaces::dimensions(_Data, dp, ec);
+				void basic_unmanaged_output_surface<GraphicsSurfaces>::dimensions(basic_display_point<graphics_math_type> dp, error_code& ec) noexcept {
+					try {
+						GraphicsSurfaces::surfaces::dimensions(_Data, dp);
+						ec.clear();
+					}
+					catch (const system_error& e) {
+						ec = e.code();
+					}
+					catch (const bad_alloc&) {
+						ec = make_error_code(errc::not_enough_memory);
+					}
 				}
 				template<class GraphicsSurfaces>
-				inline void basic_unmanaged_output_surface<GraphicsSurfaces>::display_dimensions(basic_display_point<graphics_math_type> dp) {
+				void basic_unmanaged_output_surface<GraphicsSurfaces>::display_dimensions(basic_display_point<graphics_math_type> dp) {
 					GraphicsSurfaces::surfaces::display_dimensions(_Data, dp);
 				}
 				template<class GraphicsSurfaces>
-				inline void basic_unmanaged_output_surface<GraphicsSurfaces>::display_dimensions(basic_display_point<graphics_math_type> dp, error_code & ec) noexcept {
-					GraphicsSurfaces::surfaces::display_dimensions(_Data, dp, ec);
+				void basic_unmanaged_output_surface<GraphicsSurfaces>::display_dimensions(basic_display_point<graphics_math_type> dp, error_code & ec) noexcept {
+					try {
+						GraphicsSurfaces::surfaces::display_dimensions(_Data, dp);
+						ec.clear();
+					}
+					catch (const system_error& e) {
+						ec = e.code();
+					}
+					catch (const bad_alloc&) {
+						ec = make_error_code(errc::not_enough_memory);
+					}
 				}
 				template <class GraphicsSurfaces>
-				inline void basic_unmanaged_output_surface<GraphicsSurfaces>::scaling(experimental::io2d::scaling scl) noexcept {
+				void basic_unmanaged_output_surface<GraphicsSurfaces>::scaling(experimental::io2d::scaling scl) noexcept {
 					GraphicsSurfaces::surfaces::scaling(_Data, scl);
 				}
 				template <class GraphicsSurfaces>
-				inline void basic_unmanaged_output_surface<GraphicsSurfaces>::user_scaling_callback(const function<basic_bounding_box<graphics_math_type>(const basic_unmanaged_output_surface&, bool&)>& fn) {
+				void basic_unmanaged_output_surface<GraphicsSurfaces>::user_scaling_callback(const function<basic_bounding_box<graphics_math_type>(const basic_unmanaged_output_surface&, bool&)>& fn) {
 					GraphicsSurfaces::surfaces::user_scaling_callback(_Data, fn);
 				}
 				template <class GraphicsSurfaces>
-				inline void basic_unmanaged_output_surface<GraphicsSurfaces>::letterbox_brush(const optional<basic_brush<GraphicsSurfaces>>& b, const optional<basic_brush_props<GraphicsSurfaces>>& bp) noexcept {
+				void basic_unmanaged_output_surface<GraphicsSurfaces>::letterbox_brush(const optional<basic_brush<GraphicsSurfaces>>& b, const optional<basic_brush_props<GraphicsSurfaces>>& bp) noexcept {
 					GraphicsSurfaces::surfaces::letterbox_brush(_Data, b, bp);
 				}
 				template<class GraphicsSurfaces>
-				inline void basic_unmanaged_output_surface<GraphicsSurfaces>::letterbox_brush_props(const optional<basic_brush_props<GraphicsSurfaces>>& bp) noexcept {
-					GraphicsSurfaces::surfaces::letterbox_brush_props(_Data, bp);
+				void basic_unmanaged_output_surface<GraphicsSurfaces>::letterbox_brush_props(const optional<basic_brush_props<GraphicsSurfaces>>& bp) noexcept {
+					GraphicsSurfaces::surfaces::letterbox_brush_props(_Data, bp.value_or(basic_brush_props<GraphicsSurfaces>()));
 				}
 				template <class GraphicsSurfaces>
-				inline void basic_unmanaged_output_surface<GraphicsSurfaces>::auto_clear(bool val) noexcept {
+				void basic_unmanaged_output_surface<GraphicsSurfaces>::auto_clear(bool val) noexcept {
 					GraphicsSurfaces::surfaces::auto_clear(_Data, val);
 				}
 				template <class GraphicsSurfaces>
-				inline void basic_unmanaged_output_surface<GraphicsSurfaces>::redraw_required(bool val) noexcept {
+				void basic_unmanaged_output_surface<GraphicsSurfaces>::redraw_required(bool val) noexcept {
 					GraphicsSurfaces::surfaces::redraw_required(_Data, val);
 				}
 				template <class GraphicsSurfaces>
-				inline io2d::format basic_unmanaged_output_surface<GraphicsSurfaces>::format() const noexcept {
+				io2d::format basic_unmanaged_output_surface<GraphicsSurfaces>::format() const noexcept {
 					return GraphicsSurfaces::surfaces::format(_Data);
 				}
 				template <class GraphicsSurfaces>
-				inline basic_display_point<typename GraphicsSurfaces::graphics_math_type> basic_unmanaged_output_surface<GraphicsSurfaces>::dimensions() const noexcept {
+				basic_display_point<typename GraphicsSurfaces::graphics_math_type> basic_unmanaged_output_surface<GraphicsSurfaces>::dimensions() const noexcept {
 					return GraphicsSurfaces::surfaces::dimensions(_Data);
 				}
 				template <class GraphicsSurfaces>
-				inline basic_display_point<typename GraphicsSurfaces::graphics_math_type> basic_unmanaged_output_surface<GraphicsSurfaces>::max_dimensions() const noexcept {
+				basic_display_point<typename GraphicsSurfaces::graphics_math_type> basic_unmanaged_output_surface<GraphicsSurfaces>::max_dimensions() const noexcept {
 					return GraphicsSurfaces::surfaces::max_dimensions();
 				}
 				template<class GraphicsSurfaces>
-				inline basic_display_point<typename GraphicsSurfaces::graphics_math_type> basic_unmanaged_output_surface<GraphicsSurfaces>::display_dimensions() const noexcept {
+				basic_display_point<typename GraphicsSurfaces::graphics_math_type> basic_unmanaged_output_surface<GraphicsSurfaces>::display_dimensions() const noexcept {
 					return GraphicsSurfaces::surfaces::display_dimensions(_Data);
 				}
 				template<class GraphicsSurfaces>
-				inline basic_display_point<typename GraphicsSurfaces::graphics_math_type> basic_unmanaged_output_surface<GraphicsSurfaces>::max_display_dimensions() const noexcept {
+				basic_display_point<typename GraphicsSurfaces::graphics_math_type> basic_unmanaged_output_surface<GraphicsSurfaces>::max_display_dimensions() const noexcept {
 					return GraphicsSurfaces::surfaces::max_display_dimensions();
 				}
 				template <class GraphicsSurfaces>
-				inline io2d::scaling basic_unmanaged_output_surface<GraphicsSurfaces>::scaling() const noexcept {
+				io2d::scaling basic_unmanaged_output_surface<GraphicsSurfaces>::scaling() const noexcept {
 					return GraphicsSurfaces::surfaces::scaling(_Data);
 				}
 				template <class GraphicsSurfaces>
-				inline optional<basic_brush<GraphicsSurfaces>> basic_unmanaged_output_surface<GraphicsSurfaces>::letterbox_brush() const noexcept {
+				optional<basic_brush<GraphicsSurfaces>> basic_unmanaged_output_surface<GraphicsSurfaces>::letterbox_brush() const noexcept {
 					return GraphicsSurfaces::surfaces::letterbox_brush(_Data);
 				}
 				template <class GraphicsSurfaces>
-				inline optional<basic_brush_props<GraphicsSurfaces>> basic_unmanaged_output_surface<GraphicsSurfaces>::letterbox_brush_props() const noexcept {
+				optional<basic_brush_props<GraphicsSurfaces>> basic_unmanaged_output_surface<GraphicsSurfaces>::letterbox_brush_props() const noexcept {
 					return GraphicsSurfaces::surfaces::letterbox_brush_props(_Data);
 				}
 				template <class GraphicsSurfaces>
-				inline bool basic_unmanaged_output_surface<GraphicsSurfaces>::auto_clear() const noexcept {
+				bool basic_unmanaged_output_surface<GraphicsSurfaces>::auto_clear() const noexcept {
 					return GraphicsSurfaces::surfaces::auto_clear(_Data);
 				}
 			}
@@ -22,33 +22,33 @@ namespace std {
 		namespace io2d {
 			inline namespace v1 {
 				template <class GraphicsSurfaces>
-				inline const typename basic_render_props<GraphicsSurfaces>::data_type& basic_render_props<GraphicsSurfaces>::data() const noexcept {
+				const typename basic_render_props<GraphicsSurfaces>::data_type& basic_render_props<GraphicsSurfaces>::data() const noexcept {
 					return _Data;
 				}
 
 				template<class GraphicsSurfaces>
-				inline typename basic_render_props<GraphicsSurfaces>::data_type& basic_render_props<GraphicsSurfaces>::data() noexcept {
+				typename basic_render_props<GraphicsSurfaces>::data_type& basic_render_props<GraphicsSurfaces>::data() noexcept {
 					return _Data;
 				}
 
 				template <class GraphicsSurfaces>
-				inline basic_render_props<GraphicsSurfaces>::basic_render_props() noexcept
+				basic_render_props<GraphicsSurfaces>::basic_render_props() noexcept
 					: _Data(GraphicsSurfaces::surface_state_props::create_render_props()) {
 				}
 
 				template <class GraphicsSurfaces>
-				inline basic_render_props<GraphicsSurfaces>::basic_render_props(io2d::antialias a, const basic_matrix_2d<graphics_math_type>& m,
+				basic_render_props<GraphicsSurfaces>::basic_render_props(io2d::antialias a, const basic_matrix_2d<graphics_math_type>& m,
 					compositing_op co) noexcept
 					: _Data(GraphicsSurfaces::surface_state_props::create_render_props(a, m, co)) {
 				}
 
 				template<class GraphicsSurfaces>
-				inline basic_render_props<GraphicsSurfaces>::basic_render_props(const basic_render_props& other)
+				basic_render_props<GraphicsSurfaces>::basic_render_props(const basic_render_props& other)
 					: _Data(GraphicsSurfaces::surface_state_props::copy_render_props(other._Data)) {
 				}
 
 				template<class GraphicsSurfaces>
-				inline basic_render_props<GraphicsSurfaces>& basic_render_props<GraphicsSurfaces>::operator=(const basic_render_props& other) {
+				basic_render_props<GraphicsSurfaces>& basic_render_props<GraphicsSurfaces>::operator=(const basic_render_props& other) {
 					if (this != &other) {
 						GraphicsSurfaces::surface_state_props::copy_render_props(other._Data);
 					}
@@ -56,12 +56,12 @@ namespace std {
 				}
 
 				template<class GraphicsSurfaces>
-				inline basic_render_props<GraphicsSurfaces>::basic_render_props(basic_render_props&& other) noexcept
+				basic_render_props<GraphicsSurfaces>::basic_render_props(basic_render_props&& other) noexcept
 					: _Data(GraphicsSurfaces::surface_state_props::move_render_props(move(other._Data))) {
 				}
 
 				template<class GraphicsSurfaces>
-				inline basic_render_props<GraphicsSurfaces>& basic_render_props<GraphicsSurfaces>::operator=(basic_render_props&& other) noexcept {
+				basic_render_props<GraphicsSurfaces>& basic_render_props<GraphicsSurfaces>::operator=(basic_render_props&& other) noexcept {
 					if (this != &other) {
 						_Data = GraphicsSurfaces::surface_state_props::move_render_props(move(other._Data));
 					}
@@ -69,44 +69,44 @@ namespace std {
 				}
 
 				template<class GraphicsSurfaces>
-				inline basic_render_props<GraphicsSurfaces>::~basic_render_props() noexcept {
+				basic_render_props<GraphicsSurfaces>::~basic_render_props() noexcept {
 					GraphicsSurfaces::surface_state_props::destroy(_Data);
 				}
 
 				template <class GraphicsSurfaces>
-				inline void basic_render_props<GraphicsSurfaces>::antialiasing(io2d::antialias a) noexcept {
+				void basic_render_props<GraphicsSurfaces>::antialiasing(io2d::antialias a) noexcept {
 					GraphicsSurfaces::surface_state_props::antialiasing(_Data, a);
 				}
 
 				template <class GraphicsSurfaces>
-				inline void basic_render_props<GraphicsSurfaces>::compositing(compositing_op co) noexcept {
+				void basic_render_props<GraphicsSurfaces>::compositing(compositing_op co) noexcept {
 					GraphicsSurfaces::surface_state_props::compositing(_Data, co);
 				}
 
 				template <class GraphicsSurfaces>
-				inline void basic_render_props<GraphicsSurfaces>::surface_matrix(const basic_matrix_2d<typename GraphicsSurfaces::graphics_math_type>& m) noexcept {
+				void basic_render_props<GraphicsSurfaces>::surface_matrix(const basic_matrix_2d<typename GraphicsSurfaces::graphics_math_type>& m) noexcept {
 					GraphicsSurfaces::surface_state_props::surface_matrix(_Data, m);
 				}
 
 				template <class GraphicsSurfaces>
-				inline io2d::antialias basic_render_props<GraphicsSurfaces>::antialiasing() const noexcept {
+				io2d::antialias basic_render_props<GraphicsSurfaces>::antialiasing() const noexcept {
 					return GraphicsSurfaces::surface_state_props::antialiasing(_Data);
 				}
 
 				template <class GraphicsSurfaces>
-				inline compositing_op basic_render_props<GraphicsSurfaces>::compositing() const noexcept {
+				compositing_op basic_render_props<GraphicsSurfaces>::compositing() const noexcept {
 					return GraphicsSurfaces::surface_state_props::compositing(_Data);
 				}
 
 				template <class GraphicsSurfaces>
-				inline basic_matrix_2d<typename GraphicsSurfaces::graphics_math_type> basic_render_props<GraphicsSurfaces>::surface_matrix() const noexcept {
+				basic_matrix_2d<typename GraphicsSurfaces::graphics_math_type> basic_render_props<GraphicsSurfaces>::surface_matrix() const noexcept {
 					return GraphicsSurfaces::surface_state_props::surface_matrix(_Data);
 				}
 
 				// brush props
 
 				template <class GraphicsSurfaces>
-				inline basic_brush_props<GraphicsSurfaces>::basic_brush_props(experimental::io2d::wrap_mode w,
+				basic_brush_props<GraphicsSurfaces>::basic_brush_props(experimental::io2d::wrap_mode w,
 					experimental::io2d::filter fi,
 					experimental::io2d::fill_rule fr,
 					const basic_matrix_2d<typename GraphicsSurfaces::graphics_math_type>& m) noexcept
@@ -114,12 +114,12 @@ namespace std {
 				}
 
 				template<class GraphicsSurfaces>
-				inline basic_brush_props<GraphicsSurfaces>::basic_brush_props(const basic_brush_props& other)
+				basic_brush_props<GraphicsSurfaces>::basic_brush_props(const basic_brush_props& other)
 					: _Data(GraphicsSurfaces::surface_state_props::copy_brush_props(other._Data)) {
 				}
 
 				template<class GraphicsSurfaces>
-				inline basic_brush_props<GraphicsSurfaces>& basic_brush_props<GraphicsSurfaces>::operator=(const basic_brush_props& other) {
+				basic_brush_props<GraphicsSurfaces>& basic_brush_props<GraphicsSurfaces>::operator=(const basic_brush_props& other) {
 					if (this != &other) {
 						GraphicsSurfaces::surface_state_props::copy_brush_props(other._Data);
 					}
@@ -127,12 +127,12 @@ namespace std {
 				}
 
 				template<class GraphicsSurfaces>
-				inline basic_brush_props<GraphicsSurfaces>::basic_brush_props(basic_brush_props&& other) noexcept
+				basic_brush_props<GraphicsSurfaces>::basic_brush_props(basic_brush_props&& other) noexcept
 					: _Data(GraphicsSurfaces::surface_state_props::move_brush_props(move(other._Data))) {
 				}
 
 				template<class GraphicsSurfaces>
-				inline basic_brush_props<GraphicsSurfaces>& basic_brush_props<GraphicsSurfaces>::operator=(basic_brush_props&& other) noexcept {
+				basic_brush_props<GraphicsSurfaces>& basic_brush_props<GraphicsSurfaces>::operator=(basic_brush_props&& other) noexcept {
 					if (this != &other) {
 						_Data = move(GraphicsSurfaces::surface_state_props::move_brush_props(move(other._Data)));
 					}
@@ -140,86 +140,86 @@ namespace std {
 				}
 
 				template<class GraphicsSurfaces>
-				inline basic_brush_props<GraphicsSurfaces>::~basic_brush_props() noexcept {
+				basic_brush_props<GraphicsSurfaces>::~basic_brush_props() noexcept {
 					GraphicsSurfaces::surface_state_props::destroy(_Data);
 				}
 
 				template <class GraphicsSurfaces>
-				inline void basic_brush_props<GraphicsSurfaces>::filter(experimental::io2d::filter fi) noexcept {
+				void basic_brush_props<GraphicsSurfaces>::filter(experimental::io2d::filter fi) noexcept {
 					GraphicsSurfaces::surface_state_props::filter(_Data, fi);
 				}
 
 				template <class GraphicsSurfaces>
-				inline void basic_brush_props<GraphicsSurfaces>::wrap_mode(experimental::io2d::wrap_mode w) noexcept {
+				void basic_brush_props<GraphicsSurfaces>::wrap_mode(experimental::io2d::wrap_mode w) noexcept {
 					GraphicsSurfaces::surface_state_props::wrap_mode(_Data, w);
 				}
 
 				template <class GraphicsSurfaces>
-				inline void basic_brush_props<GraphicsSurfaces>::fill_rule(experimental::io2d::fill_rule fr) noexcept {
+				void basic_brush_props<GraphicsSurfaces>::fill_rule(experimental::io2d::fill_rule fr) noexcept {
 					GraphicsSurfaces::surface_state_props::fill_rule(_Data, fr);
 				}
 
 				template <class GraphicsSurfaces>
-				inline void basic_brush_props<GraphicsSurfaces>::brush_matrix(const basic_matrix_2d<typename GraphicsSurfaces::graphics_math_type>& m) noexcept {
+				void basic_brush_props<GraphicsSurfaces>::brush_matrix(const basic_matrix_2d<typename GraphicsSurfaces::graphics_math_type>& m) noexcept {
 					GraphicsSurfaces::surface_state_props::brush_matrix(_Data, m);
 				}
 
 				template <class GraphicsSurfaces>
-				inline experimental::io2d::filter basic_brush_props<GraphicsSurfaces>::filter() const noexcept {
+				experimental::io2d::filter basic_brush_props<GraphicsSurfaces>::filter() const noexcept {
 					return GraphicsSurfaces::surface_state_props::filter(_Data);
 				}
 
 				template <class GraphicsSurfaces>
-				inline experimental::io2d::wrap_mode basic_brush_props<GraphicsSurfaces>::wrap_mode() const noexcept {
+				experimental::io2d::wrap_mode basic_brush_props<GraphicsSurfaces>::wrap_mode() const noexcept {
 					return GraphicsSurfaces::surface_state_props::wrap_mode(_Data);
 				}
 
 				template <class GraphicsSurfaces>
-				inline experimental::io2d::fill_rule basic_brush_props<GraphicsSurfaces>::fill_rule() const noexcept {
+				experimental::io2d::fill_rule basic_brush_props<GraphicsSurfaces>::fill_rule() const noexcept {
 					return GraphicsSurfaces::surface_state_props::fill_rule(_Data);
 				}
 
 				template <class GraphicsSurfaces>
-				inline basic_matrix_2d<typename basic_brush_props<GraphicsSurfaces>::graphics_math_type> basic_brush_props<GraphicsSurfaces>::brush_matrix() const noexcept {
+				basic_matrix_2d<typename basic_brush_props<GraphicsSurfaces>::graphics_math_type> basic_brush_props<GraphicsSurfaces>::brush_matrix() const noexcept {
 					return GraphicsSurfaces::surface_state_props::brush_matrix(_Data);
 				}
 
 				// clip_props
 				template <class GraphicsSurfaces>
-				inline const typename basic_clip_props<GraphicsSurfaces>::data_type& basic_clip_props<GraphicsSurfaces>::data() const noexcept {
+				const typename basic_clip_props<GraphicsSurfaces>::data_type& basic_clip_props<GraphicsSurfaces>::data() const noexcept {
 					return _Data;
 				}
 				template<class GraphicsSurfaces>
-				inline typename basic_clip_props<GraphicsSurfaces>::data_type& basic_clip_props<GraphicsSurfaces>::data() noexcept {
+				typename basic_clip_props<GraphicsSurfaces>::data_type& basic_clip_props<GraphicsSurfaces>::data() noexcept {
 					return _Data;
 				}
 				template <class GraphicsSurfaces>
-				inline basic_clip_props<GraphicsSurfaces>::basic_clip_props() noexcept
+				basic_clip_props<GraphicsSurfaces>::basic_clip_props() noexcept
 					: _Data(GraphicsSurfaces::surface_state_props::create_clip_props()) {}
 				template <class GraphicsSurfaces>
 				template <class Allocator>
-				inline basic_clip_props<GraphicsSurfaces>::basic_clip_props(const basic_path_builder<GraphicsSurfaces, Allocator> &pb,
+				basic_clip_props<GraphicsSurfaces>::basic_clip_props(const basic_path_builder<GraphicsSurfaces, Allocator> &pb,
 					io2d::fill_rule fr)
 					: _Data(GraphicsSurfaces::surface_state_props::create_clip_props(pb, fr)) { }
 
 				template <class GraphicsSurfaces>
-				inline basic_clip_props<GraphicsSurfaces>::basic_clip_props(const basic_interpreted_path<GraphicsSurfaces>& ip,
+				basic_clip_props<GraphicsSurfaces>::basic_clip_props(const basic_interpreted_path<GraphicsSurfaces>& ip,
 					io2d::fill_rule fr) noexcept
 					: _Data(GraphicsSurfaces::surface_state_props::create_clip_props(ip, fr)) { }
 
 				template <class GraphicsSurfaces>
-				inline basic_clip_props<GraphicsSurfaces>::basic_clip_props(const basic_bounding_box<typename basic_clip_props<GraphicsSurfaces>::graphics_math_type>& bbox,
+				basic_clip_props<GraphicsSurfaces>::basic_clip_props(const basic_bounding_box<typename basic_clip_props<GraphicsSurfaces>::graphics_math_type>& bbox,
 					experimental::io2d::fill_rule fr)
 					: _Data(GraphicsSurfaces::surface_state_props::create_clip_props(bbox, fr)) {
 				}
 
 				template<class GraphicsSurfaces>
-				inline basic_clip_props<GraphicsSurfaces>::basic_clip_props(const basic_clip_props& other)
+				basic_clip_props<GraphicsSurfaces>::basic_clip_props(const basic_clip_props& other)
 					: _Data(GraphicsSurfaces::surface_state_props::copy_clip_props(other._Data)) {
 				}
 
 				template<class GraphicsSurfaces>
-				inline basic_clip_props<GraphicsSurfaces>& basic_clip_props<GraphicsSurfaces>::operator=(const basic_clip_props& other) {
+				basic_clip_props<GraphicsSurfaces>& basic_clip_props<GraphicsSurfaces>::operator=(const basic_clip_props& other) {
 					if (this != &other) {
 						GraphicsSurfaces::surface_state_props::copy_clip_props(other._Data);
 					}
@@ -227,12 +227,12 @@ namespace std {
 				}
 
 				template<class GraphicsSurfaces>
-				inline basic_clip_props<GraphicsSurfaces>::basic_clip_props(basic_clip_props&& other) noexcept
+				basic_clip_props<GraphicsSurfaces>::basic_clip_props(basic_clip_props&& other) noexcept
 					: _Data(GraphicsSurfaces::surface_state_props::move_clip_props(move(other._Data))) {
 				}
 
 				template<class GraphicsSurfaces>
-				inline basic_clip_props<GraphicsSurfaces>& basic_clip_props<GraphicsSurfaces>::operator=(basic_clip_props&& other) noexcept {
+				basic_clip_props<GraphicsSurfaces>& basic_clip_props<GraphicsSurfaces>::operator=(basic_clip_props&& other) noexcept {
 					if (this != &other) {
 						_Data = move(GraphicsSurfaces::surface_state_props::move_clip_props(move(other._Data)));
 					}
@@ -240,51 +240,54 @@ namespace std {
 				}
 
 				template<class GraphicsSurfaces>
-				inline basic_clip_props<GraphicsSurfaces>::~basic_clip_props() noexcept {
+				basic_clip_props<GraphicsSurfaces>::~basic_clip_props() noexcept {
 					GraphicsSurfaces::surface_state_props::destroy(_Data);
 				}
 
 				template <class GraphicsSurfaces>
 				template <class Allocator>
-				inline void basic_clip_props<GraphicsSurfaces>::clip(const basic_path_builder<GraphicsSurfaces, Allocator>& pb) {
+				void basic_clip_props<GraphicsSurfaces>::clip(const basic_path_builder<GraphicsSurfaces, Allocator>& pb) {
 					GraphicsSurfaces::surface_state_props::clip(_Data, pb);
 				}
 
 				template <class GraphicsSurfaces>
-				inline void basic_clip_props<GraphicsSurfaces>::clip(const basic_interpreted_path<GraphicsSurfaces>& ip) noexcept {
+				void basic_clip_props<GraphicsSurfaces>::clip(const basic_interpreted_path<GraphicsSurfaces>& ip) noexcept {
 					GraphicsSurfaces::surface_state_props::clip(_Data, ip);
 				}
 
 				template <class GraphicsSurfaces>
-				inline void basic_clip_props<GraphicsSurfaces>::fill_rule(experimental::io2d::fill_rule fr) noexcept {
+				void basic_clip_props<GraphicsSurfaces>::fill_rule(experimental::io2d::fill_rule fr) noexcept {
 					GraphicsSurfaces::surface_state_props::fill_rule(_Data, fr);
 				}
 
 				template <class GraphicsSurfaces>
-				inline basic_interpreted_path<GraphicsSurfaces> basic_clip_props<GraphicsSurfaces>::clip() const noexcept {
-					return GraphicsSurfaces::surface_state_props::clip(_Data);
+				basic_interpreted_path<GraphicsSurfaces> basic_clip_props<GraphicsSurfaces>::clip() const noexcept {
+					basic_interpreted_path<GraphicsSurfaces> result;
+					GraphicsSurfaces::paths::destroy(result.data());
+					result.data() = GraphicsSurfaces::surface_state_props::clip(_Data);
+					return result;
 				}
 
 				template <class GraphicsSurfaces>
-				inline io2d::fill_rule basic_clip_props<GraphicsSurfaces>::fill_rule() const noexcept {
+				io2d::fill_rule basic_clip_props<GraphicsSurfaces>::fill_rule() const noexcept {
 					return GraphicsSurfaces::surface_state_props::fill_rule(_Data);
 				}
 
 				// stroke props
 				template <class GraphicsSurfaces>
-				inline const typename basic_stroke_props<GraphicsSurfaces>::data_type& basic_stroke_props<GraphicsSurfaces>::data() const noexcept {
+				const typename basic_stroke_props<GraphicsSurfaces>::data_type& basic_stroke_props<GraphicsSurfaces>::data() const noexcept {
 					return _Data;
 				}
 				template<class GraphicsSurfaces>
-				inline typename basic_stroke_props<GraphicsSurfaces>::data_type& basic_stroke_props<GraphicsSurfaces>::data() noexcept {
+				typename basic_stroke_props<GraphicsSurfaces>::data_type& basic_stroke_props<GraphicsSurfaces>::data() noexcept {
 					return _Data;
 				}
 				template <class GraphicsSurfaces>
-				inline basic_stroke_props<GraphicsSurfaces>::basic_stroke_props() noexcept
+				basic_stroke_props<GraphicsSurfaces>::basic_stroke_props() noexcept
 					: _Data(GraphicsSurfaces::surface_state_props::create_stroke_props()) {
 				}
 				template <class GraphicsSurfaces>
-				inline basic_stroke_props<GraphicsSurfaces>::basic_stroke_props(float w,
+				basic_stroke_props<GraphicsSurfaces>::basic_stroke_props(float w,
 					io2d::line_cap lc,
 					io2d::line_join lj,
 					float ml) noexcept
@@ -292,12 +295,12 @@ namespace std {
 				}
 
 				template<class GraphicsSurfaces>
-				inline basic_stroke_props<GraphicsSurfaces>::basic_stroke_props(const basic_stroke_props& other)
+				basic_stroke_props<GraphicsSurfaces>::basic_stroke_props(const basic_stroke_props& other)
 					: _Data(GraphicsSurfaces::surface_state_props::copy_stroke_props(other._Data)) {
 				}
 
 				template<class GraphicsSurfaces>
-				inline basic_stroke_props<GraphicsSurfaces>& basic_stroke_props<GraphicsSurfaces>::operator=(const basic_stroke_props& other) {
+				basic_stroke_props<GraphicsSurfaces>& basic_stroke_props<GraphicsSurfaces>::operator=(const basic_stroke_props& other) {
 					if (this != &other) {
 						_Data = GraphicsSurfaces::surface_state_props::copy_stroke_props(other._Data);
 					}
@@ -305,12 +308,12 @@ namespace std {
 				}
 
 				template<class GraphicsSurfaces>
-				inline basic_stroke_props<GraphicsSurfaces>::basic_stroke_props(basic_stroke_props&& other) noexcept
+				basic_stroke_props<GraphicsSurfaces>::basic_stroke_props(basic_stroke_props&& other) noexcept
 					: _Data(GraphicsSurfaces::surface_state_props::move_stroke_props(move(other._Data))) {
 				}
 
 				template<class GraphicsSurfaces>
-				inline basic_stroke_props<GraphicsSurfaces>& basic_stroke_props<GraphicsSurfaces>::operator=(basic_stroke_props&& other) noexcept {
+				basic_stroke_props<GraphicsSurfaces>& basic_stroke_props<GraphicsSurfaces>::operator=(basic_stroke_props&& other) noexcept {
 					if (this != &other) {
 						_Data = move(GraphicsSurfaces::surface_state_props::move_stroke_props(move(other._Data)));
 					}
@@ -318,73 +321,73 @@ namespace std {
 				}
 
 				template<class GraphicsSurfaces>
-				inline basic_stroke_props<GraphicsSurfaces>::~basic_stroke_props() noexcept {
+				basic_stroke_props<GraphicsSurfaces>::~basic_stroke_props() noexcept {
 					GraphicsSurfaces::surface_state_props::destroy(_Data);
 				}
 
 				template <class GraphicsSurfaces>
-				inline void basic_stroke_props<GraphicsSurfaces>::line_width(float w) noexcept {
+				void basic_stroke_props<GraphicsSurfaces>::line_width(float w) noexcept {
 					GraphicsSurfaces::surface_state_props::line_width(_Data, w);
 				}
 				template <class GraphicsSurfaces>
-				inline void basic_stroke_props<GraphicsSurfaces>::line_cap(io2d::line_cap lc) noexcept {
+				void basic_stroke_props<GraphicsSurfaces>::line_cap(io2d::line_cap lc) noexcept {
 					GraphicsSurfaces::surface_state_props::line_cap(_Data, lc);
 				}
 				template <class GraphicsSurfaces>
-				inline void basic_stroke_props<GraphicsSurfaces>::line_join(experimental::io2d::line_join lj) noexcept {
+				void basic_stroke_props<GraphicsSurfaces>::line_join(experimental::io2d::line_join lj) noexcept {
 					GraphicsSurfaces::surface_state_props::line_join(_Data, lj);
 				}
 				template <class GraphicsSurfaces>
-				inline void basic_stroke_props<GraphicsSurfaces>::miter_limit(float ml) noexcept {
+				void basic_stroke_props<GraphicsSurfaces>::miter_limit(float ml) noexcept {
 					GraphicsSurfaces::surface_state_props::miter_limit(_Data, ml);
 				}
 
 				template <class GraphicsSurfaces>
-				inline float basic_stroke_props<GraphicsSurfaces>::line_width() const noexcept {
+				float basic_stroke_props<GraphicsSurfaces>::line_width() const noexcept {
 					return GraphicsSurfaces::surface_state_props::line_width(_Data);
 				}
 				template <class GraphicsSurfaces>
-				inline experimental::io2d::line_cap basic_stroke_props<GraphicsSurfaces>::line_cap() const noexcept {
+				experimental::io2d::line_cap basic_stroke_props<GraphicsSurfaces>::line_cap() const noexcept {
 					return GraphicsSurfaces::surface_state_props::line_cap(_Data);
 				}
 				template <class GraphicsSurfaces>
-				inline experimental::io2d::line_join basic_stroke_props<GraphicsSurfaces>::line_join() const noexcept {
+				experimental::io2d::line_join basic_stroke_props<GraphicsSurfaces>::line_join() const noexcept {
 					return GraphicsSurfaces::surface_state_props::line_join(_Data);
 				}
 				template <class GraphicsSurfaces>
-				inline float basic_stroke_props<GraphicsSurfaces>::miter_limit() const noexcept {
+				float basic_stroke_props<GraphicsSurfaces>::miter_limit() const noexcept {
 					return GraphicsSurfaces::surface_state_props::miter_limit(_Data);
 				}
 				template <class GraphicsSurfaces>
-				inline float basic_stroke_props<GraphicsSurfaces>::max_miter_limit() const noexcept {
+				float basic_stroke_props<GraphicsSurfaces>::max_miter_limit() const noexcept {
 					return GraphicsSurfaces::surface_state_props::max_miter_limit();
 				}
 
 				// Mask props
 				template<class GraphicsSurfaces>
-				inline const typename basic_mask_props<GraphicsSurfaces>::data_type& basic_mask_props<GraphicsSurfaces>::data() const noexcept {
+				const typename basic_mask_props<GraphicsSurfaces>::data_type& basic_mask_props<GraphicsSurfaces>::data() const noexcept {
 					return _Data;
 				}
 
 				template<class GraphicsSurfaces>
-				inline typename basic_mask_props<GraphicsSurfaces>::data_type& basic_mask_props<GraphicsSurfaces>::data() noexcept {
+				typename basic_mask_props<GraphicsSurfaces>::data_type& basic_mask_props<GraphicsSurfaces>::data() noexcept {
 					return _Data;
 				}
 
 				template <class GraphicsSurfaces>
-				inline basic_mask_props<GraphicsSurfaces>::basic_mask_props(experimental::io2d::wrap_mode w,
+				basic_mask_props<GraphicsSurfaces>::basic_mask_props(experimental::io2d::wrap_mode w,
 					experimental::io2d::filter fi,
 					const basic_matrix_2d<graphics_math_type>& m) noexcept
 					: _Data(GraphicsSurfaces::surface_state_props::create_mask_props(w, fi, m)) {
 				}
 
 				template<class GraphicsSurfaces>
-				inline basic_mask_props<GraphicsSurfaces>::basic_mask_props(const basic_mask_props& other) noexcept
+				basic_mask_props<GraphicsSurfaces>::basic_mask_props(const basic_mask_props& other) noexcept
 					: _Data(GraphicsSurfaces::surface_state_props::copy_mask_props(other._Data)) {
 				}
 
 				template<class GraphicsSurfaces>
-				inline basic_mask_props<GraphicsSurfaces>& basic_mask_props<GraphicsSurfaces>::operator=(const basic_mask_props & other) noexcept {
+				basic_mask_props<GraphicsSurfaces>& basic_mask_props<GraphicsSurfaces>::operator=(const basic_mask_props & other) noexcept {
 					if (this != &other) {
 						GraphicsSurfaces::surface_state_props::copy_mask_props(other._Data);
 					}
@@ -392,12 +395,12 @@ namespace std {
 				}
 
 				template<class GraphicsSurfaces>
-				inline basic_mask_props<GraphicsSurfaces>::basic_mask_props(basic_mask_props&& other) noexcept
+				basic_mask_props<GraphicsSurfaces>::basic_mask_props(basic_mask_props&& other) noexcept
 					: _Data(GraphicsSurfaces::surface_state_props::move_mask_props(move(other._Data))) {
 				}
 
 				template<class GraphicsSurfaces>
-				inline basic_mask_props<GraphicsSurfaces>& basic_mask_props<GraphicsSurfaces>::operator=(basic_mask_props&& other) noexcept {
+				basic_mask_props<GraphicsSurfaces>& basic_mask_props<GraphicsSurfaces>::operator=(basic_mask_props&& other) noexcept {
 					if (this != &other) {
 						_Data = move(GraphicsSurfaces::surface_state_props::move_mask_props(move(other._Data)));
 					}
@@ -405,83 +408,191 @@ namespace std {
 				}
 
 				template<class GraphicsSurfaces>
-				inline basic_mask_props<GraphicsSurfaces>::~basic_mask_props() noexcept {
+				basic_mask_props<GraphicsSurfaces>::~basic_mask_props() noexcept {
 					GraphicsSurfaces::surface_state_props::destroy(_Data);
 				}
 
 				template <class GraphicsSurfaces>
-				inline void basic_mask_props<GraphicsSurfaces>::wrap_mode(experimental::io2d::wrap_mode w) noexcept {
+				void basic_mask_props<GraphicsSurfaces>::wrap_mode(experimental::io2d::wrap_mode w) noexcept {
 					GraphicsSurfaces::surface_state_props::wrap_mode(_Data, w);
 				}
 				template <class GraphicsSurfaces>
-				inline void basic_mask_props<GraphicsSurfaces>::filter(experimental::io2d::filter fi) noexcept {
+				void basic_mask_props<GraphicsSurfaces>::filter(experimental::io2d::filter fi) noexcept {
 					GraphicsSurfaces::surface_state_props::filter(_Data, fi);
 				}
 				template <class GraphicsSurfaces>
-				inline void basic_mask_props<GraphicsSurfaces>::mask_matrix(const basic_matrix_2d<graphics_math_type>& m) noexcept {
+				void basic_mask_props<GraphicsSurfaces>::mask_matrix(const basic_matrix_2d<graphics_math_type>& m) noexcept {
 					GraphicsSurfaces::surface_state_props::mask_matrix(_Data, m);
 				}
 
 				template <class GraphicsSurfaces>
-				inline experimental::io2d::wrap_mode basic_mask_props<GraphicsSurfaces>::wrap_mode() const noexcept {
+				experimental::io2d::wrap_mode basic_mask_props<GraphicsSurfaces>::wrap_mode() const noexcept {
 					return GraphicsSurfaces::surface_state_props::wrap_mode(_Data);
 				}
 				template <class GraphicsSurfaces>
-				inline experimental::io2d::filter basic_mask_props<GraphicsSurfaces>::filter() const noexcept {
+				experimental::io2d::filter basic_mask_props<GraphicsSurfaces>::filter() const noexcept {
 					return GraphicsSurfaces::surface_state_props::filter(_Data);
 				}
 				template <class GraphicsSurfaces>
-				inline basic_matrix_2d<typename basic_mask_props<GraphicsSurfaces>::graphics_math_type> basic_mask_props<GraphicsSurfaces>::mask_matrix() const noexcept {
+				basic_matrix_2d<typename basic_mask_props<GraphicsSurfaces>::graphics_math_type> basic_mask_props<GraphicsSurfaces>::mask_matrix() const noexcept {
 					return GraphicsSurfaces::surface_state_props::mask_matrix(_Data);
 				}
 
 				// dashes
 				template<class GraphicsSurfaces>
-				inline const typename basic_dashes<GraphicsSurfaces>::data_type& basic_dashes<GraphicsSurfaces>::data() const noexcept {
+				const typename basic_dashes<GraphicsSurfaces>::data_type& basic_dashes<GraphicsSurfaces>::data() const noexcept {
 					return _Data;
 				}
 
 				template<class GraphicsSurfaces>
-				inline typename basic_dashes<GraphicsSurfaces>::data_type& basic_dashes<GraphicsSurfaces>::data() noexcept {
+				typename basic_dashes<GraphicsSurfaces>::data_type& basic_dashes<GraphicsSurfaces>::data() noexcept {
 					return _Data;
 				}
 
 				template <class GraphicsSurfaces>
-				inline basic_dashes<GraphicsSurfaces>::basic_dashes() noexcept
+				basic_dashes<GraphicsSurfaces>::basic_dashes() noexcept
 					: _Data(GraphicsSurfaces::surface_state_props::create_dashes()) {}
 				template <class GraphicsSurfaces>
 				template <class ForwardIterator>
-				inline basic_dashes<GraphicsSurfaces>::basic_dashes(float offset, ForwardIterator first, ForwardIterator last)
+				basic_dashes<GraphicsSurfaces>::basic_dashes(float offset, ForwardIterator first, ForwardIterator last)
 					: _Data(GraphicsSurfaces::surface_state_props::create_dashes(offset, first, last)) {}
 				template <class GraphicsSurfaces>
-				inline basic_dashes<GraphicsSurfaces>::basic_dashes(float offset, ::std::initializer_list<float> il)
+				basic_dashes<GraphicsSurfaces>::basic_dashes(float offset, ::std::initializer_list<float> il)
 					: _Data(GraphicsSurfaces::surface_state_props::create_dashes(offset, il)) {}
 				template<class GraphicsSurfaces>
-				inline basic_dashes<GraphicsSurfaces>::basic_dashes(const basic_dashes& other)
+				basic_dashes<GraphicsSurfaces>::basic_dashes(const basic_dashes& other)
 					: _Data(GraphicsSurfaces::surface_state_props::copy_dashes(other._Data)) {
 				}
 				template<class GraphicsSurfaces>
-				inline basic_dashes<GraphicsSurfaces>& basic_dashes<GraphicsSurfaces>::operator=(const basic_dashes& other) {
+				basic_dashes<GraphicsSurfaces>& basic_dashes<GraphicsSurfaces>::operator=(const basic_dashes& other) {
 					if (this != &other) {
 						_Data = GraphicsSurfaces::surface_state_props::copy_dashes(other._Data);
 					}
 					return *this;
 				}
 				template<class GraphicsSurfaces>
-				inline basic_dashes<GraphicsSurfaces>::basic_dashes(basic_dashes&& other) noexcept
+				basic_dashes<GraphicsSurfaces>::basic_dashes(basic_dashes&& other) noexcept
 					: _Data(GraphicsSurfaces::surface_state_props::move_dashes(move(other._Data))) {
 				}
 				template<class GraphicsSurfaces>
-				inline basic_dashes<GraphicsSurfaces>& basic_dashes<GraphicsSurfaces>::operator=(basic_dashes&& other) noexcept {
+				basic_dashes<GraphicsSurfaces>& basic_dashes<GraphicsSurfaces>::operator=(basic_dashes&& other) noexcept {
 					if (this != &other) {
 						_Data = move(GraphicsSurfaces::surface_state_props::move_dashes(move(other._Data)));
 					}
 					return *this;
 				}
 				template<class GraphicsSurfaces>
-				inline basic_dashes<GraphicsSurfaces>::~basic_dashes() noexcept {
+				basic_dashes<GraphicsSurfaces>::~basic_dashes() noexcept {
 					GraphicsSurfaces::surface_state_props::destroy(_Data);
 				}
+
+				template <class GraphicsMath>
+				basic_fill_instance<GraphicsMath>::basic_fill_instance() noexcept
+					: _Matrix()
+					, _Color()
+					, _Alpha(1.0F) {
+				}
+				template <class GraphicsMath>
+				basic_fill_instance<GraphicsMath>::basic_fill_instance(const basic_matrix_2d<GraphicsMath>& m, float alpha) noexcept
+					: _Matrix(m)
+					, _Color()
+					, _Alpha(alpha) {
+				}
+				template <class GraphicsMath>
+				basic_fill_instance<GraphicsMath>::basic_fill_instance(const basic_matrix_2d<GraphicsMath>& m, const rgba_color& c, float alpha) noexcept
+					: _Matrix(m)
+					, _Color(c)
+					, _Alpha(alpha) {
+				}
+				template <class GraphicsMath>
+				void basic_fill_instance<GraphicsMath>::matrix(const basic_matrix_2d<GraphicsMath>& m) noexcept {
+					_Matrix = m;
+				}
+				template <class GraphicsMath>
+				void basic_fill_instance<GraphicsMath>::color(const optional<rgba_color>& c) noexcept {
+					_Color = c;
+				}
+				template <class GraphicsMath>
+				void basic_fill_instance<GraphicsMath>::alpha(float a) noexcept {
+					_Alpha = a;
+				}
+				template <class GraphicsMath>
+				const basic_matrix_2d<GraphicsMath>& basic_fill_instance<GraphicsMath>::matrix() const noexcept {
+					return _Matrix;
+				}
+				template <class GraphicsMath>
+				const optional<rgba_color>& basic_fill_instance<GraphicsMath>::color() const noexcept {
+					return _Color;
+				}
+				template <class GraphicsMath>
+				float basic_fill_instance<GraphicsMath>::alpha() const noexcept {
+					return _Alpha;
+				}
+
+				template <class GraphicsMath>
+				_Fill_instance_range<GraphicsMath>::_Fill_instance_range(const basic_fill_instance<GraphicsMath>* first, size_t count) noexcept
+					: _First(first)
+					, _Count(count) {
+				}
+				template <class GraphicsMath>
+				const basic_fill_instance<GraphicsMath>* _Fill_instance_range<GraphicsMath>::begin() const noexcept {
+					return _First;
+				}
+				template <class GraphicsMath>
+				const basic_fill_instance<GraphicsMath>* _Fill_instance_range<GraphicsMath>::end() const noexcept {
+					return _First + _Count;
+				}
+				template <class GraphicsMath>
+				size_t _Fill_instance_range<GraphicsMath>::size() const noexcept {
+					return _Count;
+				}
+				template <class GraphicsMath>
+				bool _Fill_instance_range<GraphicsMath>::empty() const noexcept {
+					return _Count == 0;
+				}
+				template <class GraphicsMath>
+				const basic_fill_instance<GraphicsMath>& _Fill_instance_range<GraphicsMath>::operator[](size_t i) const noexcept {
+					return _First[i];
+				}
+
+				// Pointers to instances and vector iterators are the contiguous ranges that can be recognised before C++20; anything else, including
+				// ranges of basic_matrix_2d, is copied.
+				template <class GraphicsMath, class InputIterator, class Function>
+				void _Call_with_fill_instances(InputIterator first, InputIterator last, Function&& f) {
+					using instance_type = basic_fill_instance<GraphicsMath>;
+					if constexpr ((::std::is_pointer_v<InputIterator> && ::std::is_same_v<::std::remove_cv_t<::std::remove_pointer_t<InputIterator>>, instance_type>) ||
+						::std::is_same_v<InputIterator, typename ::std::vector<instance_type>::iterator> || ::std::is_same_v<InputIterator, typename ::std::vector<instance_type>::const_iterator>) {
+						const auto count = static_cast<size_t>(last - first);
+						f(_Fill_instance_range<GraphicsMath>(count == 0 ? nullptr : ::std::addressof(*first), count));
+					}
+					else {
+						const ::std::vector<instance_type> instances(first, last);
+						f(_Fill_instance_range<GraphicsMath>(instances.data(), instances.size()));
+					}
+				}
+
+				inline coverage_cache_stats::coverage_cache_stats(size_t entries, size_t bytes, size_t hits, size_t misses, size_t evictions) noexcept
+					: _Entries(entries)
+					, _Bytes(bytes)
+					, _Hits(hits)
+					, _Misses(misses)
+					, _Evictions(evictions) {
+				}
+				inline size_t coverage_cache_stats::entries() const noexcept {
+					return _Entries;
+				}
+				inline size_t coverage_cache_stats::bytes() const noexcept {
+					return _Bytes;
+				}
+				inline size_t coverage_cache_stats::hits() const noexcept {
+					return _Hits;
+				}
+				inline size_t coverage_cache_stats::misses() const noexcept {
+					return _Misses;
+				}
+				inline size_t coverage_cache_stats::evictions() const noexcept {
+					return _Evictions;
+				}
 			}
 		}
 	}
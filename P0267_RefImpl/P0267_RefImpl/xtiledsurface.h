@@ -0,0 +1,66 @@
+#pragma once
+#include "xio2d.h"
+#include "xbrushes.h"
+#include "xsurfaces.h"
+
+namespace std::experimental::io2d {
+	inline namespace v1 {
+		// A large image split into a grid of tile_dimensions() sized image surfaces, the last row and column cropped to dimensions(). A tile is only
+		// created the first time a draw call may change it; tiles that were never created read as transparent black. Each draw call is sent only to the
+		// tiles that its transformed bounds, limited by the clip's bounds, overlap. Operators that also change pixels outside of what is drawn
+		// (in, out, dest_in and dest_atop) are sent to every existing tile as well, since a tile that does not exist yet would stay transparent anyway.
+		template <class GraphicsSurfaces>
+		class basic_tiled_image_surface {
+		public:
+			using graphics_math_type = typename GraphicsSurfaces::graphics_math_type;
+		private:
+			io2d::format _Format;
+			basic_display_point<graphics_math_type> _Dimensions;
+			basic_display_point<graphics_math_type> _Tile_dimensions;
+			int _Columns;
+			int _Rows;
+			// Row major, null for tiles that do not exist.
+			::std::vector<::std::unique_ptr<basic_image_surface<GraphicsSurfaces>>> _Tiles;
+
+			template <class GS>
+			friend basic_tiled_image_surface<GS> copy_surface(basic_tiled_image_surface<GS>& sfc);
+
+			template <class Draw>
+			void _Draw(const basic_bounding_box<graphics_math_type>& bounds, const basic_render_props<GraphicsSurfaces>& rp, const basic_clip_props<GraphicsSurfaces>& cl, Draw&& draw);
+			basic_image_surface<GraphicsSurfaces>& _Create_tile(int column, int row);
+		public:
+			basic_tiled_image_surface(io2d::format fmt, int width, int height, const basic_display_point<graphics_math_type>& tileDimensions = basic_display_point<graphics_math_type>(256, 256));
+			basic_tiled_image_surface(basic_tiled_image_surface&&) noexcept = default;
+			basic_tiled_image_surface& operator=(basic_tiled_image_surface&&) noexcept = default;
+
+			io2d::format format() const noexcept;
+			basic_display_point<graphics_math_type> dimensions() const noexcept;
+			basic_display_point<graphics_math_type> tile_dimensions() const noexcept;
+			// The number of columns and rows of tiles.
+			basic_display_point<graphics_math_type> grid_dimensions() const noexcept;
+
+			// Tiles are identified by their column and row. tile() returns nullptr for a tile that does not exist; tile(), tile_bounds() and release_tile()
+			// throw a system_error with errc::argument_out_of_domain for an index outside grid_dimensions().
+			size_t tile_count() const noexcept;
+			::std::vector<basic_display_point<graphics_math_type>> tiles() const;
+			basic_image_surface<GraphicsSurfaces>* tile(const basic_display_point<graphics_math_type>& index);
+			const basic_image_surface<GraphicsSurfaces>* tile(const basic_display_point<graphics_math_type>& index) const;
+			basic_bounding_box<graphics_math_type> tile_bounds(const basic_display_point<graphics_math_type>& index) const;
+			void release_tile(const basic_display_point<graphics_math_type>& index);
+			void clear() noexcept;
+
+			void paint(const basic_brush<GraphicsSurfaces>& b, const optional<basic_brush_props<GraphicsSurfaces>>& bp = nullopt, const optional<basic_render_props<GraphicsSurfaces>>& rp = nullopt, const optional<basic_clip_props<GraphicsSurfaces>>& cl = nullopt);
+			void fill(const basic_brush<GraphicsSurfaces>& b, const basic_interpreted_path<GraphicsSurfaces>& ip, const optional<basic_brush_props<GraphicsSurfaces>>& bp = nullopt, const optional<basic_render_props<GraphicsSurfaces>>& rp = nullopt, const optional<basic_clip_props<GraphicsSurfaces>>& cl = nullopt);
+			void fill_rect(const basic_brush<GraphicsSurfaces>& b, const basic_bounding_box<graphics_math_type>& bb, const optional<basic_brush_props<GraphicsSurfaces>>& bp = nullopt, const optional<basic_render_props<GraphicsSurfaces>>& rp = nullopt, const optional<basic_clip_props<GraphicsSurfaces>>& cl = nullopt);
+			void stroke(const basic_brush<GraphicsSurfaces>& b, const basic_interpreted_path<GraphicsSurfaces>& ip, const optional<basic_brush_props<GraphicsSurfaces>>& bp = nullopt, const optional<basic_stroke_props<GraphicsSurfaces>>& sp = nullopt, const optional<basic_dashes<GraphicsSurfaces>>& d = nullopt, const optional<basic_render_props<GraphicsSurfaces>>& rp = nullopt, const optional<basic_clip_props<GraphicsSurfaces>>& cl = nullopt);
+
+			// Copies every existing tile into target at its position in this surface. Areas without a tile are left as they are.
+			void copy_to(basic_image_surface<GraphicsSurfaces>& target) const;
+		};
+
+		// Each tile of the copy shares its pixels with the same tile of sfc, as copy_surface does for an image surface, so a draw call that reaches
+		// only some tiles copies only those tiles.
+		template <class GraphicsSurfaces>
+		basic_tiled_image_surface<GraphicsSurfaces> copy_surface(basic_tiled_image_surface<GraphicsSurfaces>& sfc);
+	}
+}
@@ -0,0 +1,231 @@
+#pragma once
+#include "xtiledsurface.h"
+
+namespace std::experimental::io2d {
+	inline namespace v1 {
+		// The device space bounds of bb drawn with m, grown by a pixel for antialiasing.
+		template <class GraphicsMath>
+		basic_bounding_box<GraphicsMath> _Tile_device_bounds(const basic_bounding_box<GraphicsMath>& bb, const basic_matrix_2d<GraphicsMath>& m) noexcept {
+			const basic_point_2d<GraphicsMath> corners[] = {
+				m.transform_pt(bb.top_left()),
+				m.transform_pt(basic_point_2d<GraphicsMath>(bb.x() + bb.width(), bb.y())),
+				m.transform_pt(basic_point_2d<GraphicsMath>(bb.x(), bb.y() + bb.height())),
+				m.transform_pt(bb.bottom_right())
+			};
+			float left = corners[0].x();
+			float top = corners[0].y();
+			float right = left;
+			float bottom = top;
+			for (const auto& corner : corners) {
+				left = ::std::min(left, corner.x());
+				top = ::std::min(top, corner.y());
+				right = ::std::max(right, corner.x());
+				bottom = ::std::max(bottom, corner.y());
+			}
+			return basic_bounding_box<GraphicsMath>(basic_point_2d<GraphicsMath>(left - 1.0F, top - 1.0F), basic_point_2d<GraphicsMath>(right + 1.0F, bottom + 1.0F));
+		}
+
+		template <class GraphicsSurfaces>
+		basic_tiled_image_surface<GraphicsSurfaces>::basic_tiled_image_surface(io2d::format fmt, int width, int height, const basic_display_point<graphics_math_type>& tileDimensions)
+			: _Format(fmt)
+			, _Dimensions(width, height)
+			, _Tile_dimensions(tileDimensions)
+			, _Columns(0)
+			, _Rows(0) {
+			const auto maxDimensions = basic_image_surface<GraphicsSurfaces>::max_dimensions();
+			if (fmt == io2d::format::invalid || width <= 0 || height <= 0 || tileDimensions.x() <= 0 || tileDimensions.y() <= 0 ||
+				tileDimensions.x() > maxDimensions.x() || tileDimensions.y() > maxDimensions.y()) {
+				throw ::std::system_error(::std::make_error_code(::std::errc::invalid_argument));
+			}
+			_Columns = (width + tileDimensions.x() - 1) / tileDimensions.x();
+			_Rows = (height + tileDimensions.y() - 1) / tileDimensions.y();
+			_Tiles.resize(static_cast<size_t>(_Columns) * static_cast<size_t>(_Rows));
+		}
+
+		template <class GraphicsSurfaces>
+		basic_image_surface<GraphicsSurfaces>& basic_tiled_image_surface<GraphicsSurfaces>::_Create_tile(int column, int row) {
+			auto& slot = _Tiles[static_cast<size_t>(row) * static_cast<size_t>(_Columns) + static_cast<size_t>(column)];
+			if (slot == nullptr) {
+				const int width = ::std::min(_Tile_dimensions.x(), _Dimensions.x() - column * _Tile_dimensions.x());
+				const int height = ::std::min(_Tile_dimensions.y(), _Dimensions.y() - row * _Tile_dimensions.y());
+				slot = make_unique<basic_image_surface<GraphicsSurfaces>>(_Format, width, height);
+			}
+			return *slot;
+		}
+
+		// bounds is in device space. Each tile is drawn to with the render props' matrix followed by a translation that moves the tile's top left corner
+		// to the origin, which moves the brush and the clip along with what is drawn.
+		template <class GraphicsSurfaces>
+		template <class Draw>
+		void basic_tiled_image_surface<GraphicsSurfaces>::_Draw(const basic_bounding_box<graphics_math_type>& bounds, const basic_render_props<GraphicsSurfaces>& rp, const basic_clip_props<GraphicsSurfaces>& cl, Draw&& draw) {
+			const auto m = rp.surface_matrix();
+			auto left = bounds.x();
+			auto top = bounds.y();
+			auto right = bounds.x() + bounds.width();
+			auto bottom = bounds.y() + bounds.height();
+			// An empty clip path means there is no clip.
+			const auto clipBounds = cl.clip().bounds();
+			if (clipBounds.width() > 0.0F || clipBounds.height() > 0.0F) {
+				const auto deviceClip = _Tile_device_bounds(clipBounds, m);
+				left = ::std::max(left, deviceClip.x());
+				top = ::std::max(top, deviceClip.y());
+				right = ::std::min(right, deviceClip.x() + deviceClip.width());
+				bottom = ::std::min(bottom, deviceClip.y() + deviceClip.height());
+			}
+			const int firstColumn = ::std::max(static_cast<int>(::std::floor(left / _Tile_dimensions.x())), 0);
+			const int firstRow = ::std::max(static_cast<int>(::std::floor(top / _Tile_dimensions.y())), 0);
+			const int lastColumn = ::std::min(static_cast<int>(::std::ceil(right / _Tile_dimensions.x())), _Columns) - 1;
+			const int lastRow = ::std::min(static_cast<int>(::std::ceil(bottom / _Tile_dimensions.y())), _Rows) - 1;
+			const bool overlaps = left < right && top < bottom;
+
+			const auto op = rp.compositing();
+			const bool unbounded = op == compositing_op::in || op == compositing_op::out || op == compositing_op::dest_in || op == compositing_op::dest_atop;
+			auto tileProps = rp;
+			for (int row = 0; row < _Rows; ++row) {
+				for (int column = 0; column < _Columns; ++column) {
+					const bool inBounds = overlaps && column >= firstColumn && column <= lastColumn && row >= firstRow && row <= lastRow;
+					const auto& slot = _Tiles[static_cast<size_t>(row) * static_cast<size_t>(_Columns) + static_cast<size_t>(column)];
+					if (!inBounds && !(unbounded && slot != nullptr)) {
+						continue;
+					}
+					auto& tile = _Create_tile(column, row);
+					tileProps.surface_matrix(m * basic_matrix_2d<graphics_math_type>::create_translate(basic_point_2d<graphics_math_type>(static_cast<float>(-column * _Tile_dimensions.x()), static_cast<float>(-row * _Tile_dimensions.y()))));
+					draw(tile, tileProps);
+				}
+			}
+		}
+
+		template <class GraphicsSurfaces>
+		io2d::format basic_tiled_image_surface<GraphicsSurfaces>::format() const noexcept {
+			return _Format;
+		}
+		template <class GraphicsSurfaces>
+		basic_display_point<typename basic_tiled_image_surface<GraphicsSurfaces>::graphics_math_type> basic_tiled_image_surface<GraphicsSurfaces>::dimensions() const noexcept {
+			return _Dimensions;
+		}
+		template <class GraphicsSurfaces>
+		basic_display_point<typename basic_tiled_image_surface<GraphicsSurfaces>::graphics_math_type> basic_tiled_image_surface<GraphicsSurfaces>::tile_dimensions() const noexcept {
+			return _Tile_dimensions;
+		}
+		template <class GraphicsSurfaces>
+		basic_display_point<typename basic_tiled_image_surface<GraphicsSurfaces>::graphics_math_type> basic_tiled_image_surface<GraphicsSurfaces>::grid_dimensions() const noexcept {
+			return basic_display_point<graphics_math_type>(_Columns, _Rows);
+		}
+
+		template <class GraphicsSurfaces>
+		size_t basic_tiled_image_surface<GraphicsSurfaces>::tile_count() const noexcept {
+			return static_cast<size_t>(::std::count_if(_Tiles.begin(), _Tiles.end(), [](const auto& tile) { return tile != nullptr; }));
+		}
+		template <class GraphicsSurfaces>
+		::std::vector<basic_display_point<typename basic_tiled_image_surface<GraphicsSurfaces>::graphics_math_type>> basic_tiled_image_surface<GraphicsSurfaces>::tiles() const {
+			::std::vector<basic_display_point<graphics_math_type>> result;
+			for (int row = 0; row < _Rows; ++row) {
+				for (int column = 0; column < _Columns; ++column) {
+					if (_Tiles[static_cast<size_t>(row) * static_cast<size_t>(_Columns) + static_cast<size_t>(column)] != nullptr) {
+						result.emplace_back(column, row);
+					}
+				}
+			}
+			return result;
+		}
+		template <class GraphicsSurfaces>
+		basic_image_surface<GraphicsSurfaces>* basic_tiled_image_surface<GraphicsSurfaces>::tile(const basic_display_point<graphics_math_type>& index) {
+			if (index.x() < 0 || index.y() < 0 || index.x() >= _Columns || index.y() >= _Rows) {
+				throw ::std::system_error(::std::make_error_code(::std::errc::argument_out_of_domain));
+			}
+			return _Tiles[static_cast<size_t>(index.y()) * static_cast<size_t>(_Columns) + static_cast<size_t>(index.x())].get();
+		}
+		template <class GraphicsSurfaces>
+		const basic_image_surface<GraphicsSurfaces>* basic_tiled_image_surface<GraphicsSurfaces>::tile(const basic_display_point<graphics_math_type>& index) const {
+			return const_cast<basic_tiled_image_surface*>(this)->tile(index);
+		}
+		template <class GraphicsSurfaces>
+		basic_bounding_box<typename basic_tiled_image_surface<GraphicsSurfaces>::graphics_math_type> basic_tiled_image_surface<GraphicsSurfaces>::tile_bounds(const basic_display_point<graphics_math_type>& index) const {
+			if (index.x() < 0 || index.y() < 0 || index.x() >= _Columns || index.y() >= _Rows) {
+				throw ::std::system_error(::std::make_error_code(::std::errc::argument_out_of_domain));
+			}
+			const int x = index.x() * _Tile_dimensions.x();
+			const int y = index.y() * _Tile_dimensions.y();
+			return basic_bounding_box<graphics_math_type>(static_cast<float>(x), static_cast<float>(y), static_cast<float>(::std::min(_Tile_dimensions.x(), _Dimensions.x() - x)), static_cast<float>(::std::min(_Tile_dimensions.y(), _Dimensions.y() - y)));
+		}
+		template <class GraphicsSurfaces>
+		void basic_tiled_image_surface<GraphicsSurfaces>::release_tile(const basic_display_point<graphics_math_type>& index) {
+			if (index.x() < 0 || index.y() < 0 || index.x() >= _Columns || index.y() >= _Rows) {
+				throw ::std::system_error(::std::make_error_code(::std::errc::argument_out_of_domain));
+			}
+			_Tiles[static_cast<size_t>(index.y()) * static_cast<size_t>(_Columns) + static_cast<size_t>(index.x())].reset();
+		}
+		template <class GraphicsSurfaces>
+		void basic_tiled_image_surface<GraphicsSurfaces>::clear() noexcept {
+			for (auto& tile : _Tiles) {
+				tile.reset();
+			}
+		}
+
+		template <class GraphicsSurfaces>
+		void basic_tiled_image_surface<GraphicsSurfaces>::paint(const basic_brush<GraphicsSurfaces>& b, const optional<basic_brush_props<GraphicsSurfaces>>& bp, const optional<basic_render_props<GraphicsSurfaces>>& rp, const optional<basic_clip_props<GraphicsSurfaces>>& cl) {
+			const auto renderProps = rp.value_or(basic_render_props<GraphicsSurfaces>());
+			const auto clipProps = cl.value_or(basic_clip_props<GraphicsSurfaces>());
+			const basic_bounding_box<graphics_math_type> all(0.0F, 0.0F, static_cast<float>(_Dimensions.x()), static_cast<float>(_Dimensions.y()));
+			_Draw(all, renderProps, clipProps, [&](basic_image_surface<GraphicsSurfaces>& tile, const basic_render_props<GraphicsSurfaces>& tileProps) {
+				tile.paint(b, bp, tileProps, clipProps);
+			});
+		}
+		template <class GraphicsSurfaces>
+		void basic_tiled_image_surface<GraphicsSurfaces>::fill(const basic_brush<GraphicsSurfaces>& b, const basic_interpreted_path<GraphicsSurfaces>& ip, const optional<basic_brush_props<GraphicsSurfaces>>& bp, const optional<basic_render_props<GraphicsSurfaces>>& rp, const optional<basic_clip_props<GraphicsSurfaces>>& cl) {
+			const auto renderProps = rp.value_or(basic_render_props<GraphicsSurfaces>());
+			const auto clipProps = cl.value_or(basic_clip_props<GraphicsSurfaces>());
+			_Draw(_Tile_device_bounds(ip.bounds(), renderProps.surface_matrix()), renderProps, clipProps, [&](basic_image_surface<GraphicsSurfaces>& tile, const basic_render_props<GraphicsSurfaces>& tileProps) {
+				tile.fill(b, ip, bp, tileProps, clipProps);
+			});
+		}
+		template <class GraphicsSurfaces>
+		void basic_tiled_image_surface<GraphicsSurfaces>::fill_rect(const basic_brush<GraphicsSurfaces>& b, const basic_bounding_box<graphics_math_type>& bb, const optional<basic_brush_props<GraphicsSurfaces>>& bp, const optional<basic_render_props<GraphicsSurfaces>>& rp, const optional<basic_clip_props<GraphicsSurfaces>>& cl) {
+			const auto renderProps = rp.value_or(basic_render_props<GraphicsSurfaces>());
+			const auto clipProps = cl.value_or(basic_clip_props<GraphicsSurfaces>());
+			_Draw(_Tile_device_bounds(bb, renderProps.surface_matrix()), renderProps, clipProps, [&](basic_image_surface<GraphicsSurfaces>& tile, const basic_render_props<GraphicsSurfaces>& tileProps) {
+				tile.fill_rect(b, bb, bp, tileProps, clipProps);
+			});
+		}
+		// The stroke reaches at most half the line width from the path, times the miter limit for mitered joins or the square root of two for square
+		// caps.
+		template <class GraphicsSurfaces>
+		void basic_tiled_image_surface<GraphicsSurfaces>::stroke(const basic_brush<GraphicsSurfaces>& b, const basic_interpreted_path<GraphicsSurfaces>& ip, const optional<basic_brush_props<GraphicsSurfaces>>& bp, const optional<basic_stroke_props<GraphicsSurfaces>>& sp, const optional<basic_dashes<GraphicsSurfaces>>& d, const optional<basic_render_props<GraphicsSurfaces>>& rp, const optional<basic_clip_props<GraphicsSurfaces>>& cl) {
+			const auto renderProps = rp.value_or(basic_render_props<GraphicsSurfaces>());
+			const auto clipProps = cl.value_or(basic_clip_props<GraphicsSurfaces>());
+			const auto strokeProps = sp.value_or(basic_stroke_props<GraphicsSurfaces>());
+			float reach = 1.0F;
+			if (strokeProps.line_join() == line_join::miter) {
+				reach = ::std::max(reach, strokeProps.miter_limit());
+			}
+			if (strokeProps.line_cap() == line_cap::square) {
+				reach = ::std::max(reach, ::std::sqrt(2.0F));
+			}
+			const float extent = strokeProps.line_width() * 0.5F * reach;
+			const auto pathBounds = ip.bounds();
+			const basic_bounding_box<graphics_math_type> strokeBounds(pathBounds.x() - extent, pathBounds.y() - extent, pathBounds.width() + 2.0F * extent, pathBounds.height() + 2.0F * extent);
+			_Draw(_Tile_device_bounds(strokeBounds, renderProps.surface_matrix()), renderProps, clipProps, [&](basic_image_surface<GraphicsSurfaces>& tile, const basic_render_props<GraphicsSurfaces>& tileProps) {
+				tile.stroke(b, ip, bp, strokeProps, d, tileProps, clipProps);
+			});
+		}
+
+		template <class GraphicsSurfaces>
+		void basic_tiled_image_surface<GraphicsSurfaces>::copy_to(basic_image_surface<GraphicsSurfaces>& target) const {
+			for (const auto& index : tiles()) {
+				const auto bounds = tile_bounds(index);
+				copy_region(*tile(index), basic_bounding_box<graphics_math_type>(0.0F, 0.0F, bounds.width(), bounds.height()), target, basic_display_point<graphics_math_type>(static_cast<int>(bounds.x()), static_cast<int>(bounds.y())));
+			}
+		}
+
+		template <class GraphicsSurfaces>
+		basic_tiled_image_surface<GraphicsSurfaces> copy_surface(basic_tiled_image_surface<GraphicsSurfaces>& sfc) {
+			basic_tiled_image_surface<GraphicsSurfaces> result(sfc._Format, sfc._Dimensions.x(), sfc._Dimensions.y(), sfc._Tile_dimensions);
+			for (size_t i = 0; i < sfc._Tiles.size(); ++i) {
+				if (sfc._Tiles[i] != nullptr) {
+					result._Tiles[i] = make_unique<basic_image_surface<GraphicsSurfaces>>(copy_surface(*sfc._Tiles[i]));
+				}
+			}
+			return result;
+		}
+	}
+}
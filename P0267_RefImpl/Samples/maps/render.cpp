@@ -32,18 +32,14 @@ void Render::Display( io2d::output_surface &surface )
 void Render::DrawBuildings(io2d::output_surface &surface) const
 {
     for( auto &building: m_Model.Buildings() ) {
-        auto path = PathFromMP(building);
-        surface.fill(m_BuildingFillBrush, path);        
-        surface.stroke(m_BuildingOutlineBrush, path, std::nullopt, m_BuildingOutlineStrokeProps);
+        surface.fill_stroke(m_BuildingFillBrush, m_BuildingOutlineBrush, PathFromMP(building), std::nullopt, m_BuildingOutlineStrokeProps);
     }
 }
 
 void Render::DrawLeisure(io2d::output_surface &surface) const
 {
     for( auto &leisure: m_Model.Leisures()) {
-        auto path = PathFromMP(leisure);
-        surface.fill(m_LeisureFillBrush, path);        
-        surface.stroke(m_LeisureOutlineBrush, path, std::nullopt, m_LeisureOutlineStrokeProps);
+        surface.fill_stroke(m_LeisureFillBrush, m_LeisureOutlineBrush, PathFromMP(leisure), std::nullopt, m_LeisureOutlineStrokeProps);
     }
 }
 
@@ -0,0 +1,74 @@
+#include "catch.hpp"
+#include <io2d.h>
+#include "comparison.h"
+#include <cstdio>
+#include <sstream>
+
+using namespace std;
+using namespace std::experimental;
+using namespace std::experimental::io2d;
+
+static const auto g_BANDEDPNG = "banded_export.png";
+static const auto g_BANDEDTIFF = "banded_export.tiff";
+
+static void DrawScene(image_surface& image, const render_props& rp, const clip_props& cl)
+{
+    path_builder pb{};
+    pb.new_figure({20.f, 15.f});
+    pb.line({280.f, 90.f});
+    pb.line({60.f, 190.f});
+    pb.close_figure();
+    image.paint(brush{rgba_color::white}, nullopt, rp, cl);
+    image.fill(brush{rgba_color{0.2f, 0.4f, 0.8f, 0.5f}}, interpreted_path{pb}, nullopt, rp, cl);
+    image.stroke(brush{rgba_color::crimson}, interpreted_path{pb}, nullopt, stroke_props{5.f}, nullopt, rp, cl);
+}
+
+TEST_CASE("IO2D banded rendering matches rendering the whole image at once")
+{
+    auto expected = image_surface{format::argb32, 300, 200};
+    DrawScene(expected, render_props{}, clip_props{});
+
+    // Bands that do not divide the height evenly, and a seam through the middle of every edge.
+    const auto renderer = banded_renderer{format::argb32, 300, 200, 37};
+    CHECK(renderer.band_height() == 37);
+    int calls = 0;
+    const auto draw = [&calls](image_surface& band, const render_props& rp, const clip_props& cl) {
+        ++calls;
+        DrawScene(band, rp, cl);
+    };
+    renderer.save(g_BANDEDPNG, image_file_format::png, draw);
+    CHECK(calls == 6);
+    auto png = image_surface{g_BANDEDPNG, image_file_format::png, format::argb32};
+    CHECK(CompareImages(png, expected, 0.02f, 0));
+    remove(g_BANDEDPNG);
+
+    renderer.save(g_BANDEDTIFF, image_file_format::tiff, draw);
+    auto tiff = image_surface{g_BANDEDTIFF, image_file_format::tiff, format::argb32};
+    CHECK(CompareImages(tiff, expected, 0.02f, 0));
+    remove(g_BANDEDTIFF);
+}
+
+TEST_CASE("IO2D banded rendering streams to any output stream")
+{
+    const auto renderer = banded_renderer{format::xrgb32, 64, 1000, 100};
+    const auto draw = [](image_surface& band, const render_props& rp, const clip_props& cl) {
+        band.paint(brush{rgba_color::green}, nullopt, rp, cl);
+    };
+
+    ostringstream png;
+    renderer.save(png, image_file_format::png, draw);
+    const auto pngBytes = png.str();
+    REQUIRE(pngBytes.size() > 8);
+    CHECK(pngBytes.compare(1, 3, "PNG") == 0);
+    CHECK(pngBytes.compare(pngBytes.size() - 8, 4, "IEND") == 0);
+
+    ostringstream tiff;
+    renderer.save(tiff, image_file_format::tiff, draw);
+    const auto tiffBytes = tiff.str();
+    CHECK(tiffBytes.compare(0, 4, string("II*\0", 4)) == 0);
+    // The rows follow the directory and are not compressed.
+    CHECK(tiffBytes.size() > 64u * 1000u * 3u);
+
+    CHECK_THROWS_AS(renderer.save(png, image_file_format::jpeg, draw), system_error);
+    CHECK_THROWS_AS((banded_renderer{format::argb32, 64, 0}), system_error);
+}
@@ -0,0 +1,125 @@
+#include "catch.hpp"
+#include <io2d.h>
+#include "comparison.h"
+
+using namespace std;
+using namespace std::experimental;
+using namespace std::experimental::io2d;
+
+static interpreted_path MakeRoundedRect(const bounding_box& bb, float r)
+{
+    path_builder pb{};
+    pb.new_figure({bb.x() + r, bb.y()});
+    pb.line({bb.x() + bb.width() - r, bb.y()});
+    pb.quadratic_curve({bb.x() + bb.width(), bb.y()}, {bb.x() + bb.width(), bb.y() + r});
+    pb.line({bb.x() + bb.width(), bb.y() + bb.height() - r});
+    pb.quadratic_curve({bb.x() + bb.width(), bb.y() + bb.height()}, {bb.x() + bb.width() - r, bb.y() + bb.height()});
+    pb.line({bb.x() + r, bb.y() + bb.height()});
+    pb.quadratic_curve({bb.x(), bb.y() + bb.height()}, {bb.x(), bb.y() + bb.height() - r});
+    pb.line({bb.x(), bb.y() + r});
+    pb.quadratic_curve({bb.x(), bb.y()}, {bb.x() + r, bb.y()});
+    pb.close_figure();
+    return interpreted_path{pb};
+}
+
+// Strokes are always clipped by the clip path itself, so a stroke wide enough to cover the surface shows exactly the area the clip lets through.
+static void PaintThroughPathClip(image_surface& image, const brush& b, const clip_props& cl, const render_props& rp)
+{
+    path_builder pb{};
+    pb.new_figure({-1000.f, 0.f});
+    pb.line({1000.f, 0.f});
+    image.stroke(b, interpreted_path{pb}, nullopt, stroke_props{4000.f}, nullopt, rp, cl);
+}
+
+TEST_CASE("IO2D draws through a clip mask cover the same pixels as the clip path")
+{
+    const auto cl = clip_props{MakeRoundedRect({20.5f, 15.25f, 200.f, 120.f}, 24.f)};
+    const auto b = brush{rgba_color::teal};
+    for (auto m : { matrix_2d{}, matrix_2d::create_translate({13.3f, 7.f}), matrix_2d::create_rotate(0.3f, {120.f, 80.f}) }) {
+        const auto rp = render_props{antialias::good, m};
+
+        auto expected = image_surface{format::argb32, 260, 180};
+        expected.paint(brush{rgba_color::white});
+        PaintThroughPathClip(expected, b, cl, rp);
+
+        auto painted = image_surface{format::argb32, 260, 180};
+        painted.paint(brush{rgba_color::white});
+        painted.paint(b, nullopt, rp, cl);
+        CHECK(CompareImages(painted, expected, 0.f, 0));
+
+        // Two fills that together cover the clip, drawn through the same clip props.
+        auto filled = image_surface{format::argb32, 260, 180};
+        filled.paint(brush{rgba_color::white});
+        filled.fill(b, interpreted_path{bounding_box{-500.f, -500.f, 620.f, 1000.f}}, nullopt, rp, cl);
+        filled.fill(b, interpreted_path{bounding_box{120.f, -500.f, 500.f, 1000.f}}, nullopt, rp, cl);
+        CHECK(CompareImages(filled, expected, 0.f, 0));
+    }
+}
+
+TEST_CASE("IO2D changing clip props replaces their clip mask")
+{
+    auto cl = clip_props{MakeRoundedRect({10.f, 10.f, 100.f, 80.f}, 20.f)};
+    const auto copy = cl;
+    cl.clip(MakeRoundedRect({60.f, 40.f, 120.f, 100.f}, 30.f));
+    const auto b = brush{rgba_color::orange};
+    const auto rp = render_props{};
+
+    for (const auto& props : { copy, cl }) {
+        auto image = image_surface{format::argb32, 200, 160};
+        image.paint(brush{rgba_color::white});
+        image.paint(b, nullopt, rp, props);
+        auto expected = image_surface{format::argb32, 200, 160};
+        expected.paint(brush{rgba_color::white});
+        PaintThroughPathClip(expected, b, props, rp);
+        CHECK(CompareImages(image, expected, 0.f, 0));
+    }
+}
+
+TEST_CASE("IO2D one surface drawn through a clip under alternating matrices keeps the clip for each")
+{
+    const auto cl = clip_props{MakeRoundedRect({30.25f, 20.5f, 110.f, 70.f}, 18.f)};
+    const auto b = brush{rgba_color::purple};
+    const matrix_2d matrices[] = { matrix_2d::create_translate({-40.f, 0.f}), matrix_2d::create_rotate(-0.25f, {90.f, 60.f}), matrix_2d::create_translate({40.f, 50.f}) };
+
+    auto expected = image_surface{format::argb32, 240, 200};
+    expected.paint(brush{rgba_color::white});
+    for (const auto& m : matrices) {
+        PaintThroughPathClip(expected, b, cl, render_props{antialias::good, m});
+    }
+
+    // The second pass draws with the masks the first one made.
+    auto image = image_surface{format::argb32, 240, 200};
+    for (int pass = 0; pass < 2; ++pass) {
+        image.paint(brush{rgba_color::white});
+        for (const auto& m : matrices) {
+            image.fill(b, interpreted_path{bounding_box{-500.f, -500.f, 1000.f, 1000.f}}, nullopt, render_props{antialias::good, m}, cl);
+        }
+        CHECK(CompareImages(image, expected, 0.f, 0));
+    }
+}
+
+TEST_CASE("IO2D rectangular clips give the same result aligned or not")
+{
+    const auto b = brush{rgba_color::navy};
+    for (auto bb : { bounding_box{20.f, 30.f, 100.f, 60.f}, bounding_box{20.5f, 30.25f, 100.f, 60.f} }) {
+        const auto cl = clip_props{bb};
+        auto image = image_surface{format::argb32, 160, 120};
+        image.paint(brush{rgba_color::white});
+        image.paint(b, nullopt, nullopt, cl);
+
+        auto expected = image_surface{format::argb32, 160, 120};
+        expected.paint(brush{rgba_color::white});
+        expected.fill(b, interpreted_path{bb});
+        CHECK(CompareImages(image, expected, 0.f, 0));
+    }
+}
+
+TEST_CASE("IO2D unbounded operators stay inside the clip")
+{
+    const auto cl = clip_props{MakeRoundedRect({40.f, 40.f, 80.f, 60.f}, 16.f)};
+    auto image = image_surface{format::argb32, 160, 140};
+    image.paint(brush{rgba_color::red});
+    image.paint(brush{rgba_color::blue}, nullopt, render_props{antialias::good, matrix_2d{}, compositing_op::in}, cl);
+    CHECK(CompareImageColor(image, 5, 5, rgba_color::red));
+    CHECK(CompareImageColor(image, 80, 70, rgba_color::blue));
+}
@@ -0,0 +1,88 @@
+#include "catch.hpp"
+#include <io2d.h>
+#include "comparison.h"
+#include <cstdio>
+
+using namespace std;
+using namespace std::experimental;
+using namespace std::experimental::io2d;
+
+static image_surface MakeOriginal()
+{
+    auto image = image_surface{format::argb32, 64, 48};
+    image.paint(brush{rgba_color::white});
+    image.fill_rect(brush{rgba_color::navy}, bounding_box{8.f, 8.f, 16.f, 16.f});
+    return image;
+}
+
+TEST_CASE("IO2D copies made by copy_surface do not see later drawing to either surface")
+{
+    auto original = MakeOriginal();
+    auto copy = copy_surface(original);
+    auto reference = MakeOriginal();
+    CHECK(CompareImages(copy, reference, 0.f, 0));
+
+    copy.fill_rect(brush{rgba_color::red}, bounding_box{32.f, 8.f, 16.f, 16.f});
+    CHECK(CompareImages(original, reference, 0.f, 0));
+    CHECK(CompareImageColor(copy, 40, 16, rgba_color::red));
+    CHECK(CompareImageColor(copy, 16, 16, rgba_color::navy));
+
+    auto second = copy_surface(original);
+    original.clear();
+    CHECK(CompareImages(second, reference, 0.f, 0));
+    CHECK(CompareImageColor(original, 16, 16, rgba_color::transparent_black));
+}
+
+TEST_CASE("IO2D brushes made from a copy keep its pixels after the original is drawn to")
+{
+    auto original = MakeOriginal();
+    auto reference = MakeOriginal();
+    auto copy = copy_surface(original);
+    const auto sampled = brush{copy};
+    const auto consumed = brush{copy_surface(original)};
+    original.paint(brush{rgba_color::green});
+
+    auto target = image_surface{format::argb32, 64, 48};
+    target.paint(sampled);
+    CHECK(CompareImages(target, reference, 0.f, 0));
+    target.clear();
+    target.paint(consumed);
+    CHECK(CompareImages(target, reference, 0.f, 0));
+    CHECK(CompareImageColor(original, 16, 16, rgba_color::green));
+}
+
+TEST_CASE("IO2D surfaces over a mapped file keep drawing to the file after copy_surface")
+{
+    const auto name = "copy_on_write.io2draw";
+    {
+        auto mapped = image_surface::create_mapped(name, format::argb32, 64, 48);
+        mapped.paint(brush{rgba_color::white});
+        auto snapshot = copy_surface(mapped);
+        mapped.fill_rect(brush{rgba_color::navy}, bounding_box{8.f, 8.f, 16.f, 16.f});
+        CHECK(CompareImageColor(snapshot, 16, 16, rgba_color::white));
+        mapped.flush();
+    }
+    {
+        auto reopened = image_surface::open_mapped(name);
+        auto reference = MakeOriginal();
+        CHECK(CompareImages(reopened, reference, 0.f, 0));
+    }
+    remove(name);
+}
+
+TEST_CASE("IO2D copies of a tiled surface share tiles until each one is drawn to")
+{
+    auto original = tiled_image_surface{format::argb32, 128, 64, {64, 64}};
+    original.fill_rect(brush{rgba_color::white}, bounding_box{0.f, 0.f, 128.f, 64.f});
+    auto copy = copy_surface(original);
+    CHECK(copy.tile_count() == 2);
+
+    copy.fill_rect(brush{rgba_color::red}, bounding_box{8.f, 8.f, 16.f, 16.f});
+    CHECK(CompareImageColor(*copy.tile({0, 0}), 16, 16, rgba_color::red));
+    CHECK(CompareImageColor(*original.tile({0, 0}), 16, 16, rgba_color::white));
+    CHECK(CompareImages(*copy.tile({1, 0}), *original.tile({1, 0}), 0.f, 0));
+
+    original.fill_rect(brush{rgba_color::navy}, bounding_box{72.f, 8.f, 16.f, 16.f});
+    CHECK(CompareImageColor(*original.tile({1, 0}), 16, 16, rgba_color::navy));
+    CHECK(CompareImageColor(*copy.tile({1, 0}), 16, 16, rgba_color::white));
+}
@@ -0,0 +1,76 @@
+#include "catch.hpp"
+#include <io2d.h>
+#include "comparison.h"
+
+using namespace std;
+using namespace std::experimental;
+using namespace std::experimental::io2d;
+
+// Four 20x20 squares of different colors.
+static image_surface MakeQuadrants(format fmt)
+{
+    auto image = image_surface{fmt, 40, 40};
+    image.fill_rect(brush{rgba_color::red}, bounding_box{0.f, 0.f, 20.f, 20.f});
+    image.fill_rect(brush{rgba_color::lime}, bounding_box{20.f, 0.f, 20.f, 20.f});
+    image.fill_rect(brush{rgba_color::blue}, bounding_box{0.f, 20.f, 20.f, 20.f});
+    image.fill_rect(brush{rgba_color::yellow}, bounding_box{20.f, 20.f, 20.f, 20.f});
+    return image;
+}
+
+TEST_CASE("IO2D copy_region copies a block of pixels into another surface")
+{
+    auto src = MakeQuadrants(format::argb32);
+    auto dst = image_surface{format::argb32, 50, 50};
+    dst.paint(brush{rgba_color::white});
+
+    copy_region(src, bounding_box{20.f, 20.f, 20.f, 20.f}, dst, display_point{5, 5});
+    CHECK(CompareImageColor(dst, 15, 15, rgba_color::yellow));
+    CHECK(CompareImageColor(dst, 24, 24, rgba_color::yellow));
+    CHECK(CompareImageColor(dst, 25, 25, rgba_color::white));
+    CHECK(CompareImageColor(dst, 4, 4, rgba_color::white));
+
+    // Parts outside either surface are left out.
+    copy_region(src, bounding_box{-10.f, 0.f, 60.f, 20.f}, dst, display_point{30, 30});
+    CHECK(CompareImageColor(dst, 49, 35, rgba_color::red));
+    CHECK(CompareImageColor(dst, 45, 45, rgba_color::red));
+    CHECK(CompareImageColor(dst, 35, 35, rgba_color::white));
+
+    // Surfaces of different formats are drawn instead, with the same result.
+    auto opaque = image_surface{format::xrgb32, 50, 50};
+    opaque.paint(brush{rgba_color::white});
+    copy_region(src, bounding_box{0.f, 20.f, 20.f, 20.f}, opaque, display_point{30, 0});
+    CHECK(CompareImageColor(opaque, 40, 10, rgba_color::blue));
+    CHECK(CompareImageColor(opaque, 29, 10, rgba_color::white));
+}
+
+TEST_CASE("IO2D scroll moves pixels within a surface")
+{
+    auto image = MakeQuadrants(format::argb32);
+    image.scroll(display_point{-20, 0});
+    CHECK(CompareImageColor(image, 10, 10, rgba_color::lime));
+    CHECK(CompareImageColor(image, 10, 30, rgba_color::yellow));
+    // Nothing moved into the right half, so it keeps what it had.
+    CHECK(CompareImageColor(image, 30, 10, rgba_color::lime));
+
+    image = MakeQuadrants(format::argb32);
+    image.scroll(display_point{0, 10}, bounding_box{0.f, 0.f, 20.f, 40.f});
+    CHECK(CompareImageColor(image, 10, 25, rgba_color::red));
+    CHECK(CompareImageColor(image, 10, 35, rgba_color::blue));
+    CHECK(CompareImageColor(image, 30, 25, rgba_color::yellow));
+
+    // Overlapping copies within one surface behave like scroll.
+    auto expected = MakeQuadrants(format::argb32);
+    expected.scroll(display_point{5, 5});
+    auto copied = MakeQuadrants(format::argb32);
+    copy_region(copied, bounding_box{0.f, 0.f, 40.f, 40.f}, copied, display_point{5, 5});
+    CHECK(CompareImages(copied, expected, 0.f, 0));
+}
+
+TEST_CASE("IO2D copy_region and scroll leave copies made by copy_surface alone")
+{
+    auto image = MakeQuadrants(format::argb32);
+    auto copy = copy_surface(image);
+    image.scroll(display_point{20, 20});
+    CHECK(CompareImageColor(image, 30, 30, rgba_color::red));
+    CHECK(CompareImageColor(copy, 30, 30, rgba_color::yellow));
+}
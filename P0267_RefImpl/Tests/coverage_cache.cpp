@@ -0,0 +1,90 @@
+#include "catch.hpp"
+#include <io2d.h>
+#include "comparison.h"
+
+using namespace std;
+using namespace std::experimental;
+using namespace std::experimental::io2d;
+
+static interpreted_path MakeMarker()
+{
+    path_builder pb{};
+    pb.new_figure({0.f, 0.f});
+    pb.line({20.f, 4.f});
+    pb.cubic_curve({24.f, 20.f}, {10.f, 24.f}, {2.f, 18.f});
+    pb.close_figure();
+    return interpreted_path{pb};
+}
+
+static void DrawMarkers(image_surface& image, const interpreted_path& ip, const matrix_2d& m)
+{
+    image.paint(brush{rgba_color::white});
+    for (int y = 0; y < 4; ++y)
+        for (int x = 0; x < 6; ++x) {
+            // Quarter pixel offsets land exactly on the cache's subpixel steps, so cached and uncached fills match.
+            auto rp = render_props{antialias::good, m * matrix_2d::create_translate({x * 40.f + x * 0.25f, y * 40.f + y * 0.75f})};
+            image.fill(brush{rgba_color::teal}, ip, nullopt, rp);
+        }
+}
+
+TEST_CASE("IO2D coverage cache is off by default")
+{
+    auto image = image_surface{format::argb32, 100, 100};
+    CHECK(image.coverage_cache_limit() == 0);
+    image.fill(brush{rgba_color::teal}, MakeMarker());
+    auto stats = image.coverage_cache_statistics();
+    CHECK(stats.entries() == 0);
+    CHECK(stats.hits() == 0);
+    CHECK(stats.misses() == 0);
+}
+
+TEST_CASE("IO2D fills through the coverage cache draw the same as uncached fills")
+{
+    auto ip = MakeMarker();
+    for (auto m : { matrix_2d{}, matrix_2d::create_scale({1.5f, 0.75f}), matrix_2d::create_rotate(0.6f) }) {
+        auto expected = image_surface{format::argb32, 280, 180};
+        DrawMarkers(expected, ip, m);
+
+        auto image = image_surface{format::argb32, 280, 180};
+        image.coverage_cache_limit(1 << 20);
+        DrawMarkers(image, ip, m);
+        CHECK(image.coverage_cache_statistics().hits() > 0);
+        CHECK(CompareImages(image, expected, 0.f, 0));
+    }
+}
+
+TEST_CASE("IO2D coverage cache reports hits, misses and evictions")
+{
+    auto ip = MakeMarker();
+    auto image = image_surface{format::argb32, 200, 200};
+    image.coverage_cache_limit(1 << 20);
+    CHECK(image.coverage_cache_limit() == (1 << 20));
+
+    for (float x : { 10.f, 50.f, 90.f })
+        image.fill(brush{rgba_color::teal}, ip, nullopt, render_props{antialias::good, matrix_2d::create_translate({x, 10.f})});
+    auto stats = image.coverage_cache_statistics();
+    CHECK(stats.entries() == 1);
+    CHECK(stats.misses() == 1);
+    CHECK(stats.hits() == 2);
+    CHECK(stats.bytes() > 0);
+
+    // Each subpixel offset and each scale needs a mask of its own.
+    image.fill(brush{rgba_color::teal}, ip, nullopt, render_props{antialias::good, matrix_2d::create_translate({10.5f, 50.f})});
+    image.fill(brush{rgba_color::teal}, ip, nullopt, render_props{antialias::good, matrix_2d::create_scale({2.f, 2.f}) * matrix_2d::create_translate({10.f, 90.f})});
+    stats = image.coverage_cache_statistics();
+    CHECK(stats.entries() == 3);
+    CHECK(stats.misses() == 3);
+
+    // A limit smaller than the cached masks evicts the least recently used of them.
+    image.coverage_cache_limit(4096);
+    for (int i = 0; i < 8; ++i)
+        image.fill(brush{rgba_color::teal}, ip, nullopt, render_props{antialias::good, matrix_2d::create_translate({10.f + i * 0.25f, 10.f + (i / 4) * 0.25f})});
+    stats = image.coverage_cache_statistics();
+    CHECK(stats.bytes() <= 4096);
+    CHECK(stats.entries() < 8);
+    CHECK(stats.evictions() > 0);
+
+    image.coverage_cache_limit(0);
+    CHECK(image.coverage_cache_limit() == 0);
+    CHECK(image.coverage_cache_statistics().entries() == 0);
+}
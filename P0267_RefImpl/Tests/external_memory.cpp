@@ -0,0 +1,67 @@
+#include "catch.hpp"
+#include <io2d.h>
+#include "comparison.h"
+
+using namespace std;
+using namespace std::experimental;
+using namespace std::experimental::io2d;
+
+static interpreted_path MakeTriangle()
+{
+    path_builder pb{};
+    pb.new_figure({10.f, 5.f});
+    pb.line({70.f, 20.f});
+    pb.line({25.f, 45.f});
+    pb.close_figure();
+    return interpreted_path{pb};
+}
+
+TEST_CASE("IO2D surfaces over caller memory draw into that memory")
+{
+    const int width = 20;
+    const int height = 10;
+    const int stride = image_surface::stride_for_width(format::argb32, width) + 16;
+    vector<uint32_t> pixels(stride / 4 * height, 0x12345678u);
+    {
+        auto image = image_surface{format::argb32, width, height, reinterpret_cast<byte*>(pixels.data()), stride};
+        image.paint(brush{rgba_color::red});
+        image.flush();
+        CHECK(pixels[0] == 0xFFFF0000u);
+        CHECK(pixels[(height - 1) * stride / 4 + width - 1] == 0xFFFF0000u);
+        // The padding at the end of each row is not touched.
+        CHECK(pixels[width] == 0x12345678u);
+
+        // Changes made directly to the memory are seen once the surface is told about them.
+        pixels[5 * stride / 4 + 5] = 0xFF0000FFu;
+        image.mark_dirty();
+        CHECK(CompareImageColor(image, 5, 5, rgba_color::blue));
+    }
+    // Destroying the surface leaves the memory and its contents alone.
+    CHECK(pixels[0] == 0xFFFF0000u);
+}
+
+TEST_CASE("IO2D surfaces over caller memory draw the same as surfaces that own their pixels")
+{
+    const auto ip = MakeTriangle();
+    for (auto fmt : { format::argb32, format::xrgb32, format::a8 }) {
+        const int stride = image_surface::stride_for_width(fmt, 80);
+        vector<byte> memory(static_cast<size_t>(stride) * 50);
+        auto wrapped = image_surface{fmt, 80, 50, memory.data(), stride};
+        auto owned = image_surface{fmt, 80, 50};
+        for (auto* image : { &wrapped, &owned }) {
+            image->paint(brush{rgba_color::white});
+            image->fill(brush{rgba_color::teal}, ip);
+        }
+        CHECK(CompareImages(wrapped, owned, 0.f, 0));
+    }
+}
+
+TEST_CASE("IO2D surfaces over caller memory reject an invalid layout")
+{
+    vector<byte> memory(4096);
+    const int stride = image_surface::stride_for_width(format::argb32, 16);
+    CHECK(stride >= 16 * 4);
+    CHECK_THROWS_AS((image_surface{format::argb32, 16, 16, nullptr, stride}), system_error);
+    CHECK_THROWS_AS((image_surface{format::argb32, 16, 16, memory.data(), stride - 4}), system_error);
+    CHECK_THROWS_AS((image_surface{format::argb32, 0, 16, memory.data(), stride}), system_error);
+}
@@ -0,0 +1,62 @@
+#include "catch.hpp"
+#include <io2d.h>
+#include "comparison.h"
+#include <list>
+#include <vector>
+
+using namespace std;
+using namespace std::experimental;
+using namespace std::experimental::io2d;
+
+static interpreted_path MakeShape()
+{
+    path_builder pb{};
+    pb.new_figure({0.f, 0.f});
+    pb.line({20.f, 4.f});
+    pb.cubic_curve({24.f, 20.f}, {10.f, 24.f}, {2.f, 18.f});
+    pb.close_figure();
+    return interpreted_path{pb};
+}
+
+TEST_CASE("IO2D fill_instances draws the same as filling each instance")
+{
+    auto ip = MakeShape();
+    auto b = brush{rgba_color::teal};
+    auto rp = render_props{};
+    rp.surface_matrix(matrix_2d::create_scale({1.5f, 1.5f}));
+
+    vector<fill_instance> instances;
+    for (int y = 0; y < 5; ++y)
+        for (int x = 0; x < 6; ++x)
+            instances.emplace_back(matrix_2d::create_translate({x * 30.f, y * 30.f}));
+    instances.emplace_back(matrix_2d::create_rotate(0.7f) * matrix_2d::create_translate({100.f, 60.f}), rgba_color::orange);
+    instances.emplace_back(matrix_2d::create_translate({45.5f, 75.25f}), 0.5f);
+    instances.emplace_back(matrix_2d::create_translate({500.f, 500.f}));
+
+    auto expected = image_surface{format::argb32, 300, 240};
+    expected.paint(brush{rgba_color::white});
+    for (const auto& instance : instances) {
+        auto instanceRp = rp;
+        instanceRp.surface_matrix(instance.matrix() * rp.surface_matrix());
+        auto c = instance.color().value_or(rgba_color::teal);
+        c.a(c.a() * instance.alpha());
+        expected.fill(brush{c}, ip, nullopt, instanceRp);
+    }
+
+    auto image = image_surface{format::argb32, 300, 240};
+    image.paint(brush{rgba_color::white});
+    image.fill_instances(b, ip, instances.begin(), instances.end(), nullopt, rp);
+    CHECK(CompareImages(image, expected, 0.f, 0));
+
+    // Pointers are passed through to the backend like vector iterators; a list is copied first. Both draw the same.
+    auto fromPointers = image_surface{format::argb32, 300, 240};
+    fromPointers.paint(brush{rgba_color::white});
+    fromPointers.fill_instances(b, ip, instances.data(), instances.data() + instances.size(), nullopt, rp);
+    CHECK(CompareImages(fromPointers, expected, 0.f, 0));
+
+    const list<fill_instance> listed(instances.begin(), instances.end());
+    auto fromList = image_surface{format::argb32, 300, 240};
+    fromList.paint(brush{rgba_color::white});
+    fromList.fill_instances(b, ip, listed.begin(), listed.end(), nullopt, rp);
+    CHECK(CompareImages(fromList, expected, 0.f, 0));
+}
@@ -0,0 +1,38 @@
+#include "catch.hpp"
+#include <io2d.h>
+#include "comparison.h"
+
+using namespace std;
+using namespace std::experimental;
+using namespace std::experimental::io2d;
+
+TEST_CASE("IO2D fill_stroke draws the same as a fill followed by a stroke")
+{
+    path_builder pb{};
+    pb.new_figure({40.f, 30.f});
+    pb.line({250.f, 60.f});
+    pb.cubic_curve({200.f, 200.f}, {100.f, 100.f}, {30.f, 170.f});
+    pb.close_figure();
+    auto ip = interpreted_path{pb};
+    auto fb = brush{rgba_color::yellow};
+    auto sb = brush{rgba_color::navy};
+    auto sp = stroke_props{8.f, line_cap::round, line_join::round};
+    auto d = dashes{0.f, {30.f, 10.f}};
+    auto rp = render_props{};
+    rp.surface_matrix(matrix_2d::create_rotate(0.2f, {150.f, 100.f}));
+
+    auto expected = image_surface{format::argb32, 300, 200};
+    expected.paint(brush{rgba_color::white});
+    expected.fill(fb, ip, nullopt, rp);
+    expected.stroke(sb, ip, nullopt, sp, d, rp);
+
+    auto image = image_surface{format::argb32, 300, 200};
+    image.paint(brush{rgba_color::white});
+    image.fill_stroke(fb, sb, ip, nullopt, sp, d, rp);
+    CHECK(CompareImages(image, expected));
+
+    auto imagePb = image_surface{format::argb32, 300, 200};
+    imagePb.paint(brush{rgba_color::white});
+    imagePb.fill_stroke(fb, sb, pb, nullopt, sp, d, rp);
+    CHECK(CompareImages(imagePb, expected));
+}
@@ -0,0 +1,188 @@
+#include "catch.hpp"
+#include <io2d.h>
+
+using namespace std;
+using namespace std::experimental;
+using namespace std::experimental::io2d;
+
+static vector<point_2d> TestPoints()
+{
+    vector<point_2d> points;
+    for( int i = 0; i < 37; ++i )
+        points.emplace_back( static_cast<float>(i) * 3.5f - 40.f, 100.f - static_cast<float>(i * i) * 0.25f );
+    return points;
+}
+
+TEST_CASE("matrix_2d::transform_pts gives the same results as transforming each point")
+{
+    const auto m = matrix_2d::create_scale({2.f, -3.f}) * matrix_2d::create_rotate(0.7f) * matrix_2d::create_translate({15.f, -4.f});
+    const auto points = TestPoints();
+    
+    vector<point_2d> transformed(points.size());
+    auto end = m.transform_pts(points.data(), points.data() + points.size(), transformed.data());
+    CHECK( end == transformed.data() + transformed.size() );
+    for( size_t i = 0; i < points.size(); ++i )
+        CHECK( transformed[i] == m.transform_pt(points[i]) );
+}
+
+TEST_CASE("matrix_2d::transform_pts transforms in place and through generic iterators")
+{
+    const auto m = matrix_2d::create_shear_x(0.5f) * matrix_2d::create_translate({-1.f, 2.f});
+    const auto points = TestPoints();
+    
+    auto inPlace = points;
+    m.transform_pts(inPlace.data(), inPlace.data() + inPlace.size(), inPlace.data());
+    
+    vector<point_2d> viaIterators;
+    m.transform_pts(begin(points), end(points), back_inserter(viaIterators));
+    
+    REQUIRE( viaIterators.size() == points.size() );
+    for( size_t i = 0; i < points.size(); ++i ) {
+        CHECK( inPlace[i] == points[i] * m );
+        CHECK( viaIterators[i] == points[i] * m );
+    }
+}
+
+TEST_CASE("matrix_2d::transform_pts rounds tiny values to zero like transform_pt")
+{
+    const auto m = matrix_2d::create_rotate(half_pi<float>);
+    const point_2d points[] = { {1.f, 0.f}, {0.f, 1.f}, {-1.f, 0.f}, {0.f, -1.f}, {1e-6f, -1e-6f} };
+    point_2d transformed[5];
+    m.transform_pts(begin(points), end(points), transformed);
+    for( size_t i = 0; i < 5; ++i )
+        CHECK( transformed[i] == m.transform_pt(points[i]) );
+}
+
+TEST_CASE("unite and intersect compute the enclosing and overlapping bounding boxes")
+{
+    const bounding_box a{10.f, 20.f, 30.f, 40.f};
+    const bounding_box b{25.f, 5.f, 50.f, 20.f};
+    CHECK( unite(a, b) == bounding_box(10.f, 5.f, 65.f, 55.f) );
+    CHECK( intersect(a, b) == bounding_box(25.f, 20.f, 15.f, 5.f) );
+    
+    const bounding_box c{100.f, 100.f, 5.f, 5.f};
+    const auto none = intersect(a, c);
+    CHECK( none.width() == 0.f );
+    CHECK( none.height() == 0.f );
+}
+
+#if defined(_IO2D_Has_SSE2)
+template <class GraphicsMath>
+static basic_matrix_2d<GraphicsMath> TestMatrix()
+{
+    using m = basic_matrix_2d<GraphicsMath>;
+    return m::create_scale({2.f, -3.f}) * m::create_rotate(0.7f, {3.f, 4.f}) * m::create_shear_x(0.25f) * m::create_translate({15.f, -4.f});
+}
+
+template <class GraphicsMath>
+static void CheckPointForAngle()
+{
+    using point = basic_point_2d<GraphicsMath>;
+    CHECK( point_for_angle<GraphicsMath>(0.f, 2.f) == point(2.f, 0.f) );
+    CHECK( point_for_angle<GraphicsMath>(half_pi<float>) == point(0.f, -1.f) );
+    CHECK( point_for_angle<GraphicsMath>(half_pi<float>, point(3.f, 2.f)) == point(0.f, -2.f) );
+}
+
+TEST_CASE("point_for_angle rounds each coordinate from itself")
+{
+    CheckPointForAngle<_Graphics_math_float_impl>();
+    CheckPointForAngle<_Graphics_math_simd_impl>();
+}
+
+TEST_CASE("_Graphics_math_simd_impl gives the same results as _Graphics_math_float_impl")
+{
+    using simd_point = basic_point_2d<_Graphics_math_simd_impl>;
+    using simd_box = basic_bounding_box<_Graphics_math_simd_impl>;
+    const auto fm = TestMatrix<_Graphics_math_float_impl>();
+    const auto sm = TestMatrix<_Graphics_math_simd_impl>();
+    CHECK( fm.m00() == sm.m00() );
+    CHECK( fm.m01() == sm.m01() );
+    CHECK( fm.m10() == sm.m10() );
+    CHECK( fm.m11() == sm.m11() );
+    CHECK( fm.m20() == sm.m20() );
+    CHECK( fm.m21() == sm.m21() );
+    CHECK( sm == TestMatrix<_Graphics_math_simd_impl>() );
+    CHECK( sm != sm.inverse() );
+    
+    vector<simd_point> simdPoints;
+    for( auto &pt: TestPoints() )
+        simdPoints.emplace_back(pt.x(), pt.y());
+    vector<simd_point> simdTransformed(simdPoints.size());
+    sm.transform_pts(simdPoints.data(), simdPoints.data() + simdPoints.size(), simdTransformed.data());
+    const auto points = TestPoints();
+    for( size_t i = 0; i < points.size(); ++i ) {
+        const auto expected = points[i] * fm;
+        CHECK( (simdPoints[i] * sm).x() == expected.x() );
+        CHECK( (simdPoints[i] * sm).y() == expected.y() );
+        CHECK( simdTransformed[i].x() == expected.x() );
+        CHECK( simdTransformed[i].y() == expected.y() );
+        if( points[i] != point_2d{} ) {
+            CHECK( simdPoints[i].to_unit().x() == points[i].to_unit().x() );
+            CHECK( simdPoints[i].to_unit().y() == points[i].to_unit().y() );
+        }
+    }
+    
+    const simd_box a{10.f, 20.f, 30.f, 40.f};
+    const simd_box b{25.f, 5.f, 50.f, 20.f};
+    CHECK( unite(a, b) == simd_box(10.f, 5.f, 65.f, 55.f) );
+    CHECK( intersect(a, b) == simd_box(25.f, 20.f, 15.f, 5.f) );
+    CHECK( intersect(a, simd_box{100.f, 100.f, 5.f, 5.f}).width() == 0.f );
+}
+#endif
+
+TEST_CASE("graphics math operations can be evaluated at compile time")
+{
+    constexpr auto m = matrix_2d::create_translate({3.f, 4.f}) * matrix_2d::create_scale({2.f, 2.f});
+    constexpr auto pt = point_2d{1.f, 1.f} * m;
+    static_assert( pt == point_2d{8.f, 10.f} );
+    static_assert( m.inverse().transform_pt(pt) == point_2d{1.f, 1.f} );
+    static_assert( m.is_invertible() && m.determinant() == 4.f );
+    static_assert( (pt - point_2d{8.f, 0.f}).dot({0.f, 1.f}) == 10.f );
+    
+    constexpr bounding_box bb{point_2d{0.f, 0.f}, pt};
+    static_assert( bb.bottom_right() == pt );
+    static_assert( unite(bb, bounding_box{-2.f, 1.f, 1.f, 1.f}) == bounding_box{-2.f, 0.f, 10.f, 10.f} );
+    static_assert( intersect(bb, bounding_box{4.f, 5.f, 10.f, 10.f}) == bounding_box{4.f, 5.f, 4.f, 5.f} );
+    
+    constexpr circle c{pt, 5.f};
+    static_assert( c.center() == pt && c.radius() == 5.f );
+    CHECK( m.transform_pt({1.f, 1.f}) == pt );
+}
+
+TEST_CASE("static_path resolves figure items at compile time")
+{
+    using segment_type = static_path<16>::segment_type;
+    constexpr auto sp = [] {
+        static_path<16> p;
+        p.matrix(matrix_2d::create_translate({10.f, 20.f}));
+        p.new_figure({0.f, 0.f});
+        p.rel_line({4.f, 0.f});
+        p.rel_line({0.f, 0.f}); // degenerate, dropped
+        p.quadratic_curve({4.f, 3.f}, {0.f, 3.f});
+        p.close_figure();
+        p.revert_matrix();
+        p.rel_new_figure({1.f, 1.f});
+        p.rel_cubic_curve({1.f, 0.f}, {0.f, 1.f}, {-1.f, 0.f});
+        p.close_figure();
+        return p;
+    }();
+    static_assert( sp.size() == 9 );
+    static_assert( sp[0].type == segment_type::new_figure && sp[0].pts[0] == point_2d{10.f, 20.f} );
+    static_assert( sp[1].type == segment_type::line && sp[1].pts[0] == point_2d{14.f, 20.f} );
+    static_assert( sp[2].type == segment_type::cubic_curve && sp[2].pts[2] == point_2d{10.f, 23.f} );
+    static_assert( sp[3].type == segment_type::close_figure );
+    static_assert( sp[4].type == segment_type::new_figure && sp[4].pts[0] == point_2d{10.f, 20.f} );
+    static_assert( sp[5].type == segment_type::new_figure && sp[5].pts[0] == point_2d{11.f, 21.f} );
+    static_assert( sp[6].type == segment_type::cubic_curve && sp[6].pts[0] == point_2d{12.f, 21.f} && sp[6].pts[1] == point_2d{12.f, 22.f} && sp[6].pts[2] == point_2d{11.f, 22.f} );
+    static_assert( sp[7].type == segment_type::close_figure );
+    
+    // The quadratic curve is converted to a cubic curve the same way interpretation does.
+    const point_2d begin{14.f, 20.f}, control{14.f, 23.f}, end{10.f, 23.f};
+    CHECK( sp[2].pts[0] == (control - begin) * (2.f / 3.f) + begin );
+    CHECK( sp[2].pts[1] == (control - end) * (2.f / 3.f) + end );
+    
+    static_path<1> full;
+    full.new_figure({0.f, 0.f});
+    CHECK_THROWS_AS( full.line({1.f, 1.f}), length_error );
+    CHECK( full.size() == 1 );
+}
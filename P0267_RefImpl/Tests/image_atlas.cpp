@@ -0,0 +1,63 @@
+#include "catch.hpp"
+#include <io2d.h>
+#include "comparison.h"
+#include <vector>
+
+using namespace std;
+using namespace std::experimental;
+using namespace std::experimental::io2d;
+
+static image_surface MakeImage(int index)
+{
+    const int width = 8 + (index * 7) % 41;
+    const int height = 6 + (index * 13) % 37;
+    auto img = image_surface{format::argb32, width, height};
+    auto b = brush{point_2d{0.f, 0.f}, point_2d{float(width), float(height)},
+                   {gradient_stop{0.f, rgba_color{index * 17 % 256, 40, 200, 255}},
+                    gradient_stop{1.f, rgba_color{30, index * 29 % 256, 90, 128}}}};
+    img.paint(b);
+    return img;
+}
+
+TEST_CASE("IO2D atlas sprites draw the same as the images they were built from")
+{
+    const int count = 40;
+    auto builder = atlas_builder{display_point{128, 128}};
+    for (int i = 0; i < count; ++i)
+        CHECK(builder.add(MakeImage(i)) == size_t(i));
+    auto atlas = builder.build();
+    REQUIRE(atlas.size() == size_t(count));
+    CHECK(atlas.page_count() >= 2);
+    CHECK(builder.size() == 0);
+
+    for (int i = 0; i < count; ++i) {
+        const auto& sprite = atlas.sprite(size_t(i));
+        auto original = MakeImage(i);
+        CHECK(sprite.dimensions() == original.dimensions());
+        for (int j = 0; j < i; ++j) {
+            const auto& other = atlas.sprite(size_t(j));
+            if (other.page() == sprite.page()) {
+                auto overlap = intersect(other.bounds(), sprite.bounds());
+                CHECK((overlap.width() <= 0.f || overlap.height() <= 0.f));
+            }
+        }
+    }
+
+    for (auto wrap : {wrap_mode::none, wrap_mode::repeat, wrap_mode::pad}) {
+        for (int i : {0, 11, 27, 39}) {
+            auto bp = brush_props{wrap, filter::bilinear, fill_rule::winding, matrix_2d::create_scale({0.7f, 0.7f}) * matrix_2d::create_translate({-20.f, -15.f})};
+            auto expected = image_surface{format::argb32, 120, 100};
+            expected.paint(brush{MakeImage(i)}, bp);
+            auto image = image_surface{format::argb32, 120, 100};
+            image.paint(atlas.sprite(size_t(i)).brush(), bp);
+            CHECK(CompareImages(image, expected));
+        }
+    }
+}
+
+TEST_CASE("IO2D atlas_builder rejects images larger than a page")
+{
+    auto builder = atlas_builder{display_point{32, 32}};
+    CHECK_THROWS_AS(builder.add(image_surface{format::argb32, 33, 8}), system_error);
+    CHECK_NOTHROW(builder.add(image_surface{format::argb32, 32, 32}));
+}
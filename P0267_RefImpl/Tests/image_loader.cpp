@@ -0,0 +1,87 @@
+#include "catch.hpp"
+#include <io2d.h>
+#include "comparison.h"
+#include <atomic>
+#include <fstream>
+#include <iterator>
+
+using namespace std;
+using namespace std::experimental;
+using namespace std::experimental::io2d;
+
+static vector<byte> ReadBytes(const char* name)
+{
+    ifstream ifs(name, ifstream::binary);
+    vector<char> chars((istreambuf_iterator<char>(ifs)), istreambuf_iterator<char>());
+    vector<byte> bytes(chars.size());
+    transform(chars.begin(), chars.end(), bytes.begin(), [](char c) { return static_cast<byte>(c); });
+    return bytes;
+}
+
+TEST_CASE("IO2D images decoded from memory match images read from files")
+{
+    const auto bytes = ReadBytes("image_500x375.png");
+    REQUIRE(!bytes.empty());
+    auto fromMemory = image_surface{bytes.data(), bytes.size(), image_file_format::png, format::argb32};
+    auto fromFile = image_surface{"image_500x375.png", image_file_format::png, format::argb32};
+    CHECK(CompareImages(fromMemory, fromFile, 0.f, 0));
+
+    error_code ec;
+    auto broken = image_surface{bytes.data(), bytes.size() / 10, image_file_format::png, format::argb32, ec};
+    CHECK(ec);
+}
+
+TEST_CASE("IO2D image loaders decode many images at once")
+{
+    auto reference = image_surface{"image_500x375.png", image_file_format::png, format::argb32};
+    auto loader = image_loader{3};
+    CHECK(loader.decode_threads() == 3);
+
+    auto futures = loader.load(vector<string>(12, "image_500x375.png"), image_file_format::png, format::argb32);
+    futures.push_back(loader.load(ReadBytes("image_500x375.png"), image_file_format::png, format::argb32));
+    for (auto& future : futures) {
+        auto image = future.get();
+        CHECK(CompareImages(image, reference, 0.f, 0));
+    }
+
+    auto missing = loader.load(string("no_such_image.png"), image_file_format::png, format::argb32);
+    CHECK_THROWS_AS(missing.get(), system_error);
+}
+
+TEST_CASE("IO2D image loaders call back once every requested image is ready")
+{
+    atomic<int> loaded{0};
+    atomic<int> failed{0};
+    {
+        auto loader = image_loader{2};
+        for (int i = 0; i < 6; ++i) {
+            loader.load(string(i % 3 == 2 ? "no_such_image.png" : "image_500x375.jpg"), image_file_format::jpeg, format::xrgb32, [&](future<image_surface> result) {
+                try {
+                    auto image = result.get();
+                    if (image.dimensions() == display_point{500, 375}) {
+                        ++loaded;
+                    }
+                }
+                catch (const system_error&) {
+                    ++failed;
+                }
+            });
+        }
+        // Destroying the loader waits for the loads it was given.
+    }
+    CHECK(loaded == 4);
+    CHECK(failed == 2);
+}
+
+TEST_CASE("IO2D moved-from image loaders refuse loads until assigned")
+{
+    auto loader = image_loader{1};
+    auto other = move(loader);
+    CHECK(other.decode_threads() == 1);
+    CHECK(loader.decode_threads() == 0);
+    CHECK_THROWS_AS(loader.load(string("image_500x375.png"), image_file_format::png, format::argb32), system_error);
+
+    loader = image_loader{2};
+    CHECK(loader.decode_threads() == 2);
+    CHECK(loader.load(string("image_500x375.png"), image_file_format::png, format::argb32).get().dimensions() == display_point{500, 375});
+}
@@ -0,0 +1,54 @@
+#include "catch.hpp"
+#include <io2d.h>
+#include "comparison.h"
+
+using namespace std;
+using namespace std::experimental;
+using namespace std::experimental::io2d;
+
+TEST_CASE("IO2D pixels written through map_pixels show up in the surface")
+{
+    auto image = image_surface{format::argb32, 64, 32};
+    image.paint(brush{rgba_color::white});
+    {
+        auto pixels = image.map_pixels();
+        CHECK(pixels.format() == format::argb32);
+        CHECK(pixels.dimensions() == display_point{64, 32});
+        CHECK(pixels.stride() >= 64 * 4);
+        CHECK(*pixels.row(0) == 0xFFFFFFFFu);
+        // Left half opaque red, right half opaque blue.
+        for (int y = 0; y < 32; ++y) {
+            auto row = pixels.row(y);
+            fill(row, row + 32, 0xFFFF0000u);
+            fill(row + 32, row + 64, 0xFF0000FFu);
+        }
+    }
+    CHECK(CompareImageColor(image, 10, 10, rgba_color::red));
+    CHECK(CompareImageColor(image, 50, 20, rgba_color::blue));
+
+    // Drawing after commit() sees the pixels written so far.
+    auto pixels = image.map_pixels(bounding_box{0.f, 0.f, 64.f, 16.f});
+    fill(pixels.row(4), pixels.row(4) + 64, 0xFF00FF00u);
+    pixels.commit();
+    auto target = image_surface{format::argb32, 64, 32};
+    target.paint(brush{image});
+    CHECK(CompareImageColor(target, 40, 4, rgba_color::lime));
+    CHECK(CompareImageColor(target, 40, 5, rgba_color::blue));
+}
+
+TEST_CASE("IO2D map_pixels gives a copy made by copy_surface its own pixels")
+{
+    auto original = image_surface{format::a8, 16, 16};
+    original.paint(brush{rgba_color::black});
+    auto copy = copy_surface(original);
+    {
+        auto pixels = copy.map_pixels();
+        for (int y = 0; y < 16; ++y) {
+            fill(pixels.row<uint8_t>(y), pixels.row<uint8_t>(y) + 16, uint8_t{0});
+        }
+    }
+    auto originalPixels = original.map_pixels();
+    CHECK(originalPixels.row<uint8_t>(8)[8] == 0xFF);
+    auto copyPixels = copy.map_pixels();
+    CHECK(copyPixels.row<uint8_t>(8)[8] == 0);
+}
@@ -0,0 +1,77 @@
+#include "catch.hpp"
+#include <io2d.h>
+#include "comparison.h"
+#include <cstdio>
+#include <fstream>
+
+using namespace std;
+using namespace std::experimental;
+using namespace std::experimental::io2d;
+
+static const auto g_MAPPEDFN = "mapped_surface.io2draw";
+
+static void DrawScene(image_surface& image)
+{
+    path_builder pb{};
+    pb.new_figure({10.f, 10.f});
+    pb.line({110.f, 30.f});
+    pb.line({40.f, 70.f});
+    pb.close_figure();
+    image.paint(brush{rgba_color::white});
+    image.fill(brush{rgba_color::crimson}, interpreted_path{pb});
+}
+
+TEST_CASE("IO2D mapped surfaces keep their pixels in the file")
+{
+    auto expected = image_surface{format::argb32, 120, 80};
+    DrawScene(expected);
+    {
+        auto mapped = image_surface::create_mapped(g_MAPPEDFN, format::argb32, 120, 80);
+        CHECK(mapped.dimensions().x() == 120);
+        CHECK(mapped.format() == format::argb32);
+        CHECK(CompareImageColor(mapped, 60, 40, rgba_color::transparent_black));
+        DrawScene(mapped);
+        mapped.flush();
+    }
+    {
+        auto reopened = image_surface::open_mapped(g_MAPPEDFN);
+        CHECK(reopened.dimensions().y() == 80);
+        CHECK(CompareImages(reopened, expected, 0.f, 0));
+    }
+
+    // A reopened file can be drawn from as a brush without decoding.
+    auto target = image_surface{format::argb32, 120, 80};
+    target.paint(brush{image_surface::open_mapped(g_MAPPEDFN, mapped_file_mode::read_only)});
+    CHECK(CompareImages(target, expected, 0.f, 0));
+    remove(g_MAPPEDFN);
+}
+
+TEST_CASE("IO2D read only mapped surfaces never change their file")
+{
+    {
+        auto mapped = image_surface::create_mapped(g_MAPPEDFN, format::a8, 33, 17);
+        mapped.paint(brush{rgba_color::black});
+    }
+    {
+        auto readOnly = image_surface::open_mapped(g_MAPPEDFN, mapped_file_mode::read_only);
+        CHECK(readOnly.format() == format::a8);
+        readOnly.paint(brush{rgba_color::transparent_black}, nullopt, render_props{antialias::none, matrix_2d{}, compositing_op::clear});
+        readOnly.flush();
+        CHECK(CompareImageColor(readOnly, 5, 5, rgba_color::transparent_black));
+    }
+    auto reopened = image_surface::open_mapped(g_MAPPEDFN, mapped_file_mode::read_only);
+    CHECK(CompareImageColor(reopened, 5, 5, rgba_color::black));
+    remove(g_MAPPEDFN);
+}
+
+TEST_CASE("IO2D opening a file that is not a mapped surface throws")
+{
+    {
+        ofstream ofs(g_MAPPEDFN, ofstream::binary);
+        ofs << "This is not an image surface, although it is long enough to hold a header.........";
+    }
+    CHECK_THROWS_AS(image_surface::open_mapped(g_MAPPEDFN), system_error);
+    remove(g_MAPPEDFN);
+    CHECK_THROWS_AS(image_surface::open_mapped(g_MAPPEDFN), system_error);
+    CHECK_THROWS_AS(image_surface::create_mapped(g_MAPPEDFN, format::argb32, 0, 10), system_error);
+}
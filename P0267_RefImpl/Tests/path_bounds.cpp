@@ -0,0 +1,77 @@
+#include "catch.hpp"
+#include <io2d.h>
+#include "comparison.h"
+
+using namespace std;
+using namespace std::experimental;
+using namespace std::experimental::io2d;
+
+TEST_CASE("interpreted_path reports tight bounds")
+{
+    SECTION("Circle") {
+        path_builder pb{};
+        pb.new_figure({100.f, 50.f});
+        pb.arc({50.f, 50.f}, two_pi<float>, 0.f);
+        pb.close_figure();
+        auto b = interpreted_path{pb}.bounds();
+        CHECK(b.x() == Approx(0.f).margin(0.01f));
+        CHECK(b.y() == Approx(0.f).margin(0.01f));
+        CHECK(b.width() == Approx(100.f).margin(0.01f));
+        CHECK(b.height() == Approx(100.f).margin(0.01f));
+    }
+
+    SECTION("Cubic curve bounds exclude its control points") {
+        path_builder pb{};
+        pb.new_figure({0.f, 0.f});
+        pb.cubic_curve({0.f, 100.f}, {100.f, 100.f}, {100.f, 0.f});
+        auto b = interpreted_path{pb}.bounds();
+        CHECK(b.height() == Approx(75.f));
+    }
+
+    SECTION("Empty path") {
+        auto b = interpreted_path{}.bounds();
+        CHECK(b.width() == 0.f);
+        CHECK(b.height() == 0.f);
+    }
+}
+
+TEST_CASE("IO2D skips draws that lie outside the surface or clip")
+{
+    auto b = brush{rgba_color::blue};
+    auto image = image_surface{format::argb32, 100, 100};
+    image.paint(brush{rgba_color::white});
+    auto inside = interpreted_path{bounding_box{10.f, 10.f, 20.f, 20.f}};
+    auto outside = interpreted_path{bounding_box{150.f, 10.f, 20.f, 20.f}};
+
+    SECTION("Geometry outside the surface changes nothing") {
+        image.fill(b, outside);
+        image.stroke(b, outside);
+        CHECK(CompareImageColor(image, 99, 20, rgba_color::white));
+    }
+
+    SECTION("A stroke reaching into the surface from outside is drawn") {
+        auto sp = stroke_props{110.f};
+        image.stroke(b, outside, nullopt, sp);
+        CHECK(CompareImageColor(image, 99, 20, rgba_color::blue));
+    }
+
+    SECTION("The surface matrix is applied before culling") {
+        auto rp = render_props{};
+        rp.surface_matrix(matrix_2d::create_translate({-100.f, 0.f}));
+        image.fill(b, outside, nullopt, rp);
+        CHECK(CompareImageColor(image, 60, 20, rgba_color::blue));
+    }
+
+    SECTION("Geometry outside the clip changes nothing") {
+        auto cl = clip_props{bounding_box{50.f, 50.f, 50.f, 50.f}};
+        image.fill(b, inside, nullopt, nullopt, cl);
+        CHECK(CompareImageColor(image, 20, 20, rgba_color::white));
+    }
+
+    SECTION("Unbounded operators still affect the surface") {
+        auto rp = render_props{};
+        rp.compositing(compositing_op::in);
+        image.fill(b, outside, nullopt, rp);
+        CHECK_FALSE(CompareImageColor(image, 20, 20, rgba_color::white));
+    }
+}
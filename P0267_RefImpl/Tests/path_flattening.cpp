@@ -0,0 +1,64 @@
+#include "catch.hpp"
+#include <io2d.h>
+#include "comparison.h"
+
+using namespace std;
+using namespace std::experimental;
+using namespace std::experimental::io2d;
+
+static interpreted_path BuildCurvedPath()
+{
+    path_builder pb{};
+    pb.new_figure({150.f, 20.f});
+    pb.arc({80.f, 80.f}, two_pi<float>, half_pi<float>);
+    pb.close_figure();
+    pb.new_figure({20.f, 180.f});
+    pb.cubic_curve({100.f, 100.f}, {200.f, 260.f}, {280.f, 180.f});
+    pb.close_figure();
+    return interpreted_path{pb};
+}
+
+TEST_CASE("IO2D fills a flattened path like the curved path it was made from")
+{
+    auto curved = BuildCurvedPath();
+    auto b = brush{rgba_color::blue};
+    auto expected = image_surface{format::argb32, 300, 200};
+    expected.paint(brush{rgba_color::white});
+    expected.fill(b, curved);
+
+    auto rp = render_props{};
+    rp.surface_matrix(matrix_2d::create_scale({0.5f, 0.5f}) * matrix_2d::create_translate({75.f, 50.f}));
+    auto expectedScaled = image_surface{format::argb32, 300, 200};
+    expectedScaled.paint(brush{rgba_color::white});
+    expectedScaled.fill(b, curved, nullopt, rp);
+
+    SECTION("Identity transform") {
+        auto image = image_surface{format::argb32, 300, 200};
+        image.paint(brush{rgba_color::white});
+        image.fill(b, curved.flatten(0.1f));
+        CHECK(CompareImages(image, expected, 0.05f, 1));
+    }
+
+    SECTION("Flattened for the surface matrix it is drawn with") {
+        auto image = image_surface{format::argb32, 300, 200};
+        image.paint(brush{rgba_color::white});
+        image.fill(b, curved.flatten(0.1f, rp.surface_matrix()), nullopt, rp);
+        CHECK(CompareImages(image, expectedScaled, 0.05f, 1));
+    }
+
+    SECTION("Repeated flattening reuses the cached result") {
+        auto first = curved.flatten(0.25f);
+        auto second = curved.flatten(0.25f);
+        // Both backends hand out the cached flattened path itself, so a hit shares it.
+        CHECK(first.data().path == second.data().path);
+        CHECK(curved.flatten(0.5f).data().path != first.data().path);
+        // Copies of the path share its cache.
+        const auto copy = curved;
+        CHECK(copy.flatten(0.25f).data().path == first.data().path);
+        auto image1 = image_surface{format::argb32, 300, 200};
+        auto image2 = image_surface{format::argb32, 300, 200};
+        image1.fill(b, first);
+        image2.fill(b, second);
+        CHECK(CompareImages(image1, image2));
+    }
+}
@@ -0,0 +1,98 @@
+#include "catch.hpp"
+#include <io2d.h>
+#include "comparison.h"
+
+using namespace std;
+using namespace std::experimental;
+using namespace std::experimental::io2d;
+
+static const auto RectBrushes = { brush{rgba_color::teal}, brush{ {0.f, 0.f}, {160.f, 0.f}, { gradient_stop{0.f, rgba_color::red}, gradient_stop{1.f, rgba_color::blue} } } };
+
+static bool OnWholePixels(const bounding_box& bb)
+{
+    return floor(bb.x()) == bb.x() && floor(bb.y()) == bb.y() && floor(bb.width()) == bb.width() && floor(bb.height()) == bb.height();
+}
+
+TEST_CASE("IO2D fill_rect draws the same as filling the rectangle's path")
+{
+    for (const auto& b : RectBrushes)
+        for (auto bb : { bounding_box{20.f, 30.f, 100.f, 60.f}, bounding_box{20.5f, 30.25f, 99.5f, 60.f}, bounding_box{-10.f, -10.f, 400.f, 400.f} })
+            for (auto m : { matrix_2d{}, matrix_2d::create_translate({3.f, 4.f}), matrix_2d::create_rotate(0.4f, {80.f, 60.f}) }) {
+                const bool rotated = m.m01() != 0.f;
+                const auto rp = render_props{antialias::good, m};
+                auto image = image_surface{format::argb32, 160, 120};
+                image.paint(brush{rgba_color::white});
+                image.fill_rect(b, bb, nullopt, rp);
+
+                auto expected = image_surface{format::argb32, 160, 120};
+                expected.paint(brush{rgba_color::white});
+                expected.fill(b, interpreted_path{bb}, nullopt, rp);
+                // Solid rectangles on whole pixels are written directly and must match the rasterizer exactly.
+                if (b.type() == brush_type::solid_color && OnWholePixels(bb) && !rotated) {
+                    CHECK(CompareImages(image, expected, 0.f, 0));
+                }
+                else {
+                    CHECK(CompareImages(image, expected, 0.05f, 1));
+                }
+            }
+}
+
+TEST_CASE("IO2D fill_rect honours clips and operators on aligned rectangles")
+{
+    const auto bb = bounding_box{10.f, 10.f, 80.f, 60.f};
+    const auto translucent = brush{rgba_color{0.2f, 0.4f, 0.6f, 0.5f}};
+    for (auto clipRect : { bounding_box{40.f, 20.f, 100.f, 30.f}, bounding_box{40.5f, 20.5f, 100.f, 30.f} })
+        for (auto op : { compositing_op::over, compositing_op::source }) {
+            const auto cl = clip_props{clipRect};
+            const auto rp = render_props{antialias::good, matrix_2d{}, op};
+            for (auto fmt : { format::argb32, format::xrgb32, format::a8 }) {
+                auto image = image_surface{fmt, 120, 100};
+                image.paint(brush{rgba_color::white});
+                image.fill_rect(translucent, bb, nullopt, rp, cl);
+
+                auto expected = image_surface{fmt, 120, 100};
+                expected.paint(brush{rgba_color::white});
+                expected.fill(translucent, interpreted_path{bb}, nullopt, rp, cl);
+                if (OnWholePixels(clipRect)) {
+                    CHECK(CompareImages(image, expected, 0.f, 0));
+                }
+                else {
+                    CHECK(CompareImages(image, expected, 0.05f, 1));
+                }
+            }
+        }
+}
+
+TEST_CASE("IO2D stroke_rect draws the same as stroking the rectangle's path")
+{
+    for (const auto& b : RectBrushes)
+        for (auto bb : { bounding_box{20.f, 30.f, 100.f, 60.f}, bounding_box{20.5f, 30.5f, 99.f, 59.f} }) {
+            auto image = image_surface{format::argb32, 160, 120};
+            image.paint(brush{rgba_color::white});
+            image.stroke_rect(b, bb, nullopt, stroke_props{5.f});
+
+            auto expected = image_surface{format::argb32, 160, 120};
+            expected.paint(brush{rgba_color::white});
+            expected.stroke(b, interpreted_path{bb}, nullopt, stroke_props{5.f});
+            CHECK(CompareImages(image, expected, 0.05f, 1));
+        }
+}
+
+TEST_CASE("IO2D fill_circle draws the same as filling the circle's path")
+{
+    for (const auto& b : RectBrushes)
+        for (auto c : { circle{{80.f, 60.f}, 40.f}, circle{{80.25f, 59.5f}, 12.5f} }) {
+            auto image = image_surface{format::argb32, 160, 120};
+            image.paint(brush{rgba_color::white});
+            image.fill_circle(b, c);
+
+            path_builder pb{};
+            pb.new_figure({c.center().x() + c.radius(), c.center().y()});
+            pb.arc({c.radius(), c.radius()}, two_pi<float>, 0.f);
+            pb.close_figure();
+            auto expected = image_surface{format::argb32, 160, 120};
+            expected.paint(brush{rgba_color::white});
+            expected.fill(b, interpreted_path{pb});
+            CHECK(CompareImages(image, expected, 0.05f, 1));
+        }
+}
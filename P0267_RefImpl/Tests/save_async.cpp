@@ -0,0 +1,50 @@
+#include "catch.hpp"
+#include <io2d.h>
+#include "comparison.h"
+#include <cstdio>
+
+using namespace std;
+using namespace std::experimental;
+using namespace std::experimental::io2d;
+
+static void DrawFrame(image_surface& image, int frame)
+{
+    image.paint(brush{rgba_color::white});
+    image.fill_circle(brush{rgba_color::navy}, circle{{20.f + frame * 30.f, 40.f}, 15.f});
+}
+
+TEST_CASE("IO2D save_async saves the pixels the surface had when it was called")
+{
+    auto image = image_surface{format::argb32, 160, 80};
+    auto expected = image_surface{format::argb32, 160, 80};
+    DrawFrame(expected, 0);
+
+    vector<future<void>> saves;
+    vector<string> names;
+    for (int frame = 0; frame < 4; ++frame) {
+        DrawFrame(image, frame);
+        names.push_back("save_async_" + to_string(frame) + ".png");
+        saves.push_back(image.save_async(names.back(), image_file_format::png));
+    }
+    // Drawing after the call does not reach the saved copy.
+    image.paint(brush{rgba_color::red});
+    for (auto& save : saves) {
+        CHECK_NOTHROW(save.get());
+    }
+
+    auto first = image_surface{names.front(), image_file_format::png, format::argb32};
+    CHECK(CompareImages(first, expected, 0.01f, 0));
+    auto last = image_surface{names.back(), image_file_format::png, format::argb32};
+    CHECK(CompareImageColor(last, 110, 40, rgba_color::navy));
+    CHECK(CompareImageColor(last, 20, 40, rgba_color::white));
+    for (const auto& name : names) {
+        remove(name.c_str());
+    }
+}
+
+TEST_CASE("IO2D save_async reports errors through its future")
+{
+    auto image = image_surface{format::argb32, 16, 16};
+    auto save = image.save_async("save_async_unknown.img", image_file_format::unknown);
+    CHECK_THROWS_AS(save.get(), system_error);
+}
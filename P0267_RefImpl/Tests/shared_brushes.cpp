@@ -0,0 +1,71 @@
+#include "catch.hpp"
+#include <io2d.h>
+#include "comparison.h"
+#include <thread>
+#include <vector>
+
+using namespace std;
+using namespace std::experimental;
+using namespace std::experimental::io2d;
+
+static image_surface MakeTexture()
+{
+    auto img = image_surface{format::argb32, 40, 30};
+    img.paint(brush{point_2d{0.f, 0.f}, point_2d{40.f, 30.f}, {gradient_stop{0.f, rgba_color::orange}, gradient_stop{1.f, rgba_color::blue}}});
+    return img;
+}
+
+TEST_CASE("IO2D surface brush can be made from an image without consuming it")
+{
+    auto img = MakeTexture();
+    auto shared = brush{img};
+    CHECK(shared.type() == brush_type::surface);
+
+    auto bp = brush_props{wrap_mode::repeat, filter::bilinear, fill_rule::winding, matrix_2d::create_rotate(0.3f)};
+    auto expected = image_surface{format::argb32, 120, 100};
+    expected.paint(brush{MakeTexture()}, bp);
+    auto image = image_surface{format::argb32, 120, 100};
+    image.paint(shared, bp);
+    CHECK(CompareImages(image, expected));
+
+    img.paint(brush{rgba_color::red});
+    CHECK(img.dimensions() == display_point{40, 30});
+}
+
+TEST_CASE("IO2D brushes can be drawn with different brush props from several threads at once")
+{
+    const vector<brush> brushes = {
+        brush{MakeTexture()},
+        brush{point_2d{0.f, 0.f}, point_2d{60.f, 0.f}, {gradient_stop{0.f, rgba_color::white}, gradient_stop{1.f, rgba_color::green}}}
+    };
+    const vector<brush_props> props = {
+        brush_props{wrap_mode::repeat, filter::nearest, fill_rule::winding, matrix_2d::create_scale({0.5f, 0.5f})},
+        brush_props{wrap_mode::reflect, filter::bilinear, fill_rule::winding, matrix_2d::create_rotate(0.8f)},
+        brush_props{wrap_mode::pad, filter::good, fill_rule::winding, matrix_2d::create_translate({-30.f, -10.f})},
+        brush_props{wrap_mode::none, filter::fast, fill_rule::winding, matrix_2d::create_translate({15.f, 5.f})}
+    };
+
+    for (const auto& b : brushes) {
+        vector<image_surface> expected;
+        for (const auto& bp : props) {
+            expected.emplace_back(format::argb32, 120, 100);
+            expected.back().paint(b, bp);
+        }
+
+        vector<image_surface> images;
+        for (size_t i = 0; i < props.size(); ++i)
+            images.emplace_back(format::argb32, 120, 100);
+        vector<thread> threads;
+        for (size_t i = 0; i < props.size(); ++i) {
+            threads.emplace_back([&, i] {
+                for (int n = 0; n < 50; ++n)
+                    images[i].paint(b, props[i]);
+            });
+        }
+        for (auto& t : threads)
+            t.join();
+
+        for (size_t i = 0; i < props.size(); ++i)
+            CHECK(CompareImages(images[i], expected[i]));
+    }
+}
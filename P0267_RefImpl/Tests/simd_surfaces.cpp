@@ -0,0 +1,78 @@
+#include "catch.hpp"
+#include <io2d.h>
+#include <cstdint>
+
+using namespace std;
+using namespace std::experimental;
+using namespace std::experimental::io2d;
+
+// _Graphics_math_simd_impl is a drop-in GraphicsMath for the cairo backend, so this test only exists when cairo is the default backend.
+#ifdef _XCAIRO_
+
+template <class GraphicsSurfaces>
+static basic_image_surface<GraphicsSurfaces> DrawScene()
+{
+    using math = typename GraphicsSurfaces::graphics_math_type;
+    using point = basic_point_2d<math>;
+    using matrix = basic_matrix_2d<math>;
+    using brush_type = basic_brush<GraphicsSurfaces>;
+
+    auto image = basic_image_surface<GraphicsSurfaces>{format::argb32, 160, 120};
+    image.paint(brush_type{rgba_color::white});
+
+    basic_path_builder<GraphicsSurfaces> pb{};
+    pb.new_figure(point{20.f, 20.f});
+    pb.line(point{70.f, 15.f});
+    pb.quadratic_curve(point{90.f, 40.f}, point{75.f, 60.f});
+    pb.cubic_curve(point{60.f, 80.f}, point{30.f, 70.f}, point{25.f, 50.f});
+    pb.arc(point{12.f, 8.f}, half_pi<float>, pi<float>);
+    pb.close_figure();
+    pb.new_figure(point{110.f, 30.f});
+    pb.rel_line(point{30.f, 10.f});
+    pb.rel_cubic_curve(point{5.f, 20.f}, point{-20.f, 30.f}, point{-35.f, 15.f});
+    pb.close_figure();
+    const auto ip = basic_interpreted_path<GraphicsSurfaces>{pb};
+
+    const auto rotated = matrix::create_rotate(0.3f, point{80.f, 60.f}) * matrix::create_scale(point{1.1f, 0.9f});
+    const auto linear = brush_type{point{0.f, 0.f}, point{160.f, 120.f}, {gradient_stop{0.f, rgba_color::navy}, gradient_stop{1.f, rgba_color::orange}}};
+    image.fill(linear, ip, nullopt, basic_render_props<GraphicsSurfaces>{antialias::good, rotated});
+
+    const auto dash = basic_dashes<GraphicsSurfaces>{1.5f, {6.f, 3.f, 1.f, 3.f}};
+    image.stroke(brush_type{rgba_color::crimson}, ip, nullopt, basic_stroke_props<GraphicsSurfaces>{3.5f, line_cap::round, line_join::round}, dash,
+        basic_render_props<GraphicsSurfaces>{antialias::good, matrix::create_translate(point{4.5f, 7.25f})});
+
+    basic_path_builder<GraphicsSurfaces> clip{};
+    clip.new_figure(point{10.f, 70.f});
+    clip.line(point{150.f, 65.f});
+    clip.line(point{120.f, 115.f});
+    clip.line(point{30.f, 110.f});
+    clip.close_figure();
+    const auto radial = brush_type{basic_circle<math>{point{80.f, 90.f}, 2.f}, basic_circle<math>{point{80.f, 90.f}, 60.f}, {gradient_stop{0.f, rgba_color::yellow}, gradient_stop{1.f, rgba_color::teal}}};
+    image.fill_circle(radial, basic_circle<math>{point{80.f, 90.f}, 45.25f}, basic_brush_props<GraphicsSurfaces>{wrap_mode::reflect, filter::good, fill_rule::winding, matrix::create_scale(point{1.2f, 0.8f})},
+        nullopt, basic_clip_props<GraphicsSurfaces>{basic_interpreted_path<GraphicsSurfaces>{clip}, fill_rule::even_odd});
+
+    image.fill_rect(brush_type{rgba_color{0.2f, 0.6f, 0.3f, 0.5f}}, basic_bounding_box<math>{100.25f, 5.5f, 40.f, 30.75f}, nullopt,
+        basic_render_props<GraphicsSurfaces>{antialias::good, matrix::create_rotate(-0.2f, point{120.f, 20.f})});
+    return image;
+}
+
+TEST_CASE("IO2D image surfaces draw the same with _Graphics_math_simd_impl as with _Graphics_math_float_impl")
+{
+    auto scalar = DrawScene<_Cairo::_Cairo_graphics_surfaces<_Graphics_math_float_impl>>();
+    auto simd = DrawScene<_Cairo::_Cairo_graphics_surfaces<_Graphics_math_simd_impl>>();
+    auto scalarPixels = scalar.map_pixels();
+    auto simdPixels = simd.map_pixels();
+    int differences = 0;
+    for (int y = 0; y < 120; ++y) {
+        const auto scalarRow = scalarPixels.row<uint32_t>(y);
+        const auto simdRow = simdPixels.row<uint32_t>(y);
+        for (int x = 0; x < 160; ++x) {
+            if (scalarRow[x] != simdRow[x]) {
+                ++differences;
+            }
+        }
+    }
+    CHECK(differences == 0);
+}
+
+#endif
@@ -0,0 +1,70 @@
+#include "catch.hpp"
+#include <io2d.h>
+#include "comparison.h"
+
+using namespace std;
+using namespace std::experimental;
+using namespace std::experimental::io2d;
+
+static interpreted_path BuildStrokedPath()
+{
+    path_builder pb{};
+    pb.new_figure({30.f, 30.f});
+    pb.line({120.f, 40.f});
+    pb.line({60.f, 110.f});
+    pb.line({140.f, 170.f});
+    pb.new_figure({170.f, 40.f});
+    pb.line({270.f, 40.f});
+    pb.line({270.f, 140.f});
+    pb.close_figure();
+    pb.new_figure({160.f, 180.f});
+    pb.cubic_curve({200.f, 120.f}, {240.f, 240.f}, {285.f, 170.f});
+    return interpreted_path{pb};
+}
+
+static void CheckOutlineMatchesStroke(const interpreted_path& ip, const stroke_props& sp, const dashes& d = dashes{})
+{
+    auto b = brush{rgba_color::black};
+    auto expected = image_surface{format::argb32, 300, 200};
+    expected.paint(brush{rgba_color::white});
+    expected.stroke(b, ip, nullopt, sp, d);
+
+    auto image = image_surface{format::argb32, 300, 200};
+    image.paint(brush{rgba_color::white});
+    image.fill(b, ip.stroke_outline(sp, d));
+    CHECK(CompareImages(image, expected, 0.05f, 1));
+}
+
+TEST_CASE("IO2D fills a stroke outline like the stroke it was made from")
+{
+    auto ip = BuildStrokedPath();
+
+    SECTION("Miter joins, no caps") {
+        CheckOutlineMatchesStroke(ip, stroke_props{12.f, line_cap::none, line_join::miter});
+    }
+
+    SECTION("Bevel joins, square caps") {
+        CheckOutlineMatchesStroke(ip, stroke_props{12.f, line_cap::square, line_join::bevel});
+    }
+
+    SECTION("Round joins and caps") {
+        CheckOutlineMatchesStroke(ip, stroke_props{12.f, line_cap::round, line_join::round});
+    }
+
+    SECTION("Miter limit") {
+        CheckOutlineMatchesStroke(ip, stroke_props{12.f, line_cap::none, line_join::miter, 1.5f});
+    }
+
+    SECTION("Dashes") {
+        CheckOutlineMatchesStroke(ip, stroke_props{6.f, line_cap::round, line_join::round}, dashes{5.f, {20.f, 8.f, 4.f}});
+    }
+
+    SECTION("Invalid arguments") {
+        CHECK_THROWS_AS(ip.stroke_outline(stroke_props{}, dashes{}, matrix_2d{}, 0.f), system_error);
+        CHECK_THROWS_AS(ip.stroke_outline(stroke_props{}, dashes{0.f, {-1.f, 2.f}}), system_error);
+    }
+
+    SECTION("Empty path") {
+        CHECK(interpreted_path{}.stroke_outline(stroke_props{}).bounds() == bounding_box{});
+    }
+}
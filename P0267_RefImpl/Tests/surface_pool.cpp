@@ -0,0 +1,110 @@
+#include "catch.hpp"
+#include <io2d.h>
+#include "comparison.h"
+
+using namespace std;
+using namespace std::experimental;
+using namespace std::experimental::io2d;
+
+TEST_CASE("IO2D pooled surfaces are recycled by format and size")
+{
+    auto pool = image_surface_pool{1 << 22};
+    {
+        auto image = pool.acquire(format::argb32, 64, 32);
+        image.paint(brush{rgba_color::red});
+    }
+    auto stats = pool.statistics();
+    CHECK(stats.surfaces() == 1);
+    CHECK(stats.bytes() == 64 * 32 * 4);
+    CHECK(stats.misses() == 1);
+
+    // A different format or size needs a surface of its own.
+    { auto image = pool.acquire(format::a8, 64, 32); }
+    { auto image = pool.acquire(format::argb32, 32, 64); }
+    CHECK(pool.statistics().misses() == 3);
+    CHECK(pool.statistics().surfaces() == 3);
+
+    auto image = pool.acquire(format::argb32, 64, 32);
+    stats = pool.statistics();
+    CHECK(stats.hits() == 1);
+    CHECK(stats.surfaces() == 2);
+    // Recycled surfaces come back cleared.
+    CHECK(CompareImageColor(image, 10, 10, rgba_color::transparent_black));
+    CHECK(image.dimensions().x() == 64);
+    CHECK(image.format() == format::argb32);
+}
+
+TEST_CASE("IO2D surface pool scopes route image surface construction through the pool")
+{
+    auto pool = image_surface_pool{1 << 22};
+    {
+        image_surface_pool_scope scope{pool};
+        for (int i = 0; i < 10; ++i) {
+            auto image = image_surface{format::argb32, 100, 100};
+            image.paint(brush{rgba_color::blue});
+        }
+    }
+    auto stats = pool.statistics();
+    CHECK(stats.misses() == 1);
+    CHECK(stats.hits() == 9);
+
+    // Outside the scope surfaces are allocated as usual.
+    { auto image = image_surface{format::argb32, 100, 100}; }
+    CHECK(pool.statistics().hits() == 9);
+}
+
+TEST_CASE("IO2D surface pool stays within its budget")
+{
+    auto pool = image_surface_pool{3 * 40 * 40 * 4};
+    {
+        vector<image_surface> images;
+        for (int i = 0; i < 5; ++i) {
+            images.push_back(pool.acquire(format::argb32, 40, 40));
+        }
+    }
+    auto stats = pool.statistics();
+    CHECK(stats.surfaces() == 3);
+    CHECK(stats.bytes() <= pool.budget());
+    CHECK(stats.evictions() == 2);
+
+    pool.budget(40 * 40 * 4);
+    CHECK(pool.statistics().surfaces() == 1);
+    pool.clear();
+    CHECK(pool.statistics().surfaces() == 0);
+    CHECK(pool.statistics().bytes() == 0);
+
+    // A surface larger than the whole budget is never retained.
+    { auto image = pool.acquire(format::argb32, 100, 100); }
+    CHECK(pool.statistics().surfaces() == 0);
+}
+
+TEST_CASE("IO2D pooled surfaces still drawn by a brush are not recycled")
+{
+    auto pool = image_surface_pool{1 << 22};
+    brush shared{rgba_color::black};
+    {
+        auto image = pool.acquire(format::argb32, 20, 20);
+        image.paint(brush{rgba_color::lime});
+        shared = brush{image};
+    }
+    CHECK(pool.statistics().surfaces() == 0);
+
+    {
+        auto image = pool.acquire(format::argb32, 20, 20);
+        auto consumed = brush{move(image)};
+    }
+    CHECK(pool.statistics().surfaces() == 0);
+
+    auto target = image_surface{format::argb32, 20, 20};
+    target.paint(shared);
+    CHECK(CompareImageColor(target, 5, 5, rgba_color::lime));
+}
+
+TEST_CASE("IO2D pooled surfaces may outlive their pool")
+{
+    auto pool = make_unique<image_surface_pool>(1 << 22);
+    auto image = pool->acquire(format::argb32, 16, 16);
+    pool.reset();
+    image.paint(brush{rgba_color::red});
+    CHECK(CompareImageColor(image, 8, 8, rgba_color::red));
+}
@@ -0,0 +1,110 @@
+#include "catch.hpp"
+#include <io2d.h>
+#include "comparison.h"
+
+using namespace std;
+using namespace std::experimental;
+using namespace std::experimental::io2d;
+
+static interpreted_path MakeTriangle()
+{
+    path_builder pb{};
+    pb.new_figure({30.f, 20.f});
+    pb.line({170.f, 60.f});
+    pb.line({60.f, 110.f});
+    pb.close_figure();
+    return interpreted_path{pb};
+}
+
+TEST_CASE("IO2D tiled surfaces only create the tiles that are drawn to")
+{
+    auto tiled = tiled_image_surface{format::argb32, 1000, 700, {64, 64}};
+    CHECK(tiled.grid_dimensions() == display_point{16, 11});
+    CHECK(tiled.tile_count() == 0);
+
+    tiled.fill_rect(brush{rgba_color::red}, bounding_box{10.f, 10.f, 20.f, 20.f}, nullopt, render_props{antialias::none});
+    CHECK(tiled.tile_count() == 1);
+    REQUIRE(tiled.tile({0, 0}) != nullptr);
+    CHECK(tiled.tile({1, 0}) == nullptr);
+    CHECK(CompareImageColor(*tiled.tile({0, 0}), 15, 15, rgba_color::red));
+
+    // The render props' matrix moves what is drawn, and so which tiles it reaches.
+    tiled.fill_rect(brush{rgba_color::red}, bounding_box{10.f, 10.f, 20.f, 20.f}, nullopt, render_props{antialias::none, matrix_2d::create_translate({900.f, 600.f})});
+    CHECK(tiled.tile_count() == 2);
+    REQUIRE(tiled.tile({14, 9}) != nullptr);
+    CHECK(CompareImageColor(*tiled.tile({14, 9}), 915 - 14 * 64, 615 - 9 * 64, rgba_color::red));
+
+    // The last row and column are cropped to the surface's dimensions.
+    CHECK(tiled.tile_bounds({15, 10}) == bounding_box{960.f, 640.f, 40.f, 60.f});
+    CHECK(tiled.tiles() == vector<display_point>{ {0, 0}, {14, 9} });
+
+    tiled.release_tile({0, 0});
+    CHECK(tiled.tile({0, 0}) == nullptr);
+    CHECK(tiled.tile_count() == 1);
+    tiled.clear();
+    CHECK(tiled.tile_count() == 0);
+    CHECK_THROWS_AS(tiled.tile({16, 0}), system_error);
+}
+
+TEST_CASE("IO2D tiled surfaces draw the same as a single image surface")
+{
+    const auto ip = MakeTriangle();
+    const auto rp = render_props{antialias::good, matrix_2d::create_rotate(0.1f, {100.f, 60.f})};
+    auto tiled = tiled_image_surface{format::argb32, 200, 130, {48, 32}};
+    auto dense = image_surface{format::argb32, 200, 130};
+
+    auto tiledCopy = image_surface{format::argb32, 200, 130};
+    for (auto* image : { &dense, &tiledCopy }) {
+        image->paint(brush{rgba_color::transparent_black}, nullopt, render_props{antialias::none, matrix_2d{}, compositing_op::source});
+    }
+    // Round joins keep the stroke within half its width of the path.
+    const auto sp = stroke_props{6.f, line_cap::none, line_join::round};
+    tiled.fill(brush{rgba_color::teal}, ip, nullopt, rp);
+    tiled.stroke(brush{rgba_color::orange}, ip, nullopt, sp, nullopt, rp);
+    dense.fill(brush{rgba_color::teal}, ip, nullopt, rp);
+    dense.stroke(brush{rgba_color::orange}, ip, nullopt, sp, nullopt, rp);
+    tiled.copy_to(tiledCopy);
+    // Every tile is drawn with a whole pixel translation, so the seams match exactly.
+    CHECK(CompareImages(tiledCopy, dense, 0.f, 0));
+
+    // The rotated stroke bounds, grown by a pixel for antialiasing, span about (21, 9) to (178, 121), which reaches columns 0 to 3 and rows 0 to 3.
+    // The cropped last column and row (8 and 2 pixels) are not reached.
+    CHECK(tiled.tiles() == vector<display_point>{
+        {0, 0}, {1, 0}, {2, 0}, {3, 0},
+        {0, 1}, {1, 1}, {2, 1}, {3, 1},
+        {0, 2}, {1, 2}, {2, 2}, {3, 2},
+        {0, 3}, {1, 3}, {2, 3}, {3, 3} });
+    CHECK(tiled.tile({4, 0}) == nullptr);
+    CHECK(tiled.tile({0, 4}) == nullptr);
+    CHECK(tiled.tile_bounds({0, 0}) == bounding_box{0.f, 0.f, 48.f, 32.f});
+    CHECK(tiled.tile_bounds({3, 3}) == bounding_box{144.f, 96.f, 48.f, 32.f});
+    CHECK(tiled.tile_bounds({4, 3}) == bounding_box{192.f, 96.f, 8.f, 32.f});
+    CHECK(tiled.tile_bounds({4, 4}) == bounding_box{192.f, 128.f, 8.f, 2.f});
+
+    // Tiles the clip keeps the draw away from are left alone.
+    path_builder clip{};
+    clip.new_figure({150.f, 100.f});
+    clip.rel_line({40.f, 0.f});
+    clip.rel_line({0.f, 20.f});
+    clip.rel_line({-40.f, 0.f});
+    clip.close_figure();
+    auto clipped = tiled_image_surface{format::argb32, 200, 130, {48, 32}};
+    clipped.paint(brush{rgba_color::white}, nullopt, nullopt, clip_props{interpreted_path{clip}});
+    for (const auto& index : clipped.tiles()) {
+        CHECK(index.x() >= 3);
+        CHECK(index.y() >= 3);
+    }
+}
+
+TEST_CASE("IO2D tiled surfaces send unbounded operators to every existing tile")
+{
+    auto tiled = tiled_image_surface{format::argb32, 256, 256, {64, 64}};
+    tiled.fill_rect(brush{rgba_color::blue}, bounding_box{0.f, 0.f, 256.f, 32.f});
+    CHECK(tiled.tile_count() == 4);
+
+    // in clears everything outside what it draws, including tiles the rectangle does not reach.
+    tiled.fill_rect(brush{rgba_color::blue}, bounding_box{0.f, 0.f, 16.f, 16.f}, nullopt, render_props{antialias::none, matrix_2d{}, compositing_op::in});
+    CHECK(tiled.tile_count() == 4);
+    CHECK(CompareImageColor(*tiled.tile({0, 0}), 8, 8, rgba_color::blue));
+    CHECK(CompareImageColor(*tiled.tile({3, 0}), 8, 8, rgba_color::transparent_black));
+}